@@ -12,11 +12,33 @@ SYSCFG_SRCS += \
 ../gpiointerrupt.syscfg 
 
 C_SRCS += \
+../acquire.c \
+../analysis.c \
+../arena.c \
+../channels.c \
+../console.c \
+../event.c \
+../frequency.c \
+../goertzel.c \
 ../gpiointerrupt.c \
 ./syscfg/ti_drivers_config.c \
+../ingest.c \
+../log.c \
 ../main_nortos.c \
+../profile.c \
+../ring.c \
+../scheduler.c \
+../sdft.c \
+../spectrum.c \
+../stream.c \
+../telemetry.c \
+../testwave.c \
+../trigger.c \
 ../system_msp432e401y.c \
-../uartstdio.c 
+../uartstdio.c \
+../udma.c \
+../window.c \
+../window_tables.c 
 
 GEN_FILES += \
 ./syscfg/ti_drivers_config.c 
@@ -25,18 +47,62 @@ GEN_MISC_DIRS += \
 ./syscfg/ 
 
 C_DEPS += \
+./acquire.d \
+./analysis.d \
+./arena.d \
+./channels.d \
+./console.d \
+./event.d \
+./frequency.d \
+./goertzel.d \
 ./gpiointerrupt.d \
 ./syscfg/ti_drivers_config.d \
+./ingest.d \
+./log.d \
 ./main_nortos.d \
+./profile.d \
+./ring.d \
+./scheduler.d \
+./sdft.d \
+./spectrum.d \
+./stream.d \
+./telemetry.d \
+./testwave.d \
+./trigger.d \
 ./system_msp432e401y.d \
-./uartstdio.d 
+./uartstdio.d \
+./udma.d \
+./window.d \
+./window_tables.d 
 
 OBJS += \
+./acquire.obj \
+./analysis.obj \
+./arena.obj \
+./channels.obj \
+./console.obj \
+./event.obj \
+./frequency.obj \
+./goertzel.obj \
 ./gpiointerrupt.obj \
 ./syscfg/ti_drivers_config.obj \
+./ingest.obj \
+./log.obj \
 ./main_nortos.obj \
+./profile.obj \
+./ring.obj \
+./scheduler.obj \
+./sdft.obj \
+./spectrum.obj \
+./stream.obj \
+./telemetry.obj \
+./testwave.obj \
+./trigger.obj \
 ./system_msp432e401y.obj \
-./uartstdio.obj 
+./uartstdio.obj \
+./udma.obj \
+./window.obj \
+./window_tables.obj 
 
 GEN_MISC_FILES += \
 ./syscfg/ti_drivers_config.h \
@@ -47,11 +113,33 @@ GEN_MISC_DIRS__QUOTED += \
 "syscfg\" 
 
 OBJS__QUOTED += \
+"acquire.obj" \
+"analysis.obj" \
+"arena.obj" \
+"channels.obj" \
+"console.obj" \
+"event.obj" \
+"frequency.obj" \
+"goertzel.obj" \
 "gpiointerrupt.obj" \
 "syscfg\ti_drivers_config.obj" \
+"ingest.obj" \
+"log.obj" \
 "main_nortos.obj" \
+"profile.obj" \
+"ring.obj" \
+"scheduler.obj" \
+"sdft.obj" \
+"spectrum.obj" \
+"stream.obj" \
+"telemetry.obj" \
+"testwave.obj" \
+"trigger.obj" \
 "system_msp432e401y.obj" \
-"uartstdio.obj" 
+"uartstdio.obj" \
+"udma.obj" \
+"window.obj" \
+"window_tables.obj" 
 
 GEN_MISC_FILES__QUOTED += \
 "syscfg\ti_drivers_config.h" \
@@ -59,21 +147,65 @@ GEN_MISC_FILES__QUOTED += \
 "syscfg\syscfg_c.rov.xs" 
 
 C_DEPS__QUOTED += \
+"acquire.d" \
+"analysis.d" \
+"arena.d" \
+"channels.d" \
+"console.d" \
+"event.d" \
+"frequency.d" \
+"goertzel.d" \
 "gpiointerrupt.d" \
 "syscfg\ti_drivers_config.d" \
+"ingest.d" \
+"log.d" \
 "main_nortos.d" \
+"profile.d" \
+"ring.d" \
+"scheduler.d" \
+"sdft.d" \
+"spectrum.d" \
+"stream.d" \
+"telemetry.d" \
+"testwave.d" \
+"trigger.d" \
 "system_msp432e401y.d" \
-"uartstdio.d" 
+"uartstdio.d" \
+"udma.d" \
+"window.d" \
+"window_tables.d" 
 
 GEN_FILES__QUOTED += \
 "syscfg\ti_drivers_config.c" 
 
 C_SRCS__QUOTED += \
+"../acquire.c" \
+"../analysis.c" \
+"../arena.c" \
+"../channels.c" \
+"../console.c" \
+"../event.c" \
+"../frequency.c" \
+"../goertzel.c" \
 "../gpiointerrupt.c" \
 "./syscfg/ti_drivers_config.c" \
+"../ingest.c" \
+"../log.c" \
 "../main_nortos.c" \
+"../profile.c" \
+"../ring.c" \
+"../scheduler.c" \
+"../sdft.c" \
+"../spectrum.c" \
+"../stream.c" \
+"../telemetry.c" \
+"../testwave.c" \
+"../trigger.c" \
 "../system_msp432e401y.c" \
-"../uartstdio.c" 
+"../uartstdio.c" \
+"../udma.c" \
+"../window.c" \
+"../window_tables.c" 
 
 SYSCFG_SRCS__QUOTED += \
 "../gpiointerrupt.syscfg" 
@@ -38,14 +38,32 @@
 /* must be located at the beginning of the application.                      */
 #define RAM_BASE 0x20000000
 
+/* CMSIS-DSP code and tables run from SRAM, copied there at boot through     */
+/* the BINIT table (placement.h).  The library is built with function and    */
+/* data subsections, so they are picked by input section name; names of      */
+/* the other precisions match nothing.  The tables are those of              */
+/* NUM_SAMPLES 1024 in main_nortos.c, a 512-point complex FFT; other         */
+/* lengths chosen at run time read theirs from flash.  Set a switch to 0     */
+/* to leave that group in flash; tools/placement_report.py lists the         */
+/* cost of each.                                                             */
+#define RAM_FFT         1   /* Butterflies, bit reversal, RFFT split         */
+#define RAM_MAGNITUDE   1   /* arm_cmplx_mag_*(), arm_mult_q15()             */
+#define RAM_TWIDDLE     1   /* Complex FFT twiddles and bit reversal         */
+#define RAM_SPLIT       0   /* RFFT split tables, 8192 points, 32 or 64 KB   */
+/* The window table needs no switch: Analysis_configure() copies the one    */
+/* in use into the arena, for every length.                                  */
+
 --stack_size=0x1000
---heap_size=0x8000
+/* No heap: the measurement buffers come from the static arena (arena.h).    */
+--heap_size=0
 --entry_point=resetISR
 
 MEMORY
 {
     FLASH (RX) : origin = 0x00000000, length = 0x00100000
     SRAM (RWX) : origin = 0x20000000, length = 0x00040000
+    /* Log_print() format strings (log.h), kept in the executable only */
+    LOG_DATA (R) : origin = 0x90000000, length = 0x00040000
 }
 
 /* Section allocation in memory */
@@ -60,11 +78,44 @@ SECTIONS
     .init_array : > FLASH
 
     .vtable :   > RAM_BASE
-    .TI.ramfunc : {} load=FLASH, run=SRAM, table(BINIT)
+    .TI.ramfunc : {
+        *(.TI.ramfunc)
+#if RAM_FFT
+        *(.text:arm_rfft_q15)           *(.text:arm_split_rfft_q15)
+        *(.text:arm_cfft_q15)           *(.text:arm_cfft_radix4by2_q15)
+        *(.text:arm_radix4_butterfly_q15)
+        *(.text:arm_rfft_q31)           *(.text:arm_split_rfft_q31)
+        *(.text:arm_cfft_q31)           *(.text:arm_cfft_radix4by2_q31)
+        *(.text:arm_radix4_butterfly_q31)
+        *(.text:arm_rfft_fast_f32)      *(.text:stage_rfft_f32)
+        *(.text:arm_cfft_f32)           *(.text:arm_cfft_radix8by2_f32)
+        *(.text:arm_cfft_radix8by4_f32) *(.text:arm_radix8_butterfly_f32)
+        *(.text:arm_bitreversal_16)     *(.text:arm_bitreversal_32)
+#endif
+#if RAM_MAGNITUDE
+        *(.text:arm_cmplx_mag_q15)      *(.text:arm_cmplx_mag_q31)
+        *(.text:arm_cmplx_mag_f32)      *(.text:arm_mult_q15)
+#endif
+    } load=FLASH, run=SRAM, table(BINIT)
+    .TI.ramconst : {
+#if RAM_TWIDDLE
+        *(.const:twiddleCoef_512_q15)   *(.const:twiddleCoef_512_q31)
+        *(.const:armBitRevIndexTable_fixed_512)
+        *(.const:twiddleCoef_512)       *(.const:armBitRevIndexTable512)
+        *(.const:twiddleCoef_rfft_1024)
+#endif
+#if RAM_SPLIT
+        *(.const:realCoefAQ15)          *(.const:realCoefBQ15)
+        *(.const:realCoefAQ31)          *(.const:realCoefBQ31)
+#endif
+    } load=FLASH, run=SRAM, table(BINIT)
+    .binit  :   > FLASH
     .data   :   > SRAM
     .bss    :   > SRAM
     .sysmem :   > SRAM
     .stack  :   > SRAM (HIGH)
 
     .intvecs :  > 0x00000000
+
+    .log_data : > LOG_DATA, type = COPY
 }
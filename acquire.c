@@ -0,0 +1,675 @@
+/*
+ *  ======== acquire.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(HOST_BUILD)
+#include <time.h>
+#else
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "acquire.h"
+#include "udma.h"
+
+#if !defined(HOST_BUILD)
+/* ADC module resources, one sample sequencer 0 stream each */
+typedef struct {
+    uint32_t           base;        /* ADC module */
+    uint32_t           dmaChannel;  /* uDMA channel of sequencer 0 */
+    uint32_t           intNum;      /* Sequencer 0 interrupt */
+    volatile uint32_t *fifo;        /* Sequencer 0 FIFO */
+} AdcHw;
+
+/* GPIO pin of each analog input */
+typedef struct {
+    uint32_t      periph;
+    uint32_t      port;
+    uint_least8_t pin;
+} AinPin;
+
+static const AdcHw adcHw[Channels_NUM_ADCS] = {
+    {ADC0_BASE, UDMA_CH14_ADC0_0, INT_ADC0SS0, &ADC0->SSFIFO0},
+    {ADC1_BASE, UDMA_CH24_ADC1_0, INT_ADC1SS0, &ADC1->SSFIFO0}
+};
+
+static const AinPin ainPins[] = {
+    {SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_3},     /* AIN0 */
+    {SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_2},     /* AIN1 */
+    {SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_1},     /* AIN2 */
+    {SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_0},     /* AIN3 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_7},     /* AIN4 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_6},     /* AIN5 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_5},     /* AIN6 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_4},     /* AIN7 */
+    {SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_5},     /* AIN8 */
+    {SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_4},     /* AIN9 */
+    {SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_4},     /* AIN10 */
+    {SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_5},     /* AIN11 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_3},     /* AIN12 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_2},     /* AIN13 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_1},     /* AIN14 */
+    {SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_0},     /* AIN15 */
+    {SYSCTL_PERIPH_GPIOK, GPIO_PORTK_BASE, GPIO_PIN_0},     /* AIN16 */
+    {SYSCTL_PERIPH_GPIOK, GPIO_PORTK_BASE, GPIO_PIN_1},     /* AIN17 */
+    {SYSCTL_PERIPH_GPIOK, GPIO_PORTK_BASE, GPIO_PIN_2},     /* AIN18 */
+    {SYSCTL_PERIPH_GPIOK, GPIO_PORTK_BASE, GPIO_PIN_3}      /* AIN19 */
+};
+
+#define NUM_AIN     (sizeof(ainPins) / sizeof(ainPins[0]))
+
+/*
+ *  ======== configureAin ========
+ *  PD7 (AIN4) is the NMI pin.  It comes out of reset locked to the NMI
+ *  function, AFSEL, DEN and PCTL set, and its GPIOCR bit clear, so
+ *  GPIOPinTypeADC() alone leaves the digital input and the NMI on the
+ *  waveform.  Unlock and commit it for the change, then lock it again.
+ */
+static void configureAin(const AinPin *ain)
+{
+    bool locked = (ain->port == GPIO_PORTD_BASE) && (ain->pin == GPIO_PIN_7);
+
+    while (!MAP_SysCtlPeripheralReady(ain->periph)) {
+    }
+
+    if (locked) {
+        HWREG(ain->port + GPIO_O_LOCK) = GPIO_LOCK_KEY;
+        HWREG(ain->port + GPIO_O_CR) |= ain->pin;
+    }
+
+    MAP_GPIOPinTypeADC(ain->port, ain->pin);
+
+    if (locked) {
+        HWREG(ain->port + GPIO_O_CR) &= ~(uint32_t)ain->pin;
+        HWREG(ain->port + GPIO_O_LOCK) = 0;
+    }
+}
+#endif
+
+/*
+ *  ======== pause ========
+ *  Triggered mode: stop the sample timer at the end of a frame.  The timer
+ *  is stopped before waiting is set, so a trigger in between finds nothing
+ *  to start rather than being undone.
+ */
+static void pause(Acquire_Object *obj)
+{
+#if defined(HOST_BUILD)
+    pthread_mutex_lock(&obj->lock);
+    obj->waiting = true;
+    pthread_mutex_unlock(&obj->lock);
+#else
+    MAP_TimerDisable(TIMER0_BASE, TIMER_A);
+    obj->waiting = true;
+#endif
+}
+
+/*
+ *  ======== frameComplete ========
+ *  Streams finish a frame at slightly different times; the frame is
+ *  published when the last of them does.  By then every stream has moved
+ *  on into the other frame, and will come back to this one a frame time
+ *  later.
+ *
+ *  In triggered mode the first stream to finish stops the timer.  Both
+ *  sequencers convert on the same timer trigger, so the last sample of the
+ *  frame has been taken on every stream, and the next trigger is a sample
+ *  period away.
+ */
+static void frameComplete(Acquire_Object *obj, uint_least8_t stream,
+                          int_fast8_t frame)
+{
+    uint_least8_t done = obj->pending[frame] | (1U << stream);
+
+    if (obj->triggered && (obj->pending[frame] == 0)) {
+        pause(obj);
+    }
+
+    if (done != obj->activeMask) {
+        obj->pending[frame] = done;
+        return;
+    }
+    obj->pending[frame] = 0;
+
+    /* The uDMA has moved on into a frame the DSP still holds */
+    if (obj->held == (frame ^ 1)) {
+        obj->overruns++;
+    }
+
+    obj->number[frame] = obj->frames;
+    obj->frames++;
+    obj->ready = frame;
+
+    if (obj->callbackFxn != NULL) {
+        obj->callbackFxn(frame, obj->arg);
+    }
+}
+
+/*
+ *  ======== blockComplete ========
+ *  Called once per finished block of a stream, in order.  Block b of the
+ *  ring belongs to frame b / (numBlocks / 2).
+ */
+static void blockComplete(Acquire_Object *obj, uint_least8_t stream)
+{
+    Acquire_Stream *s = &obj->streams[stream];
+    uint16_t blocksPerFrame = s->numBlocks >> 1;
+    uint16_t block = s->nextBlock;
+
+    s->nextBlock = (block + 1U == s->numBlocks) ? 0 : (block + 1U);
+
+    if ((s->nextBlock % blocksPerFrame) == 0) {
+        frameComplete(obj, stream, (block < blocksPerFrame) ? 0 : 1);
+    }
+}
+
+#if defined(HOST_BUILD)
+/*
+ *  ======== dmaThread ========
+ *  Host stand-in for the timer, ADCs and uDMA.  Every tick produces the
+ *  samples of the shortest block of all streams, against an absolute
+ *  monotonic deadline so the pace does not drift with the time spent in
+ *  the source or the callback.  Block lengths are powers of two, so the
+ *  longer blocks complete after a whole number of ticks.
+ */
+static void *dmaThread(void *arg)
+{
+    Acquire_Object *obj = (Acquire_Object *)arg;
+    Acquire_Stream *s;
+    uint16_t tick = obj->frameLen;
+    uint64_t periodNs;
+    struct timespec deadline;
+    uint_least8_t i;
+    uint16_t *dst;
+
+    for (i = 0; i < Channels_NUM_ADCS; i++) {
+        s = &obj->streams[i];
+        if ((s->numChannels != 0) &&
+            ((s->blockLen / s->numChannels) < tick)) {
+            tick = s->blockLen / s->numChannels;
+        }
+    }
+
+    periodNs = ((uint64_t)tick * 1000000000ULL) / obj->sampleRate;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    while (obj->running) {
+        /* Triggered mode: the pace starts over from the trigger */
+        if (obj->waiting) {
+            pthread_mutex_lock(&obj->lock);
+            while (obj->waiting && obj->running) {
+                pthread_cond_wait(&obj->wake, &obj->lock);
+            }
+            pthread_mutex_unlock(&obj->lock);
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            continue;
+        }
+
+        deadline.tv_nsec += (long)(periodNs % 1000000000ULL);
+        deadline.tv_sec += (time_t)(periodNs / 1000000000ULL);
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_nsec -= 1000000000L;
+            deadline.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+
+        for (i = 0; i < obj->numChannels; i++) {
+            s = &obj->streams[obj->stream[i]];
+            dst = &s->buffer[((uint32_t)s->nextBlock * s->blockLen) +
+                             s->fill + obj->slot[i]];
+            obj->sourceFxn(i, dst, tick, s->numChannels, obj->sourceArg);
+        }
+
+        for (i = 0; i < Channels_NUM_ADCS; i++) {
+            s = &obj->streams[i];
+            if (s->numChannels == 0) {
+                continue;
+            }
+
+            s->fill += tick * s->numChannels;
+            if (s->fill == s->blockLen) {
+                s->fill = 0;
+                blockComplete(obj, i);
+            }
+        }
+    }
+
+    return (NULL);
+}
+#else
+/*
+ *  ======== armBlock ========
+ */
+static void armBlock(Acquire_Stream *s, uint_least8_t adc, uint32_t select,
+                     uint16_t block)
+{
+    MAP_uDMAChannelTransferSet(adcHw[adc].dmaChannel | select,
+                               UDMA_MODE_PINGPONG, (void *)adcHw[adc].fifo,
+                               &s->buffer[(uint32_t)block * s->blockLen],
+                               s->blockLen);
+}
+
+/*
+ *  ======== dmaService ========
+ *  Even blocks run on the primary structure and odd blocks on the
+ *  alternate one, so the parity of the next block says which structure
+ *  finishes next.  Loop in case the interrupt was late enough for both to
+ *  have finished.
+ */
+static void dmaService(Acquire_Object *obj, uint_least8_t adc)
+{
+    Acquire_Stream *s = &obj->streams[adc];
+    uint32_t select;
+    uint16_t block;
+
+    MAP_ADCIntClearEx(adcHw[adc].base, ADC_INT_DMA_SS0);
+
+    for (;;) {
+        block = s->nextBlock;
+        select = (block & 1U) ? UDMA_ALT_SELECT : UDMA_PRI_SELECT;
+
+        if (MAP_uDMAChannelModeGet(adcHw[adc].dmaChannel | select) !=
+            UDMA_MODE_STOP) {
+            break;
+        }
+
+        block += 2U;
+        if (block >= s->numBlocks) {
+            block -= s->numBlocks;
+        }
+        armBlock(s, adc, select, block);
+        blockComplete(obj, adc);
+    }
+}
+
+/*
+ *  ======== adc0HwiFxn ========
+ */
+static void adc0HwiFxn(uintptr_t arg)
+{
+    dmaService((Acquire_Object *)arg, 0);
+}
+
+/*
+ *  ======== adc1HwiFxn ========
+ */
+static void adc1HwiFxn(uintptr_t arg)
+{
+    dmaService((Acquire_Object *)arg, 1);
+}
+
+/*
+ *  ======== configureStream ========
+ *  Sequencer 0 converts the channels of this module in table order on
+ *  every timer trigger; the last step raises the uDMA request.  The code
+ *  is in bits 11:0 of the FIFO word, so the uDMA moves half-words.
+ */
+static int_fast16_t configureStream(Acquire_Object *obj,
+                                    const Channels_Config *channels,
+                                    uint_least8_t adc)
+{
+    Acquire_Stream *s = &obj->streams[adc];
+    uint32_t base = adcHw[adc].base;
+    uint32_t dmaChannel = adcHw[adc].dmaChannel;
+    HwiP_Params hwiParams;
+    uint32_t ctl;
+    uint_least8_t ain;
+    uint_least8_t i;
+
+    MAP_ADCClockConfigSet(base, ADC_CLOCK_SRC_PLL | ADC_CLOCK_RATE_FULL, 15);
+    MAP_ADCSequenceDisable(base, 0);
+    MAP_ADCSequenceConfigure(base, 0, ADC_TRIGGER_TIMER, 0);
+
+    for (i = 0; i < obj->numChannels; i++) {
+        if (obj->stream[i] != adc) {
+            continue;
+        }
+
+        ain = channels[i].ain;
+        ctl = (ain < 16U) ? ain : (0x100U | (ain - 16U));
+        if ((obj->slot[i] + 1U) == s->numChannels) {
+            ctl |= ADC_CTL_IE | ADC_CTL_END;
+        }
+        MAP_ADCSequenceStepConfigure(base, 0, obj->slot[i], ctl);
+    }
+
+    MAP_ADCSequenceEnable(base, 0);
+    MAP_ADCSequenceDMAEnable(base, 0);
+    MAP_ADCIntEnableEx(base, ADC_INT_DMA_SS0);
+
+    MAP_uDMAChannelAssign(dmaChannel);
+    MAP_uDMAChannelAttributeDisable(dmaChannel,
+                                    UDMA_ATTR_ALTSELECT |
+                                    UDMA_ATTR_USEBURST |
+                                    UDMA_ATTR_HIGH_PRIORITY |
+                                    UDMA_ATTR_REQMASK);
+    MAP_uDMAChannelControlSet(dmaChannel | UDMA_PRI_SELECT,
+                              UDMA_SIZE_16 | UDMA_SRC_INC_NONE |
+                              UDMA_DST_INC_16 | UDMA_ARB_1);
+    MAP_uDMAChannelControlSet(dmaChannel | UDMA_ALT_SELECT,
+                              UDMA_SIZE_16 | UDMA_SRC_INC_NONE |
+                              UDMA_DST_INC_16 | UDMA_ARB_1);
+    armBlock(s, adc, UDMA_PRI_SELECT, 0);
+    armBlock(s, adc, UDMA_ALT_SELECT, 1);
+    MAP_uDMAChannelEnable(dmaChannel);
+
+    HwiP_Params_init(&hwiParams);
+    hwiParams.arg = (uintptr_t)obj;
+    if (HwiP_construct(&s->hwi, adcHw[adc].intNum,
+                       (adc == 0) ? adc0HwiFxn : adc1HwiFxn,
+                       &hwiParams) == NULL) {
+        return (Acquire_STATUS_ERROR);
+    }
+
+    return (Acquire_STATUS_SUCCESS);
+}
+#endif
+
+/*
+ *  ======== Acquire_init ========
+ */
+int_fast16_t Acquire_init(Acquire_Object *obj,
+                          const Channels_Config *channels,
+                          uint_least8_t numChannels, uint16_t *buffer,
+                          uint16_t frameLen, uint32_t sampleRate,
+                          uint32_t systemClock,
+                          Acquire_CallbackFxn callbackFxn, void *arg)
+{
+    Acquire_Stream *s;
+    uint_least8_t perAdc = 0;
+    uint_least8_t adc;
+    uint_least8_t i;
+    uint16_t samplesPerBlock;
+#if !defined(HOST_BUILD)
+    uint32_t load;
+#endif
+
+    if ((obj == NULL) || (channels == NULL) || (buffer == NULL) ||
+        (numChannels == 0) || (numChannels > Acquire_MAX_CHANNELS) ||
+        (sampleRate == 0) || (frameLen < 16) || (frameLen > 8192) ||
+        ((frameLen & (frameLen - 1)) != 0)) {
+        return (Acquire_STATUS_ERROR);
+    }
+
+    /* Assign every channel a slot in its module's sequence */
+    for (adc = 0; adc < Channels_NUM_ADCS; adc++) {
+        obj->streams[adc].numChannels = 0;
+    }
+    for (i = 0; i < numChannels; i++) {
+        adc = channels[i].adc;
+        if ((adc >= Channels_NUM_ADCS) ||
+            (obj->streams[adc].numChannels == Channels_MAX_PER_ADC)) {
+            return (Acquire_STATUS_ERROR);
+        }
+#if !defined(HOST_BUILD)
+        if (channels[i].ain >= NUM_AIN) {
+            return (Acquire_STATUS_ERROR);
+        }
+#endif
+        obj->stream[i] = adc;
+        obj->slot[i] = obj->streams[adc].numChannels++;
+        if (obj->streams[adc].numChannels > perAdc) {
+            perAdc = obj->streams[adc].numChannels;
+        }
+    }
+
+    if (((uint64_t)sampleRate * perAdc) > Acquire_MAX_CONVERSIONS) {
+        return (Acquire_STATUS_ERROR);
+    }
+
+    /* Lay the rings out back to back; blocks hold whole sample sets */
+    obj->activeMask = 0;
+    for (adc = 0; adc < Channels_NUM_ADCS; adc++) {
+        s = &obj->streams[adc];
+        s->buffer = buffer;
+        s->nextBlock = 0;
+#if defined(HOST_BUILD)
+        s->fill = 0;
+#endif
+        if (s->numChannels == 0) {
+            s->blockLen = 0;
+            s->numBlocks = 0;
+            continue;
+        }
+
+        for (samplesPerBlock = frameLen;
+             ((uint32_t)samplesPerBlock * s->numChannels) >
+             Acquire_MAX_BLOCK_LEN;
+             samplesPerBlock >>= 1) {
+        }
+
+        s->blockLen = samplesPerBlock * s->numChannels;
+        s->numBlocks = (uint16_t)((2U * frameLen) / samplesPerBlock);
+        buffer += Acquire_BUFFER_LEN(frameLen, s->numChannels);
+        obj->activeMask |= 1U << adc;
+    }
+
+    obj->numChannels = numChannels;
+    obj->frameLen = frameLen;
+    obj->pending[0] = 0;
+    obj->pending[1] = 0;
+    obj->ready = Acquire_NO_FRAME;
+    obj->held = Acquire_NO_FRAME;
+    obj->frames = 0;
+    obj->number[0] = 0;
+    obj->number[1] = 0;
+    obj->overruns = 0;
+    obj->callbackFxn = callbackFxn;
+    obj->arg = arg;
+    obj->triggered = false;
+    obj->waiting = false;
+
+#if defined(HOST_BUILD)
+    (void)systemClock;
+
+    obj->sampleRate = sampleRate;
+    obj->sourceFxn = NULL;
+    obj->sourceArg = NULL;
+    obj->running = false;
+    pthread_mutex_init(&obj->lock, NULL);
+    pthread_cond_init(&obj->wake, NULL);
+#else
+    load = (systemClock + (sampleRate / 2U)) / sampleRate;
+    if (load < 2U) {
+        return (Acquire_STATUS_ERROR);
+    }
+    obj->sampleRate = systemClock / load;
+    obj->timerLoad = load;
+
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC0);
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_ADC1);
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
+    for (i = 0; i < numChannels; i++) {
+        MAP_SysCtlPeripheralEnable(ainPins[channels[i].ain].periph);
+    }
+    while (!MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_ADC0) ||
+           !MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_ADC1) ||
+           !MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER0)) {
+    }
+
+    for (i = 0; i < numChannels; i++) {
+        configureAin(&ainPins[channels[i].ain]);
+    }
+
+    /* Sample timer, triggering both ADC modules on every time-out */
+    MAP_TimerConfigure(TIMER0_BASE, TIMER_CFG_PERIODIC);
+    MAP_TimerLoadSet(TIMER0_BASE, TIMER_A, load - 1U);
+    MAP_TimerADCEventSet(TIMER0_BASE, TIMER_ADC_TIMEOUT_A);
+    MAP_TimerControlTrigger(TIMER0_BASE, TIMER_A, true);
+
+    Udma_init();
+
+    for (adc = 0; adc < Channels_NUM_ADCS; adc++) {
+        if ((obj->activeMask & (1U << adc)) &&
+            (configureStream(obj, channels, adc) != Acquire_STATUS_SUCCESS)) {
+            return (Acquire_STATUS_ERROR);
+        }
+    }
+#endif
+
+    return (Acquire_STATUS_SUCCESS);
+}
+
+#if defined(HOST_BUILD)
+/*
+ *  ======== Acquire_setSource ========
+ */
+void Acquire_setSource(Acquire_Object *obj, Acquire_SourceFxn fxn, void *arg)
+{
+    obj->sourceFxn = fxn;
+    obj->sourceArg = arg;
+}
+#endif
+
+/*
+ *  ======== Acquire_setTriggered ========
+ */
+void Acquire_setTriggered(Acquire_Object *obj, bool triggered)
+{
+    obj->triggered = triggered;
+}
+
+/*
+ *  ======== Acquire_start ========
+ */
+int_fast16_t Acquire_start(Acquire_Object *obj)
+{
+#if defined(HOST_BUILD)
+    if ((obj->sourceFxn == NULL) || obj->running) {
+        return (Acquire_STATUS_ERROR);
+    }
+
+    obj->waiting = obj->triggered;
+    obj->running = true;
+    if (pthread_create(&obj->thread, NULL, dmaThread, obj) != 0) {
+        obj->running = false;
+        return (Acquire_STATUS_ERROR);
+    }
+#else
+    if (obj->triggered) {
+        obj->waiting = true;
+    }
+    else {
+        MAP_TimerEnable(TIMER0_BASE, TIMER_A);
+    }
+#endif
+
+    return (Acquire_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Acquire_stop ========
+ */
+void Acquire_stop(Acquire_Object *obj)
+{
+#if defined(HOST_BUILD)
+    if (obj->running) {
+        pthread_mutex_lock(&obj->lock);
+        obj->running = false;
+        obj->waiting = false;
+        pthread_cond_signal(&obj->wake);
+        pthread_mutex_unlock(&obj->lock);
+        pthread_join(obj->thread, NULL);
+    }
+#else
+    /* A trigger from here on finds nothing to start */
+    obj->waiting = false;
+    MAP_TimerDisable(TIMER0_BASE, TIMER_A);
+#endif
+}
+
+/*
+ *  ======== Acquire_trigger ========
+ *  Only a stopped timer is started, so triggers during a frame are
+ *  ignored.  Starting the count over from a full period puts the first
+ *  sample at the same delay from every trigger.
+ */
+bool Acquire_trigger(Acquire_Object *obj)
+{
+    bool started;
+
+#if defined(HOST_BUILD)
+    pthread_mutex_lock(&obj->lock);
+    started = obj->waiting && obj->running;
+    if (started) {
+        obj->waiting = false;
+        pthread_cond_signal(&obj->wake);
+    }
+    pthread_mutex_unlock(&obj->lock);
+#else
+    started = obj->waiting;
+    if (started) {
+        obj->waiting = false;
+        HWREG(TIMER0_BASE + TIMER_O_TAV) = obj->timerLoad - 1U;
+        MAP_TimerEnable(TIMER0_BASE, TIMER_A);
+    }
+#endif
+
+    return (started);
+}
+
+/*
+ *  ======== Acquire_getFrame ========
+ */
+int_fast8_t Acquire_getFrame(Acquire_Object *obj)
+{
+    int_fast8_t frame;
+#if defined(HOST_BUILD)
+
+    frame = __atomic_exchange_n(&obj->ready, Acquire_NO_FRAME,
+                                __ATOMIC_ACQ_REL);
+#else
+    uintptr_t key;
+
+    /* Take and clear the flag without losing a frame published between */
+    key = HwiP_disable();
+    frame = obj->ready;
+    obj->ready = Acquire_NO_FRAME;
+    HwiP_restore(key);
+#endif
+
+    if (frame != Acquire_NO_FRAME) {
+        obj->held = frame;
+    }
+
+    return (frame);
+}
+
+/*
+ *  ======== Acquire_releaseFrame ========
+ */
+void Acquire_releaseFrame(Acquire_Object *obj)
+{
+    obj->held = Acquire_NO_FRAME;
+}
+
+/*
+ *  ======== Acquire_frameNumber ========
+ */
+uint32_t Acquire_frameNumber(const Acquire_Object *obj, int_fast8_t frame)
+{
+    return (obj->number[frame]);
+}
+
+/*
+ *  ======== Acquire_samples ========
+ */
+const uint16_t *Acquire_samples(const Acquire_Object *obj, int_fast8_t frame,
+                                uint_least8_t channel)
+{
+    const Acquire_Stream *s = &obj->streams[obj->stream[channel]];
+
+    return (&s->buffer[((uint32_t)frame * obj->frameLen * s->numChannels) +
+                       obj->slot[channel]]);
+}
+
+/*
+ *  ======== Acquire_stride ========
+ */
+uint16_t Acquire_stride(const Acquire_Object *obj, uint_least8_t channel)
+{
+    return (obj->streams[obj->stream[channel]].numChannels);
+}
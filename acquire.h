@@ -0,0 +1,272 @@
+/*
+ *  ======== acquire.h ========
+ *  Gapless multi-channel ADC acquisition with uDMA ping-pong.
+ *
+ *  A general-purpose timer triggers sample sequencer 0 of both ADC modules
+ *  at the sample rate.  Each sequencer converts its channels back to back
+ *  and its uDMA channel moves the results, interleaved, into a ring of two
+ *  frames without CPU involvement (one stream per ADC module).  The codes
+ *  are 12 bits, so the uDMA reads the FIFO as half-words and the ring holds
+ *  one uint16_t per sample, half the SRAM of a word per sample.  The uDMA
+ *  runs in ping-pong mode: the primary and alternate control structures
+ *  take turns, and whenever one finishes its block the interrupt re-arms
+ *  it two blocks ahead while the other one keeps the transfer going.  A
+ *  single uDMA transfer is limited to 1024 items, so longer frames are made
+ *  of several blocks.
+ *
+ *  Once both streams have finished a frame, it is published: the optional
+ *  callback runs in interrupt context and Acquire_getFrame() returns it.
+ *  The DSP then has one frame time to work on it while the other frame
+ *  fills.  Frames still held when they are due to be refilled are counted
+ *  as overruns.  Acquire_samples() and Acquire_stride() locate a channel
+ *  within a frame for de-interleaving (see Ingest_deinterleave()).
+ *
+ *  In triggered mode (Acquire_setTriggered()) the sample timer stops at
+ *  the end of every frame, and the next frame starts at the first
+ *  Acquire_trigger() after that, usually called for a zero-crossing edge
+ *  (trigger.h).  The uDMA stays armed throughout, so nothing else
+ *  changes.  Frames are then no longer gapless: a capture waits for the
+ *  edge after the frame it follows.
+ *
+ *  Building with HOST_BUILD replaces the timer, ADC and uDMA with a POSIX
+ *  thread that fills blocks from a source function at the same real-time
+ *  pace, so the buffer-swap logic and its timing can be run on Linux.
+ */
+#ifndef ACQUIRE_H_
+#define ACQUIRE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(HOST_BUILD)
+#include <pthread.h>
+#else
+#include <ti/drivers/dpl/HwiP.h>
+#endif
+
+#include "channels.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Acquire functions.
+ */
+#define Acquire_STATUS_SUCCESS      (0)
+
+/*!
+ *  @brief  Returned for an invalid configuration.
+ */
+#define Acquire_STATUS_ERROR        (-1)
+
+/*!
+ *  @brief  Longest uDMA block, in samples
+ */
+#define Acquire_MAX_BLOCK_LEN       (1024)
+
+/*!
+ *  @brief  Most channels, eight per ADC module
+ */
+#define Acquire_MAX_CHANNELS        (Channels_NUM_ADCS * Channels_MAX_PER_ADC)
+
+/*!
+ *  @brief  Conversion rate of one ADC module
+ */
+#define Acquire_MAX_CONVERSIONS     (2000000U)
+
+/*!
+ *  @brief  Number of uint16_t samples required for the frame rings.
+ */
+#define Acquire_BUFFER_LEN(frameLen, numChannels) \
+    (2U * (uint32_t)(frameLen) * (numChannels))
+
+/*!
+ *  @brief  Returned by Acquire_getFrame() when no new frame is ready.
+ */
+#define Acquire_NO_FRAME            (-1)
+
+/*!
+ *  @brief  Called in interrupt context when a frame is complete.
+ *
+ *  @param  frame     Index of the complete frame (0 or 1)
+ *  @param  arg       User argument given to Acquire_init()
+ */
+typedef void (*Acquire_CallbackFxn)(int_fast8_t frame, void *arg);
+
+#if defined(HOST_BUILD)
+/*!
+ *  @brief  Host stand-in for the ADC: fill the raw codes of one channel.
+ *
+ *  @param  channel     Channel index in the table given to Acquire_init()
+ *  @param  dst         First sample of the channel
+ *  @param  numSamples  Samples to produce
+ *  @param  stride      Distance between samples of the channel
+ *  @param  arg         Argument given to Acquire_setSource()
+ */
+typedef void (*Acquire_SourceFxn)(uint_least8_t channel, uint16_t *dst,
+                                  uint16_t numSamples, uint16_t stride,
+                                  void *arg);
+#endif
+
+/*!
+ *  @brief  One sequencer's uDMA stream
+ */
+typedef struct {
+    uint16_t             *buffer;       /*!< Ring of two interleaved frames */
+    uint_least8_t         numChannels;  /*!< Channels on this sequencer */
+    uint16_t              blockLen;     /*!< Samples per uDMA transfer */
+    uint16_t              numBlocks;    /*!< Blocks in the ring */
+    uint16_t              nextBlock;    /*!< Next block to complete */
+#if defined(HOST_BUILD)
+    uint16_t              fill;         /*!< Samples of nextBlock written */
+#else
+    HwiP_Struct           hwi;          /*!< uDMA done interrupt */
+#endif
+} Acquire_Stream;
+
+/*!
+ *  @brief  Acquisition state
+ */
+typedef struct {
+    Acquire_Stream        streams[Channels_NUM_ADCS];
+    uint_least8_t         numChannels;  /*!< Channels in the table */
+    uint_least8_t         activeMask;   /*!< Streams with channels */
+    uint_least8_t         stream[Acquire_MAX_CHANNELS];  /*!< Per channel */
+    uint_least8_t         slot[Acquire_MAX_CHANNELS];    /*!< Per channel */
+    uint16_t              frameLen;     /*!< Samples per channel and frame */
+    uint32_t              sampleRate;   /*!< Actual sample rate in Hz */
+    volatile uint_least8_t pending[2];  /*!< Streams done, per frame */
+    volatile int_fast8_t  ready;        /*!< Published frame, or -1 */
+    volatile int_fast8_t  held;         /*!< Frame owned by the DSP, or -1 */
+    volatile uint32_t     frames;       /*!< Frames completed */
+    volatile uint32_t     number[2];    /*!< Per frame, frames before it */
+    volatile uint32_t     overruns;     /*!< Frames refilled while held */
+    Acquire_CallbackFxn   callbackFxn;  /*!< Frame complete callback */
+    void                 *arg;          /*!< Callback argument */
+    bool                  triggered;    /*!< Frames start on a trigger */
+    volatile bool         waiting;      /*!< Timer stopped for a trigger */
+#if defined(HOST_BUILD)
+    Acquire_SourceFxn     sourceFxn;    /*!< Sample source */
+    void                 *sourceArg;    /*!< Sample source argument */
+    pthread_t             thread;       /*!< Emulated uDMA */
+    pthread_mutex_t       lock;         /*!< Guards waiting */
+    pthread_cond_t        wake;         /*!< Signalled by a trigger */
+    volatile bool         running;
+#else
+    uint32_t              timerLoad;    /*!< Sample period in clocks */
+#endif
+} Acquire_Object;
+
+/*!
+ *  @brief  Configure the timer, ADCs and uDMA for continuous acquisition.
+ *
+ *  @param  obj          Acquisition object to initialize
+ *  @param  channels     Channel table; the entries of each ADC module are
+ *                       converted in table order
+ *  @param  numChannels  Entries in @p channels (1 to Acquire_MAX_CHANNELS,
+ *                       at most Channels_MAX_PER_ADC per module)
+ *  @param  buffer       Acquire_BUFFER_LEN(frameLen, numChannels) samples
+ *  @param  frameLen     Samples per channel and frame (power of two,
+ *                       16 to 8192)
+ *  @param  sampleRate   Requested sample rate per channel in Hz; the timer
+ *                       period is rounded, the actual rate is left in
+ *                       obj->sampleRate
+ *  @param  systemClock  System clock in Hz (ignored on the host)
+ *  @param  callbackFxn  Frame complete callback, or NULL to poll
+ *  @param  arg          Argument passed to @p callbackFxn
+ *
+ *  @return Acquire_STATUS_SUCCESS, or Acquire_STATUS_ERROR for an invalid
+ *          configuration or more conversions than an ADC module can do
+ */
+extern int_fast16_t Acquire_init(Acquire_Object *obj,
+                                 const Channels_Config *channels,
+                                 uint_least8_t numChannels, uint16_t *buffer,
+                                 uint16_t frameLen, uint32_t sampleRate,
+                                 uint32_t systemClock,
+                                 Acquire_CallbackFxn callbackFxn, void *arg);
+
+#if defined(HOST_BUILD)
+/*!
+ *  @brief  Set the sample source of the host stand-in.  Must be called
+ *          before Acquire_start().
+ */
+extern void Acquire_setSource(Acquire_Object *obj, Acquire_SourceFxn fxn,
+                              void *arg);
+#endif
+
+/*!
+ *  @brief  Start each frame on a trigger instead of right after the last
+ *          one.  Must be called before Acquire_start().
+ */
+extern void Acquire_setTriggered(Acquire_Object *obj, bool triggered);
+
+/*!
+ *  @brief  Start the sample timer, or in triggered mode wait for the
+ *          first trigger.
+ */
+extern int_fast16_t Acquire_start(Acquire_Object *obj);
+
+/*!
+ *  @brief  Stop the sample timer; the uDMA stays armed.
+ */
+extern void Acquire_stop(Acquire_Object *obj);
+
+/*!
+ *  @brief  Start the next frame in triggered mode.
+ *
+ *  Called in interrupt context.  The first sample is taken one sample
+ *  period after the call.
+ *
+ *  @return true if a frame was started, false while one is being captured
+ *          or acquisition is stopped
+ */
+extern bool Acquire_trigger(Acquire_Object *obj);
+
+/*!
+ *  @brief  Take the most recent complete frame.
+ *
+ *  The frame stays owned by the caller until Acquire_releaseFrame().
+ *
+ *  @return Frame index, or Acquire_NO_FRAME if no new frame is ready
+ */
+extern int_fast8_t Acquire_getFrame(Acquire_Object *obj);
+
+/*!
+ *  @brief  Hand the frame from Acquire_getFrame() back to the uDMA.
+ */
+extern void Acquire_releaseFrame(Acquire_Object *obj);
+
+/*!
+ *  @brief  Number of a frame since Acquire_init(), from 0.
+ *
+ *  Every frame completed counts, picked up or not, so a gap between the
+ *  numbers of two frames taken is the number of frames missed.  Valid
+ *  while the frame is held.
+ *
+ *  @param  obj    Acquisition object
+ *  @param  frame  Frame index from Acquire_getFrame()
+ */
+extern uint32_t Acquire_frameNumber(const Acquire_Object *obj,
+                                    int_fast8_t frame);
+
+/*!
+ *  @brief  First raw code of a channel within a frame.
+ *
+ *  Successive samples of the channel are Acquire_stride() apart.
+ */
+extern const uint16_t *Acquire_samples(const Acquire_Object *obj,
+                                       int_fast8_t frame,
+                                       uint_least8_t channel);
+
+/*!
+ *  @brief  Distance between samples of a channel.
+ */
+extern uint16_t Acquire_stride(const Acquire_Object *obj,
+                               uint_least8_t channel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ACQUIRE_H_ */
@@ -0,0 +1,328 @@
+/*
+ *  ======== analysis.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#include "analysis.h"
+#include "profile.h"
+
+/*
+ *  ======== restart ========
+ *  Forget every channel's history, partial averages included.
+ */
+static void restart(Analysis_Object *obj)
+{
+    uint_least8_t i;
+
+    for (i = 0; i < obj->numChannels; i++) {
+        obj->channels[i].head = 0;
+        obj->channels[i].fill = 0;
+        obj->channels[i].sum = 0;
+        obj->channels[i].count = 0;
+    }
+}
+
+/*
+ *  ======== Analysis_init ========
+ */
+int_fast16_t Analysis_init(Analysis_Object *obj, uint_least8_t numChannels,
+                           Precision_Sample *history, Precision_Sample *work,
+                           q15_t *windowTable, uint16_t samplesPerCycle,
+                           uint32_t sampleRate)
+{
+    uint_least8_t i;
+
+    if ((obj == NULL) || (history == NULL) || (work == NULL) ||
+        (windowTable == NULL) ||
+        (numChannels == 0) || (numChannels > Analysis_MAX_CHANNELS) ||
+        (samplesPerCycle == 0) || (sampleRate == 0)) {
+        return (Analysis_STATUS_ERROR);
+    }
+
+    memset(&obj->config, 0, sizeof(obj->config));
+    obj->spectrum.work = work;
+    obj->window = work + Spectrum_WORK_LEN(Analysis_MAX_LEN);
+    obj->windowTable = windowTable;
+    obj->samplesPerCycle = samplesPerCycle;
+    obj->decimation = 0;
+    obj->sampleRate = sampleRate;
+    obj->numChannels = numChannels;
+    obj->numReported = 0;
+    obj->triggered = false;
+    obj->peakBin = 0;
+    obj->peak.offset = 0.0f;
+    obj->peak.amplitude = 0.0f;
+
+    for (i = 0; i < numChannels; i++) {
+        obj->channels[i].history = history + ((uint32_t)i *
+                                              Analysis_HISTORY_LEN);
+    }
+    restart(obj);
+
+    return (Analysis_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Analysis_setTriggered ========
+ */
+void Analysis_setTriggered(Analysis_Object *obj, bool triggered)
+{
+    obj->triggered = triggered;
+}
+
+/*
+ *  ======== Analysis_check ========
+ */
+int_fast16_t Analysis_check(const Analysis_Object *obj,
+                            const Analysis_Config *config)
+{
+    uint32_t span = (uint32_t)obj->samplesPerCycle * config->cycles;
+    uint_least8_t i;
+
+    if ((config->fftLen < Analysis_MIN_LEN) ||
+        (config->fftLen > Analysis_MAX_LEN) ||
+        ((config->fftLen & (config->fftLen - 1U)) != 0)) {
+        return (Analysis_STATUS_BAD_LENGTH);
+    }
+
+    /* The window must be a whole number of acquired samples apart */
+    if ((config->cycles == 0) || ((span % config->fftLen) != 0) ||
+        ((span / config->fftLen) > UINT16_MAX)) {
+        return (Analysis_STATUS_BAD_CYCLES);
+    }
+
+    /* Triggered frames do not join up into a longer window */
+    if (obj->triggered && (config->cycles > 1U)) {
+        return (Analysis_STATUS_TRIGGERED);
+    }
+
+    if ((config->window >= Window_COUNT) ||
+        ((config->window != Window_RECTANGULAR) &&
+         (Window_table(config->window, config->fftLen) == NULL))) {
+        return (Analysis_STATUS_BAD_WINDOW);
+    }
+
+    if ((config->numHarmonics == 0) ||
+        (config->numHarmonics > Analysis_MAX_HARMONICS)) {
+        return (Analysis_STATUS_BAD_ORDER);
+    }
+    for (i = 0; i < config->numHarmonics; i++) {
+        if (config->orders[i] == 0) {
+            return (Analysis_STATUS_BAD_ORDER);
+        }
+    }
+
+    return (Analysis_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Analysis_configure ========
+ *  Averaging a run of D samples multiplies a harmonic at x cycles per
+ *  sample by sin(pi x D) / (D sin(pi x)) and delays it by (D - 1) / 2
+ *  samples; both are undone here once per order, with the coherent gain
+ *  of the window.
+ *
+ *  The window table is read once per sample of every transform, so the
+ *  FFT gets the copy in obj->windowTable instead of the table in flash.
+ */
+int_fast16_t Analysis_configure(Analysis_Object *obj,
+                                const Analysis_Config *config)
+{
+    int_fast16_t status = Analysis_check(obj, config);
+    float32_t gain;
+    float32_t x;
+    const q15_t *table;
+    uint32_t bin;
+    uint16_t decimation;
+    uint_least8_t i;
+
+    if (status != Analysis_STATUS_SUCCESS) {
+        return (status);
+    }
+
+    if ((Spectrum_init(&obj->spectrum, config->fftLen, obj->spectrum.work) !=
+         Spectrum_STATUS_SUCCESS) ||
+        (Spectrum_setWindow(&obj->spectrum, config->window) !=
+         Spectrum_STATUS_SUCCESS)) {
+        return (Analysis_STATUS_ERROR);
+    }
+
+    table = Window_table(config->window, config->fftLen);
+    if (table != NULL) {
+        memcpy(obj->windowTable, table, config->fftLen * sizeof(q15_t));
+        Spectrum_setWindowTable(&obj->spectrum, obj->windowTable);
+    }
+
+    decimation = (uint16_t)(((uint32_t)obj->samplesPerCycle *
+                             config->cycles) / config->fftLen);
+
+    obj->numReported = 0;
+    for (i = 0; i < config->numHarmonics; i++) {
+        bin = (uint32_t)config->orders[i] * config->cycles;
+        if (bin >= (config->fftLen / 2U)) {
+            continue;
+        }
+
+        x = (float32_t)config->orders[i] / (float32_t)obj->samplesPerCycle;
+        gain = Window_coherentGain(config->window);
+        if (decimation > 1U) {
+            gain *= sinf(PI * x * decimation) /
+                    ((float32_t)decimation * sinf(PI * x));
+        }
+        obj->orders[obj->numReported] = config->orders[i];
+        obj->correct[obj->numReported][0] =
+            cosf(PI * x * (float32_t)(decimation - 1U)) / gain;
+        obj->correct[obj->numReported][1] =
+            -sinf(PI * x * (float32_t)(decimation - 1U)) / gain;
+        obj->numReported++;
+    }
+
+    obj->config = *config;
+    obj->decimation = decimation;
+    restart(obj);
+
+    return (Analysis_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Analysis_push ========
+ *  Without decimation the frame is copied in as is, in at most two runs.
+ */
+void Analysis_push(Analysis_Object *obj, uint_least8_t channel,
+                   const Precision_Sample *samples, uint32_t numSamples)
+{
+    Analysis_Channel *ch = &obj->channels[channel];
+    uint32_t offset;
+    uint32_t run;
+    uint32_t i;
+
+    if (obj->decimation == 0) {
+        return;
+    }
+
+    if (obj->decimation == 1U) {
+        if (numSamples > Analysis_HISTORY_LEN) {
+            samples += numSamples - Analysis_HISTORY_LEN;
+            ch->head += numSamples - Analysis_HISTORY_LEN;
+            ch->fill += numSamples - Analysis_HISTORY_LEN;
+            numSamples = Analysis_HISTORY_LEN;
+        }
+        while (numSamples != 0) {
+            offset = ch->head & (Analysis_HISTORY_LEN - 1U);
+            run = Analysis_HISTORY_LEN - offset;
+            if (run > numSamples) {
+                run = numSamples;
+            }
+            memcpy(&ch->history[offset], samples,
+                   run * sizeof(Precision_Sample));
+            samples += run;
+            numSamples -= run;
+            ch->head += run;
+            ch->fill += run;
+        }
+        return;
+    }
+
+    for (i = 0; i < numSamples; i++) {
+        ch->sum += samples[i];
+        if (++ch->count == obj->decimation) {
+            ch->history[ch->head & (Analysis_HISTORY_LEN - 1U)] =
+#if (PRECISION == PRECISION_F32)
+                ch->sum / (float32_t)obj->decimation;
+#else
+                (Precision_Sample)(ch->sum / obj->decimation);
+#endif
+            ch->head++;
+            ch->fill++;
+            ch->sum = 0;
+            ch->count = 0;
+        }
+    }
+}
+
+/*
+ *  ======== Analysis_run ========
+ */
+bool Analysis_run(Analysis_Object *obj, uint_least8_t channel,
+                  Window_Interp method)
+{
+    Analysis_Channel *ch = &obj->channels[channel];
+    uint16_t fftLen = obj->config.fftLen;
+    uint32_t numBins = Spectrum_NUM_BINS(fftLen);
+    Precision_Sample *mag = obj->window;
+    Precision_Sample maxValue;
+    uint32_t maxIndex;
+    uint32_t start;
+    uint32_t first;
+
+    if ((obj->decimation == 0) || (ch->fill < fftLen)) {
+        return (false);
+    }
+
+    /* The FFT works in place, so it gets a copy of the newest window */
+    start = (ch->head - fftLen) & (Analysis_HISTORY_LEN - 1U);
+    first = Analysis_HISTORY_LEN - start;
+    if (first > fftLen) {
+        first = fftLen;
+    }
+    memcpy(obj->window, &ch->history[start],
+           first * sizeof(Precision_Sample));
+    memcpy(obj->window + first, ch->history,
+           (fftLen - first) * sizeof(Precision_Sample));
+
+    Profile_BEGIN(Profile_STAGE_TRANSFORM);
+    Spectrum_transform(&obj->spectrum, obj->window);
+    Profile_END(Profile_STAGE_TRANSFORM);
+
+    Profile_BEGIN(Profile_STAGE_MAGNITUDE);
+    Spectrum_magnitude(&obj->spectrum, mag);
+    Profile_END(Profile_STAGE_MAGNITUDE);
+
+    /* Largest bin above DC, refined to a fractional bin */
+    Profile_BEGIN(Profile_STAGE_PEAK);
+    Precision_max(&mag[1], numBins - 1U, &maxValue, &maxIndex);
+    maxIndex += 1U;
+
+    obj->peakBin = maxIndex;
+    obj->peak.offset = 0.0f;
+    obj->peak.amplitude = Spectrum_MAG_TO_FLOAT(maxValue);
+    if (maxIndex < (numBins - 1U)) {
+        Window_estimate(obj->config.window, method,
+                        Spectrum_MAG_TO_FLOAT(mag[maxIndex - 1U]),
+                        Spectrum_MAG_TO_FLOAT(maxValue),
+                        Spectrum_MAG_TO_FLOAT(mag[maxIndex + 1U]),
+                        &obj->peak);
+    }
+    Profile_END(Profile_STAGE_PEAK);
+
+    return (true);
+}
+
+/*
+ *  ======== Analysis_harmonic ========
+ */
+void Analysis_harmonic(const Analysis_Object *obj, uint_least8_t index,
+                       float32_t *re, float32_t *im)
+{
+    uint32_t k = 2U * (uint32_t)obj->orders[index] * obj->config.cycles;
+    float32_t x = Precision_toFloat(obj->spectrum.work[k]);
+    float32_t y = Precision_toFloat(obj->spectrum.work[k + 1U]);
+    float32_t c = obj->correct[index][0];
+    float32_t s = obj->correct[index][1];
+
+    *re = (x * c) - (y * s);
+    *im = (x * s) + (y * c);
+}
+
+/*
+ *  ======== Analysis_frequency ========
+ */
+float32_t Analysis_frequency(const Analysis_Object *obj)
+{
+    return (((float32_t)obj->peakBin + obj->peak.offset) *
+            Analysis_rate(obj) / (float32_t)obj->config.fftLen);
+}
@@ -0,0 +1,286 @@
+/*
+ *  ======== analysis.h ========
+ *  FFT harmonic analysis with a window set at run time.
+ *
+ *  The acquisition frame is fixed at build time; the analysis window is
+ *  not.  Each channel keeps a history of samples, decimated so that the
+ *  window of fftLen samples spans exactly the configured number of
+ *  fundamental cycles:
+ *
+ *      decimation = samplesPerCycle * cycles / fftLen
+ *
+ *  where samplesPerCycle is the number of acquired samples in one nominal
+ *  fundamental cycle.  Every frame appends frameLen / decimation samples
+ *  and the window is the newest fftLen of them, so a result is produced
+ *  for every frame whatever the window length: a short window follows a
+ *  change of the signal within a few cycles, a long one resolves more
+ *  finely and averages more.  The fundamental falls on bin cycles and
+ *  harmonic h on bin h * cycles.
+ *
+ *  Decimation averages each run of samples (integrate and dump), carried
+ *  across frame boundaries.  Its sinc droop and half-run delay are known
+ *  at every harmonic and taken out of the reported phasors, together with
+ *  the coherent gain of the window.  The average is a weak anti-alias
+ *  filter; harmonics above half the decimated rate alias.
+ *
+ *  Analysis_configure() switches to a new window; call it between frames.
+ *  It copies the coefficients of the window at the new length into a
+ *  buffer of the caller, which main_nortos.c takes from the arena in
+ *  SRAM, so Window_apply() does not read them from flash whatever the
+ *  length (placement.h).  The acquisition is not touched.  The histories
+ *  restart, so the next results come once the new window has filled,
+ *  cycles frames later in the common case of one cycle per frame.
+ *
+ *  Triggered frames (Acquire_setTriggered()) each hold one cycle from a
+ *  zero crossing, with a gap before the next, so a window of more cycles
+ *  would join frames across the gaps.  Analysis_setTriggered() limits the
+ *  window to one cycle.
+ */
+#ifndef ANALYSIS_H_
+#define ANALYSIS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#include "channels.h"
+#include "precision.h"
+#include "spectrum.h"
+#include "window.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Analysis functions.
+ */
+#define Analysis_STATUS_SUCCESS     (0)
+
+/*!
+ *  @brief  Returned for an invalid object or buffer.
+ */
+#define Analysis_STATUS_ERROR       (-1)
+
+/*!
+ *  @brief  The FFT length is not a power of two from Analysis_MIN_LEN to
+ *          Analysis_MAX_LEN.
+ */
+#define Analysis_STATUS_BAD_LENGTH  (-2)
+
+/*!
+ *  @brief  The cycles do not give a whole decimation of at least 1.
+ */
+#define Analysis_STATUS_BAD_CYCLES  (-3)
+
+/*!
+ *  @brief  No table for the window at this length, or an unknown window.
+ */
+#define Analysis_STATUS_BAD_WINDOW  (-4)
+
+/*!
+ *  @brief  Empty harmonic list, or an order of 0.
+ */
+#define Analysis_STATUS_BAD_ORDER   (-5)
+
+/*!
+ *  @brief  More than one cycle while frames are triggered.
+ */
+#define Analysis_STATUS_TRIGGERED   (-6)
+
+/*!
+ *  @brief  Shortest and longest FFT
+ */
+#define Analysis_MIN_LEN            (Window_MIN_LEN)
+#ifndef Analysis_MAX_LEN
+#define Analysis_MAX_LEN            (Window_MAX_LEN)
+#endif
+
+/*!
+ *  @brief  Most harmonics in the list
+ */
+#define Analysis_MAX_HARMONICS      (50)
+
+/*!
+ *  @brief  Most channels
+ */
+#define Analysis_MAX_CHANNELS       (Channels_NUM_ADCS * Channels_MAX_PER_ADC)
+
+/*!
+ *  @brief  Precision_Sample values of history per channel.
+ */
+#define Analysis_HISTORY_LEN        (Analysis_MAX_LEN)
+
+/*!
+ *  @brief  Precision_Sample values of the shared work buffer: the FFT
+ *          output and a copy of the window, which the FFT consumes and
+ *          the magnitudes then reuse.
+ */
+#define Analysis_WORK_LEN           (Spectrum_WORK_LEN(Analysis_MAX_LEN) + \
+                                     Analysis_MAX_LEN)
+
+/*!
+ *  @brief  q15 coefficients of the window copy
+ */
+#define Analysis_WINDOW_TABLE_LEN   (Analysis_MAX_LEN)
+
+/*!
+ *  @brief  Analysis window and reported harmonics
+ */
+typedef struct {
+    uint16_t      fftLen;           /*!< FFT length, a power of two */
+    uint16_t      cycles;           /*!< Fundamental cycles per window */
+    Window_Type   window;           /*!< Window function */
+    uint_least8_t numHarmonics;     /*!< Entries in orders */
+    /*! Harmonic orders to report, 1 for the fundamental */
+    uint8_t       orders[Analysis_MAX_HARMONICS];
+} Analysis_Config;
+
+/*!
+ *  @brief  History of one channel
+ */
+typedef struct {
+    Precision_Sample *history;      /*!< Analysis_HISTORY_LEN samples */
+    uint32_t          head;         /*!< Samples written, free running */
+    uint32_t          fill;         /*!< Samples since the last restart */
+#if (PRECISION == PRECISION_F32)
+    float32_t         sum;          /*!< Partial average */
+#else
+    int64_t           sum;          /*!< Partial average */
+#endif
+    uint16_t          count;        /*!< Samples in sum */
+} Analysis_Channel;
+
+/*!
+ *  @brief  Analysis state
+ */
+typedef struct {
+    Analysis_Config   config;       /*!< Active configuration */
+    Spectrum_Object   spectrum;     /*!< FFT of config.fftLen */
+    Precision_Sample *window;       /*!< Copy of the window, in work */
+    q15_t            *windowTable;  /*!< Copy of the window coefficients */
+    uint16_t          samplesPerCycle;  /*!< Acquired samples per cycle */
+    uint16_t          decimation;   /*!< Acquired samples per window sample */
+    uint32_t          sampleRate;   /*!< Acquisition rate in Hz */
+    uint_least8_t     numChannels;  /*!< Channels with a history */
+    uint_least8_t     numReported;  /*!< Entries in orders */
+    bool              triggered;    /*!< One cycle per window at most */
+    /*! Orders of config.orders below Nyquist, in list order */
+    uint8_t           orders[Analysis_MAX_HARMONICS];
+    /*! Correction of each reported order, cos and sin scaled by the gain */
+    float32_t         correct[Analysis_MAX_HARMONICS][2];
+    uint32_t          peakBin;      /*!< Largest bin of the last window */
+    Window_Estimate   peak;         /*!< Its interpolated position */
+    Analysis_Channel  channels[Analysis_MAX_CHANNELS];
+} Analysis_Object;
+
+/*!
+ *  @brief  Initialize the analysis.  Analysis_configure() must follow.
+ *
+ *  @param  obj              Analysis object to initialize
+ *  @param  numChannels      Channels to analyze
+ *  @param  history          numChannels * Analysis_HISTORY_LEN values
+ *  @param  work             Analysis_WORK_LEN values, shared by all
+ *                           channels; 32-bit aligned
+ *  @param  windowTable      Analysis_WINDOW_TABLE_LEN values, kept for the
+ *                           coefficients of the configured window
+ *  @param  samplesPerCycle  Acquired samples per nominal fundamental cycle
+ *  @param  sampleRate       Acquisition sample rate in Hz
+ *
+ *  @return Analysis_STATUS_SUCCESS or Analysis_STATUS_ERROR
+ */
+extern int_fast16_t Analysis_init(Analysis_Object *obj,
+                                  uint_least8_t numChannels,
+                                  Precision_Sample *history,
+                                  Precision_Sample *work,
+                                  q15_t *windowTable,
+                                  uint16_t samplesPerCycle,
+                                  uint32_t sampleRate);
+
+/*!
+ *  @brief  Limit the window to one cycle, for triggered frames.
+ *
+ *  Takes effect with the next Analysis_check() or Analysis_configure();
+ *  the active configuration is kept.
+ */
+extern void Analysis_setTriggered(Analysis_Object *obj, bool triggered);
+
+/*!
+ *  @brief  Check a configuration without applying it.
+ *
+ *  @return Analysis_STATUS_SUCCESS or one of the Analysis_STATUS_BAD_*
+ *          codes
+ */
+extern int_fast16_t Analysis_check(const Analysis_Object *obj,
+                                   const Analysis_Config *config);
+
+/*!
+ *  @brief  Switch to a new configuration and restart every history.
+ *
+ *  Orders at or above half the decimated rate cannot be resolved and are
+ *  left out of the report; obj->orders and obj->numReported hold the
+ *  orders that remain.
+ *
+ *  @return Analysis_STATUS_SUCCESS, or the Analysis_check() code with the
+ *          previous configuration left in place
+ */
+extern int_fast16_t Analysis_configure(Analysis_Object *obj,
+                                       const Analysis_Config *config);
+
+/*!
+ *  @brief  Append one frame of a channel to its history.
+ *
+ *  @param  obj         Configured analysis object
+ *  @param  channel     Channel index
+ *  @param  samples     Converted samples of the frame
+ *  @param  numSamples  Samples in the frame
+ */
+extern void Analysis_push(Analysis_Object *obj, uint_least8_t channel,
+                          const Precision_Sample *samples,
+                          uint32_t numSamples);
+
+/*!
+ *  @brief  Analyze the newest window of a channel.
+ *
+ *  Windows, transforms and finds the largest bin above DC, refined with
+ *  the interpolation method of the window.  The results stay valid until
+ *  the next call for any channel.
+ *
+ *  @return false, with nothing done, while the window is still filling
+ *          after Analysis_init() or Analysis_configure()
+ */
+extern bool Analysis_run(Analysis_Object *obj, uint_least8_t channel,
+                         Window_Interp method);
+
+/*!
+ *  @brief  Phasor of the @p index th reported order of the last window,
+ *          corrected for decimation and window, as X[k] / N.
+ *
+ *  @param  obj     Analysis object after Analysis_run()
+ *  @param  index   Index into obj->orders, below obj->numReported
+ *  @param  re      Real part
+ *  @param  im      Imaginary part
+ */
+extern void Analysis_harmonic(const Analysis_Object *obj, uint_least8_t index,
+                              float32_t *re, float32_t *im);
+
+/*!
+ *  @brief  Interpolated frequency of the largest bin of the last window,
+ *          in Hz.
+ */
+extern float32_t Analysis_frequency(const Analysis_Object *obj);
+
+/*!
+ *  @brief  Samples per second after decimation.
+ */
+static inline float32_t Analysis_rate(const Analysis_Object *obj)
+{
+    return ((float32_t)obj->sampleRate / (float32_t)obj->decimation);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ANALYSIS_H_ */
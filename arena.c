@@ -0,0 +1,63 @@
+/*
+ *  ======== arena.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "arena.h"
+
+/*
+ *  ======== Arena_init ========
+ */
+void Arena_init(Arena_Object *obj, void *mem, uint32_t size)
+{
+    obj->base = (uint8_t *)mem;
+    obj->size = size & ~(Arena_ALIGN - 1U);
+    obj->boot = 0;
+    obj->scratch = 0;
+}
+
+/*
+ *  ======== Arena_allocBoot ========
+ */
+void *Arena_allocBoot(Arena_Object *obj, uint32_t size)
+{
+    uint32_t bytes = Arena_ROUND(size);
+    void *buffer;
+
+    if (bytes > Arena_unused(obj)) {
+        return (NULL);
+    }
+
+    buffer = obj->base + obj->boot;
+    obj->boot += bytes;
+
+    return (buffer);
+}
+
+/*
+ *  ======== Arena_allocScratch ========
+ *  The scratch ends at the top of the block, so growing it moves its start
+ *  down and the smaller scratch handed out before stays inside it.
+ */
+void *Arena_allocScratch(Arena_Object *obj, uint32_t size)
+{
+    uint32_t bytes = Arena_ROUND(size);
+
+    if (bytes > obj->scratch) {
+        if ((bytes - obj->scratch) > Arena_unused(obj)) {
+            return (NULL);
+        }
+        obj->scratch = bytes;
+    }
+
+    return (obj->base + (obj->size - bytes));
+}
+
+/*
+ *  ======== Arena_unused ========
+ */
+uint32_t Arena_unused(const Arena_Object *obj)
+{
+    return (obj->size - obj->boot - obj->scratch);
+}
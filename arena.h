@@ -0,0 +1,86 @@
+/*
+ *  ======== arena.h ========
+ *  Static memory arena with per-boot and scratch lifetimes.
+ *
+ *  The arena hands out pieces of one statically sized block; there is no
+ *  heap and nothing is ever freed.  Buffers live for one of two lifetimes:
+ *
+ *  boot     Taken once while the program starts up and kept until reset:
+ *           the acquisition ring, histories, results.  They grow from the
+ *           bottom of the block.
+ *
+ *  scratch  Valid for one channel job only.  Every Arena_allocScratch()
+ *           returns the same memory at the top of the block, grown to the
+ *           largest request, so the stages of a job that run one after the
+ *           other (the ingested frame, then the FFT work buffer) share it.
+ *           A stage that needs several buffers at the same time takes them
+ *           from one request.
+ *
+ *  Allocations are rounded up to Arena_ALIGN bytes.  Size the block with
+ *  the Budget_* macros of budget.h so that every allocation succeeds.
+ */
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Alignment of every allocation, in bytes
+ */
+#define Arena_ALIGN             (8U)
+
+/*!
+ *  @brief  @p bytes rounded up to a multiple of Arena_ALIGN
+ */
+#define Arena_ROUND(bytes) \
+    (((uint32_t)(bytes) + (Arena_ALIGN - 1U)) & ~(Arena_ALIGN - 1U))
+
+/*!
+ *  @brief  Arena state
+ */
+typedef struct {
+    uint8_t  *base;                 /*!< Start of the block */
+    uint32_t  size;                 /*!< Bytes in the block */
+    uint32_t  boot;                 /*!< Bytes taken for the boot lifetime */
+    uint32_t  scratch;              /*!< Bytes of the shared scratch */
+} Arena_Object;
+
+/*!
+ *  @brief  Initialize an empty arena over a block of memory.
+ *
+ *  @param  obj     Arena
+ *  @param  mem     Block, aligned to Arena_ALIGN
+ *  @param  size    Bytes in @p mem
+ */
+extern void Arena_init(Arena_Object *obj, void *mem, uint32_t size);
+
+/*!
+ *  @brief  Take @p size bytes until reset.
+ *
+ *  @return The buffer, or NULL if it does not fit beside the scratch
+ */
+extern void *Arena_allocBoot(Arena_Object *obj, uint32_t size);
+
+/*!
+ *  @brief  Take the scratch, at least @p size bytes, shared with every
+ *          other scratch user.
+ *
+ *  @return The scratch, or NULL if growing it would reach the boot
+ *          buffers
+ */
+extern void *Arena_allocScratch(Arena_Object *obj, uint32_t size);
+
+/*!
+ *  @brief  Bytes neither boot buffers nor scratch have taken.
+ */
+extern uint32_t Arena_unused(const Arena_Object *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARENA_H_ */
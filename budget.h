@@ -0,0 +1,136 @@
+/*
+ *  ======== budget.h ========
+ *  Memory budget of the measurement buffers.
+ *
+ *  Every buffer whose size follows the channel count, the frame length or
+ *  the number of harmonics is taken from the static arena (arena.h).  The
+ *  macros below give the bytes of each, by lifetime, for any of those
+ *  values and the precision of the build; main_nortos.c sizes its arena
+ *  with them for its engine and fails to compile if the arena does not
+ *  fit in Budget_ARENA_MAX_BYTES.
+ *
+ *  boot     the acquisition ring, the log records, the per-channel
+ *           histories and tables, and the per-channel results of the
+ *           harmonic banks
+ *  scratch  the frame of the channel being processed and the buffers of
+ *           its transform, one job at a time
+ *
+ *  tools/budget_report.c prints the table for any channel count and frame
+ *  length, with the module buffers outside the arena, against the SRAM.
+ */
+#ifndef BUDGET_H_
+#define BUDGET_H_
+
+#include <stdint.h>
+
+#include "acquire.h"
+#include "analysis.h"
+#include "arena.h"
+#include "goertzel.h"
+#include "log.h"
+#include "precision.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  SRAM of the MSP432E401Y
+ */
+#define Budget_SRAM_BYTES           (0x40000U)
+
+/*!
+ *  @brief  SRAM left for everything outside the arena: the stack, the
+ *          vector and uDMA tables, module state and the UART and stream
+ *          rings
+ */
+#define Budget_OTHER_BYTES          (0x4000U)
+
+/*!
+ *  @brief  Largest arena that fits
+ */
+#define Budget_ARENA_MAX_BYTES      (Budget_SRAM_BYTES - Budget_OTHER_BYTES)
+
+#define Budget_MAX(a, b)            (((a) > (b)) ? (a) : (b))
+
+/*
+ *  Boot buffers
+ */
+
+/*! @brief  uDMA ring of two frames of 16-bit ADC codes (ADC source) */
+#define Budget_ACQUIRE_BYTES(len, ch) \
+    Arena_ROUND(Acquire_BUFFER_LEN(len, ch) * sizeof(uint16_t))
+
+/*! @brief  Records of the deferred log */
+#define Budget_LOG_BYTES \
+    Arena_ROUND(Log_RING_LEN * sizeof(Log_Record))
+
+/*! @brief  FFT engine: decimated history of every channel */
+#define Budget_FFT_HISTORY_BYTES(ch) \
+    Arena_ROUND((uint32_t)(ch) * Analysis_HISTORY_LEN * \
+                sizeof(Precision_Sample))
+
+/*! @brief  FFT engine: copy of the window coefficients */
+#define Budget_FFT_WINDOW_BYTES \
+    Arena_ROUND(Analysis_WINDOW_TABLE_LEN * sizeof(q15_t))
+
+/*! @brief  Goertzel engine: phasors of every channel */
+#define Budget_GOERTZEL_RESULT_BYTES(ch, h) \
+    Arena_ROUND((uint32_t)(ch) * (h) * sizeof(Goertzel_Phasor))
+
+/*! @brief  SDFT engine: q15 sample history of every channel */
+#define Budget_SDFT_HISTORY_BYTES(len, ch) \
+    Arena_ROUND((uint32_t)(ch) * (len) * sizeof(q15_t))
+
+/*! @brief  SDFT engine: cosine table shared by the channels */
+#define Budget_SDFT_TABLE_BYTES(len) \
+    Arena_ROUND((uint32_t)(len) * sizeof(q15_t))
+
+/*! @brief  SDFT engine: q31 phasors of every channel */
+#define Budget_SDFT_RESULT_BYTES(ch, h) \
+    Arena_ROUND((uint32_t)(ch) * 2U * (h) * sizeof(q31_t))
+
+/*
+ *  Scratch
+ */
+
+/*! @brief  Frame of the channel being processed */
+#define Budget_FRAME_BYTES(len) \
+    Arena_ROUND((uint32_t)(len) * sizeof(Precision_Sample))
+
+/*! @brief  FFT engine: FFT output and window copy, in place of the frame */
+#define Budget_FFT_WORK_BYTES \
+    Arena_ROUND(Analysis_WORK_LEN * sizeof(Precision_Sample))
+
+/*! @brief  SDFT engine: q15 copy of the frame, beside it; none in q15 */
+#if (PRECISION == PRECISION_Q15)
+#define Budget_SDFT_FRAME_BYTES(len)    (0U)
+#else
+#define Budget_SDFT_FRAME_BYTES(len) \
+    Arena_ROUND((uint32_t)(len) * sizeof(q15_t))
+#endif
+
+/*
+ *  Totals per engine, without the acquisition ring and the log records
+ */
+#define Budget_FFT_BOOT_BYTES(len, ch, h) \
+    (Budget_FFT_HISTORY_BYTES(ch) + Budget_FFT_WINDOW_BYTES)
+#define Budget_FFT_SCRATCH_BYTES(len) \
+    Budget_MAX(Budget_FRAME_BYTES(len), Budget_FFT_WORK_BYTES)
+
+#define Budget_GOERTZEL_BOOT_BYTES(len, ch, h) \
+    Budget_GOERTZEL_RESULT_BYTES(ch, h)
+#define Budget_GOERTZEL_SCRATCH_BYTES(len) \
+    Budget_FRAME_BYTES(len)
+
+#define Budget_SDFT_BOOT_BYTES(len, ch, h) \
+    (Budget_SDFT_HISTORY_BYTES(len, ch) + Budget_SDFT_TABLE_BYTES(len) + \
+     Budget_SDFT_RESULT_BYTES(ch, h))
+#define Budget_SDFT_SCRATCH_BYTES(len) \
+    (Budget_FRAME_BYTES(len) + Budget_SDFT_FRAME_BYTES(len))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BUDGET_H_ */
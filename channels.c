@@ -0,0 +1,21 @@
+/*
+ *  ======== channels.c ========
+ */
+#include <stdint.h>
+
+#include "channels.h"
+
+/*
+ *  Inputs are AIN0-AIN3 (PE3-PE0) and AIN4-AIN6 (PD7-PD5).  Results are in
+ *  q15 of the full scale of the conditioning stage, noted per channel.
+ *  PD7 is the locked NMI pin; Acquire_init() unlocks it for AIN4.
+ */
+const Channels_Config Channels_config[Channels_COUNT] = {
+    {0, 0},                 /* Va, 400 V */
+    {0, 1},                 /* Vb, 400 V */
+    {0, 2},                 /* Vc, 400 V */
+    {1, 3},                 /* Ia, 20 A */
+    {1, 4},                 /* Ib, 20 A */
+    {1, 5},                 /* Ic, 20 A */
+    {1, 6}                  /* In, 20 A */
+};
@@ -0,0 +1,66 @@
+/*
+ *  ======== channels.h ========
+ *  Analog input channel table of the three-phase front end.
+ *
+ *  Each entry, indexed by the measured quantity (Channels_Id), gives the
+ *  ADC module whose sample sequencer converts it and its analog input.  Voltages go to ADC0 and
+ *  currents to ADC1, so the voltage and current of a phase are converted
+ *  by the two modules on the same timer trigger.  Channels of one module
+ *  are converted back to back in table order.
+ *
+ *  Acquisition stores every frame interleaved per ADC module, as the uDMA
+ *  delivers it; the ingest stage de-interleaves it into one contiguous,
+ *  32-bit aligned q15 frame per channel (structure of arrays) so each
+ *  channel is transformed on contiguous memory.
+ */
+#ifndef CHANNELS_H_
+#define CHANNELS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Number of ADC modules, each with one sample sequencer in use
+ */
+#define Channels_NUM_ADCS       (2)
+
+/*!
+ *  @brief  Steps of sample sequencer 0, the most channels per ADC module
+ */
+#define Channels_MAX_PER_ADC    (8)
+
+/*!
+ *  @brief  Measured channels, in table order
+ */
+typedef enum {
+    Channels_VA = 0,        /*!< Phase A voltage */
+    Channels_VB,            /*!< Phase B voltage */
+    Channels_VC,            /*!< Phase C voltage */
+    Channels_IA,            /*!< Phase A current */
+    Channels_IB,            /*!< Phase B current */
+    Channels_IC,            /*!< Phase C current */
+    Channels_IN,            /*!< Neutral current */
+    Channels_COUNT
+} Channels_Id;
+
+/*!
+ *  @brief  Channel configuration
+ */
+typedef struct {
+    uint_least8_t adc;      /*!< ADC module, 0 or 1 */
+    uint_least8_t ain;      /*!< Analog input AINn */
+} Channels_Config;
+
+/*!
+ *  @brief  Board channel table, indexed by Channels_Id
+ */
+extern const Channels_Config Channels_config[Channels_COUNT];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHANNELS_H_ */
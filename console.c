@@ -0,0 +1,354 @@
+/*
+ *  ======== console.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "console.h"
+#include "uartstdio.h"
+
+/* Names of the windows, in Window_Type order */
+static const char *const windowNames[Window_COUNT] = {
+    "rect", "hann", "flattop", "bh"
+};
+
+/*
+ *  ======== nextToken ========
+ *  Split off the next word; spaces and commas separate words.
+ */
+static char *nextToken(char **cursor)
+{
+    char *p = *cursor;
+    char *token;
+
+    while ((*p == ' ') || (*p == ',') || (*p == '\t')) {
+        p++;
+    }
+    if (*p == '\0') {
+        *cursor = p;
+        return (NULL);
+    }
+
+    token = p;
+    while ((*p != '\0') && (*p != ' ') && (*p != ',') && (*p != '\t')) {
+        p++;
+    }
+    if (*p != '\0') {
+        *p++ = '\0';
+    }
+    *cursor = p;
+
+    return (token);
+}
+
+/*
+ *  ======== parseNumber ========
+ *  Decimal number of up to five digits, ended by the end of the token or
+ *  by @p end.
+ */
+static bool parseNumber(const char **text, char end, uint32_t *value)
+{
+    const char *p = *text;
+    uint32_t n = 0;
+
+    if ((*p < '0') || (*p > '9')) {
+        return (false);
+    }
+    while ((*p >= '0') && (*p <= '9')) {
+        n = (n * 10U) + (uint32_t)(*p++ - '0');
+        if (n > 99999U) {
+            return (false);
+        }
+    }
+    if ((*p != '\0') && (*p != end)) {
+        return (false);
+    }
+
+    *text = p;
+    *value = n;
+
+    return (true);
+}
+
+/*
+ *  ======== parseValue ========
+ */
+static bool parseValue(const char *token, uint32_t *value)
+{
+    return ((token != NULL) && parseNumber(&token, '\0', value));
+}
+
+/*
+ *  ======== parseOrders ========
+ *  Single orders and ranges like 3-9, in the order given.
+ */
+static bool parseOrders(char *cursor, Analysis_Config *config)
+{
+    const char *token;
+    uint32_t first;
+    uint32_t last;
+    uint_least8_t n = 0;
+
+    while ((token = nextToken(&cursor)) != NULL) {
+        if (!parseNumber(&token, '-', &first)) {
+            return (false);
+        }
+        last = first;
+        if (*token == '-') {
+            token++;
+            if (!parseNumber(&token, '\0', &last) || (last < first)) {
+                return (false);
+            }
+        }
+        if ((first == 0) || (last > UINT8_MAX) ||
+            ((last - first) >= (uint32_t)(Analysis_MAX_HARMONICS - n))) {
+            return (false);
+        }
+        while (first <= last) {
+            config->orders[n++] = (uint8_t)first++;
+        }
+    }
+
+    config->numHarmonics = n;
+
+    return (n != 0);
+}
+
+/*
+ *  ======== gcd ========
+ */
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    uint32_t t;
+
+    while (b != 0) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+
+    return (a);
+}
+
+/*
+ *  ======== printConfig ========
+ *  One line per configuration: the window and what it gives.
+ */
+static void printConfig(const Console_Object *obj, const char *label,
+                        const Analysis_Config *config)
+{
+    const Analysis_Object *analysis = obj->analysis;
+    uint32_t decimation = ((uint32_t)analysis->samplesPerCycle *
+                           config->cycles) / config->fftLen;
+    float32_t rate = (float32_t)analysis->sampleRate / (float32_t)decimation;
+    uint_least8_t reported = 0;
+    uint_least8_t i;
+
+    UARTprintf("%s: fft %u, %u cycles, %s, %.1f ms, %.2f Hz bins, "
+               "%u Hz after /%u, harmonics", label, config->fftLen,
+               config->cycles, windowNames[config->window],
+               (double)(1000.0f * (float32_t)config->fftLen / rate),
+               (double)(rate / (float32_t)config->fftLen),
+               (uint32_t)(rate + 0.5f), decimation);
+    for (i = 0; i < config->numHarmonics; i++) {
+        UARTprintf(" %u", config->orders[i]);
+        if (((uint32_t)config->orders[i] * config->cycles) <
+            (config->fftLen / 2U)) {
+            reported++;
+        }
+    }
+    if (reported < config->numHarmonics) {
+        UARTprintf(" (%u below Nyquist)", reported);
+    }
+    UARTprintf("\n");
+}
+
+/*
+ *  ======== printHelp ========
+ */
+static void printHelp(void)
+{
+    UARTprintf("fft <%u-%u> [cycles], cycles <n>, "
+               "window rect|hann|flattop|bh,\n"
+               "harmonics <orders, a-b for a range>, show, help\n",
+               Analysis_MIN_LEN, Analysis_MAX_LEN);
+}
+
+/*
+ *  ======== reject ========
+ *  Say why a staged configuration was refused.
+ */
+static void reject(const Console_Object *obj, const Analysis_Config *config,
+                   int_fast16_t status)
+{
+    uint32_t span;
+
+    switch (status) {
+        case Analysis_STATUS_BAD_LENGTH:
+            UARTprintf("error: fft must be a power of two, %u to %u\n",
+                       Analysis_MIN_LEN, Analysis_MAX_LEN);
+            break;
+
+        case Analysis_STATUS_BAD_CYCLES:
+            span = config->fftLen / gcd(obj->analysis->samplesPerCycle,
+                                        config->fftLen);
+            UARTprintf("error: fft %u takes %u, %u, %u... cycles\n",
+                       config->fftLen, span, 2U * span, 3U * span);
+            break;
+
+        case Analysis_STATUS_TRIGGERED:
+            UARTprintf("error: triggered frames take 1 cycle\n");
+            break;
+
+        case Analysis_STATUS_BAD_WINDOW:
+            UARTprintf("error: no %s window for fft %u\n",
+                       (config->window < Window_COUNT) ?
+                       windowNames[config->window] : "such",
+                       config->fftLen);
+            break;
+
+        default:
+            UARTprintf("error: harmonics are 1 to %u orders from 1 to 255\n",
+                       Analysis_MAX_HARMONICS);
+            break;
+    }
+}
+
+/*
+ *  ======== Console_init ========
+ */
+void Console_init(Console_Object *obj, Analysis_Object *analysis)
+{
+    obj->analysis = analysis;
+    obj->staged = analysis->config;
+    obj->pending = false;
+    obj->line[0] = '\0';
+}
+
+#if defined(UART_BUFFERED)
+/*
+ *  ======== Console_poll ========
+ */
+bool Console_poll(Console_Object *obj)
+{
+    if (UARTPeek('\r') < 0) {
+        return (false);
+    }
+
+    UARTgets(obj->line, sizeof(obj->line));
+    Console_execute(obj, obj->line);
+
+    return (true);
+}
+#endif
+
+/*
+ *  ======== Console_execute ========
+ *  Commands work on a copy of the staged configuration, which replaces it
+ *  only if the result passes Analysis_check().
+ */
+void Console_execute(Console_Object *obj, char *line)
+{
+    Analysis_Config config = obj->staged;
+    const char *command = nextToken(&line);
+    const char *arg;
+    int_fast16_t status;
+    uint32_t value;
+    uint_least8_t i;
+
+    if (command == NULL) {
+        return;
+    }
+
+    if (strcmp(command, "help") == 0) {
+        printHelp();
+        return;
+    }
+
+    if (strcmp(command, "show") == 0) {
+        printConfig(obj, "active", &obj->analysis->config);
+        if (obj->pending) {
+            printConfig(obj, "staged", &obj->staged);
+        }
+        return;
+    }
+
+    if (strcmp(command, "fft") == 0) {
+        if (!parseValue(nextToken(&line), &value) || (value > UINT16_MAX)) {
+            reject(obj, &config, Analysis_STATUS_BAD_LENGTH);
+            return;
+        }
+        config.fftLen = (uint16_t)value;
+        arg = nextToken(&line);
+        if (arg != NULL) {
+            if (!parseValue(arg, &value) || (value == 0) ||
+                (value > UINT16_MAX)) {
+                reject(obj, &config, Analysis_STATUS_BAD_CYCLES);
+                return;
+            }
+            config.cycles = (uint16_t)value;
+        }
+    }
+    else if (strcmp(command, "cycles") == 0) {
+        if (!parseValue(nextToken(&line), &value) || (value == 0) ||
+            (value > UINT16_MAX)) {
+            reject(obj, &config, Analysis_STATUS_BAD_CYCLES);
+            return;
+        }
+        config.cycles = (uint16_t)value;
+    }
+    else if (strcmp(command, "window") == 0) {
+        arg = nextToken(&line);
+        config.window = Window_COUNT;
+        for (i = 0; (arg != NULL) && (i < Window_COUNT); i++) {
+            if (strcmp(arg, windowNames[i]) == 0) {
+                config.window = (Window_Type)i;
+            }
+        }
+    }
+    else if (strcmp(command, "harmonics") == 0) {
+        if (!parseOrders(line, &config)) {
+            reject(obj, &config, Analysis_STATUS_BAD_ORDER);
+            return;
+        }
+    }
+    else {
+        UARTprintf("error: unknown command %s, try help\n", command);
+        return;
+    }
+
+    status = Analysis_check(obj->analysis, &config);
+    if (status != Analysis_STATUS_SUCCESS) {
+        reject(obj, &config, status);
+        return;
+    }
+
+    /* Harmonics are cycles bins apart; a window that spreads each one as
+     * far as the next mixes them */
+    if (config.cycles <= Window_spread(config.window)) {
+        UARTprintf("error: %s needs more than %u cycles\n",
+                   windowNames[config.window], Window_spread(config.window));
+        return;
+    }
+
+    obj->staged = config;
+    obj->pending = true;
+    printConfig(obj, "next frame", &config);
+}
+
+/*
+ *  ======== Console_take ========
+ */
+bool Console_take(Console_Object *obj, Analysis_Config *config)
+{
+    if (!obj->pending) {
+        return (false);
+    }
+
+    *config = obj->staged;
+    obj->pending = false;
+
+    return (true);
+}
@@ -0,0 +1,98 @@
+/*
+ *  ======== console.h ========
+ *  Command interpreter for the analysis settings.
+ *
+ *  Reads command lines with UARTgets() and changes the analysis window and
+ *  the reported harmonics (analysis.h) without a rebuild:
+ *
+ *      fft <length> [cycles]   FFT length, 64 to 4096, and optionally the
+ *                              fundamental cycles per window with it
+ *      cycles <n>              fundamental cycles per window
+ *      window <name>           rect, hann, flattop or bh
+ *      harmonics <list>        orders to report, e.g. "1-13,15 17 19";
+ *                              up to Analysis_MAX_HARMONICS
+ *      show                    active and staged settings
+ *      help                    this list
+ *
+ *  Each command is checked against Analysis_check(), and a window must
+ *  leave the harmonics apart (Window_spread()), so Hann needs 2 cycles,
+ *  Blackman-Harris 4 and flat top 5.  A command that passes stages a new
+ *  configuration; one that fails leaves the staged one as it was and
+ *  says why.  The measurement loop picks the staged configuration up with
+ *  Console_take() at the next frame boundary, so the acquisition runs on
+ *  undisturbed.  Settings that are only valid together, such as a long
+ *  FFT and the cycles it needs, can be given in one fft command.
+ *
+ *  Replies are text on the console UART, between the binary telemetry
+ *  frames, which the decoders skip.  Console_poll() needs the buffered
+ *  UART (UART_BUFFERED), whose UARTPeek() tells whether a whole line is
+ *  waiting, so it never blocks; Console_execute() runs a line from
+ *  anywhere.
+ */
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "analysis.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Longest command line, including the terminating zero
+ */
+#define Console_LINE_LEN        (80)
+
+/*!
+ *  @brief  Console state
+ */
+typedef struct {
+    Analysis_Object *analysis;      /*!< Analysis the settings apply to */
+    Analysis_Config  staged;        /*!< Configuration to apply next */
+    bool             pending;       /*!< staged differs from the active one */
+    char             line[Console_LINE_LEN];    /*!< Line being run */
+} Console_Object;
+
+/*!
+ *  @brief  Initialize the console with the active configuration staged.
+ *
+ *  @param  obj       Console object to initialize
+ *  @param  analysis  Configured analysis object
+ */
+extern void Console_init(Console_Object *obj, Analysis_Object *analysis);
+
+#if defined(UART_BUFFERED)
+/*!
+ *  @brief  Run the next command line if a whole one has been received.
+ *
+ *  @return true if a line was run
+ */
+extern bool Console_poll(Console_Object *obj);
+#endif
+
+/*!
+ *  @brief  Run one command line.
+ *
+ *  @param  obj   Initialized console object
+ *  @param  line  Zero-terminated command; modified while it is parsed
+ */
+extern void Console_execute(Console_Object *obj, char *line);
+
+/*!
+ *  @brief  Take the staged configuration, if there is a new one.
+ *
+ *  Call between frames, from the same context as Console_poll(), and pass
+ *  the result to Analysis_configure().
+ *
+ *  @return true if @p config was filled in
+ */
+extern bool Console_take(Console_Object *obj, Analysis_Config *config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONSOLE_H_ */
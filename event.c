@@ -0,0 +1,226 @@
+/*
+ *  ======== event.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if !defined(HOST_BUILD)
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "event.h"
+#include "profile.h"
+
+/*
+ *  ======== lock ========
+ *  Mask interrupts with PRIMASK.  WFI still wakes on an interrupt masked
+ *  this way, which BASEPRI masking would hold off, so the check for
+ *  pending events and the sleep cannot miss a post between them.
+ */
+static inline uint32_t lock(Event_Object *obj)
+{
+#if defined(HOST_BUILD)
+    pthread_mutex_lock(&obj->lock);
+
+    return (0);
+#else
+    uint32_t key = __get_PRIMASK();
+
+    (void)obj;
+    __disable_irq();
+
+    return (key);
+#endif
+}
+
+/*
+ *  ======== unlock ========
+ */
+static inline void unlock(Event_Object *obj, uint32_t key)
+{
+#if defined(HOST_BUILD)
+    (void)key;
+    pthread_mutex_unlock(&obj->lock);
+#else
+    (void)obj;
+    __set_PRIMASK(key);
+#endif
+}
+
+/*
+ *  ======== lowestBit ========
+ */
+static inline uint_least8_t lowestBit(uint32_t bits)
+{
+#if defined(HOST_BUILD)
+    return ((uint_least8_t)__builtin_ctz(bits));
+#else
+    return ((uint_least8_t)__CLZ(__RBIT(bits)));
+#endif
+}
+
+/*
+ *  ======== Event_init ========
+ */
+void Event_init(Event_Object *obj)
+{
+    uint_least8_t i;
+
+    obj->pending = 0;
+    obj->busy = 0;
+    obj->sleeps = 0;
+
+    for (i = 0; i < Event_COUNT; i++) {
+        obj->events[i].fxn = NULL;
+        obj->events[i].arg = NULL;
+        obj->events[i].posted = 0;
+        obj->events[i].posts = 0;
+        obj->events[i].runs = 0;
+        obj->events[i].maxLatency = 0;
+        obj->events[i].maxRun = 0;
+    }
+
+#if defined(HOST_BUILD)
+    pthread_mutex_init(&obj->lock, NULL);
+    pthread_cond_init(&obj->posted, NULL);
+#endif
+
+    Profile_startCounter();
+    obj->wake = Profile_now();
+}
+
+/*
+ *  ======== Event_register ========
+ */
+int_fast16_t Event_register(Event_Object *obj, uint_least8_t event,
+                            Event_HandlerFxn fxn, void *arg)
+{
+    if ((event >= Event_COUNT) || (fxn == NULL)) {
+        return (Event_STATUS_ERROR);
+    }
+
+    obj->events[event].fxn = fxn;
+    obj->events[event].arg = arg;
+
+    return (Event_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Event_post ========
+ *  Latency is measured from the first post, the one that found the event
+ *  idle.
+ */
+void Event_post(Event_Object *obj, uint_least8_t event)
+{
+    uint32_t bit = 1UL << event;
+    uint32_t key;
+
+    key = lock(obj);
+    if ((obj->pending & bit) == 0) {
+        obj->events[event].posted = Profile_now();
+        obj->pending |= bit;
+#if defined(HOST_BUILD)
+        pthread_cond_signal(&obj->posted);
+#endif
+    }
+    obj->events[event].posts++;
+    unlock(obj, key);
+}
+
+/*
+ *  ======== Event_dispatch ========
+ *  The bit is cleared before the handler runs, so a post during the
+ *  handler runs it again.
+ */
+bool Event_dispatch(Event_Object *obj)
+{
+    Event_Handler *e;
+    uint32_t key;
+    uint32_t start;
+    uint32_t posted;
+    uint32_t run;
+    uint_least8_t event;
+
+    key = lock(obj);
+    if (obj->pending == 0) {
+        unlock(obj, key);
+        return (false);
+    }
+    event = lowestBit(obj->pending);
+    obj->pending &= ~(1UL << event);
+    e = &obj->events[event];
+    posted = e->posted;
+    unlock(obj, key);
+
+    start = Profile_now();
+    if ((start - posted) > e->maxLatency) {
+        e->maxLatency = start - posted;
+    }
+
+    if (e->fxn != NULL) {
+        e->fxn(e->arg);
+    }
+
+    run = Profile_now() - start;
+    if (run > e->maxRun) {
+        e->maxRun = run;
+    }
+    e->runs++;
+
+    return (true);
+}
+
+/*
+ *  ======== Event_wait ========
+ *  On the target the interrupt that ends WFI runs once PRIMASK is
+ *  restored, after the wake-up time has been taken, so its time counts as
+ *  busy.
+ */
+void Event_wait(Event_Object *obj)
+{
+    uint32_t key;
+
+    key = lock(obj);
+    if (obj->pending == 0) {
+        obj->busy += Profile_now() - obj->wake;
+        obj->sleeps++;
+#if defined(HOST_BUILD)
+        while (obj->pending == 0) {
+            pthread_cond_wait(&obj->posted, &obj->lock);
+        }
+#else
+        __WFI();
+#endif
+        obj->wake = Profile_now();
+    }
+    unlock(obj, key);
+}
+
+/*
+ *  ======== Event_run ========
+ */
+void Event_run(Event_Object *obj)
+{
+    while (1) {
+        if (!Event_dispatch(obj)) {
+            Event_wait(obj);
+        }
+    }
+}
+
+/*
+ *  ======== Event_takeBusy ========
+ *  Called from a handler, so the loop is awake: the time since the last
+ *  wake-up is added first.
+ */
+uint32_t Event_takeBusy(Event_Object *obj)
+{
+    uint32_t now = Profile_now();
+    uint32_t busy = obj->busy + (now - obj->wake);
+
+    obj->busy = 0;
+    obj->wake = now;
+
+    return (busy);
+}
@@ -0,0 +1,143 @@
+/*
+ *  ======== event.h ========
+ *  Event-driven main loop.
+ *
+ *  Interrupt handlers post events with Event_post(); the main loop runs
+ *  the handler of each pending event to completion, one at a time, and
+ *  sleeps with WFI when nothing is pending.  An event is one bit of a
+ *  pending word and its number is its priority: Event_dispatch() always
+ *  runs the lowest-numbered pending event next.  Handlers are not
+ *  preempted by other handlers, only by interrupts, so an event waits at
+ *  most for the longest handler to finish: long work is split into steps
+ *  that re-post their own event, which lets more urgent events in between
+ *  the steps.
+ *
+ *  Posting an event that is already pending does nothing more, so a
+ *  handler must finish all the work its event stands for (all waiting
+ *  lines, say), not one item per post.
+ *
+ *  The loop counts the ticks it spends awake (Profile_now()), which
+ *  Event_takeBusy() returns.  The cycle counter does not run while the
+ *  core sleeps, so idle time is the elapsed time, known from a clock that
+ *  keeps running such as the frame count, less the busy time.  Each event
+ *  also keeps its posts, runs, longest handler and longest latency from
+ *  the first post to the start of its handler.
+ *
+ *  Building with HOST_BUILD replaces WFI with a condition variable, so
+ *  events can be posted from threads standing in for the interrupts.
+ */
+#ifndef EVENT_H_
+#define EVENT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(HOST_BUILD)
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Event functions.
+ */
+#define Event_STATUS_SUCCESS    (0)
+
+/*!
+ *  @brief  Returned for an invalid event or handler.
+ */
+#define Event_STATUS_ERROR      (-1)
+
+/*!
+ *  @brief  Number of events; event 0 has the highest priority
+ */
+#define Event_COUNT             (32)
+
+/*!
+ *  @brief  Run-to-completion event handler.
+ *
+ *  @param  arg     Argument given to Event_register()
+ */
+typedef void (*Event_HandlerFxn)(void *arg);
+
+/*!
+ *  @brief  One event
+ */
+typedef struct {
+    Event_HandlerFxn fxn;           /*!< Handler, or NULL */
+    void            *arg;           /*!< Handler argument */
+    uint32_t         posted;        /*!< Tick of the first pending post */
+    uint32_t         posts;         /*!< Calls to Event_post() */
+    uint32_t         runs;          /*!< Handler runs */
+    uint32_t         maxLatency;    /*!< Longest first post to run, ticks */
+    uint32_t         maxRun;        /*!< Longest handler, ticks */
+} Event_Handler;
+
+/*!
+ *  @brief  Event loop state
+ */
+typedef struct {
+    volatile uint32_t pending;      /*!< One bit per posted event */
+    uint32_t          busy;         /*!< Ticks awake since Event_takeBusy() */
+    uint32_t          wake;         /*!< Tick of the last wake-up */
+    uint32_t          sleeps;       /*!< Times the loop went to sleep */
+    Event_Handler     events[Event_COUNT];
+#if defined(HOST_BUILD)
+    pthread_mutex_t   lock;         /*!< Stand-in for masked interrupts */
+    pthread_cond_t    posted;       /*!< Stand-in for WFI */
+#endif
+} Event_Object;
+
+/*!
+ *  @brief  Initialize an event loop with no handlers.
+ */
+extern void Event_init(Event_Object *obj);
+
+/*!
+ *  @brief  Set the handler of an event.
+ *
+ *  @param  obj     Initialized event loop
+ *  @param  event   Event number, its priority; below Event_COUNT
+ *  @param  fxn     Handler
+ *  @param  arg     Argument passed to @p fxn
+ *
+ *  @return Event_STATUS_SUCCESS or Event_STATUS_ERROR
+ */
+extern int_fast16_t Event_register(Event_Object *obj, uint_least8_t event,
+                                   Event_HandlerFxn fxn, void *arg);
+
+/*!
+ *  @brief  Mark an event pending.  May be called from interrupts and from
+ *          handlers, including the event's own.
+ */
+extern void Event_post(Event_Object *obj, uint_least8_t event);
+
+/*!
+ *  @brief  Run the handler of the highest-priority pending event.
+ *
+ *  @return false if no event was pending
+ */
+extern bool Event_dispatch(Event_Object *obj);
+
+/*!
+ *  @brief  Sleep until an event is pending.  Returns at once if one is.
+ */
+extern void Event_wait(Event_Object *obj);
+
+/*!
+ *  @brief  Dispatch events forever, sleeping whenever none is pending.
+ */
+extern void Event_run(Event_Object *obj);
+
+/*!
+ *  @brief  Ticks spent awake since the previous call.
+ */
+extern uint32_t Event_takeBusy(Event_Object *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_H_ */
@@ -0,0 +1,159 @@
+/*
+ *  ======== frequency.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if !defined(HOST_BUILD)
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "frequency.h"
+
+/*
+ *  ======== relock ========
+ */
+static void relock(Frequency_Object *obj)
+{
+    obj->count = 0;
+    obj->head = 0;
+    obj->misses = 0;
+    obj->sum = 0;
+    obj->microHertz = 0;
+}
+
+#if !defined(HOST_BUILD)
+/*
+ *  ======== captureHwiFxn ========
+ *  In edge-time mode the timer register holds the count latched at the
+ *  edge, with the prescaler extension in bits 23:16.
+ */
+static void captureHwiFxn(uintptr_t arg)
+{
+    MAP_TimerIntClear(TIMER2_BASE, TIMER_CAPA_EVENT);
+    Frequency_capture((Frequency_Object *)arg,
+                      MAP_TimerValueGet(TIMER2_BASE, TIMER_A));
+}
+#endif
+
+/*
+ *  ======== Frequency_init ========
+ */
+int_fast16_t Frequency_init(Frequency_Object *obj, uint_least8_t numCycles,
+                            uint32_t systemClock)
+{
+#if !defined(HOST_BUILD)
+    HwiP_Params hwiParams;
+#endif
+
+    if ((obj == NULL) || (numCycles == 0) ||
+        (numCycles > Frequency_MAX_CYCLES) ||
+        ((systemClock / Frequency_MIN_HZ) > Frequency_CAPTURE_MASK)) {
+        return (Frequency_STATUS_ERROR);
+    }
+
+    obj->tickRate = systemClock;
+    obj->minPeriod = systemClock / Frequency_MAX_HZ;
+    obj->maxPeriod = systemClock / Frequency_MIN_HZ;
+    obj->numCycles = numCycles;
+    obj->started = false;
+    obj->last = 0;
+    obj->updates = 0;
+    obj->edges = 0;
+    obj->ignored = 0;
+    obj->dropped = 0;
+    obj->relocks = 0;
+    relock(obj);
+
+#if !defined(HOST_BUILD)
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER2);
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOM);
+    while (!MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER2) ||
+           !MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_GPIOM)) {
+    }
+
+    MAP_GPIOPinConfigure(GPIO_PM0_T2CCP0);
+    MAP_GPIOPinTypeTimer(GPIO_PORTM_BASE, GPIO_PIN_0);
+
+    /* Count up through the full 24 bits, latching on rising edges */
+    MAP_TimerConfigure(TIMER2_BASE,
+                       TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_CAP_TIME_UP);
+    MAP_TimerControlEvent(TIMER2_BASE, TIMER_A, TIMER_EVENT_POS_EDGE);
+    MAP_TimerLoadSet(TIMER2_BASE, TIMER_A, 0xFFFFU);
+    MAP_TimerPrescaleSet(TIMER2_BASE, TIMER_A, 0xFFU);
+    MAP_TimerIntClear(TIMER2_BASE, TIMER_CAPA_EVENT);
+    MAP_TimerIntEnable(TIMER2_BASE, TIMER_CAPA_EVENT);
+
+    HwiP_Params_init(&hwiParams);
+    hwiParams.arg = (uintptr_t)obj;
+    if (HwiP_construct(&obj->hwi, INT_TIMER2A, captureHwiFxn,
+                       &hwiParams) == NULL) {
+        return (Frequency_STATUS_ERROR);
+    }
+
+    MAP_TimerEnable(TIMER2_BASE, TIMER_A);
+#endif
+
+    return (Frequency_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Frequency_capture ========
+ *  The window is a ring of periods rather than of edge times, so the
+ *  periods dropped in between do not count towards the average.  The sum
+ *  of Frequency_MAX_CYCLES periods at Frequency_MIN_HZ fits in 32 bits.
+ */
+void Frequency_capture(Frequency_Object *obj, uint32_t timestamp)
+{
+    uint32_t period = (timestamp - obj->last) & Frequency_CAPTURE_MASK;
+    uint32_t low = obj->minPeriod;
+    uint32_t high = obj->maxPeriod;
+    uint32_t average;
+
+    obj->edges++;
+
+    if (!obj->started) {
+        obj->started = true;
+        obj->last = timestamp;
+        return;
+    }
+
+    if (obj->count != 0) {
+        average = obj->sum / obj->count;
+        low = average - (average >> Frequency_TOLERANCE_SHIFT);
+        high = average + (average >> Frequency_TOLERANCE_SHIFT);
+    }
+
+    if (period < low) {
+        obj->ignored++;
+        return;
+    }
+
+    obj->last = timestamp;
+
+    if (period > high) {
+        obj->dropped++;
+        if (++obj->misses == Frequency_RELOCK_MISSES) {
+            relock(obj);
+            obj->relocks++;
+        }
+        return;
+    }
+
+    obj->misses = 0;
+    if (obj->count == obj->numCycles) {
+        obj->sum -= obj->periods[obj->head];
+    }
+    else {
+        obj->count++;
+    }
+    obj->periods[obj->head] = period;
+    obj->sum += period;
+    obj->head = (obj->head + 1U == obj->numCycles) ? 0 : (obj->head + 1U);
+
+    /* One aligned word, so a reader never sees half of an update */
+    obj->microHertz = (uint32_t)(((uint64_t)obj->tickRate * obj->count *
+                                  1000000U) / obj->sum);
+    obj->updates++;
+}
@@ -0,0 +1,155 @@
+/*
+ *  ======== frequency.h ========
+ *  Mains frequency meter on timer input capture.
+ *
+ *  The comparator on the fundamental that drives the zero-crossing trigger
+ *  (trigger.h) also drives T2CCP0 (PM0).  Timer 2A runs in edge-time mode
+ *  at the system clock and latches the count on every rising edge, so the
+ *  edge times do not depend on interrupt latency.  With the prescaler as
+ *  an extension the count is 24 bits wide and wraps every 139.8 ms at
+ *  120 MHz, well over a mains period.  One short interrupt per cycle
+ *  passes the captured count to Frequency_capture().
+ *
+ *  Frequency_capture() takes the period from the last edge and rejects
+ *  outliers against the average so far, within 1 / 2^Frequency_TOLERANCE_SHIFT
+ *  of it, or within Frequency_MIN_HZ to Frequency_MAX_HZ while the window
+ *  is empty:
+ *
+ *  short   chatter or an impulse before the real edge; the edge is
+ *          ignored and the next one is still measured from the last good
+ *          one
+ *  long    a missed edge, or an edge after an ignored one; the period is
+ *          dropped and the edge starts the next one
+ *
+ *  The window keeps the last numCycles accepted periods.  The average over
+ *  them is published as one 32-bit word in microhertz, and any stage reads
+ *  it with Frequency_get() without a lock.  At 120 MHz one tick is
+ *  21 uHz of a single 50 Hz period, and a window of N periods divides
+ *  that by N.  Comparator jitter is averaged down in the same way.  After
+ *  Frequency_RELOCK_MISSES long periods in a row, for example after a
+ *  step beyond the tolerance, the window is emptied and the meter locks
+ *  again on the wide range.  The published value is 0 until the first
+ *  period is accepted, and again after a relock, and it is held when edges
+ *  stop.
+ *
+ *  Building with HOST_BUILD leaves out the timer, and a stand-in calls
+ *  Frequency_capture() with 24-bit timestamps of its own; see
+ *  tools/frequency_sim.c.
+ */
+#ifndef FREQUENCY_H_
+#define FREQUENCY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if !defined(HOST_BUILD)
+#include <ti/drivers/dpl/HwiP.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Frequency_init().
+ */
+#define Frequency_STATUS_SUCCESS    (0)
+
+/*!
+ *  @brief  Returned by Frequency_init() for an invalid configuration.
+ */
+#define Frequency_STATUS_ERROR      (-1)
+
+/*!
+ *  @brief  Longest averaging window, in periods
+ */
+#define Frequency_MAX_CYCLES        (64)
+
+/*!
+ *  @brief  Captured counts wrap at this mask plus one
+ */
+#define Frequency_CAPTURE_MASK      (0x00FFFFFFU)
+
+/*!
+ *  @brief  Range the meter locks on from an empty window, in Hz
+ */
+#define Frequency_MIN_HZ            (40U)
+#define Frequency_MAX_HZ            (70U)
+
+/*!
+ *  @brief  A period is an outlier beyond 1 / 2^shift of the average
+ *          (about 3%)
+ */
+#define Frequency_TOLERANCE_SHIFT   (5)
+
+/*!
+ *  @brief  Long periods in a row that empty the window
+ */
+#define Frequency_RELOCK_MISSES     (8)
+
+/*!
+ *  @brief  Meter state
+ */
+typedef struct {
+    uint32_t          tickRate;     /*!< Capture ticks per second */
+    uint32_t          minPeriod;    /*!< Ticks at Frequency_MAX_HZ */
+    uint32_t          maxPeriod;    /*!< Ticks at Frequency_MIN_HZ */
+    uint_least8_t     numCycles;    /*!< Periods in a full window */
+    uint_least8_t     count;        /*!< Periods in the window */
+    uint_least8_t     head;         /*!< Next slot of periods */
+    uint_least8_t     misses;       /*!< Long periods in a row */
+    bool              started;      /*!< last holds an edge */
+    uint32_t          last;         /*!< Count at the last good edge */
+    uint32_t          sum;          /*!< Ticks of the periods */
+    uint32_t          periods[Frequency_MAX_CYCLES];
+    volatile uint32_t microHertz;   /*!< Published average, 0 unlocked */
+    volatile uint32_t updates;      /*!< Publications so far */
+    uint32_t          edges;        /*!< Edges captured */
+    uint32_t          ignored;      /*!< Short periods */
+    uint32_t          dropped;      /*!< Long periods */
+    uint32_t          relocks;      /*!< Windows emptied */
+#if !defined(HOST_BUILD)
+    HwiP_Struct       hwi;          /*!< Capture interrupt */
+#endif
+} Frequency_Object;
+
+/*!
+ *  @brief  Set up the meter and start capturing.
+ *
+ *  @param  obj          Meter object to initialize
+ *  @param  numCycles    Periods averaged, 1 to Frequency_MAX_CYCLES
+ *  @param  systemClock  System clock in Hz, the capture clock; on the host
+ *                       the rate of the stand-in's timestamps
+ *
+ *  @return Frequency_STATUS_SUCCESS, or Frequency_STATUS_ERROR for an
+ *          invalid configuration or if the interrupt cannot be created
+ */
+extern int_fast16_t Frequency_init(Frequency_Object *obj,
+                                   uint_least8_t numCycles,
+                                   uint32_t systemClock);
+
+/*!
+ *  @brief  Take the count captured at an edge.
+ *
+ *  Called from the capture interrupt, or by the host stand-in.
+ *
+ *  @param  obj         Meter object
+ *  @param  timestamp   Captured count; only the bits of
+ *                      Frequency_CAPTURE_MASK are used
+ */
+extern void Frequency_capture(Frequency_Object *obj, uint32_t timestamp);
+
+/*!
+ *  @brief  Average frequency over the window in microhertz, or 0 while
+ *          unlocked.  Safe to call from any context.
+ */
+static inline uint32_t Frequency_get(const Frequency_Object *obj)
+{
+    return (obj->microHertz);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FREQUENCY_H_ */
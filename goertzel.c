@@ -0,0 +1,236 @@
+/*
+ *  ======== goertzel.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "goertzel.h"
+
+#if (PRECISION != PRECISION_F32)
+/* Left shift that brings an input sample to q31 */
+#if (PRECISION == PRECISION_Q31)
+#define INPUT_SHIFT     0
+#else
+#define INPUT_SHIFT     16
+#endif
+
+/*
+ *  ======== toFixed ========
+ *  Round a value in [-1, 1] (or [-2, 2] for Q30) to a saturated fixed-point
+ *  value with the given number of fractional bits.
+ */
+static q31_t toFixed(double value, uint_least8_t fracBits)
+{
+    double scaled = value * (double)(1UL << fracBits);
+
+    if (scaled >= 2147483647.0) {
+        return (INT32_MAX);
+    }
+    if (scaled <= -2147483648.0) {
+        return (INT32_MIN);
+    }
+
+    return ((q31_t)floor(scaled + 0.5));
+}
+
+/*
+ *  ======== saturate ========
+ */
+static q31_t saturate(int64_t value)
+{
+    if (value > INT32_MAX) {
+        return (INT32_MAX);
+    }
+    if (value < INT32_MIN) {
+        return (INT32_MIN);
+    }
+
+    return ((q31_t)value);
+}
+#endif
+
+/*
+ *  ======== Goertzel_init ========
+ */
+int_fast16_t Goertzel_init(Goertzel_Object *obj, uint16_t fftLen,
+                           const uint16_t *bins, uint_least8_t numBins)
+{
+    uint_least8_t i;
+    uint_least8_t log2Len;
+    double w;
+#if (PRECISION != PRECISION_F32)
+    double growth;
+#endif
+
+    if ((obj == NULL) || (bins == NULL) || (numBins == 0) ||
+        (numBins > Goertzel_MAX_BINS)) {
+        return (Goertzel_STATUS_ERROR);
+    }
+
+    if ((fftLen < 16) || (fftLen > 4096) || ((fftLen & (fftLen - 1)) != 0)) {
+        return (Goertzel_STATUS_ERROR);
+    }
+
+    for (log2Len = 0; (1U << log2Len) < fftLen; log2Len++) {
+    }
+
+    for (i = 0; i < numBins; i++) {
+        if ((bins[i] == 0) || (bins[i] >= (fftLen / 2))) {
+            return (Goertzel_STATUS_ERROR);
+        }
+
+        w = 2.0 * PI * (double)bins[i] / (double)fftLen;
+
+        obj->bins[i] = bins[i];
+#if (PRECISION == PRECISION_F32)
+        obj->coeff[i] = (float32_t)(2.0 * cos(w));
+        obj->cosW[i] = (float32_t)cos(w);
+        obj->sinW[i] = (float32_t)sin(w);
+#else
+        obj->coeff[i] = toFixed(2.0 * cos(w), 30);
+        obj->cosW[i] = toFixed(cos(w), 31);
+        obj->sinW[i] = toFixed(sin(w), 31);
+
+        /*
+         * The resonator's impulse response is sin((n + 1)w) / sin(w), so a
+         * full-scale input grows the state by at most
+         * (2N / pi + 1) / sin(w) over one frame.  One guard bit covers the
+         * extra iteration that closes the frame.
+         */
+        growth = ((2.0 * fftLen / PI) + 1.0) / sin(w);
+        obj->headroom[i] = (int_least8_t)ceil(log(growth) / log(2.0)) + 1;
+#endif
+    }
+
+    obj->fftLen = fftLen;
+    obj->log2Len = log2Len;
+    obj->numBins = numBins;
+
+    return (Goertzel_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Goertzel_initHarmonics ========
+ */
+int_fast16_t Goertzel_initHarmonics(Goertzel_Object *obj, uint16_t fftLen,
+                                    uint16_t fundamentalBin,
+                                    uint_least8_t numHarmonics)
+{
+    uint16_t bins[Goertzel_MAX_BINS];
+    uint_least8_t i;
+
+    if ((numHarmonics == 0) || (numHarmonics > Goertzel_MAX_BINS)) {
+        return (Goertzel_STATUS_ERROR);
+    }
+
+    for (i = 0; i < numHarmonics; i++) {
+        bins[i] = (uint16_t)(fundamentalBin * (i + 1U));
+    }
+
+    return (Goertzel_init(obj, fftLen, bins, numHarmonics));
+}
+
+#if (PRECISION == PRECISION_F32)
+/*
+ *  ======== Goertzel_process ========
+ *  Single-precision resonators need no headroom; the result is scaled by
+ *  1 / N once the frame is done.
+ */
+void Goertzel_process(const Goertzel_Object *obj,
+                      const Precision_Sample *frame, Goertzel_Phasor *result)
+{
+    float32_t scale = 1.0f / (float32_t)obj->fftLen;
+    uint_least8_t k;
+    uint32_t n;
+    float32_t coeff;
+    float32_t s0;
+    float32_t s1;
+    float32_t s2;
+
+    for (k = 0; k < obj->numBins; k++) {
+        coeff = obj->coeff[k];
+        s1 = 0.0f;
+        s2 = 0.0f;
+
+        for (n = 0; n < obj->fftLen; n++) {
+            s0 = (coeff * s1) - s2 + frame[n];
+            s2 = s1;
+            s1 = s0;
+        }
+
+        /* One more iteration with zero input gives the exact DFT bin */
+        s0 = (coeff * s1) - s2;
+
+        /* X[k] = s[N] - e^(-jw) * s[N - 1] */
+        result[k].re = (s0 - (obj->cosW[k] * s1)) * scale;
+        result[k].im = (obj->sinW[k] * s1) * scale;
+    }
+}
+#else
+/*
+ *  ======== Goertzel_process ========
+ *  The input is scaled so the resonator state uses the full q31 range
+ *  without overflowing: a q15 sample is shifted by 16 - headroom, a q31
+ *  sample by -headroom.  The result is brought back to X[k] / N by scaling
+ *  with 2^headroom / N.
+ */
+void Goertzel_process(const Goertzel_Object *obj,
+                      const Precision_Sample *frame, Goertzel_Phasor *result)
+{
+    uint_least8_t k;
+    uint32_t n;
+    int_fast8_t shift;
+    q31_t coeff;
+    q31_t s0;
+    q31_t s1;
+    q31_t s2;
+    int64_t re;
+    int64_t im;
+
+    for (k = 0; k < obj->numBins; k++) {
+        coeff = obj->coeff[k];
+        shift = INPUT_SHIFT - obj->headroom[k];
+        s1 = 0;
+        s2 = 0;
+
+        if (shift >= 0) {
+            for (n = 0; n < obj->fftLen; n++) {
+                s0 = (q31_t)((((int64_t)coeff * s1) >> 30) - s2 +
+                             ((q31_t)frame[n] << shift));
+                s2 = s1;
+                s1 = s0;
+            }
+        }
+        else {
+            for (n = 0; n < obj->fftLen; n++) {
+                s0 = (q31_t)((((int64_t)coeff * s1) >> 30) - s2 +
+                             ((q31_t)frame[n] >> -shift));
+                s2 = s1;
+                s1 = s0;
+            }
+        }
+
+        /* One more iteration with zero input gives the exact DFT bin */
+        s0 = (q31_t)((((int64_t)coeff * s1) >> 30) - s2);
+
+        /* X[k] = s[N] - e^(-jw) * s[N - 1] */
+        re = (int64_t)s0 - (((int64_t)obj->cosW[k] * s1) >> 31);
+        im = ((int64_t)obj->sinW[k] * s1) >> 31;
+
+        /* Scale by 2^headroom / N */
+        shift = obj->headroom[k] - obj->log2Len;
+        if (shift >= 0) {
+            re <<= shift;
+            im <<= shift;
+        }
+        else {
+            re >>= -shift;
+            im >>= -shift;
+        }
+
+        result[k].re = saturate(re);
+        result[k].im = saturate(im);
+    }
+}
+#endif
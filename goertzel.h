@@ -0,0 +1,121 @@
+/*
+ *  ======== goertzel.h ========
+ *  Goertzel harmonic bank.
+ *
+ *  Evaluates only a configured list of DFT bins (typically the fundamental
+ *  and its integer harmonics) instead of the full spectrum.  Each bin costs
+ *  one multiply-accumulate per sample, so for a short harmonic list the bank
+ *  is cheaper than a full FFT with bit reversal; for a long list the FFT
+ *  wins.  The results use the same scaling as the Spectrum stage so either
+ *  engine can feed the harmonic extraction.
+ *
+ *  In q15 and q31 the resonators run in q31 with per-bin headroom; in f32
+ *  they run on the FPU and the phasors are float.
+ */
+#ifndef GOERTZEL_H_
+#define GOERTZEL_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#include "precision.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Goertzel_init().
+ */
+#define Goertzel_STATUS_SUCCESS     (0)
+
+/*!
+ *  @brief  Returned by Goertzel_init() for an invalid length or bin list.
+ */
+#define Goertzel_STATUS_ERROR       (-1)
+
+/*!
+ *  @brief  Maximum number of bins in one bank
+ */
+#define Goertzel_MAX_BINS           (50)
+
+/*!
+ *  @brief  Complex bin value; re/im are interleaved so an array of phasors
+ *          can be passed directly to arm_cmplx_mag_q31() (or
+ *          arm_cmplx_mag_f32() in f32).
+ */
+typedef struct {
+#if (PRECISION == PRECISION_F32)
+    float32_t re;
+    float32_t im;
+#else
+    q31_t re;
+    q31_t im;
+#endif
+} Goertzel_Phasor;
+
+/*!
+ *  @brief  Goertzel bank state
+ */
+typedef struct {
+    uint16_t      fftLen;                       /*!< Frame length */
+    uint_least8_t log2Len;                      /*!< log2(fftLen) */
+    uint_least8_t numBins;                      /*!< Bins in the bank */
+    uint16_t      bins[Goertzel_MAX_BINS];      /*!< DFT bin indices */
+#if (PRECISION == PRECISION_F32)
+    float32_t     coeff[Goertzel_MAX_BINS];     /*!< 2cos(w) */
+    float32_t     cosW[Goertzel_MAX_BINS];      /*!< cos(w) */
+    float32_t     sinW[Goertzel_MAX_BINS];      /*!< sin(w) */
+#else
+    q31_t         coeff[Goertzel_MAX_BINS];     /*!< 2cos(w) in Q30 */
+    q31_t         cosW[Goertzel_MAX_BINS];      /*!< cos(w) in Q31 */
+    q31_t         sinW[Goertzel_MAX_BINS];      /*!< sin(w) in Q31 */
+    int_least8_t  headroom[Goertzel_MAX_BINS];  /*!< Resonator growth bits */
+#endif
+} Goertzel_Object;
+
+/*!
+ *  @brief  Initialize a bank for an arbitrary list of bins.
+ *
+ *  @param  obj      Goertzel object to initialize
+ *  @param  fftLen   Frame length (power of two, 16 to 4096)
+ *  @param  bins     DFT bin indices, each between 1 and fftLen/2 - 1
+ *  @param  numBins  Number of entries in @p bins (1 to Goertzel_MAX_BINS)
+ *
+ *  @return Goertzel_STATUS_SUCCESS or Goertzel_STATUS_ERROR
+ */
+extern int_fast16_t Goertzel_init(Goertzel_Object *obj, uint16_t fftLen,
+                                  const uint16_t *bins, uint_least8_t numBins);
+
+/*!
+ *  @brief  Initialize a bank for harmonics 1 to @p numHarmonics of a
+ *          fundamental located in bin @p fundamentalBin.
+ *
+ *  @return Goertzel_STATUS_SUCCESS or Goertzel_STATUS_ERROR
+ */
+extern int_fast16_t Goertzel_initHarmonics(Goertzel_Object *obj,
+                                           uint16_t fftLen,
+                                           uint16_t fundamentalBin,
+                                           uint_least8_t numHarmonics);
+
+/*!
+ *  @brief  Evaluate every bin of the bank over one frame.
+ *
+ *  Unlike Spectrum_transform() the frame is left untouched.  Each phasor is
+ *  X[k] / fftLen in q31 (float in f32), so a sinusoid of peak amplitude A
+ *  (full scale 1.0) shows up with magnitude A/2, as in the Spectrum stage.
+ *
+ *  @param  obj     Initialized Goertzel object
+ *  @param  frame   fftLen samples in the analysis precision
+ *  @param  result  obj->numBins phasors, in the order of the bin list
+ */
+extern void Goertzel_process(const Goertzel_Object *obj,
+                             const Precision_Sample *frame,
+                             Goertzel_Phasor *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GOERTZEL_H_ */
@@ -0,0 +1,118 @@
+/*
+ *  ======== ingest.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "ingest.h"
+#include "placement.h"
+
+/*
+ *  ======== Ingest_init ========
+ */
+void Ingest_init(Ingest_Object *obj, uint_least8_t dcShift)
+{
+    obj->dcEstimate = 0;
+    obj->dcShift = dcShift;
+    obj->primed = false;
+}
+
+/*
+ *  ======== toSample ========
+ *  Remove the mid-scale offset of a 12-bit code and scale it to full scale.
+ */
+#if (PRECISION == PRECISION_F32)
+#define toSample(code) \
+    ((float32_t)((int32_t)(code) - Ingest_ADC_OFFSET) * (1.0f / 2048.0f))
+#elif (PRECISION == PRECISION_Q31)
+#define toSample(code)  ((q31_t)(((int32_t)(code) - Ingest_ADC_OFFSET) << 20))
+#else
+#define toSample(code)  ((q15_t)(((int32_t)(code) - Ingest_ADC_OFFSET) << 4))
+#endif
+
+/*
+ *  ======== Ingest_convert ========
+ */
+Precision_Sample Ingest_convert(Ingest_Object *obj, const uint16_t *src,
+                                Precision_Sample *dst, uint32_t numSamples)
+{
+    return (Ingest_deinterleave(obj, src, 1, dst, numSamples));
+}
+
+/*
+ *  ======== Ingest_deinterleave ========
+ *  A 12-bit code shifted up by 4 is an unsigned 16-bit offset-binary value;
+ *  flipping its MSB turns it into the two's complement q15 sample, which is
+ *  the same as subtracting 0x8000 from each half-word but needs no carry
+ *  handling, so both samples of a packed word are converted by one EOR.
+ *
+ *  The q31 sum needs 64 bits; the float sum stays exact, every sample being
+ *  a multiple of 2^-11.  Runs from SRAM with Placement_INGEST.
+ */
+Placement_INGEST_FXN
+Precision_Sample Ingest_deinterleave(Ingest_Object *obj, const uint16_t *src,
+                                     uint16_t stride, Precision_Sample *dst,
+                                     uint32_t numSamples)
+{
+#if (PRECISION == PRECISION_F32)
+    float32_t sum = 0.0f;
+    float32_t mean;
+#elif (PRECISION == PRECISION_Q31)
+    int64_t sum = 0;
+    q31_t mean;
+#else
+    int32_t sum = 0;
+    int32_t mean;
+#endif
+    uint32_t i;
+
+#if (PRECISION == PRECISION_Q15) && defined(ARM_MATH_CM4)
+    q31_t packed;
+
+    for (i = numSamples >> 1; i > 0; i--) {
+        /* Pack two 12-bit codes into the half-words of one word */
+        packed = __PKHBT(src[0], src[stride], 16);
+        src += 2U * stride;
+
+        /* Scale to 16 bits and convert both half-words to q15 */
+        packed = (q31_t)(((uint32_t)packed << 4) ^ 0x80008000U);
+
+        *__SIMD32(dst)++ = packed;
+
+        /* Add both half-words to the DC accumulator */
+        sum = __SMLAD(packed, 0x00010001, sum);
+    }
+#else
+    Precision_Sample sample;
+
+    for (i = 0; i < numSamples; i++) {
+        sample = toSample(*src);
+        src += stride;
+        dst[i] = sample;
+        sum += sample;
+    }
+#endif
+
+#if (PRECISION == PRECISION_F32)
+    mean = sum / (float32_t)numSamples;
+#else
+    mean = (q31_t)(sum / (int32_t)numSamples);
+#endif
+
+    if (obj->primed) {
+#if (PRECISION == PRECISION_F32)
+        obj->dcEstimate += (mean - obj->dcEstimate) /
+                           (float32_t)(1UL << obj->dcShift);
+#else
+        obj->dcEstimate += (Precision_Sample)
+            (((int64_t)mean - obj->dcEstimate) >> obj->dcShift);
+#endif
+    }
+    else {
+        obj->dcEstimate = mean;
+        obj->primed = true;
+    }
+
+    return ((Precision_Sample)mean);
+}
@@ -0,0 +1,99 @@
+/*
+ *  ======== ingest.h ========
+ *  Sample ingest stage: 12-bit offset-binary ADC codes to centered samples.
+ *
+ *  The ADC returns codes 0 to 4095 centered on 2048, one per half-word.
+ *  The ingest kernel removes the offset, scales the codes to the analysis
+ *  precision (see precision.h) and accumulates the DC estimate in the same
+ *  pass, so the frame never has to be walked a second time.  In q15 two
+ *  samples are packed per 32-bit word.
+ */
+#ifndef INGEST_H_
+#define INGEST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#include "precision.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Mid-scale code of the 12-bit ADC
+ */
+#define Ingest_ADC_OFFSET       (2048)
+
+/*!
+ *  @brief  Default running DC smoothing: each frame moves the estimate by
+ *          1/2^Ingest_DC_SHIFT_DEFAULT of the difference to the frame mean.
+ */
+#define Ingest_DC_SHIFT_DEFAULT (3)
+
+/*!
+ *  @brief  Ingest stage state
+ */
+typedef struct {
+    Precision_Sample dcEstimate; /*!< Running DC estimate */
+    uint_least8_t    dcShift;    /*!< Smoothing shift of the DC estimate */
+    bool             primed;     /*!< Set once the first frame was seen */
+} Ingest_Object;
+
+/*!
+ *  @brief  Initialize the ingest stage.
+ *
+ *  @param  obj      Ingest object to initialize
+ *  @param  dcShift  Smoothing shift of the running DC estimate
+ */
+extern void Ingest_init(Ingest_Object *obj, uint_least8_t dcShift);
+
+/*!
+ *  @brief  Convert a block of raw ADC codes into centered samples.
+ *
+ *  Full scale is 1.0 in every precision.  In q15 on Cortex-M4
+ *  (ARM_MATH_CM4) two codes are packed into one word and converted with
+ *  dual 16-bit operations; otherwise a portable C loop produces
+ *  bit-identical output.
+ *
+ *  @param  obj         Initialized ingest object
+ *  @param  src         Raw ADC codes, one 12-bit code per half-word
+ *  @param  dst         Output frame; must be 32-bit aligned
+ *  @param  numSamples  Number of samples; must be even
+ *
+ *  @return Mean of the block.  The running estimate in obj->dcEstimate is
+ *          updated as well.
+ */
+extern Precision_Sample Ingest_convert(Ingest_Object *obj,
+                                       const uint16_t *src,
+                                       Precision_Sample *dst,
+                                       uint32_t numSamples);
+
+/*!
+ *  @brief  Convert one channel of an interleaved multi-channel frame.
+ *
+ *  Same as Ingest_convert(), but reads every @p stride th code, so one
+ *  channel is picked out of the sequencer's interleaved output and written
+ *  to its own contiguous frame in the same pass.
+ *
+ *  @param  obj         Ingest object of this channel
+ *  @param  src         First raw ADC code of the channel
+ *  @param  stride      Distance between samples of the channel
+ *  @param  dst         Output frame; must be 32-bit aligned
+ *  @param  numSamples  Number of samples; must be even
+ *
+ *  @return Mean of the block
+ */
+extern Precision_Sample Ingest_deinterleave(Ingest_Object *obj,
+                                            const uint16_t *src,
+                                            uint16_t stride,
+                                            Precision_Sample *dst,
+                                            uint32_t numSamples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INGEST_H_ */
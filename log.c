@@ -0,0 +1,94 @@
+/*
+ *  ======== log.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "log.h"
+#include "profile.h"
+#include "telemetry.h"
+
+Log_Buffer Log_buffer;
+
+/* Drops already reported in a frame, owned by Log_drain() */
+static uint32_t droppedSent;
+
+/*
+ *  ======== put32 ========
+ */
+static uint8_t *put32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+
+    return (p + 4);
+}
+
+/*
+ *  ======== Log_init ========
+ */
+void Log_init(Log_Record *records)
+{
+    Profile_startCounter();
+
+    Log_buffer.writeIndex = 0;
+    Log_buffer.readIndex = 0;
+    Log_buffer.dropped = 0;
+    Log_buffer.record = records;
+    Log_buffer.len = Log_RING_LEN;
+    droppedSent = 0;
+}
+
+/*
+ *  ======== Log_drain ========
+ */
+uint32_t Log_drain(uint32_t maxRecords)
+{
+    uint8_t payload[Log_PAYLOAD_LEN(Log_MAX_ARGS)];
+    uint8_t frame[Telemetry_FRAME_LEN(Log_PAYLOAD_LEN(Log_MAX_ARGS))];
+    const volatile Log_Record *r;
+    uint32_t sent;
+    uint32_t numArgs;
+    uint32_t dropped;
+    uint32_t i;
+    uint8_t *p;
+
+    for (sent = 0; sent < maxRecords; sent++) {
+        if (Log_buffer.readIndex == Log_buffer.writeIndex) {
+            break;
+        }
+
+        r = &Log_buffer.record[Log_buffer.readIndex & (Log_RING_LEN - 1U)];
+        numArgs = r->header >> 24;
+        dropped = r->dropped - droppedSent;
+        if (dropped > UINT16_MAX) {
+            dropped = UINT16_MAX;
+        }
+
+        p = payload;
+        *p++ = (uint8_t)Log_FRAME_TYPE;
+        *p++ = (uint8_t)numArgs;
+        *p++ = (uint8_t)dropped;
+        *p++ = (uint8_t)(dropped >> 8);
+        p = put32(p, r->time);
+        p = put32(p, r->header & 0x00FFFFFFU);
+        for (i = 0; i < numArgs; i++) {
+            p = put32(p, r->arg[i]);
+        }
+
+        if (Telemetry_sendFrame(frame,
+                                Telemetry_encodeFrame(payload,
+                                                      (size_t)(p - payload),
+                                                      frame)) !=
+            Telemetry_STATUS_SUCCESS) {
+            break;
+        }
+
+        droppedSent = r->dropped;
+        Log_buffer.readIndex++;
+    }
+
+    return (sent);
+}
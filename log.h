@@ -0,0 +1,229 @@
+/*
+ *  ======== log.h ========
+ *  Deferred binary logging.
+ *
+ *  Log_print0() to Log_print4() record a message without formatting it:
+ *  the call site stores a message ID, a timestamp and up to four raw
+ *  32-bit arguments in a ring of Log_RING_LEN records, which takes a few
+ *  tens of cycles.  Log_drain() sends the records as binary frames from
+ *  the idle loop, and tools/log_decode.py turns them back into text on
+ *  the host.
+ *
+ *  The format strings never reach the target's memory.  Every one is
+ *  placed in its own object in the .log_data section, which the linker
+ *  command file locates at Log_BASE as a COPY section: it is kept in the
+ *  executable but not loaded.  A message ID is the offset of its string
+ *  within that section, so the decoder reads the string straight from the
+ *  executable, or from a table extracted from it at build time:
+ *
+ *      python3 tools/log_decode.py --table app.out > log_table.txt
+ *      python3 tools/log_decode.py log_table.txt /dev/ttyACM0
+ *
+ *  Formats accept %c, %d, %i, %u, %x, %X and %p with the usual flags and
+ *  width, %f for a float passed through Log_float(), and %q<n> for a
+ *  fixed-point value with n fraction bits as in UARTprintf().  Strings
+ *  (%s) cannot be logged: only their address would be recorded.
+ *
+ *  Log frames share the serial link with the result frames of telemetry.h
+ *  and use the same framing; byte 0 of the payload is Log_FRAME_TYPE
+ *  instead of Telemetry_VERSION.  Little-endian payload layout:
+ *
+ *      offset  size  field
+ *      0       1     Log_FRAME_TYPE
+ *      1       1     number of arguments (A)
+ *      2       2     records dropped before this one, saturated at 65535
+ *      4       4     timestamp, Profile_now() ticks
+ *      8       4     message ID
+ *      12      4 A   arguments
+ *      12+4A   2     CRC-16/CCITT-FALSE of all bytes above
+ *
+ *  The records are taken from the arena (Budget_LOG_BYTES in budget.h) and
+ *  handed to Log_init(); until then every record is dropped and counted.
+ *  The ring has a single producer and a single consumer and needs no lock:
+ *  Log_print*() may be called from thread context only, Log_drain() from
+ *  the idle loop.  A record that finds the ring full is dropped and
+ *  counted; the next record that fits carries the count, so the decoder
+ *  shows the gap where it happened.
+ */
+#ifndef LOG_H_
+#define LOG_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(HOST_BUILD)
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Records in the ring, a power of two
+ */
+#ifndef Log_RING_LEN
+#define Log_RING_LEN        (64U)
+#endif
+
+#if ((Log_RING_LEN & (Log_RING_LEN - 1U)) != 0U)
+#error "Log_RING_LEN must be a power of two"
+#endif
+
+/*!
+ *  @brief  Most arguments of one record
+ */
+#define Log_MAX_ARGS        (4U)
+
+/*!
+ *  @brief  First payload byte of a log frame
+ */
+#define Log_FRAME_TYPE      (0x4CU)
+
+/*!
+ *  @brief  Payload bytes of a log frame with @p numArgs arguments,
+ *          including the CRC
+ */
+#define Log_PAYLOAD_LEN(numArgs)    (14U + (4U * (numArgs)))
+
+/*
+ *  Section of the format strings and its start address.  GNU ld defines
+ *  __start_log_data for the host build; on the target the section is
+ *  placed at a fixed address that is never loaded.
+ */
+#if defined(HOST_BUILD)
+#define Log_SECTION         "log_data"
+#define Log_BASE            ((uintptr_t)__start_log_data)
+extern const char __start_log_data[];
+#else
+#define Log_SECTION         ".log_data"
+#define Log_BASE            ((uintptr_t)0x90000000U)
+#endif
+
+/* Record time base: the DWT cycle counter, read inline on the target */
+#if defined(HOST_BUILD)
+#define Log_NOW()           Profile_now()
+#else
+#define Log_NOW()           (DWT->CYCCNT)
+#endif
+
+/*!
+ *  @brief  One logged message
+ */
+typedef struct {
+    uint32_t header;                /*!< Message ID, arguments in 31:24 */
+    uint32_t time;                  /*!< Log_NOW() at the call */
+    uint32_t dropped;               /*!< Log_Buffer.dropped at the call */
+    uint32_t arg[Log_MAX_ARGS];     /*!< Raw arguments */
+} Log_Record;
+
+/*!
+ *  @brief  Record ring
+ */
+typedef struct {
+    volatile uint32_t writeIndex;   /*!< Records written, owned by Log_print */
+    volatile uint32_t readIndex;    /*!< Records sent, owned by Log_drain() */
+    uint32_t          dropped;      /*!< Records dropped on a full ring */
+    uint32_t          len;          /*!< Log_RING_LEN, 0 before Log_init() */
+    Log_Record       *record;       /*!< Log_RING_LEN records */
+} Log_Buffer;
+
+extern Log_Buffer Log_buffer;
+
+/*
+ *  ======== Log_write ========
+ *  Store one record.  numArgs is a constant at every call site, so the
+ *  stores of unused arguments drop out.
+ */
+static inline void Log_write(uint32_t header, uint32_t numArgs, uint32_t a0,
+                             uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    uint32_t w = Log_buffer.writeIndex;
+    volatile Log_Record *r;
+
+    if ((w - Log_buffer.readIndex) >= Log_buffer.len) {
+        Log_buffer.dropped++;
+        return;
+    }
+
+    r = &Log_buffer.record[w & (Log_RING_LEN - 1U)];
+    r->header = header;
+    r->time = Log_NOW();
+    r->dropped = Log_buffer.dropped;
+    if (numArgs > 0U) {
+        r->arg[0] = a0;
+    }
+    if (numArgs > 1U) {
+        r->arg[1] = a1;
+    }
+    if (numArgs > 2U) {
+        r->arg[2] = a2;
+    }
+    if (numArgs > 3U) {
+        r->arg[3] = a3;
+    }
+
+    /* Publish after the record, for Log_drain() */
+    Log_buffer.writeIndex = w + 1U;
+}
+
+#define Log_PRINT(fmt, numArgs, a0, a1, a2, a3)                         \
+    do {                                                                \
+        static const char Log_format[]                                  \
+            __attribute__((section(Log_SECTION), used)) = fmt;          \
+        Log_write((uint32_t)((uintptr_t)Log_format - Log_BASE) |        \
+                  ((uint32_t)(numArgs) << 24), (numArgs),               \
+                  (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2),       \
+                  (uint32_t)(a3));                                      \
+    } while (0)
+
+/*!
+ *  @brief  Log a message.  @p fmt must be a string literal; every
+ *          argument is converted to a 32-bit word.
+ */
+#define Log_print0(fmt)                 Log_PRINT(fmt, 0U, 0, 0, 0, 0)
+#define Log_print1(fmt, a0)             Log_PRINT(fmt, 1U, a0, 0, 0, 0)
+#define Log_print2(fmt, a0, a1)         Log_PRINT(fmt, 2U, a0, a1, 0, 0)
+#define Log_print3(fmt, a0, a1, a2)     Log_PRINT(fmt, 3U, a0, a1, a2, 0)
+#define Log_print4(fmt, a0, a1, a2, a3) Log_PRINT(fmt, 4U, a0, a1, a2, a3)
+
+/*
+ *  ======== Log_float ========
+ *  The bits of a float, for a %f argument.
+ */
+static inline uint32_t Log_float(float x)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &x, sizeof(bits));
+
+    return (bits);
+}
+
+/*!
+ *  @brief  Empty the ring and start the time base.
+ *
+ *  @param  records  Log_RING_LEN records, 32-bit aligned
+ */
+extern void Log_init(Log_Record *records);
+
+/*!
+ *  @brief  Send pending records as frames with Telemetry_sendFrame().
+ *
+ *  Stops early when the buffered UART has no room for the next frame,
+ *  which stays in the ring.  Without UART_BUFFERED each frame blocks for
+ *  its time on the wire, so keep @p maxRecords small.
+ *
+ *  @param  maxRecords  Most records to send
+ *
+ *  @return Records sent
+ */
+extern uint32_t Log_drain(uint32_t maxRecords);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_H_ */
@@ -34,12 +34,16 @@
 /*
  *  ======== main_nortos.c ========
  */
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
 #include <NoRTOS.h>
 
 #include <ti/drivers/Board.h>
+#include <ti/drivers/GPIO.h>
+
+#include "ti_drivers_config.h"
 
 extern void *mainThread(void *arg0);
 
@@ -55,16 +59,250 @@ extern void *mainThread(void *arg0);
 #include "arm_math.h"
 #include "arm_const_structs.h"
 
+#include "acquire.h"
+#include "analysis.h"
+#include "arena.h"
+#include "budget.h"
+#include "channels.h"
+#include "console.h"
+#include "event.h"
+#include "frequency.h"
+#include "goertzel.h"
+#include "ingest.h"
+#include "log.h"
+#include "precision.h"
+#include "profile.h"
+#include "scheduler.h"
+#include "sdft.h"
+#include "spectrum.h"
+#include "stream.h"
+#include "telemetry.h"
+#include "testwave.h"
+#include "trigger.h"
+#include "window.h"
+
 /* Define for Samples to be captured and Sampling Frequency */
 #define NUM_SAMPLES 1024
-#define SAMP_FREQ   1024000
+#define SAMP_FREQ   51200
+
+/* Channel run through the harmonic engine */
+#define ANALYSIS_CHANNEL    Channels_VA
+
+/*
+ * Harmonic engine: full real FFT, a Goertzel bank over the harmonics only, or
+ * a sliding DFT that refreshes the harmonics after every sample
+ */
+#define HARMONIC_ENGINE_FFT         0
+#define HARMONIC_ENGINE_GOERTZEL    1
+#define HARMONIC_ENGINE_SDFT        2
+#ifndef HARMONIC_ENGINE
+#define HARMONIC_ENGINE             HARMONIC_ENGINE_FFT
+#endif
+
+/*
+ * Signal source: live ADC frames from the uDMA ping-pong, or the recorded
+ * test waveform in TestWave_bbx
+ */
+#define SIGNAL_SOURCE_ADC       0
+#define SIGNAL_SOURCE_TABLE     1
+#ifndef SIGNAL_SOURCE
+#define SIGNAL_SOURCE           SIGNAL_SOURCE_ADC
+#endif
+
+/*
+ * Raw sample streaming on UART1 for field diagnosis (stream.h): define
+ * STREAM_ENABLE to send the ADC codes of the channels in STREAM_CHANNELS,
+ * one bit per Channels_Id; see tools/stream_decode.py
+ */
+#if defined(STREAM_ENABLE) && (SIGNAL_SOURCE != SIGNAL_SOURCE_ADC)
+#error "STREAM_ENABLE needs SIGNAL_SOURCE_ADC"
+#endif
+#ifndef STREAM_CHANNELS
+#define STREAM_CHANNELS ((1U << Channels_VA) | (1U << Channels_IA))
+#endif
+
+/*
+ * Zero-crossing trigger (trigger.h): define TRIGGER_ENABLE to start every
+ * frame on the rising edge of a comparator on the fundamental at
+ * CONFIG_GPIO_ZERO_CROSS, so harmonic phases line up from frame to frame.
+ * Edges within TRIGGER_HOLD_OFF_US of the last accepted one are ignored.
+ * A frame is sampled at SAMP_FREQ like a free-running one and spans
+ * exactly one cycle at MAINS_FREQ, so harmonic h stays on bin
+ * h * FUNDAMENTAL_BIN.  It ends just as the next crossing comes, so the
+ * hold-off, most of two cycles, skips that crossing and frames start on
+ * every other one, TRIGGER_CYCLES cycles apart, for mains from 29 to
+ * 57 Hz.  Triggered frames are not contiguous, so the analysis window is
+ * held to the one cycle of a frame (Analysis_setTriggered()); see
+ * tools/trigger_sim.c
+ */
+#if defined(TRIGGER_ENABLE) && (SIGNAL_SOURCE != SIGNAL_SOURCE_ADC)
+#error "TRIGGER_ENABLE needs SIGNAL_SOURCE_ADC"
+#endif
+#define MAINS_FREQ              50
+#define TRIGGER_CYCLES          2
+#define TRIGGER_HOLD_OFF_US     35000
+
+/*
+ * Mains frequency meter (frequency.h): define FREQUENCY_ENABLE to time the
+ * comparator edges on T2CCP0 (PM0) with Timer 2 and average the periods
+ * over FREQUENCY_CYCLES cycles.  Telemetry then carries that frequency
+ * instead of the engine's estimate.
+ */
+#define FREQUENCY_CYCLES        50
+
+/* Bin of the fundamental within a frame and number of tracked harmonics */
+#define FUNDAMENTAL_BIN 1
+#define NUM_HARMONICS   50
+
+#if defined(TRIGGER_ENABLE) && (FUNDAMENTAL_BIN != 1)
+#error "TRIGGER_ENABLE needs a frame of one cycle, FUNDAMENTAL_BIN 1"
+#endif
+
+/*
+ * The FFT engine analyzes a window that can be changed at run time
+ * (analysis.h); it starts out as one frame, FUNDAMENTAL_BIN cycles, with
+ * harmonics 1 to NUM_HARMONICS.  With the buffered UART the console
+ * (console.h) changes it; the staged settings take effect before the
+ * first channel of the next frame.
+ */
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_FFT) && defined(UART_BUFFERED)
+#define CONSOLE_ENABLE
+#endif
+
+/* Sliding DFT re-anchoring period, in windows */
+#define SDFT_ANCHOR_PERIOD  1
+
+/* Binary result frames are sent for every channel of every TELEMETRY_PERIOD
+ * th frame, 35 per second at 50 frames/s; a 115200 baud link carries
+ * about 40 with 50 harmonics */
+#define TELEMETRY_PERIOD    10
+
+/* Log records sent per step of the log event, about 30 bytes each */
+#define LOG_DRAIN_RECORDS       2
+
+/*
+ * Events of the main loop (event.h), highest priority first: the next
+ * channel job of a captured frame, a button press, a command line on the
+ * console, and the deferred log.  The loop sleeps whenever none is
+ * pending; its busy time is logged every LOAD_REPORT_FRAMES frames.
+ */
+#define EVENT_FRAME             0
+#define EVENT_BUTTON            1
+#define EVENT_CONSOLE           2
+#define EVENT_LOG               3
+#define LOAD_REPORT_FRAMES      250
+
+/* Stage timing report period, in frames, when built with PROFILE_ENABLE */
+#define PROFILE_REPORT_FRAMES   250
+
+/*
+ * FFT window at start-up and peak interpolation.  Keep the rectangular
+ * window when the analysis window holds a whole number of cycles;
+ * otherwise use a window and interpolate the peak from its neighbouring
+ * bins.
+ */
+#ifndef FFT_WINDOW
+#define FFT_WINDOW      Window_RECTANGULAR
+#endif
+#define FFT_INTERP      Window_INTERP_2POINT
 
-/* DMA Buffer declaration and buffer complete flag */
-static uint32_t bbxBuffer[1024] = {2048, 2087, 2126, 2165, 2204, 2243, 2282, 2321, 2360, 2399, 2437, 2475, 2513, 2551, 2589, 2627, 2664, 2701, 2738, 2774, 2810, 2846, 2882, 2917, 2952, 2986, 3020, 3054, 3088, 3121, 3153, 3185, 3217, 3248, 3279, 3309, 3339, 3368, 3397, 3425, 3453, 3480, 3507, 3533, 3559, 3584, 3608, 3632, 3655, 3678, 3700, 3722, 3743, 3763, 3783, 3802, 3820, 3838, 3856, 3872, 3888, 3904, 3919, 3933, 3946, 3959, 3972, 3983, 3995, 4005, 4015, 4024, 4033, 4041, 4049, 4056, 4062, 4068, 4073, 4078, 4082, 4085, 4088, 4091, 4092, 4094, 4095, 4095, 4095, 4094, 4093, 4091, 4089, 4087, 4084, 4080, 4076, 4072, 4068, 4062, 4057, 4051, 4045, 4038, 4031, 4024, 4017, 4009, 4001, 3992, 3983, 3975, 3965, 3956, 3946, 3936, 3926, 3916, 3905, 3895, 3884, 3873, 3862, 3851, 3839, 3828, 3817, 3805, 3793, 3782, 3770, 3758, 3747, 3735, 3723, 3711, 3700, 3688, 3676, 3665, 3653, 3641, 3630, 3619, 3607, 3596, 3585, 3574, 3564, 3553, 3542, 3532, 3522, 3512, 3502, 3492, 3482, 3473, 3464, 3455, 3446, 3437, 3429, 3420, 3412, 3405, 3397, 3390, 3382, 3375, 3369, 3362, 3356, 3349, 3344, 3338, 3332, 3327, 3322, 3317, 3313, 3308, 3304, 3300, 3296, 3293, 3290, 3286, 3283, 3281, 3278, 3276, 3273, 3271, 3270, 3268, 3266, 3265, 3264, 3263, 3262, 3261, 3261, 3260, 3260, 3259, 3259, 3259, 3259, 3259, 3260, 3260, 3260, 3261, 3261, 3262, 3263, 3263, 3264, 3265, 3266, 3266, 3267, 3268, 3269, 3270, 3271, 3271, 3272, 3273, 3274, 3274, 3275, 3275, 3276, 3276, 3277, 3277, 3277, 3277, 3278, 3278, 3277, 3277, 3277, 3276, 3276, 3275, 3274, 3274, 3273, 3271, 3270, 3269, 3267, 3266, 3264, 3262, 3260, 3258, 3255, 3253, 3250, 3247, 3244, 3241, 3238, 3235, 3231, 3228, 3224, 3220, 3216, 3212, 3207, 3203, 3198, 3194, 3189, 3184, 3179, 3174, 3169, 3163, 3158, 3152, 3147, 3141, 3135, 3129, 3123, 3117, 3111, 3105, 3098, 3092, 3086, 3079, 3073, 3066, 3060, 3053, 3047, 3040, 3034, 3027, 3020, 3014, 3007, 3001, 2994, 2988, 2982, 2975, 2969, 2963, 2957, 2950, 2944, 2939, 2933, 2927, 2921, 2916, 2910, 2905, 2900, 2895, 2890, 2885, 2880, 2876, 2871, 2867, 2863, 2859, 2855, 2851, 2848, 2845, 2842, 2839, 2836, 2833, 2831, 2829, 2827, 2825, 2823, 2822, 2820, 2819, 2818, 2818, 2817, 2817, 2817, 2817, 2817, 2817, 2818, 2819, 2820, 2821, 2822, 2824, 2826, 2827, 2829, 2832, 2834, 2837, 2839, 2842, 2845, 2848, 2851, 2855, 2858, 2862, 2866, 2869, 2873, 2877, 2882, 2886, 2890, 2895, 2899, 2903, 2908, 2913, 2917, 2922, 2927, 2931, 2936, 2941, 2945, 2950, 2955, 2959, 2964, 2968, 2973, 2977, 2982, 2986, 2990, 2994, 2998, 3002, 3006, 3009, 3013, 3016, 3019, 3022, 3025, 3028, 3030, 3032, 3034, 3036, 3038, 3039, 3041, 3042, 3042, 3043, 3043, 3043, 3043, 3042, 3041, 3040, 3039, 3037, 3035, 3033, 3030, 3027, 3024, 3020, 3016, 3012, 3008, 3003, 2998, 2992, 2986, 2980, 2973, 2967, 2959, 2952, 2944, 2935, 2927, 2918, 2909, 2899, 2889, 2879, 2868, 2857, 2845, 2834, 2822, 2809, 2797, 2784, 2770, 2757, 2743, 2729, 2714, 2699, 2684, 2669, 2653, 2637, 2621, 2604, 2588, 2571, 2553, 2536, 2518, 2500, 2482, 2464, 2445, 2427, 2408, 2389, 2370, 2350, 2331, 2311, 2291, 2271, 2252, 2231, 2211, 2191, 2171, 2150, 2130, 2109, 2089, 2069, 2048, 2027, 2007, 1987, 1966, 1946, 1925, 1905, 1885, 1865, 1844, 1825, 1805, 1785, 1765, 1746, 1726, 1707, 1688, 1669, 1651, 1632, 1614, 1596, 1578, 1560, 1543, 1525, 1508, 1492, 1475, 1459, 1443, 1427, 1412, 1397, 1382, 1367, 1353, 1339, 1326, 1312, 1299, 1287, 1274, 1262, 1251, 1239, 1228, 1217, 1207, 1197, 1187, 1178, 1169, 1161, 1152, 1144, 1137, 1129, 1123, 1116, 1110, 1104, 1098, 1093, 1088, 1084, 1080, 1076, 1072, 1069, 1066, 1063, 1061, 1059, 1057, 1056, 1055, 1054, 1053, 1053, 1053, 1053, 1054, 1054, 1055, 1057, 1058, 1060, 1062, 1064, 1066, 1068, 1071, 1074, 1077, 1080, 1083, 1087, 1090, 1094, 1098, 1102, 1106, 1110, 1114, 1119, 1123, 1128, 1132, 1137, 1141, 1146, 1151, 1155, 1160, 1165, 1169, 1174, 1179, 1183, 1188, 1193, 1197, 1201, 1206, 1210, 1214, 1219, 1223, 1227, 1230, 1234, 1238, 1241, 1245, 1248, 1251, 1254, 1257, 1259, 1262, 1264, 1267, 1269, 1270, 1272, 1274, 1275, 1276, 1277, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1278, 1278, 1277, 1276, 1274, 1273, 1271, 1269, 1267, 1265, 1263, 1260, 1257, 1254, 1251, 1248, 1245, 1241, 1237, 1233, 1229, 1225, 1220, 1216, 1211, 1206, 1201, 1196, 1191, 1186, 1180, 1175, 1169, 1163, 1157, 1152, 1146, 1139, 1133, 1127, 1121, 1114, 1108, 1102, 1095, 1089, 1082, 1076, 1069, 1062, 1056, 1049, 1043, 1036, 1030, 1023, 1017, 1010, 1004, 998, 991, 985, 979, 973, 967, 961, 955, 949, 944, 938, 933, 927, 922, 917, 912, 907, 902, 898, 893, 889, 884, 880, 876, 872, 868, 865, 861, 858, 855, 852, 849, 846, 843, 841, 838, 836, 834, 832, 830, 829, 827, 826, 825, 823, 822, 822, 821, 820, 820, 819, 819, 819, 818, 818, 819, 819, 819, 819, 820, 820, 821, 821, 822, 822, 823, 824, 825, 825, 826, 827, 828, 829, 830, 830, 831, 832, 833, 833, 834, 835, 835, 836, 836, 836, 837, 837, 837, 837, 837, 836, 836, 835, 835, 834, 833, 832, 831, 830, 828, 826, 825, 823, 820, 818, 815, 813, 810, 806, 803, 800, 796, 792, 788, 783, 779, 774, 769, 764, 758, 752, 747, 740, 734, 727, 721, 714, 706, 699, 691, 684, 676, 667, 659, 650, 641, 632, 623, 614, 604, 594, 584, 574, 564, 554, 543, 532, 522, 511, 500, 489, 477, 466, 455, 443, 431, 420, 408, 396, 385, 373, 361, 349, 338, 326, 314, 303, 291, 279, 268, 257, 245, 234, 223, 212, 201, 191, 180, 170, 160, 150, 140, 131, 121, 113, 104, 95, 87, 79, 72, 65, 58, 51, 45, 39, 34, 28, 24, 20, 16, 12, 9, 7, 5, 3, 2, 1, 1, 1, 2, 4, 5, 8, 11, 14, 18, 23, 28, 34, 40, 47, 55, 63, 72, 81, 91, 101, 113, 124, 137, 150, 163, 177, 192, 208, 224, 240, 258, 276, 294, 313, 333, 353, 374, 396, 418, 441, 464, 488, 512, 537, 563, 589, 616, 643, 671, 699, 728, 757, 787, 817, 848, 879, 911, 943, 975, 1008, 1042, 1076, 1110, 1144, 1179, 1214, 1250, 1286, 1322, 1358, 1395, 1432, 1469, 1507, 1545, 1583, 1621, 1659, 1697, 1736, 1775, 1814, 1853, 1892, 1931, 1970, 2009};
+#define Q31_TO_FLOAT(x) ((float32_t)(x) * (1.0f / 2147483648.0f))
 
-/* Global variables and defines for FFT */
-#define IFFTFLAG   0
-#define BITREVERSE 1
+/* Arena bytes of this build by lifetime (budget.h); the acquisition ring
+ * is only needed with the ADC */
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+#define ACQUIRE_BYTES   Budget_ACQUIRE_BYTES(NUM_SAMPLES, Channels_COUNT)
+#else
+#define ACQUIRE_BYTES   (0U)
+#endif
+#define COMMON_BYTES    (ACQUIRE_BYTES + Budget_LOG_BYTES)
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_GOERTZEL)
+#define ARENA_BOOT_BYTES    (COMMON_BYTES + Budget_GOERTZEL_BOOT_BYTES( \
+                             NUM_SAMPLES, Channels_COUNT, NUM_HARMONICS))
+#define ARENA_SCRATCH_BYTES Budget_GOERTZEL_SCRATCH_BYTES(NUM_SAMPLES)
+#elif (HARMONIC_ENGINE == HARMONIC_ENGINE_SDFT)
+#define ARENA_BOOT_BYTES    (COMMON_BYTES + Budget_SDFT_BOOT_BYTES( \
+                             NUM_SAMPLES, Channels_COUNT, NUM_HARMONICS))
+#define ARENA_SCRATCH_BYTES Budget_SDFT_SCRATCH_BYTES(NUM_SAMPLES)
+#else
+#define ARENA_BOOT_BYTES    (COMMON_BYTES + Budget_FFT_BOOT_BYTES( \
+                             NUM_SAMPLES, Channels_COUNT, NUM_HARMONICS))
+#define ARENA_SCRATCH_BYTES Budget_FFT_SCRATCH_BYTES(NUM_SAMPLES)
+#endif
+#define ARENA_BYTES         (ARENA_BOOT_BYTES + ARENA_SCRATCH_BYTES)
+
+/* Fails to compile, with a negative array size, when the arena does not
+ * leave Budget_OTHER_BYTES of SRAM; tools/budget_report.c shows why */
+typedef char ArenaFitsInSram[(ARENA_BYTES <= Budget_ARENA_MAX_BYTES) ? 1 : -1];
+
+/* Every measurement buffer; zeroed .bss, nothing copied at boot */
+static uint8_t arenaMemory[ARENA_BYTES] __attribute__((aligned(8)));
+static Arena_Object arena;
+
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+/* Two-frame ring filled by the uDMA (boot) */
+static uint16_t *acquireBuffer;
+static Acquire_Object acquire;
+#endif
+
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+static Scheduler_Object scheduler;
+static uint32_t loadFrames;
+#endif
+
+#if defined(TRIGGER_ENABLE)
+static Trigger_Object trigger;
+static uint32_t loadEdges;
+#endif
+
+#if defined(FREQUENCY_ENABLE)
+static Frequency_Object mains;
+#endif
+
+static Event_Object loop;
+
+#if defined(STREAM_ENABLE)
+static Stream_Object stream;
+static bool streaming;
+#endif
+
+/* Global variables for FFT */
+/* Frame of the channel being processed, in the analysis precision
+ * selected in precision.h (scratch: every channel job reuses it) */
+static Precision_Sample *channelFrame;
+static Ingest_Object ingest[Channels_COUNT];
+static Precision_Sample dcAverage[Channels_COUNT];
+static Precision_Sample rmsValue[Channels_COUNT];
+static Telemetry_Result telemetry;
+static uint32_t telemetryFrames;
+#if defined(PROFILE_ENABLE)
+static uint32_t profileFrames;
+#endif
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_GOERTZEL)
+static Goertzel_Object goertzel;
+static Goertzel_Phasor (*harmonics)[NUM_HARMONICS];      /* Boot */
+#elif (HARMONIC_ENGINE == HARMONIC_ENGINE_SDFT)
+static Sdft_Object sdft[Channels_COUNT];
+static q15_t (*sdftHistory)[NUM_SAMPLES];                /* Boot */
+static q15_t *sdftCosTable;                              /* Boot */
+static uint16_t sdftBins[NUM_HARMONICS];
+static q31_t (*harmonics)[2 * NUM_HARMONICS];            /* Boot */
+#if (PRECISION != PRECISION_Q15)
+static q15_t *sdftFrame;                        /* Scratch, after the frame */
+#endif
+#else
+/* Per channel history the windows are taken from and the SRAM copy of the
+ * window coefficients (boot), and the FFT buffers, which take over the
+ * scratch once the frame has been pushed */
+static Precision_Sample *analysisHistory;
+static q15_t *analysisWindow;
+static Precision_Sample *analysisWork;
+static Analysis_Object analysis;
+static bool analyzed[Channels_COUNT];
+#if defined(CONSOLE_ENABLE)
+static Console_Object console;
+#endif
+#endif
 
 void ConfigureUART(uint32_t systemClock)
 {
@@ -81,6 +319,335 @@ void ConfigureUART(uint32_t systemClock)
     UARTStdioConfig(0, 115200, systemClock);
 }
 
+/*
+ *  ======== analyzeChannel ========
+ *  Run the harmonic engine over one channel's frame.
+ */
+static void analyzeChannel(uint_least8_t channel)
+{
+#if (HARMONIC_ENGINE != HARMONIC_ENGINE_FFT)
+    Precision_Sample *frame = channelFrame;
+#endif
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_GOERTZEL)
+
+    /* Evaluate only the fundamental and its harmonics */
+    Profile_BEGIN(Profile_STAGE_TRANSFORM);
+    Goertzel_process(&goertzel, frame, harmonics[channel]);
+    Profile_END(Profile_STAGE_TRANSFORM);
+#elif (HARMONIC_ENGINE == HARMONIC_ENGINE_SDFT)
+
+    /* Track the harmonics sample by sample; phasors are valid after each
+     * update, here read once the frame has been pushed.  The recursion is
+     * exact in integers, so it always runs on q15 samples. */
+    Profile_BEGIN(Profile_STAGE_TRANSFORM);
+#if (PRECISION == PRECISION_Q31)
+    arm_q31_to_q15(frame, sdftFrame, NUM_SAMPLES);
+    Sdft_updateBlock(&sdft[channel], sdftFrame, NUM_SAMPLES);
+#elif (PRECISION == PRECISION_F32)
+    arm_float_to_q15(frame, sdftFrame, NUM_SAMPLES);
+    Sdft_updateBlock(&sdft[channel], sdftFrame, NUM_SAMPLES);
+#else
+    Sdft_updateBlock(&sdft[channel], frame, NUM_SAMPLES);
+#endif
+    Sdft_getPhasors(&sdft[channel], harmonics[channel]);
+    Profile_END(Profile_STAGE_TRANSFORM);
+#else
+
+    /* Transform the newest window of the channel and find the fundamental;
+     * nothing to report while a new window fills */
+    analyzed[channel] = Analysis_run(&analysis, channel, FFT_INTERP);
+#endif
+}
+
+/*
+ *  ======== sendTelemetry ========
+ *  Send the results of one channel as a binary frame.  Runs right after
+ *  analyzeChannel(), while the FFT output still belongs to this channel.
+ */
+static void sendTelemetry(uint_least8_t channel)
+{
+    float32_t frequency;
+    uint_least8_t h;
+#if defined(FREQUENCY_ENABLE)
+    uint32_t microHertz;
+#endif
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_FFT)
+    float32_t re;
+    float32_t im;
+
+    if (!analyzed[channel]) {
+        return;
+    }
+    telemetry.numHarmonics = analysis.numReported;
+#else
+    telemetry.numHarmonics = NUM_HARMONICS;
+#endif
+
+    telemetry.sequence = telemetryFrames;
+    telemetry.channel = channel;
+    telemetry.dc = Telemetry_q15(Precision_toFloat(dcAverage[channel]));
+    telemetry.rms = (uint16_t)Telemetry_q15(
+        Precision_toFloat(rmsValue[channel]));
+
+    for (h = 0; h < telemetry.numHarmonics; h++) {
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_FFT)
+        telemetry.order[h] = analysis.orders[h];
+#else
+        telemetry.order[h] = h + 1U;
+#endif
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_GOERTZEL) && \
+    (PRECISION == PRECISION_F32)
+        Telemetry_setHarmonic(&telemetry, h, harmonics[channel][h].re,
+                              harmonics[channel][h].im);
+#elif (HARMONIC_ENGINE == HARMONIC_ENGINE_GOERTZEL)
+        Telemetry_setHarmonic(&telemetry, h,
+                              Q31_TO_FLOAT(harmonics[channel][h].re),
+                              Q31_TO_FLOAT(harmonics[channel][h].im));
+#elif (HARMONIC_ENGINE == HARMONIC_ENGINE_SDFT)
+        Telemetry_setHarmonic(&telemetry, h,
+                              Q31_TO_FLOAT(harmonics[channel][2 * h]),
+                              Q31_TO_FLOAT(harmonics[channel][(2 * h) + 1]));
+#else
+        Analysis_harmonic(&analysis, h, &re, &im);
+        Telemetry_setHarmonic(&telemetry, h, re, im);
+#endif
+    }
+
+    /* The FFT refines the fundamental; the harmonic banks sit on it */
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_FFT)
+    frequency = Analysis_frequency(&analysis);
+#else
+    frequency = (float32_t)FUNDAMENTAL_BIN * ((float32_t)SAMP_FREQ /
+                                              NUM_SAMPLES);
+#endif
+    telemetry.frequency = (uint32_t)lrintf(frequency * 1000.0f);
+#if defined(FREQUENCY_ENABLE)
+    /* The meter instead, once it has locked */
+    microHertz = Frequency_get(&mains);
+    if (microHertz != 0U) {
+        telemetry.frequency = (microHertz + 500U) / 1000U;
+    }
+#endif
+
+    if (Telemetry_send(&telemetry) != Telemetry_STATUS_SUCCESS) {
+        Log_print2("telemetry: frame %u of channel %u dropped, link busy",
+                   telemetry.sequence, channel);
+    }
+}
+
+/*
+ *  ======== processChannel ========
+ *  Scheduler job: convert one channel of a captured frame to its own frame,
+ *  picking up the DC average in the same pass, and analyze it.  The
+ *  results go out as telemetry every TELEMETRY_PERIOD frames.  With
+ *  PROFILE_ENABLE the stage timing is printed after the last channel of
+ *  every PROFILE_REPORT_FRAMES th frame.
+ */
+static void processChannel(int_fast8_t frame, uint_least8_t channel,
+                           void *arg)
+{
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+    uint64_t elapsed;
+#endif
+#if defined(CONSOLE_ENABLE)
+    Analysis_Config config;
+
+    /* Between frames: switch to the settings staged on the console */
+    if ((channel == 0) && Console_take(&console, &config)) {
+        if (Analysis_configure(&analysis, &config) ==
+            Analysis_STATUS_SUCCESS) {
+            Log_print3("analysis: fft %u, %u cycles, %u harmonics",
+                       config.fftLen, config.cycles, analysis.numReported);
+        }
+    }
+#endif
+
+#if defined(STREAM_ENABLE)
+    /* Raw codes first; the stream drops whole blocks if the link is behind */
+    if (streaming && ((STREAM_CHANNELS & (1U << channel)) != 0U)) {
+        Stream_write(&stream, channel,
+                     Acquire_frameNumber(&acquire, frame) * NUM_SAMPLES,
+                     Acquire_samples(&acquire, frame, channel),
+                     Acquire_stride(&acquire, channel), NUM_SAMPLES);
+    }
+#endif
+
+    Profile_BEGIN(Profile_STAGE_CHANNEL);
+    Profile_BEGIN(Profile_STAGE_INGEST);
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+    dcAverage[channel] =
+        Ingest_deinterleave(&ingest[channel],
+                            Acquire_samples(&acquire, frame, channel),
+                            Acquire_stride(&acquire, channel),
+                            channelFrame, NUM_SAMPLES);
+#else
+    dcAverage[channel] = Ingest_convert(&ingest[channel], TestWave_bbx,
+                                        channelFrame, NUM_SAMPLES);
+#endif
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_FFT)
+    /* Slide the channel's analysis window on by this frame */
+    Analysis_push(&analysis, channel, channelFrame, NUM_SAMPLES);
+#endif
+    Profile_END(Profile_STAGE_INGEST);
+
+    /* Before the FFT, which works in place and takes over the scratch */
+    Precision_rms(channelFrame, NUM_SAMPLES, &rmsValue[channel]);
+
+    analyzeChannel(channel);
+    Profile_END(Profile_STAGE_CHANNEL);
+
+    if ((telemetryFrames % TELEMETRY_PERIOD) == 0) {
+        sendTelemetry(channel);
+    }
+    if (channel == (Channels_COUNT - 1)) {
+        telemetryFrames++;
+        Event_post(&loop, EVENT_LOG);
+    }
+
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+    if ((channel == (Channels_COUNT - 1)) &&
+        (++loadFrames == LOAD_REPORT_FRAMES)) {
+        loadFrames = 0;
+#if defined(TRIGGER_ENABLE)
+        /* Triggered frames do not keep time, but accepted edges are
+         * TRIGGER_CYCLES mains cycles apart */
+        elapsed = (uint64_t)(trigger.accepted - loadEdges) *
+                  ((TRIGGER_CYCLES * scheduler.tickRate) / MAINS_FREQ);
+        loadEdges = trigger.accepted;
+#else
+        elapsed = (uint64_t)LOAD_REPORT_FRAMES * scheduler.framePeriod;
+#endif
+        Log_print2("event: busy %u per mille, %u sleeps",
+                   (uint32_t)(((uint64_t)Event_takeBusy(&loop) * 1000U) /
+                              elapsed),
+                   loop.sleeps);
+#if defined(FREQUENCY_ENABLE)
+        Log_print3("frequency: %u uHz, %u ignored, %u dropped",
+                   Frequency_get(&mains), mains.ignored, mains.dropped);
+#endif
+    }
+#endif
+
+#if defined(PROFILE_ENABLE)
+    if ((channel == (Channels_COUNT - 1)) &&
+        (++profileFrames == PROFILE_REPORT_FRAMES)) {
+        profileFrames = 0;
+        Profile_REPORT();
+    }
+#endif
+}
+
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+/*
+ *  ======== frameReady ========
+ *  Acquisition callback, in interrupt context.
+ */
+static void frameReady(int_fast8_t frame, void *arg)
+{
+    (void)frame;
+    (void)arg;
+
+    Event_post(&loop, EVENT_FRAME);
+}
+
+/*
+ *  ======== frameEvent ========
+ *  One channel job per run, so that other events get in between the
+ *  channels of a frame.
+ */
+static void frameEvent(void *arg)
+{
+    (void)arg;
+
+    if (Scheduler_poll(&scheduler)) {
+        Event_post(&loop, EVENT_FRAME);
+    }
+}
+#endif
+
+#if defined(TRIGGER_ENABLE)
+/*
+ *  ======== zeroCrossing ========
+ *  GPIO callback, in interrupt context.  The first edge of a crossing
+ *  starts the next frame if the last one is complete.
+ */
+static void zeroCrossing(uint_least8_t index)
+{
+    (void)index;
+
+    if (Trigger_edge(&trigger, Trigger_now())) {
+        Acquire_trigger(&acquire);
+    }
+}
+#endif
+
+/*
+ *  ======== buttonPressed ========
+ *  GPIO callback, in interrupt context.
+ */
+static void buttonPressed(uint_least8_t index)
+{
+    (void)index;
+
+    Event_post(&loop, EVENT_BUTTON);
+}
+
+/*
+ *  ======== buttonEvent ========
+ */
+static void buttonEvent(void *arg)
+{
+    (void)arg;
+
+    GPIO_toggle(CONFIG_GPIO_LED_0);
+    Log_print1("button: %u presses", loop.events[EVENT_BUTTON].posts);
+}
+
+#if defined(UART_BUFFERED)
+/*
+ *  ======== uartEvent ========
+ *  UART callback, in interrupt context.
+ */
+static void uartEvent(uint32_t uartEvents)
+{
+    if ((uartEvents & UART_EVENT_RX_LINE) != 0U) {
+        Event_post(&loop, EVENT_CONSOLE);
+    }
+    if ((uartEvents & UART_EVENT_TX_EMPTY) != 0U) {
+        Event_post(&loop, EVENT_LOG);
+    }
+}
+#endif
+
+#if defined(CONSOLE_ENABLE)
+/*
+ *  ======== consoleEvent ========
+ *  Every line that came in, since posts of the event merge.
+ */
+static void consoleEvent(void *arg)
+{
+    (void)arg;
+
+    while (Console_poll(&console)) {
+    }
+}
+#endif
+
+/*
+ *  ======== logEvent ========
+ *  A few deferred log records per run.  A full step may leave more, so it
+ *  runs again; with the buffered UART a step that finds no room sends
+ *  nothing, and the UART posts the event once it has drained.
+ */
+static void logEvent(void *arg)
+{
+    (void)arg;
+
+    if (Log_drain(LOG_DRAIN_RECORDS) == LOG_DRAIN_RECORDS) {
+        Event_post(&loop, EVENT_LOG);
+    }
+}
+
 /*
  *  ======== main ========
  */
@@ -98,6 +665,10 @@ int main(void)
      * cmsis_msp432e4_dsp_example
      */
     uint32_t systemClock;
+    uint32_t i;
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_FFT)
+    Analysis_Config config;
+#endif
 
     /* Configure the system clock for 120 MHz */
     systemClock = MAP_SysCtlClockFreqSet((SYSCTL_XTAL_25MHZ |
@@ -108,19 +679,149 @@ int main(void)
     /* Initialize serial console */
     ConfigureUART(systemClock);
 
-    /* Display the setup on the console. */
-    UARTprintf("\033[2J\033[H");
-    UARTprintf("\rCMSIS DSP Demo...\n\n");
-    UARTprintf("\033[2GDC Average \033[31G\n");
-    UARTprintf("\033[2GRMS \033[31G\n");
-    UARTprintf("\033[2GFFT Amplitude \033[31G\n");
-    UARTprintf("\033[2GFFT Frequency \033[31G\n");
-
-    /* robust */
-    /* Compute the 1024 point FFT on the sampled data and then find the
-     * FFT point for maximum energy and the energy value */
-    arm_cfft_q15(&arm_cfft_sR_q15_len1024, (q15_t *)bbxBuffer, IFFTFLAG,
-                 BITREVERSE);
-
-    while (1) {}
+    /* Measurement buffers: boot buffers first, then the scratch that the
+     * stages of a channel job share.  The log records come first, so
+     * everything after can log. */
+    Arena_init(&arena, arenaMemory, sizeof(arenaMemory));
+
+    /* Deferred log records go out between frames; see tools/log_decode.py */
+    Log_init(Arena_allocBoot(&arena, Budget_LOG_BYTES));
+
+    /* Calibrate the stage timing (nothing unless PROFILE_ENABLE) */
+    Profile_INIT(systemClock);
+
+    /* Results follow as binary frames; see tools/telemetry_decode.py */
+    UARTprintf("\rCMSIS DSP Demo...\n");
+
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+    acquireBuffer = Arena_allocBoot(&arena, ACQUIRE_BYTES);
+#endif
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_GOERTZEL)
+    harmonics = Arena_allocBoot(&arena,
+        Budget_GOERTZEL_RESULT_BYTES(Channels_COUNT, NUM_HARMONICS));
+    channelFrame = Arena_allocScratch(&arena,
+                                      Budget_FRAME_BYTES(NUM_SAMPLES));
+#elif (HARMONIC_ENGINE == HARMONIC_ENGINE_SDFT)
+    sdftHistory = Arena_allocBoot(&arena,
+        Budget_SDFT_HISTORY_BYTES(NUM_SAMPLES, Channels_COUNT));
+    sdftCosTable = Arena_allocBoot(&arena,
+                                   Budget_SDFT_TABLE_BYTES(NUM_SAMPLES));
+    harmonics = Arena_allocBoot(&arena,
+        Budget_SDFT_RESULT_BYTES(Channels_COUNT, NUM_HARMONICS));
+
+    /* The frame and its q15 copy are needed together */
+    channelFrame = Arena_allocScratch(&arena,
+                                      Budget_SDFT_SCRATCH_BYTES(NUM_SAMPLES));
+#if (PRECISION != PRECISION_Q15)
+    sdftFrame = (q15_t *)((uint8_t *)channelFrame +
+                          Budget_FRAME_BYTES(NUM_SAMPLES));
+#endif
+#else
+    analysisHistory = Arena_allocBoot(&arena,
+        Budget_FFT_HISTORY_BYTES(Channels_COUNT));
+    analysisWindow = Arena_allocBoot(&arena, Budget_FFT_WINDOW_BYTES);
+    channelFrame = Arena_allocScratch(&arena,
+                                      Budget_FRAME_BYTES(NUM_SAMPLES));
+    analysisWork = Arena_allocScratch(&arena, Budget_FFT_WORK_BYTES);
+#endif
+    Log_print3("arena: %u bytes boot, %u scratch, %u unused", arena.boot,
+               arena.scratch, Arena_unused(&arena));
+
+    for (i = 0; i < Channels_COUNT; i++) {
+        Ingest_init(&ingest[i], Ingest_DC_SHIFT_DEFAULT);
+    }
+
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_GOERTZEL)
+    Goertzel_initHarmonics(&goertzel, NUM_SAMPLES, FUNDAMENTAL_BIN,
+                           NUM_HARMONICS);
+#elif (HARMONIC_ENGINE == HARMONIC_ENGINE_SDFT)
+    for (i = 0; i < NUM_HARMONICS; i++) {
+        sdftBins[i] = FUNDAMENTAL_BIN * (i + 1);
+    }
+    for (i = 0; i < Channels_COUNT; i++) {
+        Sdft_init(&sdft[i], NUM_SAMPLES, sdftBins, NUM_HARMONICS,
+                  SDFT_ANCHOR_PERIOD, sdftHistory[i], sdftCosTable);
+    }
+#else
+    config.fftLen = NUM_SAMPLES;
+    config.cycles = FUNDAMENTAL_BIN;
+    config.window = FFT_WINDOW;
+    config.numHarmonics = NUM_HARMONICS;
+    for (i = 0; i < NUM_HARMONICS; i++) {
+        config.orders[i] = i + 1;
+    }
+    Analysis_init(&analysis, Channels_COUNT, analysisHistory, analysisWork,
+                  analysisWindow, NUM_SAMPLES / FUNDAMENTAL_BIN, SAMP_FREQ);
+    Analysis_configure(&analysis, &config);
+#if defined(CONSOLE_ENABLE)
+    Console_init(&console, &analysis);
+#endif
+#endif
+
+    /* From here on the interrupts only post events, and the handlers run
+     * in the main loop */
+    Event_init(&loop);
+    Event_register(&loop, EVENT_BUTTON, buttonEvent, NULL);
+    Event_register(&loop, EVENT_LOG, logEvent, NULL);
+    GPIO_setCallback(CONFIG_GPIO_BUTTON_0, buttonPressed);
+#if defined(CONSOLE_ENABLE)
+    Event_register(&loop, EVENT_CONSOLE, consoleEvent, NULL);
+#endif
+#if defined(UART_BUFFERED)
+    UARTEventCallbackSet(uartEvent);
+#endif
+#if defined(FREQUENCY_ENABLE)
+    if (Frequency_init(&mains, FREQUENCY_CYCLES, systemClock) ==
+        Frequency_STATUS_SUCCESS) {
+        Log_print1("frequency: T2CCP0 capture over %u cycles",
+                   FREQUENCY_CYCLES);
+    }
+    else {
+        Log_print0("frequency: capture setup failed");
+    }
+#endif
+
+#if (SIGNAL_SOURCE == SIGNAL_SOURCE_ADC)
+    /* Start gapless acquisition; the frame event processes channel k of
+     * frame n while frame n + 1 is being captured */
+    Acquire_init(&acquire, Channels_config, Channels_COUNT, acquireBuffer,
+                 NUM_SAMPLES, SAMP_FREQ, systemClock, frameReady, NULL);
+    Scheduler_init(&scheduler, &acquire, systemClock, processChannel, NULL);
+    Event_register(&loop, EVENT_FRAME, frameEvent, NULL);
+#if defined(STREAM_ENABLE)
+    streaming = (Stream_init(&stream, Stream_BAUD_RATE, systemClock) ==
+                 Stream_STATUS_SUCCESS);
+    if (streaming) {
+        Log_print1("stream: UART1 at %u baud", stream.baudRate);
+    }
+    else {
+        Log_print0("stream: UART1 setup failed");
+    }
+#endif
+    Log_print3("acquire: %u channels, %u samples at %u Hz", Channels_COUNT,
+               NUM_SAMPLES, SAMP_FREQ);
+#if defined(TRIGGER_ENABLE)
+    /* Frames from now on start at a zero crossing instead */
+    if (Trigger_init(&trigger, TRIGGER_HOLD_OFF_US, systemClock) ==
+        Trigger_STATUS_SUCCESS) {
+        Acquire_setTriggered(&acquire, true);
+#if (HARMONIC_ENGINE == HARMONIC_ENGINE_FFT)
+        Analysis_setTriggered(&analysis, true);
+#endif
+        GPIO_setCallback(CONFIG_GPIO_ZERO_CROSS, zeroCrossing);
+        GPIO_enableInt(CONFIG_GPIO_ZERO_CROSS);
+        Log_print1("trigger: zero crossings, %u us hold-off",
+                   TRIGGER_HOLD_OFF_US);
+    }
+#endif
+    Acquire_start(&acquire);
+#else
+    /* Run the recorded waveform through every channel once */
+    for (i = 0; i < Channels_COUNT; i++) {
+        processChannel(0, i, NULL);
+    }
+#endif
+
+    /* Sleep until an interrupt posts an event; this does not return */
+    Event_run(&loop);
 }
@@ -0,0 +1,85 @@
+/*
+ *  ======== placement.h ========
+ *  SRAM placement of the hot kernels.
+ *
+ *  At 120 MHz the flash runs with wait states behind a prefetch buffer,
+ *  so code that branches a lot, and tables read with a stride, stall on
+ *  it.  Code and tables can instead run from SRAM: the linker keeps their
+ *  image in flash and the start-up code copies it to SRAM through the
+ *  BINIT copy table before main() (.TI.ramfunc and .TI.ramconst in
+ *  MSP_EXP432E401Y_NoRTOS.cmd).
+ *
+ *  Functions of this project are marked with Placement_RAMFUNC through one
+ *  macro per kernel below, selected by the Placement_KERNELS mask.  The
+ *  CMSIS-DSP code (FFT butterflies, bit reversal, magnitude) and its
+ *  tables come from a prebuilt library and are selected by input section
+ *  name in the linker command file, under its own RAM_* switches.
+ *
+ *  Tables follow the FFT length differently:
+ *
+ *      window      Analysis_configure() copies the coefficients of the
+ *                  active window and length into an arena buffer, so they
+ *                  are in SRAM for every length set on the console.
+ *      twiddles    The linker copies the CMSIS-DSP twiddle and bit
+ *                  reversal tables of NUM_SAMPLES (1024) only.  They are
+ *                  const tables the CMSIS instances point to, one set per
+ *                  length, and all of them would not fit; an FFT length
+ *                  other than 1024 set at run time reads its tables from
+ *                  flash, and its transform stage is slower than the
+ *                  profile of the 1024-point build shows.
+ *
+ *  tools/placement_report.py lists the SRAM cost of every candidate from
+ *  the linker map, and the cycle gain per profile stage from a
+ *  Profile_REPORT() capture of a build with and one without the kernels
+ *  in SRAM.
+ *
+ *  Building with HOST_BUILD leaves every function where it is.
+ */
+#ifndef PLACEMENT_H_
+#define PLACEMENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Kernels that can be marked for SRAM, one bit each
+ */
+#define Placement_INGEST        (0x01U)     /*!< Ingest_deinterleave() */
+#define Placement_WINDOW        (0x02U)     /*!< Window_apply() */
+
+/*!
+ *  @brief  Kernels copied to SRAM at boot
+ */
+#ifndef Placement_KERNELS
+#define Placement_KERNELS       (Placement_INGEST | Placement_WINDOW)
+#endif
+
+/*!
+ *  @brief  Run the function that follows from SRAM
+ */
+#if defined(HOST_BUILD)
+#define Placement_RAMFUNC
+#elif defined(__TI_COMPILER_VERSION__)
+#define Placement_RAMFUNC       __attribute__((ramfunc))
+#else
+#define Placement_RAMFUNC       __attribute__((section(".TI.ramfunc")))
+#endif
+
+#if (Placement_KERNELS & Placement_INGEST)
+#define Placement_INGEST_FXN    Placement_RAMFUNC
+#else
+#define Placement_INGEST_FXN
+#endif
+
+#if (Placement_KERNELS & Placement_WINDOW)
+#define Placement_WINDOW_FXN    Placement_RAMFUNC
+#else
+#define Placement_WINDOW_FXN
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PLACEMENT_H_ */
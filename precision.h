@@ -0,0 +1,75 @@
+/*
+ *  ======== precision.h ========
+ *  Numeric precision of the analysis chain.
+ *
+ *  One setting selects the sample format used by every stage: ingest,
+ *  window, FFT, magnitude and harmonic extraction.
+ *
+ *  PRECISION_Q15   16-bit fixed point.  Cheapest in memory and cycles, but
+ *                  the q15 RFFT scales by 1/2 in every stage, so the noise
+ *                  floor rises with the FFT length.
+ *  PRECISION_Q31   32-bit fixed point.  Same scaling, with 16 more bits
+ *                  below it.
+ *  PRECISION_F32   Single-precision float on the Cortex-M4F FPU.  No
+ *                  scaling; the spectrum is divided by fftLen once at the
+ *                  end so all three report X[k] / N.
+ *
+ *  Define PRECISION on the compiler command line or edit the default
+ *  below.  tools/precision_report.c measures the cost and the THD error of
+ *  each choice.
+ */
+#ifndef PRECISION_H_
+#define PRECISION_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PRECISION_Q15   0
+#define PRECISION_Q31   1
+#define PRECISION_F32   2
+
+#ifndef PRECISION
+#define PRECISION       PRECISION_Q15
+#endif
+
+#if (PRECISION == PRECISION_Q15)
+/*!
+ *  @brief  Sample of the analysis chain
+ */
+typedef q15_t Precision_Sample;
+
+#define Precision_NAME          "q15"
+#define Precision_max           arm_max_q15
+#define Precision_rms           arm_rms_q15
+#define Precision_toFloat(x)    ((float32_t)(x) * (1.0f / 32768.0f))
+
+#elif (PRECISION == PRECISION_Q31)
+typedef q31_t Precision_Sample;
+
+#define Precision_NAME          "q31"
+#define Precision_max           arm_max_q31
+#define Precision_rms           arm_rms_q31
+#define Precision_toFloat(x)    ((float32_t)(x) * (1.0f / 2147483648.0f))
+
+#elif (PRECISION == PRECISION_F32)
+typedef float32_t Precision_Sample;
+
+#define Precision_NAME          "f32"
+#define Precision_max           arm_max_f32
+#define Precision_rms           arm_rms_f32
+#define Precision_toFloat(x)    ((float32_t)(x))
+
+#else
+#error "PRECISION must be PRECISION_Q15, PRECISION_Q31 or PRECISION_F32"
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRECISION_H_ */
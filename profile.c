@@ -0,0 +1,185 @@
+/*
+ *  ======== profile.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(HOST_BUILD)
+#include <time.h>
+#else
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "profile.h"
+
+#if defined(PROFILE_ENABLE)
+#include "uartstdio.h"
+
+/* Ticks of an empty begin/end pair averaged over this many runs */
+#define CALIBRATE_RUNS  (16)
+
+static const char *stageNames[Profile_STAGE_COUNT] = {
+    "ingest",
+    "transform",
+    "magnitude",
+    "peak",
+    "channel",
+    "console"
+};
+
+static Profile_Stats stats[Profile_STAGE_COUNT];
+static uint32_t tickRate;
+static uint32_t overhead;
+#endif
+
+/*
+ *  ======== Profile_startCounter ========
+ */
+void Profile_startCounter(void)
+{
+#if !defined(HOST_BUILD)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/*
+ *  ======== Profile_now ========
+ */
+uint32_t Profile_now(void)
+{
+#if defined(HOST_BUILD)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint32_t)(((uint64_t)ts.tv_sec * 1000000000ULL) +
+                       (uint64_t)ts.tv_nsec));
+#else
+    return (DWT->CYCCNT);
+#endif
+}
+
+#if defined(PROFILE_ENABLE)
+/*
+ *  ======== clearPeriod ========
+ */
+static void clearPeriod(Profile_Stats *s)
+{
+    s->count = 0;
+    s->min = UINT32_MAX;
+    s->max = 0;
+    s->total = 0;
+}
+
+/*
+ *  ======== Profile_init ========
+ */
+void Profile_init(uint32_t systemClock)
+{
+    uint_least8_t i;
+
+#if defined(HOST_BUILD)
+    (void)systemClock;
+
+    tickRate = 1000000000U;
+#else
+    tickRate = systemClock;
+#endif
+
+    Profile_startCounter();
+
+    /* Time empty pairs with no correction applied yet */
+    overhead = 0;
+    clearPeriod(&stats[0]);
+    for (i = 0; i < CALIBRATE_RUNS; i++) {
+        Profile_begin((Profile_Stage)0);
+        Profile_end((Profile_Stage)0);
+    }
+    overhead = stats[0].min;
+
+    for (i = 0; i < Profile_STAGE_COUNT; i++) {
+        clearPeriod(&stats[i]);
+        stats[i].worst = 0;
+    }
+}
+
+/*
+ *  ======== Profile_begin ========
+ */
+void Profile_begin(Profile_Stage stage)
+{
+    stats[stage].start = Profile_now();
+}
+
+/*
+ *  ======== Profile_end ========
+ */
+void Profile_end(Profile_Stage stage)
+{
+    Profile_Stats *s = &stats[stage];
+    uint32_t elapsed = Profile_now() - s->start;
+
+    elapsed = (elapsed > overhead) ? (elapsed - overhead) : 0;
+
+    s->count++;
+    s->total += elapsed;
+    if (elapsed < s->min) {
+        s->min = elapsed;
+    }
+    if (elapsed > s->max) {
+        s->max = elapsed;
+    }
+    if (elapsed > s->worst) {
+        s->worst = elapsed;
+    }
+}
+
+/*
+ *  ======== toMicroseconds ========
+ */
+static uint32_t toMicroseconds(uint32_t ticks)
+{
+    return ((uint32_t)(((uint64_t)ticks * 1000000U) / tickRate));
+}
+
+/*
+ *  ======== Profile_report ========
+ */
+void Profile_report(void)
+{
+    Profile_Stats *s;
+    uint32_t avg;
+    uint_least8_t i;
+
+    Profile_begin(Profile_STAGE_CONSOLE);
+
+    UARTprintf("\nstage       count       min       avg       max     worst"
+               "  avg us  max us\n");
+
+    for (i = 0; i < Profile_STAGE_COUNT; i++) {
+        s = &stats[i];
+        if (s->count == 0) {
+            continue;
+        }
+
+        avg = (uint32_t)(s->total / s->count);
+        UARTprintf("%10s %6u %9u %9u %9u %9u %7u %7u\n", stageNames[i],
+                   s->count, s->min, avg, s->max, s->worst,
+                   toMicroseconds(avg), toMicroseconds(s->worst));
+
+        clearPeriod(s);
+    }
+
+    /* Accounted in the next report */
+    Profile_end(Profile_STAGE_CONSOLE);
+}
+
+/*
+ *  ======== Profile_getStats ========
+ */
+const Profile_Stats *Profile_getStats(Profile_Stage stage)
+{
+    return (&stats[stage]);
+}
+#endif
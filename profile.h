@@ -0,0 +1,116 @@
+/*
+ *  ======== profile.h ========
+ *  Stage timing on the DWT cycle counter.
+ *
+ *  Profile_BEGIN() and Profile_END() bracket a pipeline stage; every pair
+ *  adds one sample to that stage's statistics.  Profile_REPORT() prints
+ *  min/avg/max since the previous report and the worst case since start-up
+ *  through uartstdio, and then starts a new period.  The report's own
+ *  console output is timed as the Profile_STAGE_CONSOLE stage.
+ *
+ *  The markers are only compiled in when PROFILE_ENABLE is defined;
+ *  otherwise they expand to nothing and production images pay nothing.
+ *  The functions behind them, Profile_getStats() included, are declared
+ *  only with PROFILE_ENABLE, so a stray call fails to compile rather than
+ *  to link.  Profile_now() and Profile_startCounter() are always available
+ *  for code that needs the time base itself.
+ *
+ *  On the target one tick is one CPU cycle (DWT CYCCNT).  Building with
+ *  HOST_BUILD replaces it with CLOCK_MONOTONIC nanoseconds.  Intervals are
+ *  taken modulo 2^32, so a single stage must take less than 35 s at
+ *  120 MHz (4.2 s on the host).
+ */
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Timed stages
+ */
+typedef enum {
+    Profile_STAGE_INGEST = 0,   /*!< ADC codes to samples */
+    Profile_STAGE_TRANSFORM,    /*!< Window and FFT, Goertzel or SDFT */
+    Profile_STAGE_MAGNITUDE,    /*!< Bin magnitudes */
+    Profile_STAGE_PEAK,         /*!< Peak search and interpolation */
+    Profile_STAGE_CHANNEL,      /*!< One channel, end to end */
+    Profile_STAGE_CONSOLE,      /*!< Printing the last report */
+    Profile_STAGE_COUNT
+} Profile_Stage;
+
+/*!
+ *  @brief  Statistics of one stage
+ */
+typedef struct {
+    uint32_t start;     /*!< Tick of the open Profile_BEGIN() */
+    uint32_t count;     /*!< Samples in this period */
+    uint32_t min;       /*!< Shortest in this period */
+    uint32_t max;       /*!< Longest in this period */
+    uint64_t total;     /*!< Sum over this period */
+    uint32_t worst;     /*!< Longest since Profile_init() */
+} Profile_Stats;
+
+#if defined(PROFILE_ENABLE)
+#define Profile_INIT(systemClock)   Profile_init(systemClock)
+#define Profile_BEGIN(stage)        Profile_begin(stage)
+#define Profile_END(stage)          Profile_end(stage)
+#define Profile_REPORT()            Profile_report()
+#else
+#define Profile_INIT(systemClock)
+#define Profile_BEGIN(stage)
+#define Profile_END(stage)
+#define Profile_REPORT()
+#endif
+
+/*!
+ *  @brief  Start the cycle counter.  Harmless if it already runs.
+ */
+extern void Profile_startCounter(void);
+
+/*!
+ *  @brief  Current tick: CPU cycles, or nanoseconds on the host.
+ */
+extern uint32_t Profile_now(void);
+
+#if defined(PROFILE_ENABLE)
+/*!
+ *  @brief  Clear all statistics and measure the cost of an empty
+ *          begin/end pair, which is subtracted from every sample.
+ *
+ *  @param  systemClock  CPU clock in Hz (ignored on the host)
+ */
+extern void Profile_init(uint32_t systemClock);
+
+/*!
+ *  @brief  Mark the start of a stage.
+ */
+extern void Profile_begin(Profile_Stage stage);
+
+/*!
+ *  @brief  Mark the end of a stage and account the elapsed ticks.
+ */
+extern void Profile_end(Profile_Stage stage);
+
+/*!
+ *  @brief  Print every stage that ran and start a new period.
+ *
+ *  One line per stage: count, min/avg/max and worst case in ticks, and
+ *  the average and worst case in microseconds.
+ */
+extern void Profile_report(void);
+
+/*!
+ *  @brief  Statistics of a stage, for callers that report themselves.
+ */
+extern const Profile_Stats *Profile_getStats(Profile_Stage stage);
+#endif /* PROFILE_ENABLE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H_ */
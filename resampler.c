@@ -0,0 +1,152 @@
+/*
+ *  ======== resampler.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "resampler.h"
+
+/* One input sample period in Q32.32 */
+#define POS_ONE         (1ULL << 32)
+
+/* Default output rate before the first frequency estimate (50 Hz) */
+#define DEFAULT_UHZ     (50000000UL)
+
+/* 2^32 / 6, rounded up, for the final division of the Lagrange sum */
+#define RECIP_SIX       (715827883LL)
+
+/*
+ *  ======== interpolate ========
+ *  Third-order Lagrange interpolation between h[1] and h[2] at fractional
+ *  position mu (Q31).  With the taps at -1, 0, 1, 2:
+ *
+ *      6 * c1 = -2 h0 - 3 h1 + 6 h2 - h3
+ *      6 * c2 =  3 h0 - 6 h1 + 3 h2
+ *      6 * c3 = -h0 + 3 h1 - 3 h2 + h3
+ *      y = h1 + ((6 c3 * mu + 6 c2) * mu + 6 c1) * mu / 6
+ */
+static q15_t interpolate(const q15_t *h, int32_t mu)
+{
+    int32_t c1 = (-2 * h[0]) - (3 * h[1]) + (6 * h[2]) - h[3];
+    int32_t c2 = (3 * h[0]) - (6 * h[1]) + (3 * h[2]);
+    int32_t c3 = -h[0] + (3 * h[1]) - (3 * h[2]) + h[3];
+    int64_t acc;
+    int32_t y;
+
+    acc = (((int64_t)c3 * mu) >> 31) + c2;
+    acc = ((acc * mu) >> 31) + c1;
+    acc = (acc * mu) >> 31;
+
+    /* Divide by 6 with rounding */
+    y = h[1] + (int32_t)(((acc * RECIP_SIX) + (1LL << 31)) >> 32);
+
+    if (y > INT16_MAX) {
+        y = INT16_MAX;
+    }
+    else if (y < INT16_MIN) {
+        y = INT16_MIN;
+    }
+
+    return ((q15_t)y);
+}
+
+/*
+ *  ======== Resampler_init ========
+ */
+int_fast16_t Resampler_init(Resampler_Object *obj, uint32_t inRate,
+                            uint16_t samplesPerCycle, q15_t *frame,
+                            uint16_t frameLen,
+                            Resampler_CallbackFxn callbackFxn, void *arg)
+{
+    uint16_t cycles;
+
+    if ((obj == NULL) || (frame == NULL) || (callbackFxn == NULL) ||
+        (inRate == 0) || (samplesPerCycle == 0) ||
+        ((samplesPerCycle & (samplesPerCycle - 1)) != 0) ||
+        (frameLen < samplesPerCycle) || ((frameLen % samplesPerCycle) != 0)) {
+        return (Resampler_STATUS_ERROR);
+    }
+
+    cycles = frameLen / samplesPerCycle;
+    if ((cycles & (cycles - 1)) != 0) {
+        return (Resampler_STATUS_ERROR);
+    }
+
+    obj->inRate = inRate;
+    obj->samplesPerCycle = samplesPerCycle;
+    obj->frameLen = frameLen;
+    obj->count = 0;
+    obj->pos = POS_ONE;
+    obj->hist[0] = 0;
+    obj->hist[1] = 0;
+    obj->hist[2] = 0;
+    obj->hist[3] = 0;
+    obj->frame = frame;
+    obj->callbackFxn = callbackFxn;
+    obj->arg = arg;
+
+    return (Resampler_setFrequency(obj, DEFAULT_UHZ));
+}
+
+/*
+ *  ======== Resampler_setFrequency ========
+ *  step = inRate / (f0 * samplesPerCycle) input samples per output sample.
+ *  This runs once per frame at most, so plain double arithmetic is used.
+ */
+int_fast16_t Resampler_setFrequency(Resampler_Object *obj,
+                                    uint32_t fundamentalUHz)
+{
+    double step;
+
+    if (fundamentalUHz == 0) {
+        return (Resampler_STATUS_ERROR);
+    }
+
+    step = ((double)obj->inRate * 1.0e6) /
+           ((double)fundamentalUHz * (double)obj->samplesPerCycle);
+
+    if (step >= 2147483648.0) {
+        return (Resampler_STATUS_ERROR);
+    }
+
+    obj->step = (uint64_t)((step * 4294967296.0) + 0.5);
+
+    return (Resampler_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Resampler_process ========
+ *  pos is the position of the next output sample measured from hist[1], in
+ *  input sample periods.  Every input sample shifts the history by one and
+ *  pulls pos back by one period; outputs are produced while pos lies in the
+ *  interval [hist[1], hist[2]) where the interpolator is centered, so pos is
+ *  always at least one period when the loop exits.
+ */
+void Resampler_process(Resampler_Object *obj, const q15_t *src,
+                       uint32_t numSamples)
+{
+    uint32_t i;
+
+    for (i = 0; i < numSamples; i++) {
+        obj->hist[0] = obj->hist[1];
+        obj->hist[1] = obj->hist[2];
+        obj->hist[2] = obj->hist[3];
+        obj->hist[3] = src[i];
+
+        /* Positions are relative to hist[1], which just moved by one */
+        obj->pos -= POS_ONE;
+
+        while (obj->pos < POS_ONE) {
+            /* The fraction is Q32; drop one bit for the Q31 interpolator */
+            obj->frame[obj->count++] =
+                interpolate(obj->hist, (int32_t)((uint32_t)obj->pos >> 1));
+
+            if (obj->count == obj->frameLen) {
+                obj->callbackFxn(obj->frame, obj->frameLen, obj->arg);
+                obj->count = 0;
+            }
+
+            obj->pos += obj->step;
+        }
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ *  ======== resampler.h ========
+ *  Frequency-tracking resampler for coherent sampling.
+ *
+ *  Converts the fixed-rate ADC stream into a stream with exactly
+ *  samplesPerCycle samples per cycle of the mains fundamental, driven by an
+ *  external estimate of the fundamental frequency.  Output samples are
+ *  collected into frames of a whole number of cycles (for example 1024
+ *  samples = 8 cycles of 128), so every harmonic falls exactly on an FFT bin
+ *  and the FFT can run without a window or bin interpolation.
+ *
+ *  Interpolation is a 4-point, third-order Lagrange fractional-delay filter
+ *  evaluated in fixed point.  The input must already be band-limited to well
+ *  below half the output rate; the resampler does not filter.  Its response
+ *  only rolls off towards the input rate, so anything between half the
+ *  output rate and half the input rate folds into the output frames.  From
+ *  the 51.2 kS/s of acquire.c to 128 samples per 50 Hz cycle (6.4 kS/s)
+ *  that is everything from 3.2 kHz to 25.6 kHz, so an anti-alias stage must
+ *  come first: an analog filter on the inputs, or a decimating low-pass
+ *  FIR to a few times the output rate.
+ *
+ *  tools/resampler_chirp.c sweeps 49 to 51 Hz and checks the lock and the
+ *  leakage between harmonics, and shows a tone above 3.2 kHz folding in.
+ *
+ *  The module is not linked into the firmware (.cproject excludes it from
+ *  the Debug build).  The acquisition has no anti-alias stage for it, the
+ *  resampler works in q15 only while the FFT path follows PRECISION, and
+ *  its frames do not line up with the acquisition frames the scheduler
+ *  and analysis.h work on.  The FFT path keeps the window and bin
+ *  interpolation instead; the resampler stays for the host tools.
+ */
+#ifndef RESAMPLER_H_
+#define RESAMPLER_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Resampler functions.
+ */
+#define Resampler_STATUS_SUCCESS    (0)
+
+/*!
+ *  @brief  Returned for an invalid configuration or frequency.
+ */
+#define Resampler_STATUS_ERROR      (-1)
+
+/*!
+ *  @brief  Called from Resampler_process() each time a frame is complete.
+ *
+ *  The frame buffer is reused for the next frame once the callback returns,
+ *  so the callback must consume or copy it.
+ *
+ *  @param  frame     Completed frame of frameLen q15 samples
+ *  @param  frameLen  Number of samples in the frame
+ *  @param  arg       User argument given to Resampler_init()
+ */
+typedef void (*Resampler_CallbackFxn)(q15_t *frame, uint16_t frameLen,
+                                      void *arg);
+
+/*!
+ *  @brief  Resampler state
+ */
+typedef struct {
+    uint32_t              inRate;           /*!< Input rate in Hz */
+    uint16_t              samplesPerCycle;  /*!< Output samples per cycle */
+    uint16_t              frameLen;         /*!< Output frame length */
+    uint16_t              count;            /*!< Samples in current frame */
+    uint64_t              step;             /*!< Input samples per output,
+                                                 Q32.32 */
+    uint64_t              pos;              /*!< Next output position past
+                                                 hist[1], Q32.32 */
+    q15_t                 hist[4];          /*!< Last four input samples */
+    q15_t                *frame;            /*!< Output frame buffer */
+    Resampler_CallbackFxn callbackFxn;      /*!< Frame complete callback */
+    void                 *arg;              /*!< Callback argument */
+} Resampler_Object;
+
+/*!
+ *  @brief  Initialize a resampler.
+ *
+ *  @param  obj              Resampler object to initialize
+ *  @param  inRate           Input sample rate in Hz
+ *  @param  samplesPerCycle  Output samples per fundamental cycle (power of 2)
+ *  @param  frame            Output frame buffer of @p frameLen samples
+ *  @param  frameLen         Frame length; a power-of-two multiple of
+ *                           @p samplesPerCycle
+ *  @param  callbackFxn      Called for every completed frame
+ *  @param  arg              Argument passed to @p callbackFxn
+ *
+ *  @return Resampler_STATUS_SUCCESS or Resampler_STATUS_ERROR
+ */
+extern int_fast16_t Resampler_init(Resampler_Object *obj, uint32_t inRate,
+                                   uint16_t samplesPerCycle, q15_t *frame,
+                                   uint16_t frameLen,
+                                   Resampler_CallbackFxn callbackFxn,
+                                   void *arg);
+
+/*!
+ *  @brief  Update the fundamental-frequency estimate.
+ *
+ *  Takes effect with the next output sample; the output phase stays
+ *  continuous.  Typically called once per frame from the frequency
+ *  measurement.
+ *
+ *  @param  obj             Initialized resampler
+ *  @param  fundamentalUHz  Fundamental frequency in micro-hertz
+ *
+ *  @return Resampler_STATUS_SUCCESS, or Resampler_STATUS_ERROR if the
+ *          frequency is zero or too low for the input rate
+ */
+extern int_fast16_t Resampler_setFrequency(Resampler_Object *obj,
+                                           uint32_t fundamentalUHz);
+
+/*!
+ *  @brief  Feed a block of input samples.
+ *
+ *  Produces output samples on the fly and invokes the callback every time
+ *  the output frame is full.  Blocks of any size may be fed; state carries
+ *  over between calls.
+ */
+extern void Resampler_process(Resampler_Object *obj, const q15_t *src,
+                              uint32_t numSamples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RESAMPLER_H_ */
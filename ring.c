@@ -0,0 +1,144 @@
+/*
+ *  ======== ring.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "ring.h"
+
+/*
+ *  ======== Ring_init ========
+ */
+int_fast16_t Ring_init(Ring_Object *obj, void *buffer, uint32_t elemSize,
+                       uint32_t numElems)
+{
+    if ((buffer == NULL) || (elemSize == 0) || (numElems == 0) ||
+        ((numElems & (numElems - 1U)) != 0)) {
+        return (Ring_STATUS_ERROR);
+    }
+
+    obj->buffer = (uint8_t *)buffer;
+    obj->elemSize = elemSize;
+    obj->mask = numElems - 1U;
+    obj->head = 0;
+    obj->tail = 0;
+    obj->claim = 0;
+
+    return (Ring_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Ring_write ========
+ *  The run up to the end of the buffer, then the wrapped rest.
+ */
+uint32_t Ring_write(Ring_Object *obj, const void *src, uint32_t numElems)
+{
+    uint32_t head = obj->head;
+    uint32_t space = obj->mask + 1U - (head - Ring_load(&obj->tail));
+    uint32_t offset = head & obj->mask;
+    uint32_t first;
+
+    if (numElems > space) {
+        numElems = space;
+    }
+    first = obj->mask + 1U - offset;
+    if (first > numElems) {
+        first = numElems;
+    }
+
+    memcpy(obj->buffer + (offset * obj->elemSize), src,
+           (size_t)first * obj->elemSize);
+    memcpy(obj->buffer, (const uint8_t *)src + (first * obj->elemSize),
+           (size_t)(numElems - first) * obj->elemSize);
+    Ring_store(&obj->head, head + numElems);
+
+    return (numElems);
+}
+
+/*
+ *  ======== Ring_read ========
+ */
+uint32_t Ring_read(Ring_Object *obj, void *dst, uint32_t numElems)
+{
+    uint32_t tail = obj->tail;
+    uint32_t offset = tail & obj->mask;
+    uint32_t first;
+
+    numElems = Ring_claim(obj, tail, numElems);
+    first = obj->mask + 1U - offset;
+    if (first > numElems) {
+        first = numElems;
+    }
+
+    memcpy(dst, obj->buffer + (offset * obj->elemSize),
+           (size_t)first * obj->elemSize);
+    memcpy((uint8_t *)dst + (first * obj->elemSize), obj->buffer,
+           (size_t)(numElems - first) * obj->elemSize);
+    Ring_store(&obj->tail, tail + numElems);
+
+    return (numElems);
+}
+
+/*
+ *  ======== Ring_reserve ========
+ */
+uint32_t Ring_reserve(Ring_Object *obj, void **ptr)
+{
+    uint32_t head = obj->head;
+    uint32_t space = obj->mask + 1U - (head - Ring_load(&obj->tail));
+    uint32_t offset = head & obj->mask;
+
+    *ptr = obj->buffer + (offset * obj->elemSize);
+    if (space > (obj->mask + 1U - offset)) {
+        space = obj->mask + 1U - offset;
+    }
+
+    return (space);
+}
+
+/*
+ *  ======== Ring_retract ========
+ *  Move head back first, then look at claim: a consumer that claims after
+ *  the barrier sees the new head, and one that claimed before is seen
+ *  here.  In the second case head goes back to where it was.
+ */
+uint32_t Ring_retract(Ring_Object *obj, uint32_t numElems)
+{
+    uint32_t head = obj->head;
+    uint32_t count = head - Ring_load(&obj->claim);
+
+    /* A claim past head is one being cut back to it */
+    if (count > (obj->mask + 1U)) {
+        count = 0;
+    }
+    if (numElems > count) {
+        numElems = count;
+    }
+    if (numElems == 0U) {
+        return (0);
+    }
+
+    Ring_store(&obj->head, head - numElems);
+    Ring_fence();
+
+    if ((int32_t)(Ring_load(&obj->claim) - (head - numElems)) > 0) {
+        Ring_store(&obj->head, head);
+        return (0);
+    }
+
+    return (numElems);
+}
+
+/*
+ *  ======== Ring_peek ========
+ */
+uint32_t Ring_peek(Ring_Object *obj, void **ptr)
+{
+    uint32_t tail = obj->tail;
+    uint32_t offset = tail & obj->mask;
+
+    *ptr = obj->buffer + (offset * obj->elemSize);
+
+    return (Ring_claim(obj, tail, obj->mask + 1U - offset));
+}
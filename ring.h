@@ -0,0 +1,303 @@
+/*
+ *  ======== ring.h ========
+ *  Lock-free single-producer, single-consumer ring of fixed-size elements.
+ *
+ *  One side only ever writes (put, write, reserve/commit, retract) and the
+ *  other only ever reads (get, read, peek/release), for example an ISR and
+ *  the main loop, the main loop and the uDMA completion interrupt, or two
+ *  threads on the host.  Neither side takes a lock or disables interrupts.
+ *
+ *  The element count is a power of two.  head and tail count elements
+ *  written and read since Ring_init() and are never wrapped, so the fill
+ *  is head - tail in modulo-2^32 arithmetic, a slot is found by masking,
+ *  and every one of the elements can be used.  Only the producer stores
+ *  head and only the consumer stores tail and claim.
+ *
+ *  claim is where the consumer is reading up to: it is published before
+ *  the consumer looks at head, so a retract can tell the elements the
+ *  consumer may already hold from those it cannot have seen.  Both sides
+ *  store their index, then load the other's, with a full barrier between,
+ *  so at least one of them sees the other and backs off.
+ *
+ *  Ordering: an element is filled before head moves past it and read
+ *  before tail moves past it.  On the target the index stores are fenced
+ *  with a DMB, which also keeps the compiler from moving buffer accesses
+ *  across them; on the host they are C11-style acquire/release atomics.
+ *
+ *  reserve/commit and peek/release hand out the contiguous run of free or
+ *  queued elements up to the end of the buffer, so a block can be packed
+ *  in place or given to the uDMA without a copy.  write/read copy any
+ *  number of elements with at most two memcpy() calls each.
+ */
+#ifndef RING_H_
+#define RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if !defined(HOST_BUILD)
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Ring functions.
+ */
+#define Ring_STATUS_SUCCESS     (0)
+
+/*!
+ *  @brief  Returned when the element count is not a power of two.
+ */
+#define Ring_STATUS_ERROR       (-1)
+
+/*!
+ *  @brief  Ring state
+ */
+typedef struct {
+    uint8_t          *buffer;       /*!< numElems * elemSize bytes */
+    uint32_t          elemSize;     /*!< Bytes per element */
+    uint32_t          mask;         /*!< numElems - 1 */
+    volatile uint32_t head;         /*!< Elements written, producer only */
+    volatile uint32_t tail;         /*!< Elements read, consumer only */
+    volatile uint32_t claim;        /*!< Elements being read, consumer only */
+} Ring_Object;
+
+/*!
+ *  @brief  Load an index written by the other side.
+ */
+static inline uint32_t Ring_load(const volatile uint32_t *index)
+{
+#if defined(HOST_BUILD)
+    return (__atomic_load_n(index, __ATOMIC_ACQUIRE));
+#else
+    uint32_t value = *index;
+
+    __DMB();
+
+    return (value);
+#endif
+}
+
+/*!
+ *  @brief  Publish an index to the other side.
+ */
+static inline void Ring_store(volatile uint32_t *index, uint32_t value)
+{
+#if defined(HOST_BUILD)
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+#else
+    __DMB();
+    *index = value;
+#endif
+}
+
+/*!
+ *  @brief  Full barrier between a store and a later load.
+ */
+static inline void Ring_fence(void)
+{
+#if defined(HOST_BUILD)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#else
+    __DMB();
+#endif
+}
+
+/*!
+ *  @brief  Elements queued past @p tail.  Consumer only.
+ *
+ *  A retract that loses to the consumer on the host can leave head below
+ *  tail for a moment before it puts it back; that reads as empty.
+ */
+static inline uint32_t Ring_queued(const Ring_Object *obj, uint32_t tail)
+{
+    uint32_t count = Ring_load(&obj->head) - tail;
+
+    return ((count > (obj->mask + 1U)) ? 0U : count);
+}
+
+/*!
+ *  @brief  Claim up to @p numElems elements from @p tail before reading
+ *          them.  Consumer only.
+ *
+ *  @return Elements claimed, at most the number queued
+ */
+static inline uint32_t Ring_claim(Ring_Object *obj, uint32_t tail,
+                                  uint32_t numElems)
+{
+    uint32_t count;
+
+    obj->claim = tail + numElems;
+    Ring_fence();
+
+    count = Ring_queued(obj, tail);
+    if (numElems > count) {
+        numElems = count;
+        obj->claim = tail + numElems;
+    }
+
+    return (numElems);
+}
+
+/*!
+ *  @brief  Set up an empty ring.
+ *
+ *  @param  obj       Ring to initialize
+ *  @param  buffer    Storage for @p numElems elements of @p elemSize bytes
+ *  @param  elemSize  Bytes per element, 1 for a byte ring
+ *  @param  numElems  Capacity, a power of two
+ *
+ *  @return Ring_STATUS_SUCCESS or Ring_STATUS_ERROR
+ */
+extern int_fast16_t Ring_init(Ring_Object *obj, void *buffer,
+                              uint32_t elemSize, uint32_t numElems);
+
+/*!
+ *  @brief  Elements queued.  Exact for the consumer, a lower bound for the
+ *          producer.
+ */
+static inline uint32_t Ring_count(const Ring_Object *obj)
+{
+    return (Ring_queued(obj, Ring_load(&obj->tail)));
+}
+
+/*!
+ *  @brief  Elements free.  Exact for the producer, a lower bound for the
+ *          consumer.
+ */
+static inline uint32_t Ring_space(const Ring_Object *obj)
+{
+    return (obj->mask + 1U -
+            (Ring_load(&obj->head) - Ring_load(&obj->tail)));
+}
+
+/*!
+ *  @brief  Pointer to the @p offset-th queued element, 0 being the oldest.
+ *          Consumer only; @p offset must be below Ring_count().
+ */
+static inline void *Ring_at(const Ring_Object *obj, uint32_t offset)
+{
+    return (obj->buffer + (((obj->tail + offset) & obj->mask) *
+                           obj->elemSize));
+}
+
+/*!
+ *  @brief  Queue one byte of a byte ring.  Producer only.
+ *
+ *  @return false if the ring was full
+ */
+static inline bool Ring_putByte(Ring_Object *obj, uint8_t value)
+{
+    uint32_t head = obj->head;
+
+    if ((head - Ring_load(&obj->tail)) > obj->mask) {
+        return (false);
+    }
+    obj->buffer[head & obj->mask] = value;
+    Ring_store(&obj->head, head + 1U);
+
+    return (true);
+}
+
+/*!
+ *  @brief  Take the oldest byte of a byte ring.  Consumer only.
+ *
+ *  @return false if the ring was empty
+ */
+static inline bool Ring_getByte(Ring_Object *obj, uint8_t *value)
+{
+    uint32_t tail = obj->tail;
+
+    if (Ring_claim(obj, tail, 1) == 0U) {
+        return (false);
+    }
+    *value = obj->buffer[tail & obj->mask];
+    Ring_store(&obj->tail, tail + 1U);
+
+    return (true);
+}
+
+/*!
+ *  @brief  Copy up to @p numElems elements in.  Producer only.
+ *
+ *  @return Elements queued, fewer than @p numElems if the ring filled up
+ */
+extern uint32_t Ring_write(Ring_Object *obj, const void *src,
+                           uint32_t numElems);
+
+/*!
+ *  @brief  Copy up to @p numElems elements out.  Consumer only.
+ *
+ *  @return Elements taken, fewer than @p numElems if the ring ran empty
+ */
+extern uint32_t Ring_read(Ring_Object *obj, void *dst, uint32_t numElems);
+
+/*!
+ *  @brief  Contiguous free run at the head.  Producer only.
+ *
+ *  Fill up to the returned number of elements at @p *ptr, then make them
+ *  visible with Ring_commit().  Wrapped free space is returned by the next
+ *  call after the commit.
+ *
+ *  @return Elements free at @p *ptr, 0 if the ring is full
+ */
+extern uint32_t Ring_reserve(Ring_Object *obj, void **ptr);
+
+/*!
+ *  @brief  Queue @p numElems reserved elements.  Producer only.
+ */
+static inline void Ring_commit(Ring_Object *obj, uint32_t numElems)
+{
+    Ring_store(&obj->head, obj->head + numElems);
+}
+
+/*!
+ *  @brief  Take back up to @p numElems of the newest elements, for example
+ *          a character rubbed out before it is read.  Producer only.
+ *
+ *  Elements the consumer has claimed are never taken back: if the
+ *  consumer claimed one of them meanwhile, the retract is undone and
+ *  returns 0, so it is safe from an ISR that preempts the consumer at any
+ *  point.
+ *
+ *  @return Elements taken back
+ */
+extern uint32_t Ring_retract(Ring_Object *obj, uint32_t numElems);
+
+/*!
+ *  @brief  Contiguous queued run at the tail.  Consumer only.
+ *
+ *  The elements stay queued, and their space reserved, until
+ *  Ring_release().
+ *
+ *  @return Elements queued at @p *ptr, 0 if the ring is empty
+ */
+extern uint32_t Ring_peek(Ring_Object *obj, void **ptr);
+
+/*!
+ *  @brief  Free @p numElems peeked elements.  Consumer only.
+ */
+static inline void Ring_release(Ring_Object *obj, uint32_t numElems)
+{
+    Ring_store(&obj->tail, obj->tail + numElems);
+}
+
+/*!
+ *  @brief  Empty the ring.  Only while neither side can run.
+ */
+static inline void Ring_reset(Ring_Object *obj)
+{
+    obj->head = 0;
+    obj->tail = 0;
+    obj->claim = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_H_ */
@@ -0,0 +1,141 @@
+/*
+ *  ======== scheduler.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "profile.h"
+#include "scheduler.h"
+
+/*
+ *  ======== Scheduler_init ========
+ */
+int_fast16_t Scheduler_init(Scheduler_Object *obj, Acquire_Object *acquire,
+                            uint32_t systemClock, Scheduler_JobFxn jobFxn,
+                            void *arg)
+{
+    uint_least8_t k;
+
+    if ((obj == NULL) || (acquire == NULL) || (jobFxn == NULL)) {
+        return (Scheduler_STATUS_ERROR);
+    }
+
+#if defined(HOST_BUILD)
+    (void)systemClock;
+
+    obj->tickRate = 1000000000U;
+#else
+    obj->tickRate = systemClock;
+#endif
+    Profile_startCounter();
+
+    obj->acquire = acquire;
+    obj->jobFxn = jobFxn;
+    obj->arg = arg;
+    obj->numChannels = acquire->numChannels;
+    obj->next = 0;
+    obj->frame = Acquire_NO_FRAME;
+    obj->framePeriod = (uint32_t)(((uint64_t)obj->tickRate *
+                                   acquire->frameLen) / acquire->sampleRate);
+    obj->pickup = 0;
+    obj->busy = 0;
+    obj->maxBusy = 0;
+    obj->frames = 0;
+
+    for (k = 0; k < obj->numChannels; k++) {
+        obj->deadline[k] = (uint32_t)(((uint64_t)obj->framePeriod * (k + 1U)) /
+                                      obj->numChannels);
+        obj->misses[k] = 0;
+        obj->maxLatency[k] = 0;
+    }
+
+    return (Scheduler_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Scheduler_poll ========
+ */
+bool Scheduler_poll(Scheduler_Object *obj)
+{
+    uint_least8_t k;
+    uint32_t start;
+    uint32_t end;
+    uint32_t latency;
+
+    if (obj->frame == Acquire_NO_FRAME) {
+        obj->frame = Acquire_getFrame(obj->acquire);
+        if (obj->frame == Acquire_NO_FRAME) {
+            return (false);
+        }
+
+        obj->pickup = Profile_now();
+        obj->next = 0;
+        obj->busy = 0;
+    }
+
+    k = obj->next;
+
+    start = Profile_now();
+    obj->jobFxn(obj->frame, k, obj->arg);
+    end = Profile_now();
+
+    obj->busy += end - start;
+
+    latency = end - obj->pickup;
+    if (latency > obj->deadline[k]) {
+        obj->misses[k]++;
+    }
+    if (latency > obj->maxLatency[k]) {
+        obj->maxLatency[k] = latency;
+    }
+
+    if (++obj->next == obj->numChannels) {
+        Acquire_releaseFrame(obj->acquire);
+        obj->frame = Acquire_NO_FRAME;
+        obj->frames++;
+
+        if (obj->busy > obj->maxBusy) {
+            obj->maxBusy = obj->busy;
+        }
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== Scheduler_getStats ========
+ */
+void Scheduler_getStats(const Scheduler_Object *obj, Scheduler_Stats *stats)
+{
+    uint32_t published = obj->acquire->frames;
+    uint32_t taken = obj->frames +
+                     ((obj->frame != Acquire_NO_FRAME) ? 1U : 0U);
+    uint_least8_t k;
+
+    stats->frames = obj->frames;
+    stats->overruns = obj->acquire->overruns;
+    stats->framePeriod = obj->framePeriod;
+    stats->maxBusy = obj->maxBusy;
+
+    /* A frame still waiting to be picked up is not dropped yet */
+    if (obj->acquire->ready != Acquire_NO_FRAME) {
+        published--;
+    }
+    stats->dropped = (published > taken) ? (published - taken) : 0;
+
+    stats->misses = 0;
+    for (k = 0; k < obj->numChannels; k++) {
+        stats->misses += obj->misses[k];
+    }
+
+    if (obj->maxBusy == 0) {
+        stats->maxFrameRate = 0;
+        stats->utilization = 0;
+    }
+    else {
+        stats->maxFrameRate = obj->tickRate / obj->maxBusy;
+        stats->utilization = (uint32_t)(((uint64_t)obj->maxBusy * 100U) /
+                                        obj->framePeriod);
+    }
+}
@@ -0,0 +1,130 @@
+/*
+ *  ======== scheduler.h ========
+ *  Pipelined per-channel DSP scheduler.
+ *
+ *  While the uDMA captures frame n + 1, the scheduler works through the
+ *  channels of frame n one job at a time, so processing overlaps capture
+ *  instead of bunching up after it.  Every frame must be finished within
+ *  one frame period, before the uDMA comes back to its buffer; channel k
+ *  (of K) is given the deadline (k + 1) / K of a frame period after the
+ *  frame was picked up, which spreads that budget evenly.
+ *
+ *  Scheduler_poll() runs one job and is the only entry point.  The main
+ *  loop calls it from its frame event (event.h) and posts the event again
+ *  while it returns true, so other events get in between the channels.
+ *
+ *  Each job is timed.  The longest total job time of any frame gives the
+ *  highest frame rate the processing can sustain, reported together with
+ *  deadline misses, dropped frames and acquisition overruns by
+ *  Scheduler_getStats().
+ *
+ *  Time is read with Profile_now(): the DWT cycle counter on the target
+ *  and CLOCK_MONOTONIC in nanoseconds with HOST_BUILD.
+ */
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "acquire.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Scheduler_init().
+ */
+#define Scheduler_STATUS_SUCCESS    (0)
+
+/*!
+ *  @brief  Returned by Scheduler_init() for an invalid configuration.
+ */
+#define Scheduler_STATUS_ERROR      (-1)
+
+/*!
+ *  @brief  Process one channel of a captured frame.
+ *
+ *  @param  frame    Frame index for Acquire_samples()
+ *  @param  channel  Channel to process
+ *  @param  arg      User argument given to Scheduler_init()
+ */
+typedef void (*Scheduler_JobFxn)(int_fast8_t frame, uint_least8_t channel,
+                                 void *arg);
+
+/*!
+ *  @brief  Scheduler statistics
+ */
+typedef struct {
+    uint32_t frames;            /*!< Frames fully processed */
+    uint32_t dropped;           /*!< Frames published but never picked up */
+    uint32_t overruns;          /*!< Frames refilled while being processed */
+    uint32_t misses;            /*!< Channel deadlines missed, all channels */
+    uint32_t framePeriod;       /*!< Frame period in ticks */
+    uint32_t maxBusy;           /*!< Longest job time of a frame, in ticks */
+    uint32_t maxFrameRate;      /*!< Sustainable frames per second */
+    uint32_t utilization;       /*!< maxBusy in percent of the frame period */
+} Scheduler_Stats;
+
+/*!
+ *  @brief  Scheduler state
+ */
+typedef struct {
+    Acquire_Object  *acquire;       /*!< Frame source */
+    Scheduler_JobFxn jobFxn;        /*!< Channel job */
+    void            *arg;           /*!< Job argument */
+    uint_least8_t    numChannels;   /*!< Jobs per frame */
+    uint_least8_t    next;          /*!< Next channel to run */
+    int_fast8_t      frame;         /*!< Frame in progress */
+    uint32_t         tickRate;      /*!< Ticks per second */
+    uint32_t         framePeriod;   /*!< Ticks per frame */
+    uint32_t         pickup;        /*!< Frame pickup time */
+    uint32_t         busy;          /*!< Job time of the current frame */
+    uint32_t         maxBusy;       /*!< Longest job time of a frame */
+    uint32_t         frames;        /*!< Frames processed */
+    /*! Per channel deadline, in ticks after pickup */
+    uint32_t         deadline[Acquire_MAX_CHANNELS];
+    /*! Per channel deadline misses */
+    uint32_t         misses[Acquire_MAX_CHANNELS];
+    /*! Per channel worst completion, in ticks after pickup */
+    uint32_t         maxLatency[Acquire_MAX_CHANNELS];
+} Scheduler_Object;
+
+/*!
+ *  @brief  Initialize a scheduler for a running acquisition.
+ *
+ *  @param  obj          Scheduler object to initialize
+ *  @param  acquire      Initialized acquisition object
+ *  @param  systemClock  CPU clock in Hz (ignored on the host)
+ *  @param  jobFxn       Called once per channel and frame
+ *  @param  arg          Argument passed to @p jobFxn
+ *
+ *  @return Scheduler_STATUS_SUCCESS or Scheduler_STATUS_ERROR
+ */
+extern int_fast16_t Scheduler_init(Scheduler_Object *obj,
+                                   Acquire_Object *acquire,
+                                   uint32_t systemClock,
+                                   Scheduler_JobFxn jobFxn, void *arg);
+
+/*!
+ *  @brief  Run at most one channel job.
+ *
+ *  Picks up the next frame if none is in progress and releases it back to
+ *  the uDMA after its last channel.
+ *
+ *  @return true if a job ran, false if no frame was waiting
+ */
+extern bool Scheduler_poll(Scheduler_Object *obj);
+
+/*!
+ *  @brief  Read the statistics gathered so far.
+ */
+extern void Scheduler_getStats(const Scheduler_Object *obj,
+                               Scheduler_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_ */
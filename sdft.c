@@ -0,0 +1,188 @@
+/*
+ *  ======== sdft.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "sdft.h"
+
+/*
+ *  ======== toQ31 ========
+ */
+static q31_t toQ31(double value)
+{
+    double scaled = floor((value * 2147483648.0) + 0.5);
+
+    if (scaled > 2147483647.0) {
+        return (INT32_MAX);
+    }
+
+    return ((q31_t)scaled);
+}
+
+/*
+ *  ======== saturate ========
+ */
+static q31_t saturate(int64_t value)
+{
+    if (value > INT32_MAX) {
+        return (INT32_MAX);
+    }
+    if (value < INT32_MIN) {
+        return (INT32_MIN);
+    }
+
+    return ((q31_t)value);
+}
+
+/*
+ *  ======== Sdft_init ========
+ */
+int_fast16_t Sdft_init(Sdft_Object *obj, uint16_t winLen,
+                       const uint16_t *bins, uint_least8_t numBins,
+                       uint16_t anchorPeriod, q15_t *history, q15_t *cosTable)
+{
+    uint_least8_t k;
+    uint32_t i;
+    double w;
+    double c;
+
+    if ((obj == NULL) || (bins == NULL) || (history == NULL) ||
+        (cosTable == NULL) || (numBins == 0) || (numBins > Sdft_MAX_BINS)) {
+        return (Sdft_STATUS_ERROR);
+    }
+
+    if ((winLen < 16) || (winLen > 4096) || ((winLen & (winLen - 1)) != 0)) {
+        return (Sdft_STATUS_ERROR);
+    }
+
+    for (obj->log2Len = 0; (1U << obj->log2Len) < winLen; obj->log2Len++) {
+    }
+
+    for (i = 0; i < winLen; i++) {
+        c = cos(2.0 * PI * (double)i / (double)winLen) * 32768.0;
+        cosTable[i] = (c >= 32767.0) ? 32767 : (q15_t)floor(c + 0.5);
+        history[i] = 0;
+    }
+
+    for (k = 0; k < numBins; k++) {
+        if (bins[k] >= (winLen / 2)) {
+            return (Sdft_STATUS_ERROR);
+        }
+
+        w = 2.0 * PI * (double)bins[k] / (double)winLen;
+
+        obj->bins[k] = bins[k];
+        obj->rotRe[k] = toQ31(cos(w));
+        obj->rotIm[k] = toQ31(sin(w));
+        obj->re[k] = 0;
+        obj->im[k] = 0;
+        obj->shadowRe[k] = 0;
+        obj->shadowIm[k] = 0;
+    }
+
+    obj->winLen = winLen;
+    obj->numBins = numBins;
+    obj->anchorPeriod = anchorPeriod;
+    obj->anchorCount = 0;
+    obj->pos = 0;
+    obj->history = history;
+    obj->cosTable = cosTable;
+
+    return (Sdft_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Sdft_update ========
+ *  X[k](n) = (X[k](n - 1) + x[n] - x[n - N]) * e^(j 2 pi k / N)
+ *
+ *  The shadow sum runs during the last window of each anchor period.  Its
+ *  term for window offset m is x * e^(-j 2 pi k m / N); once m reaches
+ *  N - 1 it equals X[k] exactly and replaces the recursive state.
+ */
+void Sdft_update(Sdft_Object *obj, q15_t sample)
+{
+    uint16_t mask = obj->winLen - 1;
+    uint16_t m = obj->pos;
+    int32_t delta;
+    int32_t re;
+    uint_least8_t k;
+    uint16_t idx;
+    bool shadow = (obj->anchorPeriod != Sdft_ANCHOR_NONE) &&
+                  ((obj->anchorCount + 1U) >= obj->anchorPeriod);
+    bool anchor = shadow && (m == mask);
+
+    delta = (int32_t)sample - (int32_t)obj->history[m];
+    obj->history[m] = sample;
+
+    for (k = 0; k < obj->numBins; k++) {
+        re = obj->re[k] + delta;
+
+        obj->re[k] = (int32_t)((((int64_t)re * obj->rotRe[k]) -
+                                ((int64_t)obj->im[k] * obj->rotIm[k]) +
+                                (1LL << 30)) >> 31);
+        obj->im[k] = (int32_t)((((int64_t)re * obj->rotIm[k]) +
+                                ((int64_t)obj->im[k] * obj->rotRe[k]) +
+                                (1LL << 30)) >> 31);
+
+        if (shadow) {
+            idx = (uint16_t)(obj->bins[k] * m) & mask;
+            obj->shadowRe[k] += (int32_t)sample * obj->cosTable[idx];
+            obj->shadowIm[k] -= (int32_t)sample *
+                                obj->cosTable[(idx - (obj->winLen >> 2)) &
+                                              mask];
+
+            if (anchor) {
+                obj->re[k] = (int32_t)((obj->shadowRe[k] + (1 << 14)) >> 15);
+                obj->im[k] = (int32_t)((obj->shadowIm[k] + (1 << 14)) >> 15);
+                obj->shadowRe[k] = 0;
+                obj->shadowIm[k] = 0;
+            }
+        }
+    }
+
+    if (m == mask) {
+        obj->pos = 0;
+        obj->anchorCount = anchor ? 0 : (obj->anchorCount + 1U);
+    }
+    else {
+        obj->pos = m + 1;
+    }
+}
+
+/*
+ *  ======== Sdft_updateBlock ========
+ */
+void Sdft_updateBlock(Sdft_Object *obj, const q15_t *samples,
+                      uint32_t numSamples)
+{
+    uint32_t i;
+
+    for (i = 0; i < numSamples; i++) {
+        Sdft_update(obj, samples[i]);
+    }
+}
+
+/*
+ *  ======== Sdft_getPhasors ========
+ *  The state is a plain sum of q15 samples; X / N in q31 is the state
+ *  scaled by 2^16 / N.
+ */
+void Sdft_getPhasors(const Sdft_Object *obj, q31_t *pDst)
+{
+    uint_least8_t k;
+    int_fast8_t shift = 16 - obj->log2Len;
+
+    for (k = 0; k < obj->numBins; k++) {
+        if (shift >= 0) {
+            *pDst++ = saturate((int64_t)obj->re[k] << shift);
+            *pDst++ = saturate((int64_t)obj->im[k] << shift);
+        }
+        else {
+            *pDst++ = obj->re[k] >> -shift;
+            *pDst++ = obj->im[k] >> -shift;
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ *  ======== sdft.h ========
+ *  Sliding DFT harmonic tracker.
+ *
+ *  Keeps the DFT of the last winLen samples for a list of bins up to date
+ *  with O(numBins) work per new sample, so fresh phasors are available after
+ *  every sample instead of once per frame.
+ *
+ *  The recursive update rotates each bin by a rounded twiddle factor, which
+ *  lets fixed-point error accumulate.  To keep it bounded, a shadow sum
+ *  evaluates the same bins directly over one full window and replaces the
+ *  recursive state when that window closes (re-anchoring).  The shadow is
+ *  also O(numBins) per sample, so the per-sample cost stays constant.
+ *  tools/sdft_drift.c runs 10^8 samples with and without it.
+ */
+#ifndef SDFT_H_
+#define SDFT_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Sdft_init().
+ */
+#define Sdft_STATUS_SUCCESS     (0)
+
+/*!
+ *  @brief  Returned by Sdft_init() for an invalid length or bin list.
+ */
+#define Sdft_STATUS_ERROR       (-1)
+
+/*!
+ *  @brief  Maximum number of tracked bins
+ */
+#define Sdft_MAX_BINS           (50)
+
+/*!
+ *  @brief  anchorPeriod that turns re-anchoring off, so the recursive
+ *          state runs free; for measuring the drift it prevents
+ */
+#define Sdft_ANCHOR_NONE        (0)
+
+/*!
+ *  @brief  Sliding DFT state
+ */
+typedef struct {
+    uint16_t      winLen;                   /*!< Window length (power of 2) */
+    uint_least8_t log2Len;                  /*!< log2(winLen) */
+    uint_least8_t numBins;                  /*!< Tracked bins */
+    uint16_t      anchorPeriod;             /*!< Windows between anchors,
+                                                 Sdft_ANCHOR_NONE for none */
+    uint16_t      anchorCount;              /*!< Windows since last anchor */
+    uint16_t      pos;                      /*!< Oldest sample in history */
+    q15_t        *history;                  /*!< Last winLen samples */
+    q15_t        *cosTable;                 /*!< cos(2 pi i / winLen) */
+    uint16_t      bins[Sdft_MAX_BINS];      /*!< DFT bin indices */
+    q31_t         rotRe[Sdft_MAX_BINS];     /*!< cos(2 pi k / winLen) */
+    q31_t         rotIm[Sdft_MAX_BINS];     /*!< sin(2 pi k / winLen) */
+    int32_t       re[Sdft_MAX_BINS];        /*!< Recursive bin state */
+    int32_t       im[Sdft_MAX_BINS];
+    int64_t       shadowRe[Sdft_MAX_BINS];  /*!< Direct sum for anchoring */
+    int64_t       shadowIm[Sdft_MAX_BINS];
+} Sdft_Object;
+
+/*!
+ *  @brief  Initialize a sliding DFT.
+ *
+ *  @param  obj           Sliding DFT object to initialize
+ *  @param  winLen        Window length (power of two, 16 to 4096)
+ *  @param  bins          DFT bin indices, each below winLen / 2
+ *  @param  numBins       Number of entries in @p bins (1 to Sdft_MAX_BINS)
+ *  @param  anchorPeriod  Re-anchor after this many windows (1 re-anchors
+ *                        at the end of every window), or Sdft_ANCHOR_NONE
+ *  @param  history       Buffer of winLen samples
+ *  @param  cosTable      Buffer of winLen values, filled by this function
+ *
+ *  @return Sdft_STATUS_SUCCESS or Sdft_STATUS_ERROR
+ */
+extern int_fast16_t Sdft_init(Sdft_Object *obj, uint16_t winLen,
+                              const uint16_t *bins, uint_least8_t numBins,
+                              uint16_t anchorPeriod, q15_t *history,
+                              q15_t *cosTable);
+
+/*!
+ *  @brief  Push one new sample and update every tracked bin.
+ */
+extern void Sdft_update(Sdft_Object *obj, q15_t sample);
+
+/*!
+ *  @brief  Push a block of samples; equivalent to calling Sdft_update()
+ *          for each of them.
+ */
+extern void Sdft_updateBlock(Sdft_Object *obj, const q15_t *samples,
+                             uint32_t numSamples);
+
+/*!
+ *  @brief  Read the current phasors.
+ *
+ *  The values are X[k] / winLen in q31, interleaved re/im, using the same
+ *  scaling as the Spectrum and Goertzel stages.
+ *
+ *  @param  obj     Sliding DFT object
+ *  @param  pDst    Output of 2 * obj->numBins q31 values
+ */
+extern void Sdft_getPhasors(const Sdft_Object *obj, q31_t *pDst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SDFT_H_ */
@@ -0,0 +1,107 @@
+/*
+ *  ======== spectrum.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+#include "spectrum.h"
+
+/* Forward transform with the output in natural bin order */
+#define IFFTFLAG   0
+#define BITREVERSE 1
+
+/*
+ *  ======== Spectrum_init ========
+ */
+int_fast16_t Spectrum_init(Spectrum_Object *obj, uint16_t fftLen,
+                           Precision_Sample *work)
+{
+    arm_status status;
+
+    if ((obj == NULL) || (work == NULL)) {
+        return (Spectrum_STATUS_ERROR);
+    }
+
+#if (PRECISION == PRECISION_F32)
+    status = arm_rfft_fast_init_f32(&obj->rfft, fftLen);
+#elif (PRECISION == PRECISION_Q31)
+    status = arm_rfft_init_q31(&obj->rfft, fftLen, IFFTFLAG, BITREVERSE);
+#else
+    status = arm_rfft_init_q15(&obj->rfft, fftLen, IFFTFLAG, BITREVERSE);
+#endif
+    if (status != ARM_MATH_SUCCESS) {
+        return (Spectrum_STATUS_ERROR);
+    }
+
+    obj->fftLen = fftLen;
+    obj->work = work;
+    obj->window = NULL;
+
+    return (Spectrum_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Spectrum_setWindow ========
+ */
+int_fast16_t Spectrum_setWindow(Spectrum_Object *obj, Window_Type type)
+{
+    const q15_t *table = Window_table(type, obj->fftLen);
+
+    if ((table == NULL) && (type != Window_RECTANGULAR)) {
+        return (Spectrum_STATUS_ERROR);
+    }
+
+    obj->window = table;
+
+    return (Spectrum_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Spectrum_setWindowTable ========
+ */
+void Spectrum_setWindowTable(Spectrum_Object *obj, const q15_t *table)
+{
+    obj->window = table;
+}
+
+/*
+ *  ======== Spectrum_transform ========
+ *  The fixed-point transforms scale by 1/fftLen internally.  The float one
+ *  does not, and returns the real Nyquist bin in the imaginary part of
+ *  bin 0.
+ */
+void Spectrum_transform(Spectrum_Object *obj, Precision_Sample *frame)
+{
+    if (obj->window != NULL) {
+        Window_apply(obj->window, frame, obj->fftLen);
+    }
+
+#if (PRECISION == PRECISION_F32)
+    arm_rfft_fast_f32(&obj->rfft, frame, obj->work, IFFTFLAG);
+
+    obj->work[obj->fftLen] = obj->work[1];
+    obj->work[obj->fftLen + 1U] = 0.0f;
+    obj->work[1] = 0.0f;
+
+    arm_scale_f32(obj->work, 1.0f / (float32_t)obj->fftLen, obj->work,
+                  2U * Spectrum_NUM_BINS(obj->fftLen));
+#elif (PRECISION == PRECISION_Q31)
+    arm_rfft_q31(&obj->rfft, frame, obj->work);
+#else
+    arm_rfft_q15(&obj->rfft, frame, obj->work);
+#endif
+}
+
+/*
+ *  ======== Spectrum_magnitude ========
+ */
+void Spectrum_magnitude(Spectrum_Object *obj, Precision_Sample *mag)
+{
+#if (PRECISION == PRECISION_F32)
+    arm_cmplx_mag_f32(obj->work, mag, Spectrum_NUM_BINS(obj->fftLen));
+#elif (PRECISION == PRECISION_Q31)
+    arm_cmplx_mag_q31(obj->work, mag, Spectrum_NUM_BINS(obj->fftLen));
+#else
+    arm_cmplx_mag_q15(obj->work, mag, Spectrum_NUM_BINS(obj->fftLen));
+#endif
+}
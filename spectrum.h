@@ -0,0 +1,149 @@
+/*
+ *  ======== spectrum.h ========
+ *  Real-input spectrum stage built on the CMSIS-DSP RFFT.
+ *
+ *  The ADC delivers real samples only, so the frame is transformed with a
+ *  real FFT instead of a complex FFT with invented imaginary parts.  Only
+ *  bins 0 to fftLen/2 (fftLen/2 + 1 bins) carry information and only those
+ *  are exposed to the caller.
+ *
+ *  The transform follows the analysis precision (see precision.h):
+ *  arm_rfft_q15(), arm_rfft_q31() or arm_rfft_fast_f32().  The fast float
+ *  transform packs the Nyquist bin into bin 0; it is moved out so the
+ *  layout is the same in every precision.
+ */
+#ifndef SPECTRUM_H_
+#define SPECTRUM_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#include "precision.h"
+#include "window.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Spectrum_init().
+ */
+#define Spectrum_STATUS_SUCCESS     (0)
+
+/*!
+ *  @brief  Returned by Spectrum_init() for an unsupported FFT length.
+ */
+#define Spectrum_STATUS_ERROR       (-1)
+
+/*!
+ *  @brief  Number of bins produced for a real FFT of length @p fftLen.
+ */
+#define Spectrum_NUM_BINS(fftLen)   (((fftLen) / 2U) + 1U)
+
+/*!
+ *  @brief  Number of Precision_Sample values required for the work buffer.
+ *
+ *  The CMSIS fixed-point split stage writes the mirrored upper half of the
+ *  spectrum as well, so the output buffer must hold 2 * fftLen values even
+ *  though only the first Spectrum_NUM_BINS() complex bins are used.
+ */
+#define Spectrum_WORK_LEN(fftLen)   (2U * (fftLen))
+
+/*!
+ *  @brief  Convert a Spectrum_magnitude() value to |X[k]| / fftLen.
+ */
+#if (PRECISION == PRECISION_F32)
+#define Spectrum_MAG_TO_FLOAT(mag)  ((float32_t)(mag))
+#elif (PRECISION == PRECISION_Q31)
+#define Spectrum_MAG_TO_FLOAT(mag)  ((float32_t)(mag) * (1.0f / 1073741824.0f))
+#else
+#define Spectrum_MAG_TO_FLOAT(mag)  ((float32_t)(mag) * (1.0f / 16384.0f))
+#endif
+
+/*!
+ *  @brief  Spectrum stage state
+ */
+typedef struct {
+#if (PRECISION == PRECISION_F32)
+    arm_rfft_fast_instance_f32 rfft;    /*!< CMSIS real FFT instance */
+#elif (PRECISION == PRECISION_Q31)
+    arm_rfft_instance_q31 rfft;     /*!< CMSIS real FFT instance */
+#else
+    arm_rfft_instance_q15 rfft;     /*!< CMSIS real FFT instance */
+#endif
+    uint16_t              fftLen;   /*!< Real FFT length in samples */
+    Precision_Sample     *work;     /*!< Interleaved re/im output bins */
+    const q15_t          *window;   /*!< Window table, NULL for none */
+} Spectrum_Object;
+
+/*!
+ *  @brief  Initialize a spectrum stage for a given real FFT length.
+ *
+ *  @param  obj     Spectrum object to initialize
+ *  @param  fftLen  Real FFT length (power of two, 32 to 8192; 32 to 4096
+ *                  in f32)
+ *  @param  work    Buffer of Spectrum_WORK_LEN(fftLen) values
+ *
+ *  @return Spectrum_STATUS_SUCCESS or Spectrum_STATUS_ERROR
+ */
+extern int_fast16_t Spectrum_init(Spectrum_Object *obj, uint16_t fftLen,
+                                  Precision_Sample *work);
+
+/*!
+ *  @brief  Select the window applied before every transform.
+ *
+ *  The stage starts out with Window_RECTANGULAR.  A window scales every
+ *  bin by its coherent gain; Window_estimate() undoes that.
+ *
+ *  @param  obj     Initialized spectrum object
+ *  @param  type    Window type
+ *
+ *  @return Spectrum_STATUS_SUCCESS, or Spectrum_STATUS_ERROR if no table
+ *          exists for the FFT length
+ */
+extern int_fast16_t Spectrum_setWindow(Spectrum_Object *obj,
+                                       Window_Type type);
+
+/*!
+ *  @brief  Apply the coefficients at @p table before every transform.
+ *
+ *  For a copy of a Window_table() table kept elsewhere, for example in
+ *  SRAM.
+ *
+ *  @param  obj     Initialized spectrum object
+ *  @param  table   fftLen coefficients, or NULL for none
+ */
+extern void Spectrum_setWindowTable(Spectrum_Object *obj,
+                                    const q15_t *table);
+
+/*!
+ *  @brief  Transform one frame of real samples.
+ *
+ *  The result is fftLen/2 + 1 interleaved complex bins in obj->work.  Each
+ *  bin is scaled by 1/fftLen, so a sinusoid of peak amplitude A (full
+ *  scale 1.0) shows up as A/2 in its bin and the DC term holds the frame
+ *  mean.
+ *
+ *  @param  obj     Initialized spectrum object
+ *  @param  frame   fftLen samples; windowed in place, then overwritten by
+ *                  the transform
+ */
+extern void Spectrum_transform(Spectrum_Object *obj, Precision_Sample *frame);
+
+/*!
+ *  @brief  Compute the magnitude of every bin of the last transform.
+ *
+ *  @param  obj     Spectrum object after Spectrum_transform()
+ *  @param  mag     Output of Spectrum_NUM_BINS(fftLen) magnitudes: 2.14
+ *                  format in q15, 2.30 in q31 (see arm_cmplx_mag_q15()),
+ *                  plain values in f32.  Spectrum_MAG_TO_FLOAT() converts
+ *                  either to |X[k]| / fftLen.
+ */
+extern void Spectrum_magnitude(Spectrum_Object *obj, Precision_Sample *mag);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPECTRUM_H_ */
@@ -0,0 +1,459 @@
+/*
+ *  ======== stream.c ========
+ */
+#if defined(HOST_BUILD)
+#define _GNU_SOURCE
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(HOST_BUILD)
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "stream.h"
+#include "telemetry.h"
+#include "udma.h"
+
+#if defined(HOST_BUILD)
+/* Longest wait for the reader before the sender checks for Stream_close() */
+#define POLL_MS     (100)
+#else
+/* UART1 and the uDMA channel of its transmitter */
+#define UART_BASE   UART1_BASE
+#define UART_INT    INT_UART1
+#define DMA_CHANNEL UDMA_CH23_UART1TX
+#endif
+
+/*
+ *  ======== put16 ========
+ */
+static uint8_t *put16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+
+    return (p + 2);
+}
+
+/*
+ *  ======== put32 ========
+ */
+static uint8_t *put32(uint8_t *p, uint32_t value)
+{
+    p = put16(p, (uint16_t)value);
+
+    return (put16(p, (uint16_t)(value >> 16)));
+}
+
+/*
+ *  ======== pack ========
+ *  Header, samples two to three bytes, and the CRC.
+ */
+static void pack(Stream_Object *obj, Stream_Block *b, uint_least8_t channel,
+                 const uint16_t *samples, uint16_t stride,
+                 uint16_t numSamples)
+{
+    uint32_t dropped = obj->dropped - obj->droppedSent;
+    uint8_t *p = b->data;
+    uint32_t a;
+    uint32_t c;
+    uint16_t i;
+
+    p = put16(p, (uint16_t)Stream_SYNC);
+    *p++ = (uint8_t)channel;
+    *p++ = 0;
+    p = put32(p, obj->sequence);
+    p = put16(p, (dropped > UINT16_MAX) ? UINT16_MAX : (uint16_t)dropped);
+    p = put16(p, numSamples);
+    p = put32(p, obj->sampleIndex[channel]);
+
+    for (i = 0; (i + 1U) < numSamples; i += 2U) {
+        a = samples[0] & 0xFFFU;
+        c = samples[stride] & 0xFFFU;
+        samples += 2U * (uint32_t)stride;
+
+        p[0] = (uint8_t)a;
+        p[1] = (uint8_t)((a >> 8) | (c << 4));
+        p[2] = (uint8_t)(c >> 4);
+        p += 3;
+    }
+    if (i < numSamples) {
+        a = samples[0] & 0xFFFU;
+
+        p[0] = (uint8_t)a;
+        p[1] = (uint8_t)(a >> 8);
+        p[2] = 0;
+        p += 3;
+    }
+
+    p = put16(p, Telemetry_crc16(b->data, (size_t)(p - b->data)));
+    b->len = (uint16_t)(p - b->data);
+
+    obj->droppedSent = obj->dropped;
+}
+
+#if defined(HOST_BUILD)
+/*
+ *  ======== sendAll ========
+ *  Write a whole block to the pseudo-terminal.  A reader that does not
+ *  keep up fills the terminal buffer and stalls this loop, like CTS.
+ */
+static bool sendAll(Stream_Object *obj, const uint8_t *data, size_t len)
+{
+    struct pollfd pfd;
+    ssize_t n;
+
+    pfd.fd = obj->master;
+    pfd.events = POLLOUT;
+
+    while (len > 0) {
+        if (!obj->running) {
+            return (false);
+        }
+
+        n = write(obj->master, data, len);
+        if (n > 0) {
+            data += n;
+            len -= (size_t)n;
+        }
+        else if ((n < 0) && (errno != EAGAIN) && (errno != EINTR)) {
+            return (false);
+        }
+        else {
+            poll(&pfd, 1, POLL_MS);
+        }
+    }
+
+    return (true);
+}
+
+/*
+ *  ======== sendThread ========
+ *  Host stand-in for the UART and uDMA.  Every block is held back for its
+ *  time on the wire at the configured baud rate, 10 bits per byte, against
+ *  an absolute deadline that restarts whenever the link was idle.
+ */
+static void *sendThread(void *arg)
+{
+    Stream_Object *obj = (Stream_Object *)arg;
+    Stream_Block *b;
+    struct timespec deadline;
+    struct timespec now;
+    uint64_t ns;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    pthread_mutex_lock(&obj->lock);
+    while (obj->running) {
+        if (Ring_peek(&obj->queue, (void **)&b) == 0) {
+            pthread_cond_wait(&obj->queued, &obj->lock);
+            continue;
+        }
+        pthread_mutex_unlock(&obj->lock);
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if ((now.tv_sec > deadline.tv_sec) ||
+            ((now.tv_sec == deadline.tv_sec) &&
+             (now.tv_nsec > deadline.tv_nsec))) {
+            deadline = now;
+        }
+        ns = ((uint64_t)b->len * 10U * 1000000000ULL) / obj->baudRate;
+        deadline.tv_nsec += (long)(ns % 1000000000ULL);
+        deadline.tv_sec += (time_t)(ns / 1000000000ULL);
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_nsec -= 1000000000L;
+            deadline.tv_sec++;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+
+        if (!sendAll(obj, b->data, b->len)) {
+            pthread_mutex_lock(&obj->lock);
+            break;
+        }
+
+        pthread_mutex_lock(&obj->lock);
+        obj->bytes += b->len;
+        Ring_release(&obj->queue, 1);
+    }
+    pthread_mutex_unlock(&obj->lock);
+
+    return (NULL);
+}
+
+/*
+ *  ======== openPort ========
+ *  A pseudo-terminal in raw mode, so every byte arrives as sent.
+ */
+static int_fast16_t openPort(Stream_Object *obj)
+{
+    struct termios tio;
+    int slave;
+
+    obj->master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (obj->master < 0) {
+        return (Stream_STATUS_ERROR);
+    }
+
+    if ((grantpt(obj->master) != 0) || (unlockpt(obj->master) != 0) ||
+        (ptsname_r(obj->master, obj->port, sizeof(obj->port)) != 0)) {
+        close(obj->master);
+        return (Stream_STATUS_ERROR);
+    }
+
+    slave = open(obj->port, O_RDWR | O_NOCTTY);
+    if (slave < 0) {
+        close(obj->master);
+        return (Stream_STATUS_ERROR);
+    }
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    close(slave);
+
+    fcntl(obj->master, F_SETFL, fcntl(obj->master, F_GETFL) | O_NONBLOCK);
+
+    return (Stream_STATUS_SUCCESS);
+}
+#else
+/*
+ *  ======== startTransfer ========
+ *  Hand the oldest queued block to the uDMA.  Called with interrupts
+ *  disabled or from the UART interrupt.
+ */
+static void startTransfer(Stream_Object *obj)
+{
+    Stream_Block *b;
+
+    if (obj->busy || (Ring_peek(&obj->queue, (void **)&b) == 0)) {
+        return;
+    }
+
+    MAP_uDMAChannelTransferSet(DMA_CHANNEL | UDMA_PRI_SELECT,
+                               UDMA_MODE_BASIC, (void *)b->data,
+                               (void *)&UART1->DR, b->len);
+    obj->busy = true;
+    MAP_uDMAChannelEnable(DMA_CHANNEL);
+}
+
+/*
+ *  ======== uartHwiFxn ========
+ *  A block has been moved into the FIFO; start the next one.
+ */
+static void uartHwiFxn(uintptr_t arg)
+{
+    Stream_Object *obj = (Stream_Object *)arg;
+    Stream_Block *b;
+    uint32_t status;
+
+    status = MAP_UARTIntStatus(UART_BASE, true);
+    MAP_UARTIntClear(UART_BASE, status);
+
+    if ((status & UART_INT_DMATX) && obj->busy &&
+        !MAP_uDMAChannelIsEnabled(DMA_CHANNEL) &&
+        (Ring_peek(&obj->queue, (void **)&b) != 0)) {
+        obj->bytes += b->len;
+        Ring_release(&obj->queue, 1);
+        obj->busy = false;
+        startTransfer(obj);
+    }
+}
+#endif
+
+/*
+ *  ======== Stream_init ========
+ */
+int_fast16_t Stream_init(Stream_Object *obj, uint32_t baudRate,
+                         uint32_t systemClock)
+{
+#if !defined(HOST_BUILD)
+    HwiP_Params hwiParams;
+    uint32_t config;
+#endif
+    uint_least8_t k;
+
+    if ((obj == NULL) || (baudRate == 0) ||
+        (Ring_init(&obj->queue, obj->blocks, sizeof(Stream_Block),
+                   Stream_NUM_BLOCKS) != Ring_STATUS_SUCCESS)) {
+        return (Stream_STATUS_ERROR);
+    }
+
+    obj->sequence = 0;
+    obj->dropped = 0;
+    obj->skipped = 0;
+    obj->droppedSent = 0;
+    obj->bytes = 0;
+    for (k = 0; k < Stream_MAX_CHANNELS; k++) {
+        obj->sampleIndex[k] = 0;
+    }
+
+#if defined(HOST_BUILD)
+    (void)systemClock;
+
+    obj->baudRate = baudRate;
+    if (openPort(obj) != Stream_STATUS_SUCCESS) {
+        return (Stream_STATUS_ERROR);
+    }
+
+    pthread_mutex_init(&obj->lock, NULL);
+    pthread_cond_init(&obj->queued, NULL);
+    obj->running = true;
+    if (pthread_create(&obj->thread, NULL, sendThread, obj) != 0) {
+        obj->running = false;
+        close(obj->master);
+        return (Stream_STATUS_ERROR);
+    }
+#else
+    /* Above systemClock / 16 the UART switches to 8x oversampling */
+    if (baudRate > (systemClock / 8U)) {
+        return (Stream_STATUS_ERROR);
+    }
+
+    obj->busy = false;
+
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_UART1);
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOP);
+    while (!MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_UART1)) {
+    }
+
+    MAP_GPIOPinConfigure(GPIO_PB0_U1RX);
+    MAP_GPIOPinConfigure(GPIO_PB1_U1TX);
+    MAP_GPIOPinConfigure(GPIO_PP3_U1CTS);
+    MAP_GPIOPinTypeUART(GPIO_PORTB_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+    MAP_GPIOPinTypeUART(GPIO_PORTP_BASE, GPIO_PIN_3);
+
+    MAP_UARTConfigSetExpClk(UART_BASE, systemClock, baudRate,
+                            UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
+                            UART_CONFIG_PAR_NONE);
+    MAP_UARTConfigGetExpClk(UART_BASE, systemClock, &obj->baudRate, &config);
+    MAP_UARTFlowControlSet(UART_BASE, UART_FLOWCONTROL_TX);
+
+    /* Request a burst whenever the TX FIFO is half empty */
+    MAP_UARTFIFOLevelSet(UART_BASE, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
+
+    Udma_init();
+    MAP_uDMAChannelAssign(DMA_CHANNEL);
+    MAP_uDMAChannelAttributeDisable(DMA_CHANNEL, UDMA_ATTR_ALL);
+    MAP_uDMAChannelControlSet(DMA_CHANNEL | UDMA_PRI_SELECT,
+                              UDMA_SIZE_8 | UDMA_SRC_INC_8 |
+                              UDMA_DST_INC_NONE | UDMA_ARB_8);
+    MAP_UARTDMAEnable(UART_BASE, UART_DMA_TX);
+    MAP_UARTEnable(UART_BASE);
+
+    HwiP_Params_init(&hwiParams);
+    hwiParams.arg = (uintptr_t)obj;
+    if (HwiP_construct(&obj->hwi, UART_INT, uartHwiFxn, &hwiParams) ==
+        NULL) {
+        return (Stream_STATUS_ERROR);
+    }
+    MAP_UARTIntEnable(UART_BASE, UART_INT_DMATX);
+#endif
+
+    return (Stream_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Stream_write ========
+ */
+int_fast16_t Stream_write(Stream_Object *obj, uint_least8_t channel,
+                          uint32_t first, const uint16_t *samples,
+                          uint16_t stride, uint16_t numSamples)
+{
+    int_fast16_t status = Stream_STATUS_SUCCESS;
+    Stream_Block *b;
+    uint32_t gap;
+    uint32_t skipped;
+    uint16_t n;
+#if !defined(HOST_BUILD)
+    uintptr_t key;
+#endif
+
+    if (channel >= Stream_MAX_CHANNELS) {
+        return (Stream_STATUS_ERROR);
+    }
+
+    /* Samples never written, in the blocks they would have been sent in */
+    gap = first - obj->sampleIndex[channel];
+    if ((gap != 0U) && (gap < 0x80000000U) && (numSamples > 0U)) {
+        skipped = ((gap + numSamples - 1U) / numSamples) *
+                  ((numSamples + Stream_BLOCK_SAMPLES - 1U) /
+                   Stream_BLOCK_SAMPLES);
+        obj->sequence += skipped;
+        obj->dropped += skipped;
+        obj->skipped += skipped;
+        status = Stream_STATUS_DROPPED;
+    }
+    obj->sampleIndex[channel] = first;
+
+    while (numSamples > 0) {
+        n = (numSamples > Stream_BLOCK_SAMPLES) ? Stream_BLOCK_SAMPLES :
+            numSamples;
+
+        if (Ring_reserve(&obj->queue, (void **)&b) == 0) {
+            obj->dropped++;
+            status = Stream_STATUS_DROPPED;
+        }
+        else {
+            pack(obj, b, channel, samples, stride, n);
+
+            /* Publish the finished block and start the link if idle */
+#if defined(HOST_BUILD)
+            pthread_mutex_lock(&obj->lock);
+            Ring_commit(&obj->queue, 1);
+            pthread_cond_signal(&obj->queued);
+            pthread_mutex_unlock(&obj->lock);
+#else
+            Ring_commit(&obj->queue, 1);
+            key = HwiP_disable();
+            startTransfer(obj);
+            HwiP_restore(key);
+#endif
+        }
+
+        obj->sequence++;
+        obj->sampleIndex[channel] += n;
+        samples += (uint32_t)n * stride;
+        numSamples -= n;
+    }
+
+    return (status);
+}
+
+/*
+ *  ======== Stream_getStats ========
+ */
+void Stream_getStats(const Stream_Object *obj, Stream_Stats *stats)
+{
+    stats->blocks = obj->sequence;
+    stats->sent = obj->queue.tail;
+    stats->dropped = obj->dropped;
+    stats->skipped = obj->skipped;
+    stats->bytes = obj->bytes;
+}
+
+#if defined(HOST_BUILD)
+/*
+ *  ======== Stream_close ========
+ */
+void Stream_close(Stream_Object *obj)
+{
+    pthread_mutex_lock(&obj->lock);
+    obj->running = false;
+    pthread_cond_signal(&obj->queued);
+    pthread_mutex_unlock(&obj->lock);
+
+    pthread_join(obj->thread, NULL);
+    close(obj->master);
+}
+#endif
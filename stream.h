@@ -0,0 +1,217 @@
+/*
+ *  ======== stream.h ========
+ *  Raw sample streaming over a dedicated high-rate UART.
+ *
+ *  For field diagnosis the raw ADC codes of selected channels are packed
+ *  two 12-bit samples to three bytes and sent in blocks on UART1 at up to
+ *  a few Mbaud, next to the console on UART0.  The uDMA feeds the TX FIFO
+ *  straight from the block ring; the FIFO trigger is set to half full and
+ *  the uDMA refills it eight bytes per burst, so a block costs the CPU one
+ *  interrupt.  TX flow control is on: the UART stops between bytes while
+ *  the receiver deasserts CTS.  The stream never receives, so RTS is not
+ *  routed.
+ *
+ *  Pins on the MSP-EXP432E401Y: U1TX on PB1, U1RX on PB0, U1CTS on PP3.
+ *
+ *  Block layout, little-endian:
+ *
+ *      offset  size  field
+ *      0       2     Stream_SYNC
+ *      2       1     channel
+ *      3       1     reserved, 0
+ *      4       4     sequence, counts every block produced, sent or not
+ *      8       2     blocks dropped just before this one, saturated
+ *      10      2     samples in the block (N)
+ *      12      4     index of the first sample within its channel
+ *      16      P     samples, two per three bytes: a[7:0],
+ *                    a[11:8] | b[3:0] << 4, b[11:4]; an odd last
+ *                    sample is paired with 0, so P = 3 * ((N + 1) / 2)
+ *      16+P    2     CRC-16/CCITT-FALSE of all bytes above
+ *
+ *  Overload policy: acquisition never waits for the link.  Blocks are
+ *  packed into a ring of Stream_NUM_BLOCKS; when the link (or the
+ *  receiver, through CTS) falls behind and the ring is full, the new
+ *  block is dropped whole.  Blocks already queued are always sent intact,
+ *  and the next block that is queued carries the number dropped, so the
+ *  receiver sees exactly where samples are missing.  A gap in the sequence
+ *  without a drop count means bytes were lost on the wire.
+ *
+ *  Frames the DSP never picked up (see Scheduler_getStats()) never reach
+ *  Stream_write().  The caller passes the index of the first sample, from
+ *  Acquire_frameNumber(); samples of the channel missing before it are
+ *  counted as dropped too, as the blocks they would have made, so they
+ *  show up the same way as blocks dropped on a full ring.
+ *
+ *  At 8N1 a channel at 51.2 kS/s takes 768 kbaud, so 3 Mbaud carries three
+ *  channels with room to spare.
+ *
+ *  Building with HOST_BUILD replaces the UART and uDMA with a thread that
+ *  writes the blocks to a pseudo-terminal at the configured baud rate, so
+ *  a host tool (tools/stream_sim.c, tools/stream_decode.py) can read it
+ *  like a serial port.  A reader that stops reading stalls the writes the
+ *  way CTS stalls the UART.
+ */
+#ifndef STREAM_H_
+#define STREAM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring.h"
+
+#if defined(HOST_BUILD)
+#include <pthread.h>
+#else
+#include <ti/drivers/dpl/HwiP.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Stream functions.
+ */
+#define Stream_STATUS_SUCCESS       (0)
+
+/*!
+ *  @brief  Returned for an invalid configuration.
+ */
+#define Stream_STATUS_ERROR         (-1)
+
+/*!
+ *  @brief  Returned by Stream_write() when blocks were dropped or skipped.
+ */
+#define Stream_STATUS_DROPPED       (-2)
+
+/*!
+ *  @brief  First two bytes of a block
+ */
+#define Stream_SYNC                 (0xA55AU)
+
+/*!
+ *  @brief  Most samples in one block
+ */
+#define Stream_BLOCK_SAMPLES        (512U)
+
+/*!
+ *  @brief  Bytes of a block of @p numSamples samples
+ */
+#define Stream_BLOCK_LEN(numSamples) \
+    (18U + (3U * (((uint32_t)(numSamples) + 1U) / 2U)))
+
+/*!
+ *  @brief  Blocks in the ring, a power of two
+ */
+#ifndef Stream_NUM_BLOCKS
+#define Stream_NUM_BLOCKS           (8U)
+#endif
+
+/*!
+ *  @brief  Highest channel index that can be streamed, plus one
+ */
+#define Stream_MAX_CHANNELS         (16U)
+
+/*!
+ *  @brief  Default baud rate
+ */
+#define Stream_BAUD_RATE            (3000000U)
+
+/*!
+ *  @brief  One packed block
+ */
+typedef struct {
+    uint16_t len;                               /*!< Bytes in data */
+    uint8_t  data[Stream_BLOCK_LEN(Stream_BLOCK_SAMPLES)];
+} Stream_Block;
+
+/*!
+ *  @brief  Stream statistics
+ */
+typedef struct {
+    uint32_t blocks;        /*!< Blocks produced, sent or dropped */
+    uint32_t sent;          /*!< Blocks handed to the UART completely */
+    uint32_t dropped;       /*!< Blocks dropped, skipped ones included */
+    uint32_t skipped;       /*!< Blocks of samples never written */
+    uint32_t bytes;         /*!< Bytes sent */
+} Stream_Stats;
+
+/*!
+ *  @brief  Stream state
+ */
+typedef struct {
+    uint32_t          baudRate;     /*!< Actual baud rate */
+    uint32_t          sequence;     /*!< Blocks produced */
+    uint32_t          dropped;      /*!< Blocks dropped */
+    uint32_t          skipped;      /*!< Of them, blocks never written */
+    uint32_t          droppedSent;  /*!< dropped at the last queued block */
+    uint32_t          bytes;        /*!< Bytes sent */
+    /*! Blocks queued (head) and sent (tail), packed in place */
+    Ring_Object       queue;
+    /*! Samples produced per channel, sent or not */
+    uint32_t          sampleIndex[Stream_MAX_CHANNELS];
+    Stream_Block      blocks[Stream_NUM_BLOCKS];
+#if defined(HOST_BUILD)
+    int               master;       /*!< Pseudo-terminal master */
+    char              port[64];     /*!< Pseudo-terminal slave path */
+    pthread_t         thread;       /*!< Emulated UART and uDMA */
+    pthread_mutex_t   lock;         /*!< Guards queued and bytes */
+    pthread_cond_t    queued;       /*!< Signalled for every queued block */
+    volatile bool     running;
+#else
+    volatile bool     busy;         /*!< uDMA transfer in flight */
+    HwiP_Struct       hwi;          /*!< UART interrupt */
+#endif
+} Stream_Object;
+
+/*!
+ *  @brief  Configure UART1, its pins and its uDMA channel for streaming.
+ *
+ *  @param  obj          Stream object to initialize
+ *  @param  baudRate     Requested baud rate, at most systemClock / 8
+ *  @param  systemClock  System clock in Hz (ignored on the host)
+ *
+ *  @return Stream_STATUS_SUCCESS or Stream_STATUS_ERROR
+ */
+extern int_fast16_t Stream_init(Stream_Object *obj, uint32_t baudRate,
+                                uint32_t systemClock);
+
+/*!
+ *  @brief  Pack raw codes of one channel into blocks and queue them.
+ *
+ *  Takes up to Stream_BLOCK_SAMPLES samples per block.  If @p first is
+ *  ahead of the samples written so far, the samples in between are
+ *  counted as skipped: as many dropped blocks as calls of @p numSamples
+ *  would have made.  Call from thread context only.
+ *
+ *  @param  obj         Stream object
+ *  @param  channel     Channel index, below Stream_MAX_CHANNELS
+ *  @param  first       Index of the first sample within the channel
+ *  @param  samples     First raw code; the low 12 bits are sent
+ *  @param  stride      Distance between samples
+ *  @param  numSamples  Samples to send
+ *
+ *  @return Stream_STATUS_SUCCESS, or Stream_STATUS_DROPPED if the ring was
+ *          full for at least one block or samples were skipped
+ */
+extern int_fast16_t Stream_write(Stream_Object *obj, uint_least8_t channel,
+                                 uint32_t first, const uint16_t *samples,
+                                 uint16_t stride, uint16_t numSamples);
+
+/*!
+ *  @brief  Read the statistics gathered so far.
+ */
+extern void Stream_getStats(const Stream_Object *obj, Stream_Stats *stats);
+
+#if defined(HOST_BUILD)
+/*!
+ *  @brief  Stop the sender thread and close the pseudo-terminal.
+ */
+extern void Stream_close(Stream_Object *obj);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_H_ */
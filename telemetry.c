@@ -0,0 +1,200 @@
+/*
+ *  ======== telemetry.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "telemetry.h"
+#include "uartstdio.h"
+
+/* CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF */
+#define CRC_INIT    (0xFFFFU)
+
+/* Longest COBS block: a code byte and up to 254 non-zero bytes */
+#define COBS_BLOCK  (255U)
+
+/* CRC of every 4-bit value, for one table step per nibble */
+static const uint16_t crcNibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef
+};
+
+/*
+ *  ======== Telemetry_crc16 ========
+ */
+uint16_t Telemetry_crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = CRC_INIT;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        crc = (uint16_t)((crc << 4) ^ crcNibble[(crc >> 12) ^ (data[i] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^
+                         crcNibble[(crc >> 12) ^ (data[i] & 0x0FU)]);
+    }
+
+    return (crc);
+}
+
+/*
+ *  ======== put16 ========
+ */
+static uint8_t *put16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+
+    return (p + 2);
+}
+
+/*
+ *  ======== put32 ========
+ */
+static uint8_t *put32(uint8_t *p, uint32_t value)
+{
+    p = put16(p, (uint16_t)value);
+
+    return (put16(p, (uint16_t)(value >> 16)));
+}
+
+/*
+ *  ======== Telemetry_q15 ========
+ */
+int16_t Telemetry_q15(float32_t x)
+{
+    float32_t q = x * 32768.0f;
+
+    if (q >= 32767.0f) {
+        return (INT16_MAX);
+    }
+    if (q <= -32768.0f) {
+        return (INT16_MIN);
+    }
+
+    return ((int16_t)lrintf(q));
+}
+
+/*
+ *  ======== Telemetry_setHarmonic ========
+ *  The peak amplitude of a sinusoid is twice |X[k]| / N.
+ */
+void Telemetry_setHarmonic(Telemetry_Result *result, uint_least8_t h,
+                           float32_t re, float32_t im)
+{
+    float32_t mag = 2.0f * sqrtf((re * re) + (im * im)) * 32768.0f;
+
+    result->magnitude[h] = (mag >= 65535.0f) ? UINT16_MAX :
+                           (uint16_t)lrintf(mag);
+    result->phase[h] = Telemetry_q15(atan2f(im, re) * (1.0f / PI));
+}
+
+/*
+ *  ======== Telemetry_encodeFrame ========
+ *  Encoded forward: each zero becomes the code byte of the block it ends.
+ */
+size_t Telemetry_encodeFrame(uint8_t *payload, size_t len, uint8_t *frame)
+{
+    uint8_t *code;
+    uint8_t *out;
+    size_t i;
+
+    put16(payload + len, Telemetry_crc16(payload, len));
+    len += 2U;
+
+    code = frame;
+    out = frame + 1;
+    *code = 1;
+    for (i = 0; i < len; i++) {
+        if (payload[i] != 0) {
+            *out++ = payload[i];
+            (*code)++;
+        }
+        if ((payload[i] == 0) || (*code == COBS_BLOCK)) {
+            code = out++;
+            *code = 1;
+        }
+    }
+    *out++ = 0;
+
+    return ((size_t)(out - frame));
+}
+
+/*
+ *  ======== Telemetry_encode ========
+ */
+size_t Telemetry_encode(const Telemetry_Result *result, uint8_t *frame)
+{
+    uint_least8_t numHarmonics = (result->numHarmonics >
+                                  Telemetry_MAX_HARMONICS) ?
+                                 Telemetry_MAX_HARMONICS :
+                                 result->numHarmonics;
+    uint8_t payload[Telemetry_ORDERS_PAYLOAD_LEN(Telemetry_MAX_HARMONICS)];
+    uint8_t *p = payload;
+    uint8_t flags = 0;
+    uint_least8_t h;
+
+    /* The order list only goes out if it is not 1 to H */
+    for (h = 0; h < numHarmonics; h++) {
+        if (result->order[h] != (h + 1U)) {
+            flags = Telemetry_FLAG_ORDERS;
+            break;
+        }
+    }
+
+    *p++ = Telemetry_VERSION;
+    *p++ = (uint8_t)result->channel;
+    *p++ = (uint8_t)numHarmonics;
+    *p++ = flags;
+    p = put32(p, result->sequence);
+    p = put16(p, (uint16_t)result->dc);
+    p = put16(p, result->rms);
+    p = put32(p, result->frequency);
+    if (flags != 0U) {
+        for (h = 0; h < numHarmonics; h++) {
+            *p++ = result->order[h];
+        }
+    }
+    for (h = 0; h < numHarmonics; h++) {
+        p = put16(p, result->magnitude[h]);
+        p = put16(p, (uint16_t)result->phase[h]);
+    }
+
+    return (Telemetry_encodeFrame(payload, (size_t)(p - payload), frame));
+}
+
+/*
+ *  ======== Telemetry_sendFrame ========
+ */
+int_fast16_t Telemetry_sendFrame(const uint8_t *frame, size_t len)
+{
+#if defined(UART_BUFFERED)
+    size_t needed = len;
+    size_t i;
+
+    /* UARTwrite() adds a CR in front of every LF */
+    for (i = 0; i < len; i++) {
+        if (frame[i] == '\n') {
+            needed++;
+        }
+    }
+    if ((size_t)UARTTxBytesFree() < needed) {
+        return (Telemetry_STATUS_BUSY);
+    }
+#endif
+
+    UARTwrite((const char *)frame, len);
+
+    return (Telemetry_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Telemetry_send ========
+ */
+int_fast16_t Telemetry_send(const Telemetry_Result *result)
+{
+    uint8_t frame[Telemetry_MAX_FRAME_LEN];
+
+    return (Telemetry_sendFrame(frame, Telemetry_encode(result, frame)));
+}
@@ -0,0 +1,197 @@
+/*
+ *  ======== telemetry.h ========
+ *  Binary result frames for the serial link.
+ *
+ *  One frame carries the results of one channel: sequence number, DC,
+ *  RMS, fundamental frequency and the magnitude and phase of every
+ *  reported harmonic, all in fixed point.  Little-endian payload layout:
+ *
+ *      offset  size  field
+ *      0       1     Telemetry_VERSION
+ *      1       1     channel
+ *      2       1     numHarmonics (H)
+ *      3       1     flags, Telemetry_FLAG_ORDERS or 0
+ *      4       4     sequence
+ *      8       2     dc, q15 of full scale
+ *      10      2     rms, unsigned q15 of full scale
+ *      12      4     fundamental frequency, mHz
+ *      16      O     with Telemetry_FLAG_ORDERS only: the order of every
+ *                    harmonic, one byte each, 1 for the fundamental (O = H,
+ *                    else O = 0)
+ *      16+O    4 H   per harmonic: peak magnitude (unsigned q15 of full
+ *                    scale) and phase (q15 of pi radians)
+ *      16+O+4H 2     CRC-16/CCITT-FALSE of all bytes above
+ *
+ *  Without the flag the harmonics are the orders 1 to H, as in every frame
+ *  of version 1, which had the same layout with the flags reserved.  The
+ *  order list is only sent when the console picked other orders.  Version
+ *  2 frames carried an order byte in front of every harmonic.
+ *
+ *  The payload is COBS encoded, so it contains no zero byte, and a zero
+ *  byte ends the frame.  UARTwrite() puts a CR before every LF byte; the
+ *  decoder drops the byte before each LF, which undoes it exactly.
+ *
+ *  With 50 harmonics a frame is about 221 bytes on the wire, 271 with the
+ *  order list, against some 1.1 kB for the same values printed as decimal
+ *  text and 2.5 kB for a VT100 dashboard with cursor positioning, so the
+ *  same 115200 baud link carries 5 to 11 times more results per second.
+ *
+ *  tools/telemetry_decode.py turns the stream back into CSV.  Other
+ *  modules send their own frames with Telemetry_encodeFrame() and
+ *  Telemetry_sendFrame(); the first payload byte tells them apart.
+ */
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Telemetry_send().
+ */
+#define Telemetry_STATUS_SUCCESS    (0)
+
+/*!
+ *  @brief  Returned by Telemetry_send() when the frame was dropped because
+ *          the buffered UART had no room for all of it.
+ */
+#define Telemetry_STATUS_BUSY       (-1)
+
+/*!
+ *  @brief  Payload layout version
+ */
+#define Telemetry_VERSION           (3)
+
+/*!
+ *  @brief  Flag: the frame carries its order list
+ */
+#define Telemetry_FLAG_ORDERS       (0x01U)
+
+/*!
+ *  @brief  Most harmonics in one frame
+ */
+#define Telemetry_MAX_HARMONICS     (50)
+
+/*!
+ *  @brief  Payload bytes of a frame with @p numHarmonics harmonics 1 to
+ *          H, including the CRC
+ */
+#define Telemetry_PAYLOAD_LEN(numHarmonics) (18U + (4U * (numHarmonics)))
+
+/*!
+ *  @brief  Payload bytes of a frame with @p numHarmonics harmonics and
+ *          their order list, including the CRC
+ */
+#define Telemetry_ORDERS_PAYLOAD_LEN(numHarmonics)                      \
+    (Telemetry_PAYLOAD_LEN(numHarmonics) + (numHarmonics))
+
+/*!
+ *  @brief  Largest encoded frame of @p payloadLen payload bytes, CRC
+ *          included, with the zero delimiter
+ */
+#define Telemetry_FRAME_LEN(payloadLen)                                 \
+    ((payloadLen) + ((payloadLen) / 254U) + 2U)
+
+/*!
+ *  @brief  Largest encoded result frame, including the zero delimiter
+ */
+#define Telemetry_MAX_FRAME_LEN                                         \
+    Telemetry_FRAME_LEN(                                                \
+        Telemetry_ORDERS_PAYLOAD_LEN(Telemetry_MAX_HARMONICS))
+
+/*!
+ *  @brief  Results of one channel
+ */
+typedef struct {
+    uint32_t      sequence;         /*!< Frame counter */
+    uint_least8_t channel;          /*!< Channel index */
+    uint_least8_t numHarmonics;     /*!< Valid entries below */
+    int16_t       dc;               /*!< DC, q15 of full scale */
+    uint16_t      rms;              /*!< RMS, unsigned q15 of full scale */
+    uint32_t      frequency;        /*!< Fundamental frequency in mHz */
+    /*! Order per harmonic, 1 for the fundamental; sent only if the
+     *  orders are not 1 to numHarmonics */
+    uint8_t       order[Telemetry_MAX_HARMONICS];
+    /*! Peak magnitude per harmonic, unsigned q15 of full scale */
+    uint16_t      magnitude[Telemetry_MAX_HARMONICS];
+    /*! Phase per harmonic, q15 of pi radians */
+    int16_t       phase[Telemetry_MAX_HARMONICS];
+} Telemetry_Result;
+
+/*!
+ *  @brief  CRC-16/CCITT-FALSE of @p len bytes, as used in the frames.
+ */
+extern uint16_t Telemetry_crc16(const uint8_t *data, size_t len);
+
+/*!
+ *  @brief  Saturating conversion of a value in full-scale units to q15.
+ */
+extern int16_t Telemetry_q15(float32_t x);
+
+/*!
+ *  @brief  Set magnitude and phase of one harmonic from its phasor.
+ *
+ *  @param  result  Result to update
+ *  @param  h       Index into the result's harmonics
+ *  @param  re      Real part of X[k] / N, full scale 1.0
+ *  @param  im      Imaginary part of X[k] / N
+ */
+extern void Telemetry_setHarmonic(Telemetry_Result *result, uint_least8_t h,
+                                  float32_t re, float32_t im);
+
+/*!
+ *  @brief  Append the CRC to a payload and COBS encode it into a frame.
+ *
+ *  @param  payload  @p len payload bytes, followed by room for the 2 CRC
+ *                   bytes
+ *  @param  len      Payload bytes without the CRC
+ *  @param  frame    Output of at least Telemetry_FRAME_LEN(len + 2) bytes
+ *
+ *  @return Frame length in bytes, including the zero delimiter
+ */
+extern size_t Telemetry_encodeFrame(uint8_t *payload, size_t len,
+                                    uint8_t *frame);
+
+/*!
+ *  @brief  Encode a result into a delimited COBS frame.
+ *
+ *  @param  result  Result to encode; numHarmonics is capped at
+ *                  Telemetry_MAX_HARMONICS
+ *  @param  frame   Output of at least Telemetry_MAX_FRAME_LEN bytes
+ *
+ *  @return Frame length in bytes, including the zero delimiter
+ */
+extern size_t Telemetry_encode(const Telemetry_Result *result,
+                               uint8_t *frame);
+
+/*!
+ *  @brief  Encode a result and write it with UARTwrite().
+ *
+ *  With UART_BUFFERED the frame is only queued if it fits in the transmit
+ *  buffer as a whole, so a busy link drops whole frames instead of
+ *  corrupting them.  Otherwise the call blocks until the frame is sent.
+ *
+ *  @return Telemetry_STATUS_SUCCESS or Telemetry_STATUS_BUSY
+ */
+extern int_fast16_t Telemetry_send(const Telemetry_Result *result);
+
+/*!
+ *  @brief  Write an encoded frame with UARTwrite(), whole or not at all.
+ *
+ *  Same rules as Telemetry_send().
+ *
+ *  @return Telemetry_STATUS_SUCCESS or Telemetry_STATUS_BUSY
+ */
+extern int_fast16_t Telemetry_sendFrame(const uint8_t *frame, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H_ */
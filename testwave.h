@@ -0,0 +1,33 @@
+/*
+ *  ======== testwave.h ========
+ *  Recorded test waveform.
+ *
+ *  One mains cycle of a distorted voltage as raw 12-bit ADC codes, one
+ *  code per half-word as the uDMA delivers them.  main_nortos.c runs it
+ *  through the chain with SIGNAL_SOURCE_TABLE, and the host tools use it
+ *  as a golden input.
+ */
+#ifndef TESTWAVE_H_
+#define TESTWAVE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Samples in TestWave_bbx, exactly one cycle
+ */
+#define TestWave_LEN    (1024)
+
+/*!
+ *  @brief  The recorded cycle
+ */
+extern const uint16_t TestWave_bbx[TestWave_LEN];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTWAVE_H_ */
@@ -0,0 +1,468 @@
+/*
+ *  ======== accuracy.c ========
+ *  Host accuracy harness: every harmonic engine against a double-precision
+ *  reference.
+ *
+ *  Each input is quantized to 12-bit ADC codes once; the reference is a
+ *  direct double-precision DFT of those codes at the harmonic bins, so ADC
+ *  quantization is common to both sides and the numbers are the cost of
+ *  the arithmetic alone.  The engines are those of main_nortos.c in the
+ *  precision selected by PRECISION:
+ *
+ *      fft         real FFT, complex bins (rectangular window)
+ *      magnitude   the magnitude stage on the same FFT output, compared in
+ *                  magnitude only against the exact |X[k]| of that output
+ *      goertzel    Goertzel bank
+ *      sdft        sliding DFT after one full window (always q15 inside)
+ *
+ *  Inputs, one nominal mains cycle per frame:
+ *
+ *      bbx         the recorded TestWave_bbx cycle, stretched to fftLen
+ *      harmonics   fundamental at 0.9 full scale with harmonics to the 13th
+ *      low         the same at 0.03 full scale
+ *      noise       harmonics plus white noise of 1e-3 full scale rms
+ *      drift       harmonics with the frequency sweeping +-0.2 % over the
+ *                  frame, so the energy is no longer on exact bins
+ *
+ *  Output is CSV on stdout, one header line and one line per engine and
+ *  input:
+ *
+ *      engine,precision,input,snr_db,mag_err_pct,phase_err_deg,thd_err_pct,
+ *      ns_per_frame
+ *
+ *  snr_db is the reference energy over the error energy of all harmonic
+ *  phasors, mag_err_pct the worst harmonic magnitude error in percent of
+ *  the fundamental, phase_err_deg the worst phase error of the harmonics
+ *  above PHASE_FLOOR (empty for magnitude), thd_err_pct the THD error in
+ *  percentage points and ns_per_frame the host cost of the engine alone.
+ *
+ *  Build with tools/Makefile and run from the repository root:
+ *
+ *      make -C tools
+ *      make -C tools accuracy > accuracy.csv
+ *
+ *  or run one precision as tools/build/accuracy_q15 [fftLen].
+ *
+ *  fftLen defaults to 1024.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "goertzel.h"
+#include "ingest.h"
+#include "precision.h"
+#include "sdft.h"
+#include "spectrum.h"
+#include "testwave.h"
+
+#define MAX_LEN         (4096)
+
+/* Timed repetitions of every engine */
+#define REPEATS         (50)
+
+/* Harmonics below this fraction of the fundamental have no usable phase */
+#define PHASE_FLOOR     (1e-3)
+
+/* Noise of the noise input, rms relative to full scale */
+#define NOISE_RMS       (1e-3)
+
+/* Frequency sweep of the drift input, relative to nominal */
+#define DRIFT           (0.002)
+
+typedef enum {
+    Engine_FFT = 0,
+    Engine_MAGNITUDE,
+    Engine_GOERTZEL,
+    Engine_SDFT,
+    Engine_COUNT
+} Engine;
+
+typedef enum {
+    Input_BBX = 0,
+    Input_HARMONICS,
+    Input_LOW,
+    Input_NOISE,
+    Input_DRIFT,
+    Input_COUNT
+} Input;
+
+static const char *engineNames[Engine_COUNT] = {
+    "fft",
+    "magnitude",
+    "goertzel",
+    "sdft"
+};
+
+static const char *inputNames[Input_COUNT] = {
+    "bbx",
+    "harmonics",
+    "low",
+    "noise",
+    "drift"
+};
+
+/* Harmonic content of the synthetic inputs, relative to the fundamental */
+typedef struct {
+    uint_least8_t order;
+    double        level;
+    double        phase;
+} Harmonic;
+
+static const Harmonic profile[] = {
+    {1, 1.000, 0.0},
+    {2, 0.002, 0.3},
+    {3, 0.040, 1.1},
+    {5, 0.030, 2.0},
+    {7, 0.020, 0.7},
+    {9, 0.010, 2.9},
+    {11, 0.005, 1.6},
+    {13, 0.003, 0.2}
+};
+
+#define NUM_PROFILE     (sizeof(profile) / sizeof(profile[0]))
+
+static uint16_t codes[MAX_LEN];
+static Precision_Sample frame[MAX_LEN] __attribute__((aligned(4)));
+static Precision_Sample work[Spectrum_WORK_LEN(MAX_LEN)];
+static Precision_Sample mag[Spectrum_NUM_BINS(MAX_LEN)];
+static Goertzel_Phasor phasors[Goertzel_MAX_BINS];
+static q15_t sdftFrame[MAX_LEN];
+static q15_t sdftHistory[MAX_LEN];
+static q15_t sdftCosTable[MAX_LEN];
+static uint16_t sdftBins[Sdft_MAX_BINS];
+static q31_t sdftPhasors[2 * Sdft_MAX_BINS];
+
+static Ingest_Object ingest;
+static Spectrum_Object spectrum;
+static Goertzel_Object goertzel;
+static Sdft_Object sdft;
+
+/* Harmonic phasors, X[k] / N, of the reference and the engine under test */
+static double refRe[Goertzel_MAX_BINS];
+static double refIm[Goertzel_MAX_BINS];
+static double outRe[Goertzel_MAX_BINS];
+static double outIm[Goertzel_MAX_BINS];
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ *  ======== gaussian ========
+ *  Unit-variance normal deviate from a fixed-seed generator, so every run
+ *  sees the same noise.
+ */
+static double gaussian(void)
+{
+    static uint32_t state = 12345U;
+    double u1;
+    double u2;
+
+    state = (state * 1664525U) + 1013904223U;
+    u1 = ((state >> 8) + 1.0) / 16777217.0;
+    state = (state * 1664525U) + 1013904223U;
+    u2 = (state >> 8) / 16777216.0;
+
+    return (sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2));
+}
+
+/*
+ *  ======== synthesize ========
+ *  Rounded 12-bit codes of one frame of the input, clipped like the ADC.
+ */
+static void synthesize(Input input, uint16_t len)
+{
+    double level = (input == Input_LOW) ? 0.03 : 0.9;
+    double drift = (input == Input_DRIFT) ? DRIFT : 0.0;
+    double phi;
+    double x;
+    double code;
+    uint16_t n;
+    uint_least8_t h;
+
+    for (n = 0; n < len; n++) {
+        if (input == Input_BBX) {
+            codes[n] = TestWave_bbx[((uint32_t)n * TestWave_LEN) / len];
+            continue;
+        }
+
+        /* Fundamental phase, with the frequency swept linearly */
+        phi = 2.0 * M_PI * (n + (drift * (((double)n * n / len) - n))) / len;
+
+        x = 0.0;
+        for (h = 0; h < NUM_PROFILE; h++) {
+            x += profile[h].level * sin((profile[h].order * phi) +
+                                        profile[h].phase);
+        }
+        x *= level;
+        if (input == Input_NOISE) {
+            x += NOISE_RMS * gaussian();
+        }
+
+        code = floor((2048.0 * x) + 2048.5);
+        codes[n] = (code < 0.0) ? 0 : ((code > 4095.0) ? 4095 : code);
+    }
+}
+
+/*
+ *  ======== reference ========
+ *  Harmonic phasors of the codes by a direct double-precision DFT.
+ */
+static void reference(uint16_t len, uint_least8_t numHarmonics)
+{
+    double x;
+    double w;
+    uint16_t n;
+    uint_least8_t h;
+
+    for (h = 0; h < numHarmonics; h++) {
+        w = 2.0 * M_PI * (h + 1U) / len;
+        refRe[h] = 0.0;
+        refIm[h] = 0.0;
+        for (n = 0; n < len; n++) {
+            x = ((double)codes[n] - Ingest_ADC_OFFSET) / 2048.0;
+            refRe[h] += x * cos(w * n);
+            refIm[h] -= x * sin(w * n);
+        }
+        refRe[h] /= len;
+        refIm[h] /= len;
+    }
+}
+
+/*
+ *  ======== run ========
+ *  One frame through the engine, from the ingested frame.  The window and
+ *  transform are timed with fft, the magnitude stage alone with magnitude.
+ */
+static void run(Engine engine, uint16_t len)
+{
+    static Precision_Sample scratch[MAX_LEN] __attribute__((aligned(4)));
+
+    switch (engine) {
+        case Engine_FFT:
+            memcpy(scratch, frame, len * sizeof(Precision_Sample));
+            Spectrum_transform(&spectrum, scratch);
+            break;
+
+        case Engine_MAGNITUDE:
+            /* On the output of the FFT run just before */
+            Spectrum_magnitude(&spectrum, mag);
+            break;
+
+        case Engine_GOERTZEL:
+            Goertzel_process(&goertzel, frame, phasors);
+            break;
+
+        default:
+#if (PRECISION == PRECISION_Q31)
+            arm_q31_to_q15(frame, sdftFrame, len);
+#elif (PRECISION == PRECISION_F32)
+            arm_float_to_q15(frame, sdftFrame, len);
+#else
+            memcpy(sdftFrame, frame, len * sizeof(q15_t));
+#endif
+            Sdft_updateBlock(&sdft, sdftFrame, len);
+            Sdft_getPhasors(&sdft, sdftPhasors);
+            break;
+    }
+}
+
+/*
+ *  ======== collect ========
+ *  Harmonic phasors of the engine's last run as doubles.  The magnitude
+ *  engine has no phase; its reference becomes the exact magnitude of the
+ *  FFT bins it was computed from.
+ */
+static void collect(Engine engine, uint_least8_t numHarmonics)
+{
+    double re;
+    double im;
+    uint_least8_t h;
+
+    for (h = 0; h < numHarmonics; h++) {
+        switch (engine) {
+            case Engine_FFT:
+                outRe[h] = Precision_toFloat(work[2U * (h + 1U)]);
+                outIm[h] = Precision_toFloat(work[(2U * (h + 1U)) + 1U]);
+                break;
+
+            case Engine_MAGNITUDE:
+                re = Precision_toFloat(work[2U * (h + 1U)]);
+                im = Precision_toFloat(work[(2U * (h + 1U)) + 1U]);
+                refRe[h] = sqrt((re * re) + (im * im));
+                refIm[h] = 0.0;
+                outRe[h] = Spectrum_MAG_TO_FLOAT(mag[h + 1U]);
+                outIm[h] = 0.0;
+                break;
+
+            case Engine_GOERTZEL:
+#if (PRECISION == PRECISION_F32)
+                outRe[h] = phasors[h].re;
+                outIm[h] = phasors[h].im;
+#else
+                outRe[h] = phasors[h].re / 2147483648.0;
+                outIm[h] = phasors[h].im / 2147483648.0;
+#endif
+                break;
+
+            default:
+                outRe[h] = sdftPhasors[2U * h] / 2147483648.0;
+                outIm[h] = sdftPhasors[(2U * h) + 1U] / 2147483648.0;
+                break;
+        }
+    }
+}
+
+/*
+ *  ======== thd ========
+ *  THD in percent of a set of harmonic phasors.
+ */
+static double thd(const double *re, const double *im,
+                  uint_least8_t numHarmonics)
+{
+    double fundamental = hypot(re[0], im[0]);
+    double sum = 0.0;
+    uint_least8_t h;
+
+    for (h = 1; h < numHarmonics; h++) {
+        sum += (re[h] * re[h]) + (im[h] * im[h]);
+    }
+
+    return ((fundamental > 0.0) ? (100.0 * sqrt(sum) / fundamental) : 0.0);
+}
+
+/*
+ *  ======== report ========
+ *  Compare the engine's phasors with the reference and print one line.
+ */
+static void report(Engine engine, Input input, uint_least8_t numHarmonics,
+                   double ns)
+{
+    double fundamental = hypot(refRe[0], refIm[0]);
+    double signal = 0.0;
+    double noise = 0.0;
+    double magErr = 0.0;
+    double phaseErr = 0.0;
+    double dRe;
+    double dIm;
+    double d;
+    uint_least8_t h;
+
+    for (h = 0; h < numHarmonics; h++) {
+        dRe = outRe[h] - refRe[h];
+        dIm = outIm[h] - refIm[h];
+        signal += (refRe[h] * refRe[h]) + (refIm[h] * refIm[h]);
+        noise += (dRe * dRe) + (dIm * dIm);
+
+        d = fabs(hypot(outRe[h], outIm[h]) - hypot(refRe[h], refIm[h]));
+        if (d > magErr) {
+            magErr = d;
+        }
+
+        if (hypot(refRe[h], refIm[h]) >= (PHASE_FLOOR * fundamental)) {
+            d = atan2(outIm[h], outRe[h]) - atan2(refIm[h], refRe[h]);
+            d = fabs(remainder(d, 2.0 * M_PI)) * (180.0 / M_PI);
+            if (d > phaseErr) {
+                phaseErr = d;
+            }
+        }
+    }
+
+    printf("%s,%s,%s,", engineNames[engine], Precision_NAME,
+           inputNames[input]);
+    if (noise > 0.0) {
+        printf("%.2f,", 10.0 * log10(signal / noise));
+    }
+    else {
+        printf("inf,");
+    }
+    printf("%.5f,", (fundamental > 0.0) ? (100.0 * magErr / fundamental) :
+                                          0.0);
+    if (engine == Engine_MAGNITUDE) {
+        printf(",");
+    }
+    else {
+        printf("%.4f,", phaseErr);
+    }
+    printf("%.5f,%.0f\n",
+           fabs(thd(outRe, outIm, numHarmonics) -
+                thd(refRe, refIm, numHarmonics)), ns);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint16_t fftLen = (argc > 1) ? (uint16_t)atoi(argv[1]) : 1024;
+    uint_least8_t numHarmonics;
+    uint_least8_t h;
+    uint64_t t0;
+    uint64_t cost;
+    uint16_t r;
+    int i;
+    int e;
+
+    if ((fftLen > MAX_LEN) || (fftLen < 8) ||
+        (Spectrum_init(&spectrum, fftLen, work) != Spectrum_STATUS_SUCCESS)) {
+        fprintf(stderr, "usage: %s [fftLen]\n", argv[0]);
+        return (1);
+    }
+
+    numHarmonics = ((fftLen / 2U) - 1U < Goertzel_MAX_BINS) ?
+                   (uint_least8_t)((fftLen / 2U) - 1U) : Goertzel_MAX_BINS;
+    for (h = 0; h < numHarmonics; h++) {
+        sdftBins[h] = h + 1U;
+    }
+
+    if ((Goertzel_initHarmonics(&goertzel, fftLen, 1, numHarmonics) !=
+         Goertzel_STATUS_SUCCESS) ||
+        (Sdft_init(&sdft, fftLen, sdftBins, numHarmonics, 1, sdftHistory,
+                   sdftCosTable) != Sdft_STATUS_SUCCESS)) {
+        fprintf(stderr, "fftLen %u not supported\n", fftLen);
+        return (1);
+    }
+
+    Ingest_init(&ingest, Ingest_DC_SHIFT_DEFAULT);
+
+    printf("engine,precision,input,snr_db,mag_err_pct,phase_err_deg,"
+           "thd_err_pct,ns_per_frame\n");
+
+    for (i = 0; i < Input_COUNT; i++) {
+        synthesize((Input)i, fftLen);
+        Ingest_convert(&ingest, codes, frame, fftLen);
+
+        for (e = 0; e < Engine_COUNT; e++) {
+            cost = 0;
+            for (r = 0; r < REPEATS; r++) {
+                t0 = nowNs();
+                run((Engine)e, fftLen);
+                cost += nowNs() - t0;
+            }
+
+            /* The sliding DFT holds exactly the last frame by now */
+            reference(fftLen, numHarmonics);
+            collect((Engine)e, numHarmonics);
+            report((Engine)e, (Input)i, numHarmonics,
+                   (double)cost / REPEATS);
+        }
+    }
+
+    return (0);
+}
+
+#endif
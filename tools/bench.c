@@ -0,0 +1,375 @@
+/*
+ *  ======== bench.c ========
+ *  Host benchmark of the measurement core.
+ *
+ *  Runs every harmonic engine of main_nortos.c (real FFT with magnitude
+ *  and peak search, Goertzel bank, sliding DFT) together with the ingest
+ *  stage over interleaved multi-channel frames, for every FFT length and
+ *  channel count, and reports the cost per frame of all channels.  The
+ *  precision is the one selected by PRECISION at build time; tools/Makefile
+ *  builds one binary per precision.
+ *
+ *  Two golden inputs, each exactly one mains cycle per frame:
+ *
+ *      bbx         the recorded TestWave_bbx cycle, stretched to fftLen
+ *      harmonics   a synthetic fundamental at 0.9 full scale with odd and
+ *                  even harmonics up to the 13th
+ *
+ *  Channel k sees the input shifted by k / 3 of a cycle, like the phases
+ *  of a three-phase system.
+ *
+ *  Output is CSV on stdout, one header line and one line per case:
+ *
+ *      engine,precision,fft_len,channels,input,ns_per_frame,frames_per_s,
+ *      fundamental,thd_pct
+ *
+ *  fundamental is |X[1]| / fftLen of channel 0 (half the peak amplitude,
+ *  full scale 1.0) and thd_pct its THD over all tracked harmonics, so a
+ *  change in the numbers shows up next to a change in the speed.
+ *
+ *  Build and run on Linux from the repository root:
+ *
+ *      make -C tools CMSIS_DSP=<CMSIS-DSP> CMSIS_CORE=<CMSIS>/Core/Include
+ *      make -C tools bench > bench.csv
+ *
+ *  or run one precision as tools/build/bench_q15 [minMilliseconds], where
+ *  minMilliseconds (default 50) is the shortest timed run of every case.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "channels.h"
+#include "goertzel.h"
+#include "ingest.h"
+#include "precision.h"
+#include "sdft.h"
+#include "spectrum.h"
+#include "testwave.h"
+
+#define MAX_LEN         (4096)
+
+/* Fewest timed repetitions of every case */
+#define MIN_REPEATS     (3)
+
+typedef enum {
+    Engine_FFT = 0,
+    Engine_GOERTZEL,
+    Engine_SDFT,
+    Engine_COUNT
+} Engine;
+
+typedef enum {
+    Input_BBX = 0,
+    Input_HARMONICS,
+    Input_COUNT
+} Input;
+
+static const char *engineNames[Engine_COUNT] = {
+    "fft",
+    "goertzel",
+    "sdft"
+};
+
+static const char *inputNames[Input_COUNT] = {
+    "bbx",
+    "harmonics"
+};
+
+static const uint16_t fftLens[] = {256, 512, 1024, 2048, 4096};
+
+#define NUM_LENS        (sizeof(fftLens) / sizeof(fftLens[0]))
+
+static const uint_least8_t channelCounts[] = {1, 3, Channels_COUNT};
+
+#define NUM_COUNTS      (sizeof(channelCounts) / sizeof(channelCounts[0]))
+
+/* Harmonic content of the synthetic input, relative to the fundamental */
+typedef struct {
+    uint_least8_t order;
+    double        level;
+    double        phase;
+} Harmonic;
+
+static const Harmonic profile[] = {
+    {2, 0.002, 0.3},
+    {3, 0.040, 1.1},
+    {5, 0.030, 2.0},
+    {7, 0.020, 0.7},
+    {9, 0.010, 2.9},
+    {11, 0.005, 1.6},
+    {13, 0.003, 0.2}
+};
+
+#define NUM_PROFILE     (sizeof(profile) / sizeof(profile[0]))
+
+/* Interleaved codes, as one ADC stream delivers them */
+static uint16_t codes[MAX_LEN * Channels_COUNT];
+
+static Precision_Sample frames[Channels_COUNT][MAX_LEN]
+    __attribute__((aligned(4)));
+static Precision_Sample work[Spectrum_WORK_LEN(MAX_LEN)];
+static Precision_Sample mag[Spectrum_NUM_BINS(MAX_LEN)];
+static Goertzel_Phasor phasors[Goertzel_MAX_BINS];
+static q15_t sdftHistory[Channels_COUNT][MAX_LEN];
+static q15_t sdftCosTable[MAX_LEN];
+static uint16_t sdftBins[Sdft_MAX_BINS];
+static q31_t sdftPhasors[2 * Sdft_MAX_BINS];
+#if (PRECISION != PRECISION_Q15)
+static q15_t sdftFrame[MAX_LEN];
+#endif
+
+static Ingest_Object ingest[Channels_COUNT];
+static Spectrum_Object spectrum;
+static Goertzel_Object goertzel;
+static Sdft_Object sdft[Channels_COUNT];
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ *  ======== synthesize ========
+ *  Interleaved codes of one cycle per frame on every channel.
+ */
+static void synthesize(Input input, uint16_t len, uint_least8_t channels)
+{
+    double w = 2.0 * M_PI / len;
+    double shift;
+    double x;
+    double code;
+    uint16_t n;
+    uint_least8_t k;
+    uint_least8_t h;
+
+    for (k = 0; k < channels; k++) {
+        shift = (k % 3U) / 3.0;
+
+        for (n = 0; n < len; n++) {
+            if (input == Input_BBX) {
+                codes[(n * channels) + k] =
+                    TestWave_bbx[(uint32_t)(((n / (double)len) + shift) *
+                                            TestWave_LEN) % TestWave_LEN];
+                continue;
+            }
+
+            x = sin(w * n - (2.0 * M_PI * shift));
+            for (h = 0; h < NUM_PROFILE; h++) {
+                x += profile[h].level *
+                     sin((w * profile[h].order * n) + profile[h].phase -
+                         (2.0 * M_PI * shift * profile[h].order));
+            }
+
+            code = floor((2048.0 * 0.9 * x) + 2048.5);
+            codes[(n * channels) + k] = (code < 0.0) ? 0 :
+                                        ((code > 4095.0) ? 4095 : code);
+        }
+    }
+}
+
+/*
+ *  ======== setup ========
+ */
+static int setup(uint16_t len, uint_least8_t channels,
+                 uint_least8_t numHarmonics)
+{
+    uint_least8_t k;
+
+    if ((Spectrum_init(&spectrum, len, work) != Spectrum_STATUS_SUCCESS) ||
+        (Goertzel_initHarmonics(&goertzel, len, 1, numHarmonics) !=
+         Goertzel_STATUS_SUCCESS)) {
+        return (-1);
+    }
+
+    for (k = 0; k < numHarmonics; k++) {
+        sdftBins[k] = k + 1U;
+    }
+
+    for (k = 0; k < channels; k++) {
+        Ingest_init(&ingest[k], Ingest_DC_SHIFT_DEFAULT);
+        if (Sdft_init(&sdft[k], len, sdftBins, numHarmonics, 1,
+                      sdftHistory[k], sdftCosTable) != Sdft_STATUS_SUCCESS) {
+            return (-1);
+        }
+    }
+
+    return (0);
+}
+
+/*
+ *  ======== runChannel ========
+ *  Channel k of the interleaved frame through the ingest stage and the
+ *  engine.
+ */
+static void runChannel(Engine engine, uint16_t len, uint_least8_t channels,
+                       uint_least8_t k)
+{
+    Precision_Sample maxValue;
+    uint32_t maxIndex;
+
+    Ingest_deinterleave(&ingest[k], &codes[k], channels, frames[k], len);
+
+    switch (engine) {
+        case Engine_FFT:
+            Spectrum_transform(&spectrum, frames[k]);
+            Spectrum_magnitude(&spectrum, mag);
+            Precision_max(&mag[1], Spectrum_NUM_BINS(len) - 1, &maxValue,
+                          &maxIndex);
+            break;
+
+        case Engine_GOERTZEL:
+            Goertzel_process(&goertzel, frames[k], phasors);
+            break;
+
+        default:
+#if (PRECISION == PRECISION_Q31)
+            arm_q31_to_q15(frames[k], sdftFrame, len);
+            Sdft_updateBlock(&sdft[k], sdftFrame, len);
+#elif (PRECISION == PRECISION_F32)
+            arm_float_to_q15(frames[k], sdftFrame, len);
+            Sdft_updateBlock(&sdft[k], sdftFrame, len);
+#else
+            Sdft_updateBlock(&sdft[k], frames[k], len);
+#endif
+            Sdft_getPhasors(&sdft[k], sdftPhasors);
+            break;
+    }
+}
+
+/*
+ *  ======== runFrame ========
+ *  One frame of every channel.
+ */
+static void runFrame(Engine engine, uint16_t len, uint_least8_t channels)
+{
+    uint_least8_t k;
+
+    for (k = 0; k < channels; k++) {
+        runChannel(engine, len, channels, k);
+    }
+}
+
+/*
+ *  ======== harmonicMag ========
+ *  Magnitude of harmonic h (0 is the fundamental) in the engine's output
+ *  for the last channel run.
+ */
+static double harmonicMag(Engine engine, uint_least8_t h)
+{
+    double re;
+    double im;
+
+    switch (engine) {
+        case Engine_FFT:
+            return (Spectrum_MAG_TO_FLOAT(mag[h + 1U]));
+
+        case Engine_GOERTZEL:
+#if (PRECISION == PRECISION_F32)
+            re = phasors[h].re;
+            im = phasors[h].im;
+#else
+            re = phasors[h].re / 2147483648.0;
+            im = phasors[h].im / 2147483648.0;
+#endif
+            break;
+
+        default:
+            re = sdftPhasors[2U * h] / 2147483648.0;
+            im = sdftPhasors[(2U * h) + 1U] / 2147483648.0;
+            break;
+    }
+
+    return (sqrt((re * re) + (im * im)));
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint64_t minNs = (uint64_t)((argc > 1) ? atoi(argv[1]) : 50) * 1000000U;
+    uint64_t t0;
+    uint64_t elapsed;
+    uint32_t repeats;
+    double ns;
+    double fundamental;
+    double sum;
+    double m;
+    uint_least8_t numHarmonics;
+    uint_least8_t h;
+    unsigned int l;
+    unsigned int c;
+    int e;
+    int i;
+
+    if (minNs == 0) {
+        fprintf(stderr, "usage: %s [minMilliseconds]\n", argv[0]);
+        return (1);
+    }
+
+    printf("engine,precision,fft_len,channels,input,ns_per_frame,"
+           "frames_per_s,fundamental,thd_pct\n");
+
+    for (l = 0; l < NUM_LENS; l++) {
+        numHarmonics = ((fftLens[l] / 2U) - 1U < Goertzel_MAX_BINS) ?
+                       (uint_least8_t)((fftLens[l] / 2U) - 1U) :
+                       Goertzel_MAX_BINS;
+
+        for (c = 0; c < NUM_COUNTS; c++) {
+            if (setup(fftLens[l], channelCounts[c], numHarmonics) != 0) {
+                fprintf(stderr, "fftLen %u not supported\n", fftLens[l]);
+                return (1);
+            }
+
+            for (i = 0; i < Input_COUNT; i++) {
+                synthesize((Input)i, fftLens[l], channelCounts[c]);
+
+                for (e = 0; e < Engine_COUNT; e++) {
+                    /* Warm up, then time whole frames */
+                    runFrame((Engine)e, fftLens[l], channelCounts[c]);
+
+                    repeats = 0;
+                    t0 = nowNs();
+                    do {
+                        runFrame((Engine)e, fftLens[l], channelCounts[c]);
+                        repeats++;
+                        elapsed = nowNs() - t0;
+                    } while ((elapsed < minNs) || (repeats < MIN_REPEATS));
+
+                    /* Results of channel 0 */
+                    runChannel((Engine)e, fftLens[l], channelCounts[c], 0);
+
+                    fundamental = harmonicMag((Engine)e, 0);
+                    sum = 0.0;
+                    for (h = 1; h < numHarmonics; h++) {
+                        m = harmonicMag((Engine)e, h);
+                        sum += m * m;
+                    }
+
+                    ns = (double)elapsed / repeats;
+                    printf("%s,%s,%u,%u,%s,%.0f,%.1f,%.6f,%.4f\n",
+                           engineNames[e], Precision_NAME, fftLens[l],
+                           channelCounts[c], inputNames[i], ns, 1e9 / ns,
+                           fundamental, (fundamental > 0.0) ?
+                           (100.0 * sqrt(sum) / fundamental) : 0.0);
+                }
+            }
+        }
+    }
+
+    return (0);
+}
+
+#endif
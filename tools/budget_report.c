@@ -0,0 +1,169 @@
+/*
+ *  ======== budget_report.c ========
+ *  SRAM budget of the measurement buffers for any channel count and frame
+ *  length.
+ *
+ *  Prints the memory outside the arena (stack, tables, UART and stream
+ *  rings of a build with UART_BUFFERED and STREAM_ENABLE), then for
+ *  each harmonic engine the arena buffers of budget.h with their lifetime
+ *  and size, the arena (boot buffers plus the scratch) and the sum against
+ *  the SRAM, in the precision selected by PRECISION:
+ *
+ *      make -C tools
+ *      tools/build/budget_report_<p> [channels] [frameLen] [harmonics]
+ *
+ *  channels defaults to 7, frameLen to 1024 and harmonics to 50, the
+ *  build of main_nortos.c; "make -C tools budget" prints that and 8
+ *  channels of 4096 samples for every precision.
+ *
+ *  The acquisition ring holds two frames of 16-bit ADC codes and grows
+ *  with channels * frameLen; the FFT history and work buffers follow
+ *  Analysis_MAX_LEN, fixed at build time, not frameLen.  Structure sizes
+ *  are the host's, a little above the target's where they hold pointers.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "budget.h"
+#include "sdft.h"
+#include "stream.h"
+#include "uartstdio.h"
+
+/* From MSP_EXP432E401Y_NoRTOS.cmd and udma.c */
+#define STACK_BYTES     (0x1000U)
+#define VTABLE_BYTES    (0x400U)
+#define UDMA_BYTES      (0x400U)
+
+typedef struct {
+    const char *name;
+    const char *lifetime;
+    uint32_t    bytes;
+} Item;
+
+/*
+ *  ======== printEngine ========
+ *  The arena holds the boot items and the scratch, the largest scratch
+ *  item or the sum of those needed at the same time.  Static items are the
+ *  engine's state outside the arena.
+ */
+static void printEngine(const char *engine, const Item *items,
+                        uint_least8_t numItems, uint32_t scratch,
+                        uint32_t other)
+{
+    uint32_t boot = 0;
+    uint32_t statics = 0;
+    uint32_t arena;
+    uint32_t total;
+    uint_least8_t i;
+
+    printf("\n%-30s %-9s %9s\n", engine, "lifetime", "bytes");
+    for (i = 0; i < numItems; i++) {
+        if (items[i].bytes == 0U) {
+            continue;
+        }
+        printf("  %-28s %-9s %9u\n", items[i].name, items[i].lifetime,
+               (unsigned)items[i].bytes);
+        if (items[i].lifetime[0] == 'b') {
+            boot += items[i].bytes;
+        }
+        else if (items[i].lifetime[1] == 't') {
+            statics += items[i].bytes;
+        }
+    }
+    arena = boot + scratch;
+    total = arena + statics + other;
+    printf("  %-28s %-9s %9u  of %u\n", "arena", "", (unsigned)arena,
+           (unsigned)Budget_ARENA_MAX_BYTES);
+    printf("  %-28s %-9s %9u\n", "SRAM", "", (unsigned)total);
+    if (arena > Budget_ARENA_MAX_BYTES) {
+        printf("  arena over by %u bytes\n",
+               (unsigned)(arena - Budget_ARENA_MAX_BYTES));
+    }
+    else if (total <= Budget_SRAM_BYTES) {
+        printf("  fits, %u bytes of SRAM spare\n",
+               (unsigned)(Budget_SRAM_BYTES - total));
+    }
+    else {
+        printf("  over by %u bytes\n", (unsigned)(total - Budget_SRAM_BYTES));
+    }
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t ch = (argc > 1) ? (uint32_t)atol(argv[1]) : 7U;
+    uint32_t len = (argc > 2) ? (uint32_t)atol(argv[2]) : 1024U;
+    uint32_t h = (argc > 3) ? (uint32_t)atol(argv[3]) : 50U;
+    uint32_t acquire = Budget_ACQUIRE_BYTES(len, ch);
+    uint32_t common;
+    const Item outside[] = {
+        {"stack", "static", STACK_BYTES},
+        {"vector table", "static", VTABLE_BYTES},
+        {"uDMA control table", "static", UDMA_BYTES},
+        {"UART rings", "static",
+         (uint32_t)(UART_TX_BUFFER_SIZE + UART_RX_BUFFER_SIZE)},
+        {"stream blocks", "static", (uint32_t)sizeof(Stream_Object)},
+    };
+    const Item fft[] = {
+        {"acquisition ring", "boot", acquire},
+        {"log records", "boot", Budget_LOG_BYTES},
+        {"analysis history", "boot", Budget_FFT_HISTORY_BYTES(ch)},
+        {"window coefficients", "boot", Budget_FFT_WINDOW_BYTES},
+        {"analysis state", "static", (uint32_t)sizeof(Analysis_Object)},
+        {"frame", "scratch", Budget_FRAME_BYTES(len)},
+        {"FFT work", "scratch", Budget_FFT_WORK_BYTES},
+    };
+    const Item goertzel[] = {
+        {"acquisition ring", "boot", acquire},
+        {"log records", "boot", Budget_LOG_BYTES},
+        {"phasors", "boot", Budget_GOERTZEL_RESULT_BYTES(ch, h)},
+        {"frame", "scratch", Budget_FRAME_BYTES(len)},
+    };
+    const Item sdft[] = {
+        {"acquisition ring", "boot", acquire},
+        {"log records", "boot", Budget_LOG_BYTES},
+        {"sample history", "boot", Budget_SDFT_HISTORY_BYTES(len, ch)},
+        {"cosine table", "boot", Budget_SDFT_TABLE_BYTES(len)},
+        {"phasors", "boot", Budget_SDFT_RESULT_BYTES(ch, h)},
+        {"channel state", "static", (uint32_t)(ch * sizeof(Sdft_Object))},
+        {"frame", "scratch", Budget_FRAME_BYTES(len)},
+        {"q15 frame", "scratch", Budget_SDFT_FRAME_BYTES(len)},
+    };
+    uint_least8_t i;
+
+    if ((ch == 0U) || (len == 0U)) {
+        fprintf(stderr, "usage: %s [channels] [frameLen] [harmonics]\n",
+                argv[0]);
+        return (2);
+    }
+
+    printf("memory budget, %s, %u channels x %u samples, %u harmonics, "
+           "Analysis_MAX_LEN %u\n", Precision_NAME, (unsigned)ch,
+           (unsigned)len, (unsigned)h, (unsigned)Analysis_MAX_LEN);
+
+    common = 0;
+    printf("\n%-30s %-9s %9s\n", "outside the arena", "lifetime", "bytes");
+    for (i = 0; i < (sizeof(outside) / sizeof(outside[0])); i++) {
+        printf("  %-28s %-9s %9u\n", outside[i].name, outside[i].lifetime,
+               (unsigned)outside[i].bytes);
+        common += outside[i].bytes;
+    }
+    printf("  %-28s %-9s %9u  of %u\n", "total", "", (unsigned)common,
+           (unsigned)Budget_OTHER_BYTES);
+
+    printEngine("fft", fft, sizeof(fft) / sizeof(fft[0]),
+                Budget_FFT_SCRATCH_BYTES(len), common);
+    printEngine("goertzel", goertzel, sizeof(goertzel) / sizeof(goertzel[0]),
+                Budget_GOERTZEL_SCRATCH_BYTES(len), common);
+    printEngine("sdft", sdft, sizeof(sdft) / sizeof(sdft[0]),
+                Budget_SDFT_SCRATCH_BYTES(len), common);
+
+    return (0);
+}
+
+#endif /* HOST_BUILD */
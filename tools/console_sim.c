@@ -0,0 +1,527 @@
+/*
+ *  ======== console_sim.c ========
+ *  Host test of the analysis console against the running acquisition.
+ *
+ *  Runs the host stand-in of the acquisition at 51.2 kS/s, 1024 samples
+ *  (one 50 Hz cycle) per frame, on two channels of a known harmonic
+ *  waveform, and the same ingest, Analysis_push() and Analysis_run() path
+ *  as main_nortos.c under the scheduler.  A script of command lines is
+ *  typed into the console: each line is handed to Console_poll() through
+ *  a stand-in of UARTPeek() and UARTgets() from the idle loop, and the
+ *  staged settings are taken up before channel 0 of the next frame, as on
+ *  the target.
+ *
+ *  Checked:
+ *
+ *      every command is accepted or refused as the script says
+ *      the first result of a new window comes as soon as it has filled
+ *      every result reports the orders of the list below Nyquist, with
+ *      the magnitude and the phase relative to the fundamental of the
+ *      waveform, and the fundamental frequency
+ *      the acquisition never stops: no frame is dropped or overrun
+ *      across all the reconfigurations
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/console_sim_<p> [script]
+ *
+ *  with <p> one of q15, q31 and f32.  A script file has one command per
+ *  line; a line starting with '!' is a command that must be refused.
+ *  Output is the console dialogue, then one line per applied setting:
+ *  frames to the first result, results checked, worst magnitude, phase
+ *  and frequency errors.  The exit status is non-zero if a check failed.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "acquire.h"
+#include "analysis.h"
+#include "console.h"
+#include "ingest.h"
+#include "scheduler.h"
+#include "uartstdio.h"
+
+#define FRAME_LEN       (1024U)
+#define SAMPLE_RATE     (51200U)
+#define FUNDAMENTAL     (50.0)
+#define NUM_CHANNELS    (2U)
+
+/* Frames each setting is checked for once its results come */
+#define CHECK_FRAMES    (8U)
+
+/* Longest script */
+#define MAX_STEPS       (64U)
+
+/* Limits: magnitude in full scale, phase in degrees for orders of at
+ * least PHASE_MIN, frequency in Hz */
+#define MAG_TOL         (0.003)
+#define PHASE_TOL       (2.0)
+#define PHASE_MIN       (0.05)
+#define FREQ_TOL        (0.05)
+
+typedef struct {
+    uint8_t order;
+    double  amplitude;          /* Peak, full scale, channel 0 */
+    double  phase;              /* Degrees */
+} Tone;
+
+/* Channel 1 carries half the amplitudes */
+static const Tone tones[] = {
+    {1,  0.60,   0.0},
+    {3,  0.15,  30.0},
+    {5,  0.08, -60.0},
+    {7,  0.05,  90.0},
+    {11, 0.03,  45.0},
+    {13, 0.02, -20.0}
+};
+
+#define NUM_TONES   (sizeof(tones) / sizeof(tones[0]))
+
+typedef struct {
+    const char *line;
+    bool        accept;
+} Step;
+
+static const Step defaultScript[] = {
+    {"show",                        false},
+    {"fft 64",                      true},
+    {"harmonics 1,3,5,7 11-13",     true},
+    {"fft 4096",                    false},
+    {"fft 4096 4",                  true},
+    {"window hann",                 true},
+    {"fft 256 3",                   true},
+    {"harmonics 1-60",              false},
+    {"harmonics 1-40",              true},
+    {"window flattop",              false},
+    {"fft 256 5",                   true},
+    {"window flattop",              true},
+    {"fft 128 1",                   false},
+    {"window rect",                 true},
+    {"fft 128 1",                   true},
+    {"cycles 0",                    false},
+    {"fft 1000",                    false},
+    {"fft 2048 2",                  true},
+    {"harmonics 1 3 5 7 9 11 13",   true},
+    {"frobnicate",                  false}
+};
+
+static Step script[MAX_STEPS];
+static char scriptText[MAX_STEPS][Console_LINE_LEN];
+static uint32_t numSteps;
+
+static uint16_t buffer[Acquire_BUFFER_LEN(FRAME_LEN, NUM_CHANNELS)];
+static Channels_Config channels[NUM_CHANNELS];
+static Acquire_Object acquire;
+static Scheduler_Object scheduler;
+static Ingest_Object ingest[NUM_CHANNELS];
+static Precision_Sample frames[NUM_CHANNELS][FRAME_LEN]
+    __attribute__((aligned(4)));
+static Precision_Sample history[NUM_CHANNELS][Analysis_HISTORY_LEN]
+    __attribute__((aligned(4)));
+static Precision_Sample work[Analysis_WORK_LEN] __attribute__((aligned(4)));
+static q15_t windowTable[Analysis_WINDOW_TABLE_LEN];
+static Analysis_Object analysis;
+static Console_Object console;
+
+/* Next sample index per channel */
+static uint32_t sourceIndex[NUM_CHANNELS];
+
+/* Typed line waiting for Console_poll() */
+static char input[Console_LINE_LEN];
+static bool inputReady;
+
+/* Progress of the current setting */
+static uint32_t frameCount;         /* Frames fully processed */
+static uint32_t appliedFrame;       /* Frame the setting was taken up on */
+static uint32_t firstResult;        /* Frames to the first result */
+static uint32_t results;            /* Results checked */
+static uint32_t settleFrames;       /* Frames a window takes to fill */
+static bool applied;
+static double maxMagError;
+static double maxPhaseError;
+static double maxFreqError;
+static uint32_t failures;
+
+/*
+ *  ======== UARTprintf ========
+ *  Console replies go to stdout.
+ */
+void UARTprintf(const char *pcString, ...)
+{
+    va_list args;
+
+    va_start(args, pcString);
+    vprintf(pcString, args);
+    va_end(args);
+}
+
+/*
+ *  ======== UARTPeek ========
+ *  A typed line ends with CR.
+ */
+int UARTPeek(unsigned char ucChar)
+{
+    return ((inputReady && (ucChar == '\r')) ? (int)strlen(input) : -1);
+}
+
+/*
+ *  ======== UARTgets ========
+ */
+int UARTgets(char *pcBuf, uint32_t ui32Len)
+{
+    strncpy(pcBuf, input, ui32Len - 1U);
+    pcBuf[ui32Len - 1U] = '\0';
+    inputReady = false;
+
+    return ((int)strlen(pcBuf));
+}
+
+/*
+ *  ======== amplitude ========
+ */
+static double amplitude(uint_least8_t channel, const Tone *tone)
+{
+    return ((channel == 0) ? tone->amplitude : (tone->amplitude * 0.5));
+}
+
+/*
+ *  ======== source ========
+ *  The waveform, rounded to 12-bit codes.
+ */
+static void source(uint_least8_t channel, uint16_t *dst, uint16_t numSamples,
+                   uint16_t stride, void *arg)
+{
+    double t;
+    double x;
+    uint16_t i;
+    uint32_t k;
+
+    (void)arg;
+
+    for (i = 0; i < numSamples; i++) {
+        t = (double)sourceIndex[channel]++ / SAMPLE_RATE;
+        x = 0.0;
+        for (k = 0; k < NUM_TONES; k++) {
+            x += amplitude(channel, &tones[k]) *
+                 cos((2.0 * M_PI * FUNDAMENTAL * tones[k].order * t) +
+                     (tones[k].phase * M_PI / 180.0));
+        }
+        dst[(uint32_t)i * stride] = (uint32_t)lrint(2048.0 + (2047.0 * x));
+    }
+}
+
+/*
+ *  ======== wrap ========
+ *  Angle in degrees to -180..180.
+ */
+static double wrap(double degrees)
+{
+    degrees = fmod(degrees, 360.0);
+    if (degrees > 180.0) {
+        degrees -= 360.0;
+    }
+    if (degrees < -180.0) {
+        degrees += 360.0;
+    }
+
+    return (degrees);
+}
+
+/*
+ *  ======== check ========
+ *  Compare one result with the waveform.
+ */
+static void check(uint_least8_t channel)
+{
+    const Analysis_Config *config = &analysis.config;
+    double fundamentalPhase = 0.0;
+    double mag;
+    double phase;
+    double want;
+    double wantPhase;
+    double error;
+    float32_t re;
+    float32_t im;
+    uint_least8_t n = 0;
+    uint_least8_t i;
+    uint32_t k;
+
+    /* Orders of the list below Nyquist, in list order */
+    for (i = 0; i < config->numHarmonics; i++) {
+        if (((uint32_t)config->orders[i] * config->cycles) <
+            (config->fftLen / 2U)) {
+            if ((n >= analysis.numReported) ||
+                (analysis.orders[n] != config->orders[i])) {
+                if (failures++ < 10U) {
+                    printf("FAIL: order %u not reported\n", config->orders[i]);
+                }
+            }
+            n++;
+        }
+    }
+    if (n != analysis.numReported) {
+        if (failures++ < 10U) {
+            printf("FAIL: %u orders reported, %u expected\n",
+                   analysis.numReported, n);
+        }
+    }
+
+    for (i = 0; i < analysis.numReported; i++) {
+        if (analysis.orders[i] == 1U) {
+            Analysis_harmonic(&analysis, i, &re, &im);
+            fundamentalPhase = atan2(im, re) * 180.0 / M_PI;
+        }
+    }
+
+    for (i = 0; i < analysis.numReported; i++) {
+        Analysis_harmonic(&analysis, i, &re, &im);
+        mag = 2.0 * sqrt(((double)re * re) + ((double)im * im));
+        phase = atan2(im, re) * 180.0 / M_PI;
+
+        want = 0.0;
+        wantPhase = 0.0;
+        for (k = 0; k < NUM_TONES; k++) {
+            if (tones[k].order == analysis.orders[i]) {
+                want = amplitude(channel, &tones[k]);
+                wantPhase = tones[k].phase;
+            }
+        }
+
+        error = fabs(mag - want);
+        if (error > maxMagError) {
+            maxMagError = error;
+        }
+
+        /* Against the fundamental, which takes out the window start */
+        if (want >= PHASE_MIN) {
+            error = fabs(wrap((phase - (analysis.orders[i] *
+                                        fundamentalPhase)) -
+                              (wantPhase - (analysis.orders[i] *
+                                            tones[0].phase))));
+            if (error > maxPhaseError) {
+                maxPhaseError = error;
+            }
+        }
+    }
+
+    error = fabs(Analysis_frequency(&analysis) - FUNDAMENTAL);
+    if (error > maxFreqError) {
+        maxFreqError = error;
+    }
+}
+
+/*
+ *  ======== report ========
+ *  Close the checks of the setting in use.
+ */
+static void report(void)
+{
+    const Analysis_Config *config = &analysis.config;
+    bool pass;
+
+    if (!applied) {
+        return;
+    }
+    applied = false;
+
+    pass = (firstResult == settleFrames) && (results != 0U) &&
+           (maxMagError <= MAG_TOL) && (maxPhaseError <= PHASE_TOL) &&
+           (maxFreqError <= FREQ_TOL);
+    if (!pass) {
+        failures++;
+    }
+
+    printf("  fft %4u  cycles %2u  %-7s  first result after %u frames "
+           "(%u due)  %3u results  mag %.5f  phase %.2f  freq %.4f  %s\n",
+           config->fftLen, config->cycles,
+           (config->window == Window_RECTANGULAR) ? "rect" :
+           (config->window == Window_HANN) ? "hann" :
+           (config->window == Window_FLAT_TOP) ? "flattop" : "bh",
+           (unsigned)firstResult, (unsigned)settleFrames, (unsigned)results,
+           maxMagError, maxPhaseError, maxFreqError, pass ? "ok" : "FAIL");
+}
+
+/*
+ *  ======== job ========
+ *  As processChannel() in main_nortos.c.
+ */
+static void job(int_fast8_t frame, uint_least8_t channel, void *arg)
+{
+    Analysis_Config config;
+
+    (void)arg;
+
+    if ((channel == 0) && Console_take(&console, &config)) {
+        report();
+        if (Analysis_configure(&analysis, &config) ==
+            Analysis_STATUS_SUCCESS) {
+            applied = true;
+            appliedFrame = frameCount;
+            firstResult = 0;
+            results = 0;
+            maxMagError = 0.0;
+            maxPhaseError = 0.0;
+            maxFreqError = 0.0;
+
+            /* Frames until fftLen decimated samples have come in */
+            settleFrames = (((uint32_t)config.fftLen * analysis.decimation) +
+                            FRAME_LEN - 1U) / FRAME_LEN;
+        }
+    }
+
+    Ingest_deinterleave(&ingest[channel],
+                        Acquire_samples(&acquire, frame, channel),
+                        Acquire_stride(&acquire, channel), frames[channel],
+                        FRAME_LEN);
+    Analysis_push(&analysis, channel, frames[channel], FRAME_LEN);
+
+    if (Analysis_run(&analysis, channel, Window_INTERP_2POINT)) {
+        if (applied && (firstResult == 0U)) {
+            firstResult = frameCount + 1U - appliedFrame;
+        }
+        if (applied) {
+            check(channel);
+            results++;
+        }
+    }
+
+    if (channel == (NUM_CHANNELS - 1U)) {
+        frameCount++;
+    }
+}
+
+/*
+ *  ======== loadScript ========
+ */
+static bool loadScript(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[Console_LINE_LEN + 2];
+    size_t len;
+
+    if (f == NULL) {
+        perror(path);
+        return (false);
+    }
+
+    numSteps = 0;
+    while ((numSteps < MAX_STEPS) && (fgets(line, sizeof(line), f) != NULL)) {
+        len = strcspn(line, "\r\n");
+        line[len] = '\0';
+        if (len == 0) {
+            continue;
+        }
+        script[numSteps].accept = (line[0] != '!');
+        strncpy(scriptText[numSteps], line + (line[0] == '!' ? 1 : 0),
+                Console_LINE_LEN - 1U);
+        script[numSteps].line = scriptText[numSteps];
+        numSteps++;
+    }
+    fclose(f);
+
+    return (true);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    Analysis_Config config;
+    Scheduler_Stats stats;
+    uint32_t step = 0;
+    uint32_t waitUntil = 0;
+    bool wasPending;
+    uint_least8_t i;
+
+    if (argc > 1) {
+        if (!loadScript(argv[1])) {
+            return (1);
+        }
+    }
+    else {
+        numSteps = sizeof(defaultScript) / sizeof(defaultScript[0]);
+        memcpy(script, defaultScript, sizeof(defaultScript));
+    }
+
+    for (i = 0; i < NUM_CHANNELS; i++) {
+        channels[i].adc = i & 1U;
+        channels[i].ain = i;
+        Ingest_init(&ingest[i], Ingest_DC_SHIFT_DEFAULT);
+    }
+
+    /* Start as main_nortos.c does: one frame, harmonics 1 to 50 */
+    config.fftLen = FRAME_LEN;
+    config.cycles = 1;
+    config.window = Window_RECTANGULAR;
+    config.numHarmonics = Analysis_MAX_HARMONICS;
+    for (i = 0; i < Analysis_MAX_HARMONICS; i++) {
+        config.orders[i] = i + 1U;
+    }
+    Analysis_init(&analysis, NUM_CHANNELS, history[0], work, windowTable,
+                  FRAME_LEN, SAMPLE_RATE);
+    Analysis_configure(&analysis, &config);
+    Console_init(&console, &analysis);
+
+    printf("analysis console, %s, %u samples per frame at %u Hz\n",
+           Precision_NAME, (unsigned)FRAME_LEN, (unsigned)SAMPLE_RATE);
+
+    Acquire_init(&acquire, channels, NUM_CHANNELS, buffer, FRAME_LEN,
+                 SAMPLE_RATE, 0, NULL, NULL);
+    Acquire_setSource(&acquire, source, NULL);
+    Scheduler_init(&scheduler, &acquire, 0, job, NULL);
+    Acquire_start(&acquire);
+
+    /* Type the next line once the last setting has been checked long
+     * enough, or a frame after a refused one */
+    while ((step < numSteps) || applied) {
+        if (Scheduler_poll(&scheduler)) {
+            continue;
+        }
+
+        if (applied && (frameCount >= (appliedFrame + settleFrames +
+                                       CHECK_FRAMES))) {
+            report();
+        }
+        if (applied || (frameCount < waitUntil) || (step == numSteps)) {
+            continue;
+        }
+
+        printf("> %s\n", script[step].line);
+        strncpy(input, script[step].line, sizeof(input) - 1U);
+        inputReady = true;
+        wasPending = console.pending;
+        Console_poll(&console);
+        if (console.pending != (wasPending || script[step].accept)) {
+            printf("FAIL: expected the command to be %s\n",
+                   script[step].accept ? "accepted" : "refused");
+            failures++;
+        }
+        step++;
+        waitUntil = frameCount + 1U;
+    }
+
+    Acquire_stop(&acquire);
+    Scheduler_getStats(&scheduler, &stats);
+
+    printf("frames %u, dropped %u, overruns %u, acquired %u\n",
+           (unsigned)stats.frames, (unsigned)stats.dropped,
+           (unsigned)stats.overruns, (unsigned)acquire.frames);
+    if ((stats.dropped != 0U) || (stats.overruns != 0U) ||
+        ((acquire.frames - stats.frames) > 2U)) {
+        failures++;
+    }
+    printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+
+    return ((failures == 0U) ? 0 : 1);
+}
+
+#endif
@@ -0,0 +1,374 @@
+/*
+ *  ======== event_sim.c ========
+ *  Host latency test of the event-driven main loop.
+ *
+ *  Runs the event loop of main_nortos.c (event.h) with the same events
+ *  and priorities, driven by simulated interrupt sources:
+ *
+ *      frame      the host stand-in of the acquisition, 7 channels of
+ *                 1024 samples at 51.2 kS/s; one channel job per run with
+ *                 a synthetic cost on top of the real de-interleave
+ *      button     a thread posting edges at random, 50 to 250 ms apart
+ *      console    a thread posting received lines, 20 to 200 ms apart
+ *      log        posted after every frame; each run sends two of the
+ *                 records queued and runs again while a step was full
+ *
+ *  Handlers other than the frame jobs busy-wait for their nominal cost.
+ *  For each job cost the loop runs for a few seconds and reports the busy
+ *  time it measured against the work it was given, the sleeps, and per
+ *  event the worst latency from first post to handler and the worst
+ *  handler time.  A run-to-completion loop holds an event up by at most
+ *  the handler in progress plus the more urgent ones, so the frame event
+ *  waits at most for one handler of any kind.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/event_sim [seconds] [jobMicroseconds...]
+ *
+ *  Fails, with a non-zero exit status, if a frame was dropped or overrun,
+ *  a post was lost, or the busy time is off the work by more than 5% of
+ *  the elapsed time.  On one core the stand-in threads take their share of
+ *  the CPU while the loop is awake and add to the latencies.
+ */
+#if defined(HOST_BUILD)
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "acquire.h"
+#include "event.h"
+#include "ingest.h"
+#include "scheduler.h"
+
+#define FRAME_LEN       (1024U)
+#define SAMPLE_RATE     (51200U)
+#define NUM_CHANNELS    (7U)
+
+/* Events, highest priority first, as in main_nortos.c */
+#define EVENT_FRAME     (0)
+#define EVENT_BUTTON    (1)
+#define EVENT_CONSOLE   (2)
+#define EVENT_LOG       (3)
+#define NUM_EVENTS      (4)
+
+/* Nominal handler costs, in microseconds */
+#define BUTTON_US       (50)
+#define CONSOLE_US      (400)
+#define LOG_STEP_US     (150)
+
+/* Log records queued per frame and sent per step */
+#define LOG_PER_FRAME   (3U)
+#define LOG_PER_STEP    (2U)
+
+static const char *const eventNames[NUM_EVENTS] = {
+    "frame", "button", "console", "log"
+};
+
+static uint16_t buffer[Acquire_BUFFER_LEN(FRAME_LEN, NUM_CHANNELS)];
+static Precision_Sample frames[NUM_CHANNELS][FRAME_LEN]
+    __attribute__((aligned(4)));
+static Ingest_Object ingest[NUM_CHANNELS];
+static Channels_Config channels[NUM_CHANNELS];
+static Acquire_Object acquire;
+static Scheduler_Object scheduler;
+static Event_Object loop;
+
+static long jobNs;
+static uint64_t workNs;             /* Time the handlers were given */
+static uint32_t logQueued;          /* Simulated log records waiting */
+static volatile bool running;
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+
+    return (((uint64_t)t.tv_sec * 1000000000ULL) + (uint64_t)t.tv_nsec);
+}
+
+/*
+ *  ======== spin ========
+ *  Busy-wait, counted as handler work.
+ */
+static void spin(uint64_t ns)
+{
+    uint64_t start = nowNs();
+
+    while ((nowNs() - start) < ns) {
+    }
+    workNs += ns;
+}
+
+/*
+ *  ======== source ========
+ */
+static void source(uint_least8_t channel, uint16_t *dst, uint16_t numSamples,
+                   uint16_t stride, void *arg)
+{
+    uint16_t i;
+
+    (void)channel;
+    (void)arg;
+
+    for (i = 0; i < numSamples; i++) {
+        dst[(uint32_t)i * stride] = 2048U;
+    }
+}
+
+/*
+ *  ======== job ========
+ */
+static void job(int_fast8_t frame, uint_least8_t channel, void *arg)
+{
+    uint64_t start = nowNs();
+
+    (void)arg;
+
+    Ingest_deinterleave(&ingest[channel],
+                        Acquire_samples(&acquire, frame, channel),
+                        Acquire_stride(&acquire, channel), frames[channel],
+                        FRAME_LEN);
+    while ((nowNs() - start) < (uint64_t)jobNs) {
+    }
+    workNs += nowNs() - start;
+
+    if (channel == (NUM_CHANNELS - 1U)) {
+        logQueued += LOG_PER_FRAME;
+        Event_post(&loop, EVENT_LOG);
+    }
+}
+
+/*
+ *  ======== frameReady ========
+ *  Acquisition callback, on the stand-in thread.
+ */
+static void frameReady(int_fast8_t frame, void *arg)
+{
+    (void)frame;
+    (void)arg;
+
+    Event_post(&loop, EVENT_FRAME);
+}
+
+/*
+ *  ======== frameEvent ========
+ */
+static void frameEvent(void *arg)
+{
+    (void)arg;
+
+    if (Scheduler_poll(&scheduler)) {
+        Event_post(&loop, EVENT_FRAME);
+    }
+}
+
+/*
+ *  ======== buttonEvent ========
+ */
+static void buttonEvent(void *arg)
+{
+    (void)arg;
+
+    spin(BUTTON_US * 1000ULL);
+}
+
+/*
+ *  ======== consoleEvent ========
+ */
+static void consoleEvent(void *arg)
+{
+    (void)arg;
+
+    spin(CONSOLE_US * 1000ULL);
+}
+
+/*
+ *  ======== logEvent ========
+ */
+static void logEvent(void *arg)
+{
+    uint32_t sent = (logQueued < LOG_PER_STEP) ? logQueued : LOG_PER_STEP;
+
+    (void)arg;
+
+    if (sent == 0U) {
+        return;
+    }
+    spin((LOG_STEP_US * 1000ULL * sent) / LOG_PER_STEP);
+    logQueued -= sent;
+    if (sent == LOG_PER_STEP) {
+        Event_post(&loop, EVENT_LOG);
+    }
+}
+
+/*
+ *  ======== sourceThread ========
+ *  Posts its event at random intervals, like an interrupt.
+ */
+typedef struct {
+    uint_least8_t event;
+    long          minUs;
+    long          maxUs;
+    unsigned int  seed;
+} Source;
+
+static void *sourceThread(void *arg)
+{
+    Source *s = (Source *)arg;
+    struct timespec delay;
+    long us;
+
+    while (running) {
+        us = s->minUs + (rand_r(&s->seed) % (s->maxUs - s->minUs + 1));
+        delay.tv_sec = us / 1000000L;
+        delay.tv_nsec = (us % 1000000L) * 1000L;
+        nanosleep(&delay, NULL);
+        Event_post(&loop, s->event);
+    }
+
+    return (NULL);
+}
+
+/*
+ *  ======== runWith ========
+ *  Returns true if every check passed.
+ */
+static bool runWith(long jobUs, double seconds)
+{
+    Source sources[2] = {
+        {EVENT_BUTTON, 50000L, 250000L, 1U},
+        {EVENT_CONSOLE, 20000L, 200000L, 2U}
+    };
+    pthread_t threads[2];
+    Scheduler_Stats stats;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t busy;
+    uint32_t maxRun = 0;
+    double busyPct;
+    double workPct;
+    bool pass;
+    uint_least8_t k;
+
+    jobNs = jobUs * 1000L;
+    workNs = 0;
+    logQueued = 0;
+    for (k = 0; k < NUM_CHANNELS; k++) {
+        Ingest_init(&ingest[k], Ingest_DC_SHIFT_DEFAULT);
+    }
+
+    Event_init(&loop);
+    Event_register(&loop, EVENT_FRAME, frameEvent, NULL);
+    Event_register(&loop, EVENT_BUTTON, buttonEvent, NULL);
+    Event_register(&loop, EVENT_CONSOLE, consoleEvent, NULL);
+    Event_register(&loop, EVENT_LOG, logEvent, NULL);
+
+    Acquire_init(&acquire, channels, NUM_CHANNELS, buffer, FRAME_LEN,
+                 SAMPLE_RATE, 0, frameReady, NULL);
+    Acquire_setSource(&acquire, source, NULL);
+    Scheduler_init(&scheduler, &acquire, 0, job, NULL);
+
+    running = true;
+    for (k = 0; k < 2U; k++) {
+        pthread_create(&threads[k], NULL, sourceThread, &sources[k]);
+    }
+    Acquire_start(&acquire);
+
+    start = nowNs();
+    Event_takeBusy(&loop);
+    do {
+        if (!Event_dispatch(&loop)) {
+            Event_wait(&loop);
+        }
+    } while ((nowNs() - start) < (uint64_t)(seconds * 1e9));
+    busy = Event_takeBusy(&loop);
+    elapsed = nowNs() - start;
+
+    running = false;
+    Acquire_stop(&acquire);
+    for (k = 0; k < 2U; k++) {
+        pthread_join(threads[k], NULL);
+    }
+
+    /* Events posted since the last dispatch stay pending: running them
+     * now would count the shutdown in their latency */
+    Scheduler_getStats(&scheduler, &stats);
+
+    busyPct = (100.0 * busy) / (double)elapsed;
+    workPct = (100.0 * (double)workNs) / (double)elapsed;
+    pass = (stats.dropped == 0U) && (stats.overruns == 0U) &&
+           ((busyPct - workPct) < 5.0) && ((workPct - busyPct) < 5.0);
+
+    printf("job %ld us: busy %.1f%% measured, %.1f%% given, %u sleeps, "
+           "%u frames, %u dropped, %u overruns\n", jobUs, busyPct, workPct,
+           (unsigned)loop.sleeps, (unsigned)stats.frames,
+           (unsigned)stats.dropped, (unsigned)stats.overruns);
+    printf("    event      posts     runs  latency us   run us\n");
+    for (k = 0; k < NUM_EVENTS; k++) {
+        printf("    %-8s %7u  %7u  %10.1f  %7.1f\n", eventNames[k],
+               (unsigned)loop.events[k].posts, (unsigned)loop.events[k].runs,
+               loop.events[k].maxLatency / 1000.0,
+               loop.events[k].maxRun / 1000.0);
+
+        /* Posts merge, so there are never more runs than posts */
+        if ((loop.events[k].runs == 0U) ||
+            (loop.events[k].runs > loop.events[k].posts)) {
+            pass = false;
+        }
+        if (loop.events[k].maxRun > maxRun) {
+            maxRun = loop.events[k].maxRun;
+        }
+    }
+    printf("    frame latency %.1f us, longest handler %.1f us: %s\n",
+           loop.events[EVENT_FRAME].maxLatency / 1000.0, maxRun / 1000.0,
+           pass ? "ok" : "FAIL");
+
+    return (pass);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    static const long defaultJobs[] = {200, 800, 1600};
+    double seconds = (argc > 1) ? atof(argv[1]) : 3.0;
+    bool pass = true;
+    uint_least8_t k;
+    int i;
+
+    for (k = 0; k < NUM_CHANNELS; k++) {
+        channels[k].adc = k & 1U;
+        channels[k].ain = k;
+    }
+
+    printf("event loop, %u channels of %u samples at %u Hz, %.1f s per run\n",
+           (unsigned)NUM_CHANNELS, (unsigned)FRAME_LEN,
+           (unsigned)SAMPLE_RATE, seconds);
+
+    if (argc > 2) {
+        for (i = 2; i < argc; i++) {
+            pass = runWith(atol(argv[i]), seconds) && pass;
+        }
+    }
+    else {
+        for (k = 0; k < (sizeof(defaultJobs) / sizeof(defaultJobs[0])); k++) {
+            pass = runWith(defaultJobs[k], seconds) && pass;
+        }
+    }
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
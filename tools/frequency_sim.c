@@ -0,0 +1,285 @@
+/*
+ *  ======== frequency_sim.c ========
+ *  Host stand-in for the capture timer of the mains frequency meter
+ *  (frequency.h).
+ *
+ *  Plays mains crossings through Frequency_capture() as Timer 2 would
+ *  capture them: the edge time with comparator jitter, counted at 120 MHz
+ *  and cut to 24 bits.  Each scenario runs for a number of seconds of
+ *  simulated mains:
+ *
+ *      steady     50 Hz
+ *      drift      49.9 to 50.1 Hz over the run
+ *      step       50 Hz, then 50.5 Hz from the middle of the run
+ *      noisy      50 Hz with chatter after 10% of the crossings, 1% of
+ *                 the edges missing and impulses, 1 per second
+ *      relock     50 Hz, then 60 Hz, beyond the tolerance, from the middle
+ *
+ *  After every update the published frequency is compared with the true
+ *  average over the same number of cycles.  For each scenario the table
+ *  gives the updates, the short and long periods rejected, the relocks,
+ *  the cycles to get within 1 mHz after the start and after a step, and
+ *  the rms and largest error once settled, in mHz.  Jitter is averaged
+ *  over the window: the error is about f^2 sqrt(2) jitter / cycles, 0.35
+ *  mHz rms for 5 us at 50 Hz over 50 cycles.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/frequency_sim [cycles] [jitterUs] [seconds]
+ *
+ *  cycles averaged (default 50, as in main_nortos.c), the rms comparator
+ *  jitter (default 5) and the seconds per scenario (default 20).  Fails,
+ *  with a non-zero exit status, if a scenario never settles, if the
+ *  settled rms error is over twice that estimate plus the 24-bit
+ *  resolution, or if the relock scenario does not relock.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "frequency.h"
+
+#define CLOCK_HZ        (120000000U)
+#define CHATTER_US      (300.0)
+
+/* Scenarios */
+#define SCENARIO_STEADY (0)
+#define SCENARIO_DRIFT  (1)
+#define SCENARIO_STEP   (2)
+#define SCENARIO_NOISY  (3)
+#define SCENARIO_RELOCK (4)
+#define NUM_SCENARIOS   (5)
+
+typedef struct {
+    uint32_t updates;
+    uint32_t lockCycles;            /* To within 1 mHz from the start */
+    uint32_t stepCycles;            /* To within 1 mHz after the step */
+    uint32_t settled;               /* Updates counted in the errors */
+    double   sumSquares;            /* Of the settled error, Hz */
+    double   maxError;
+} Result;
+
+static const char *const scenarioNames[NUM_SCENARIOS] = {
+    "steady", "drift", "step", "noisy", "relock"
+};
+
+static Frequency_Object meter;
+static uint32_t state;
+
+/*
+ *  ======== uniform ========
+ *  From a fixed-seed generator, so every run sees the same edges.
+ */
+static double uniform(void)
+{
+    state = (state * 1664525U) + 1013904223U;
+
+    return ((state >> 8) / 16777216.0);
+}
+
+/*
+ *  ======== gaussian ========
+ */
+static double gaussian(void)
+{
+    double u1 = ((uniform() * 16777216.0) + 1.0) / 16777217.0;
+    double u2 = uniform();
+
+    return (sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2));
+}
+
+/*
+ *  ======== mainsHz ========
+ */
+static double mainsHz(uint_least8_t scenario, double t, double seconds)
+{
+    switch (scenario) {
+        case SCENARIO_DRIFT:
+            return (49.9 + ((0.2 * t) / seconds));
+        case SCENARIO_STEP:
+            return ((t < (seconds * 0.5)) ? 50.0 : 50.5);
+        case SCENARIO_RELOCK:
+            return ((t < (seconds * 0.5)) ? 50.0 : 60.0);
+        default:
+            return (50.0);
+    }
+}
+
+/*
+ *  ======== capture ========
+ *  The count Timer 2 latches for an edge at time t.
+ */
+static void capture(double t)
+{
+    Frequency_capture(&meter, (uint32_t)((uint64_t)llround(t * CLOCK_HZ) &
+                                         Frequency_CAPTURE_MASK));
+}
+
+/*
+ *  ======== run ========
+ *  The crossings follow the frequency of the moment; the reference is the
+ *  average over the last cycles true crossings.
+ */
+static void run(uint_least8_t scenario, uint_least8_t cycles,
+                double jitterUs, double seconds, Result *r)
+{
+    bool noisy = (scenario == SCENARIO_NOISY);
+    double *crossings;
+    double stepAt = seconds * 0.5;
+    double t = 0.0;
+    double edge;
+    double reference;
+    double error;
+    uint32_t updates;
+    uint32_t stepCycle = 0;
+    uint32_t k;
+    uint32_t n;
+    uint32_t extra;
+    uint32_t i;
+    uint32_t count = (uint32_t)(seconds * 70.0);
+
+    crossings = malloc(count * sizeof(double));
+    Frequency_init(&meter, cycles, CLOCK_HZ);
+    *r = (Result){0};
+    state = 12345U;
+
+    for (k = 0; k < count; k++) {
+        t += 1.0 / mainsHz(scenario, t, seconds);
+        if (t >= seconds) {
+            break;
+        }
+        crossings[k] = t;
+        if ((stepCycle == 0U) && (t >= stepAt) &&
+            ((scenario == SCENARIO_STEP) || (scenario == SCENARIO_RELOCK))) {
+            stepCycle = k;
+        }
+
+        if (noisy && (uniform() < (1.0 / 50.0))) {
+            capture(t - ((0.9 * uniform()) / 50.0));
+        }
+
+        edge = t + (jitterUs * 1e-6 * gaussian());
+        updates = meter.updates;
+        if (!noisy || (uniform() >= 0.01)) {
+            capture(edge);
+        }
+        if (noisy && (uniform() < 0.1)) {
+            extra = 1U + (uint32_t)(uniform() * 3.0);
+            for (i = 0; i < extra; i++) {
+                capture(edge + (CHATTER_US * 1e-6 * uniform()));
+            }
+        }
+        if ((meter.updates == updates) || (k < cycles)) {
+            continue;
+        }
+
+        reference = cycles / (t - crossings[k - cycles]);
+        error = (Frequency_get(&meter) * 1e-6) - reference;
+        r->updates++;
+
+        /* Settled: within 1 mHz and a full window after any step */
+        if (fabs(error) < 1e-3) {
+            if (r->lockCycles == 0U) {
+                r->lockCycles = k;
+            }
+            if ((stepCycle != 0U) && (r->stepCycles == 0U)) {
+                r->stepCycles = k - stepCycle;
+            }
+        }
+        n = (stepCycle != 0U) ? (stepCycle + r->stepCycles) : 0U;
+        if ((r->lockCycles != 0U) && (k >= (r->lockCycles + cycles)) &&
+            ((stepCycle == 0U) ||
+             ((r->stepCycles != 0U) && (k >= (n + cycles))))) {
+            r->settled++;
+            r->sumSquares += error * error;
+            if (fabs(error) > r->maxError) {
+                r->maxError = fabs(error);
+            }
+        }
+    }
+
+    free(crossings);
+}
+
+/*
+ *  ======== captureCost ========
+ *  Host nanoseconds per Frequency_capture() call, for scale only.
+ */
+static double captureCost(void)
+{
+    struct timespec t0;
+    struct timespec t1;
+    uint32_t period = CLOCK_HZ / 50U;
+    uint32_t n;
+
+    Frequency_init(&meter, 50, CLOCK_HZ);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (n = 0; n < 1000000U; n++) {
+        Frequency_capture(&meter, n * period);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    return ((((t1.tv_sec - t0.tv_sec) * 1e9) + (t1.tv_nsec - t0.tv_nsec)) /
+            1e6);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    long cycles = (argc > 1) ? atol(argv[1]) : 50;
+    double jitterUs = (argc > 2) ? atof(argv[2]) : 5.0;
+    double seconds = (argc > 3) ? atof(argv[3]) : 20.0;
+    double expected;
+    double rms;
+    Result r;
+    bool pass = true;
+    bool ok;
+    uint_least8_t s;
+
+    if ((cycles < 1) || (cycles > Frequency_MAX_CYCLES) ||
+        (jitterUs < 0.0) || (seconds < 2.0)) {
+        fprintf(stderr, "usage: %s [cycles] [jitterUs] [seconds]\n",
+                argv[0]);
+        return (2);
+    }
+
+    /* Jitter at both ends of the window, and the tick at each */
+    expected = (2500.0 * sqrt(2.0) *
+                ((jitterUs * 1e-6) + (1.0 / CLOCK_HZ))) / cycles;
+
+    printf("frequency sim, %ld cycles, %u Hz capture clock, %.1f us rms "
+           "jitter, %.0f s per scenario, about %.3f mHz rms expected\n\n",
+           cycles, CLOCK_HZ, jitterUs, seconds, expected * 1e3);
+    printf("%-8s %7s %7s %7s %7s %6s %6s %9s %9s\n", "scenario", "updates",
+           "ignored", "dropped", "relocks", "lock", "step", "rms mHz",
+           "max mHz");
+
+    for (s = 0; s < NUM_SCENARIOS; s++) {
+        run(s, (uint_least8_t)cycles, jitterUs, seconds, &r);
+        rms = (r.settled != 0U) ? sqrt(r.sumSquares / r.settled) : 0.0;
+        ok = (r.settled != 0U) && (rms <= ((2.0 * expected) + 1e-5)) &&
+             ((s != SCENARIO_RELOCK) || (meter.relocks != 0U));
+        pass = pass && ok;
+
+        printf("%-8s %7u %7u %7u %7u %6u %6u %9.4f %9.4f  %s\n",
+               scenarioNames[s], (unsigned)r.updates, (unsigned)meter.ignored,
+               (unsigned)meter.dropped, (unsigned)meter.relocks,
+               (unsigned)r.lockCycles, (unsigned)r.stepCycles, rms * 1e3,
+               r.maxError * 1e3, ok ? "ok" : "FAIL");
+    }
+
+    printf("\nlock and step in cycles; capture %.1f ns per call on this "
+           "host\n%s\n", captureCost(), pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
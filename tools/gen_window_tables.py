@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+#
+#  ======== gen_window_tables.py ========
+#  Generates window_tables.c: q15 window coefficient tables for every
+#  supported FFT length, placed in .const so they live in flash and need no
+#  trig or RAM copy at startup.
+#
+#  Usage: python3 tools/gen_window_tables.py > window_tables.c
+#
+#  The coefficients must match the cosine-sum terms in window.c, which are
+#  also used for the interpolation kernel.
+#
+import math
+import sys
+
+LENGTHS = [64, 128, 256, 512, 1024, 2048, 4096]
+
+# Periodic (DFT-even) cosine-sum windows:
+#   w[n] = sum_m (-1)^m a[m] cos(2 pi m n / N)
+WINDOWS = [
+    ('Hann', 'hann', [0.5, 0.5]),
+    ('Flat-top', 'flatTop',
+     [0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368]),
+    ('4-term Blackman-Harris', 'blackmanHarris',
+     [0.35875, 0.48829, 0.14128, 0.01168]),
+]
+
+PER_LINE = 10
+
+
+def coefficients(terms, length):
+    for n in range(length):
+        w = 0.0
+        for m, a in enumerate(terms):
+            w += ((-1) ** m) * a * math.cos(2.0 * math.pi * m * n / length)
+        q = int(math.floor(w * 32768.0 + 0.5))
+        yield max(-32768, min(32767, q))
+
+
+def main(out):
+    out.write('/*\n')
+    out.write(' *  ======== window_tables.c ========\n')
+    out.write(' *  Generated by tools/gen_window_tables.py -- do not edit.\n')
+    out.write(' */\n')
+    out.write('#include <stdint.h>\n\n')
+    out.write('#include "window.h"\n')
+
+    for title, name, terms in WINDOWS:
+        for length in LENGTHS:
+            values = list(coefficients(terms, length))
+            out.write('\n/* %s, %d points */\n' % (title, length))
+            out.write('const q15_t Window_%s%d[%d] '
+                      '__attribute__((aligned(4))) = {\n' %
+                      (name, length, length))
+            for i in range(0, length, PER_LINE):
+                chunk = values[i:i + PER_LINE]
+                line = ', '.join('%d' % v for v in chunk)
+                sep = ',' if i + PER_LINE < length else ''
+                out.write('    %s%s\n' % (line, sep))
+            out.write('};\n')
+
+
+if __name__ == '__main__':
+    main(sys.stdout)
@@ -0,0 +1,270 @@
+/*
+ *  ======== goertzel_bench.c ========
+ *  Host benchmark of the Goertzel harmonic bank against arm_cfft_q15.
+ *
+ *  For every FFT length and for 10, 25 and 50 harmonics, times
+ *
+ *      goertzel    Goertzel_process() over harmonics 1 to H of a frame
+ *                  holding one mains cycle, the q31 resonators of goertzel.c
+ *      cfft        the same q15 frame copied into a complex buffer with a
+ *                  zero imaginary part and arm_cfft_q15() over it, from
+ *                  which the H harmonic bins are read directly
+ *
+ *  and counts the real multiplies and adds each one executes per frame:
+ *
+ *      goertzel    N + 1 resonator steps of one multiply and two adds per
+ *                  bin, and two multiplies and an add to close the bin:
+ *                  H (N + 3) multiplies, H (2N + 3) adds
+ *      cfft        as arm_cfft_q15 splits it: radix-4 butterflies of three
+ *                  complex multiplies and eight complex adds (12 and 22),
+ *                  after one radix-2 stage of 4 and 6 when log2(N) is odd
+ *
+ *  The operation counts do not depend on the host and decide which engine
+ *  is cheaper on the Cortex-M4, where a 32 x 32 multiply-accumulate and a
+ *  q15 butterfly step take about a cycle each.  The host times are for
+ *  scale only; the cycles on the target come from the
+ *  Profile_STAGE_TRANSFORM line of main_nortos.c's load report, built with
+ *  PROFILE_ENABLE and HARMONIC_ENGINE set to each engine in turn.  Both
+ *  engines must agree on the harmonics; max_diff is the largest difference
+ *  in magnitude between them, full scale 1.0.
+ *
+ *  Output is CSV on stdout, one header line and one line per case:
+ *
+ *      fft_len,harmonics,goertzel_ns,goertzel_mul,goertzel_add,cfft_ns,
+ *      cfft_mul,cfft_add,cheaper,max_diff
+ *
+ *  Build and run on Linux from the repository root:
+ *
+ *      make -C tools CMSIS_DSP=<CMSIS-DSP> CMSIS_CORE=<CMSIS>/Core/Include
+ *      tools/build/goertzel_bench [minMilliseconds]
+ *
+ *  minMilliseconds (default 50) is the shortest timed run of every case.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "arm_math.h"
+
+#include "goertzel.h"
+
+#if (PRECISION != PRECISION_Q15)
+#error "goertzel_bench compares q15 frames; build with PRECISION_Q15"
+#endif
+
+#define MAX_LEN         (4096)
+
+/* Fewest timed repetitions of every case */
+#define MIN_REPEATS     (3)
+
+static const uint16_t fftLens[] = {256, 512, 1024, 2048, 4096};
+
+#define NUM_LENS        (sizeof(fftLens) / sizeof(fftLens[0]))
+
+static const uint_least8_t harmonicCounts[] = {10, 25, 50};
+
+#define NUM_COUNTS      (sizeof(harmonicCounts) / sizeof(harmonicCounts[0]))
+
+static q15_t frame[MAX_LEN];
+static q15_t complexFrame[2 * MAX_LEN];
+static Goertzel_Phasor phasors[Goertzel_MAX_BINS];
+
+static Goertzel_Object goertzel;
+static arm_cfft_instance_q15 cfft;
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ *  ======== synthesize ========
+ *  One cycle per frame: a fundamental at 0.5 full scale and every
+ *  harmonic up to the 50th at 1/h of a tenth of it, so no bin is empty.
+ */
+static void synthesize(uint16_t len)
+{
+    double w = 2.0 * M_PI / len;
+    double x;
+    uint16_t n;
+    uint_least8_t h;
+
+    for (n = 0; n < len; n++) {
+        x = 0.5 * sin(w * n);
+        for (h = 2; h <= Goertzel_MAX_BINS; h++) {
+            x += (0.05 / h) * sin((w * h * n) + (0.37 * h));
+        }
+        frame[n] = (q15_t)lrint(x * 32768.0);
+    }
+}
+
+/*
+ *  ======== runGoertzel ========
+ */
+static void runGoertzel(void)
+{
+    Goertzel_process(&goertzel, frame, phasors);
+}
+
+/*
+ *  ======== runCfft ========
+ *  The copy into the complex buffer is part of the cost of the engine.
+ */
+static void runCfft(void)
+{
+    uint16_t n;
+
+    for (n = 0; n < cfft.fftLen; n++) {
+        complexFrame[2U * n] = frame[n];
+        complexFrame[(2U * n) + 1U] = 0;
+    }
+
+    arm_cfft_q15(&cfft, complexFrame, 0, 1);
+}
+
+/*
+ *  ======== timeNs ========
+ *  Nanoseconds per call of run, after a warm-up call.
+ */
+static double timeNs(void (*run)(void), uint64_t minNs)
+{
+    uint64_t t0;
+    uint64_t elapsed;
+    uint32_t repeats = 0;
+
+    run();
+
+    t0 = nowNs();
+    do {
+        run();
+        repeats++;
+        elapsed = nowNs() - t0;
+    } while ((elapsed < minNs) || (repeats < MIN_REPEATS));
+
+    return ((double)elapsed / repeats);
+}
+
+/*
+ *  ======== cfftOps ========
+ *  Real multiplies and adds of one arm_cfft_q15() call of length len.
+ */
+static void cfftOps(uint32_t len, uint64_t *mul, uint64_t *add)
+{
+    uint32_t log2Len;
+    uint64_t butterflies;
+
+    for (log2Len = 0; (1UL << log2Len) < len; log2Len++) {
+    }
+
+    if ((log2Len & 1U) != 0U) {
+        /* radix4by2: one radix-2 stage, then two radix-4 halves */
+        cfftOps(len / 2U, mul, add);
+        *mul = (2U * *mul) + (4U * (uint64_t)(len / 2U));
+        *add = (2U * *add) + (6U * (uint64_t)(len / 2U));
+        return;
+    }
+
+    butterflies = ((uint64_t)len / 4U) * (log2Len / 2U);
+    *mul = 12U * butterflies;
+    *add = 22U * butterflies;
+}
+
+/*
+ *  ======== maxDiff ========
+ *  Largest difference in harmonic magnitude between the engines.  Both
+ *  give X[k] / N.
+ */
+static double maxDiff(uint_least8_t numHarmonics)
+{
+    double diff = 0.0;
+    double g;
+    double c;
+    double re;
+    double im;
+    uint_least8_t h;
+
+    for (h = 0; h < numHarmonics; h++) {
+        re = phasors[h].re / 2147483648.0;
+        im = phasors[h].im / 2147483648.0;
+        g = sqrt((re * re) + (im * im));
+
+        re = complexFrame[2U * (h + 1U)] / 32768.0;
+        im = complexFrame[(2U * (h + 1U)) + 1U] / 32768.0;
+        c = sqrt((re * re) + (im * im));
+
+        if (fabs(g - c) > diff) {
+            diff = fabs(g - c);
+        }
+    }
+
+    return (diff);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint64_t minNs = (uint64_t)((argc > 1) ? atoi(argv[1]) : 50) * 1000000U;
+    uint64_t gMul;
+    uint64_t gAdd;
+    uint64_t cMul;
+    uint64_t cAdd;
+    double gNs;
+    double cNs;
+    uint_least8_t h;
+    unsigned int l;
+    unsigned int c;
+
+    if (minNs == 0) {
+        fprintf(stderr, "usage: %s [minMilliseconds]\n", argv[0]);
+        return (1);
+    }
+
+    printf("fft_len,harmonics,goertzel_ns,goertzel_mul,goertzel_add,"
+           "cfft_ns,cfft_mul,cfft_add,cheaper,max_diff\n");
+
+    for (l = 0; l < NUM_LENS; l++) {
+        if (arm_cfft_init_q15(&cfft, fftLens[l]) != ARM_MATH_SUCCESS) {
+            fprintf(stderr, "fftLen %u not supported\n", fftLens[l]);
+            return (1);
+        }
+        synthesize(fftLens[l]);
+        cNs = timeNs(runCfft, minNs);
+        cfftOps(fftLens[l], &cMul, &cAdd);
+
+        for (c = 0; c < NUM_COUNTS; c++) {
+            h = harmonicCounts[c];
+            if (Goertzel_initHarmonics(&goertzel, fftLens[l], 1, h) !=
+                Goertzel_STATUS_SUCCESS) {
+                fprintf(stderr, "fftLen %u not supported\n", fftLens[l]);
+                return (1);
+            }
+            gNs = timeNs(runGoertzel, minNs);
+            gMul = (uint64_t)h * (fftLens[l] + 3U);
+            gAdd = (uint64_t)h * ((2U * fftLens[l]) + 3U);
+
+            printf("%u,%u,%.0f,%llu,%llu,%.0f,%llu,%llu,%s,%.6f\n",
+                   fftLens[l], h, gNs, (unsigned long long)gMul,
+                   (unsigned long long)gAdd, cNs, (unsigned long long)cMul,
+                   (unsigned long long)cAdd,
+                   ((gMul + gAdd) < (cMul + cAdd)) ? "goertzel" : "cfft",
+                   maxDiff(h));
+        }
+    }
+
+    return (0);
+}
+
+#endif
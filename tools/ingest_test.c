@@ -0,0 +1,263 @@
+/*
+ *  ======== ingest_test.c ========
+ *  Host test of Ingest_deinterleave() on interleaved frames of 1 to 8
+ *  channels.
+ *
+ *  For every channel count N the input is one frame as sample sequencer 0
+ *  delivers it, N half-word codes per conversion step, channel k at code k
+ *  of each step.  Every code carries the channel and the sample index it belongs
+ *  to, so a channel read at the wrong offset or a sample read from the
+ *  wrong step shows up as a wrong value rather than a plausible one.  The
+ *  first samples hit the 0 and 4095 ends of the code range.
+ *
+ *  Each channel goes into its own frame of one block, back to back as
+ *  main_nortos.c lays them out, with guard words around every frame.  For
+ *  each N the test checks
+ *
+ *      samples     every sample of every channel against the code it was
+ *                  made from, converted here independently of ingest.c
+ *      alignment   every frame starts 32-bit aligned, and no guard word
+ *                  next to a frame was written
+ *      mean        the returned mean against the mean of the channel
+ *
+ *  and times the de-interleave of the whole frame, in ns per sample and
+ *  as the aggregate sample rate it could keep up with on this host.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/ingest_test_q15 [numSamples] [minMilliseconds]
+ *
+ *  numSamples per channel (default 1024, even) and the shortest timed run
+ *  of every channel count (default 50).  Fails, with a non-zero exit
+ *  status, on any wrong sample, misaligned frame, written guard or wrong
+ *  mean.  The dual 16-bit path of ingest.c for Cortex-M4 is not built on
+ *  the host; it must give the same output as the portable loop tested
+ *  here.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ingest.h"
+
+#define MAX_CHANNELS    (8U)
+#define MAX_SAMPLES     (4096U)
+
+/* Guard words before and after every frame */
+#define GUARD_WORDS     (4U)
+#define GUARD           (0xA5A5A5A5U)
+
+/* Frame of one channel with its guards, in 32-bit words */
+#define SLOT_WORDS      ((GUARD_WORDS * 2U) + \
+                         ((MAX_SAMPLES * sizeof(Precision_Sample)) / 4U))
+
+/* ingest.c truncates the mean of the fixed-point samples */
+#if (PRECISION == PRECISION_F32)
+#define MEAN_TOLERANCE  (1e-6)
+#else
+#define MEAN_TOLERANCE  (1.0)
+#endif
+
+/* Fewest timed repetitions of every channel count */
+#define MIN_REPEATS     (3)
+
+static uint16_t codes[MAX_CHANNELS * MAX_SAMPLES];
+static uint32_t block[MAX_CHANNELS * SLOT_WORDS];
+static Ingest_Object ingest[MAX_CHANNELS];
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ *  ======== codeOf ========
+ *  12-bit code of sample n of channel k: different for neighbouring
+ *  channels and for neighbouring samples of a channel.
+ */
+static uint32_t codeOf(uint32_t k, uint32_t n)
+{
+    if (n == 0U) {
+        return ((k & 1U) ? 4095U : 0U);
+    }
+    if (n == 1U) {
+        return ((k & 1U) ? 0U : 4095U);
+    }
+
+    return (((k * 509U) + (n * 37U) + ((n * n) >> 3)) & 0xFFFU);
+}
+
+/*
+ *  ======== expected ========
+ *  The sample a code stands for, full scale 1.0.
+ */
+static Precision_Sample expected(uint32_t code)
+{
+    int32_t centered = (int32_t)code - Ingest_ADC_OFFSET;
+
+#if (PRECISION == PRECISION_F32)
+    return ((float32_t)centered / 2048.0f);
+#elif (PRECISION == PRECISION_Q31)
+    return ((q31_t)(centered * (1L << 20)));
+#else
+    return ((q15_t)(centered * 16));
+#endif
+}
+
+/*
+ *  ======== frameOf ========
+ *  Frame of channel k in the block, after its leading guard.
+ */
+static Precision_Sample *frameOf(uint32_t k)
+{
+    return ((Precision_Sample *)&block[(k * SLOT_WORDS) + GUARD_WORDS]);
+}
+
+/*
+ *  ======== deinterleave ========
+ *  Every channel of the interleaved frame into its own frame.
+ */
+static void deinterleave(uint_least8_t channels, uint32_t numSamples,
+                         Precision_Sample *means)
+{
+    uint_least8_t k;
+
+    for (k = 0; k < channels; k++) {
+        means[k] = Ingest_deinterleave(&ingest[k], &codes[k], channels,
+                                       frameOf(k), numSamples);
+    }
+}
+
+/*
+ *  ======== check ========
+ *  Errors of one de-interleaved frame of channels channels.
+ */
+static uint32_t check(uint_least8_t channels, uint32_t numSamples,
+                      const Precision_Sample *means)
+{
+    uint32_t errors = 0;
+    uint32_t frameWords = (numSamples * sizeof(Precision_Sample)) / 4U;
+    const uint32_t *slot;
+    const Precision_Sample *frame;
+    double sum;
+    uint32_t n;
+    uint32_t g;
+    uint_least8_t k;
+
+    for (k = 0; k < channels; k++) {
+        slot = &block[k * SLOT_WORDS];
+        frame = frameOf(k);
+
+        if (((uintptr_t)frame & 3U) != 0U) {
+            printf("  channel %u: frame not 32-bit aligned\n", k);
+            errors++;
+        }
+
+        for (g = 0; g < GUARD_WORDS; g++) {
+            if ((slot[g] != GUARD) ||
+                (slot[GUARD_WORDS + frameWords + g] != GUARD)) {
+                printf("  channel %u: guard word written\n", k);
+                errors++;
+                break;
+            }
+        }
+
+        sum = 0;
+        for (n = 0; n < numSamples; n++) {
+            sum += expected(codeOf(k, n));
+            if (frame[n] != expected(codeOf(k, n))) {
+                if (errors < 10U) {
+                    printf("  channel %u sample %u: wrong value\n", k,
+                           (unsigned)n);
+                }
+                errors++;
+            }
+        }
+
+        if (fabs((double)means[k] - (sum / numSamples)) > MEAN_TOLERANCE) {
+            printf("  channel %u: wrong mean\n", k);
+            errors++;
+        }
+    }
+
+    return (errors);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    long numSamples = (argc > 1) ? atol(argv[1]) : 1024;
+    uint64_t minNs = (uint64_t)((argc > 2) ? atoi(argv[2]) : 50) * 1000000U;
+    Precision_Sample means[MAX_CHANNELS];
+    uint64_t t0;
+    uint64_t elapsed;
+    uint32_t repeats;
+    uint32_t errors;
+    uint32_t i;
+    double ns;
+    bool pass = true;
+    uint_least8_t channels;
+
+    if ((numSamples < 2) || (numSamples > (long)MAX_SAMPLES) ||
+        ((numSamples & 1) != 0) || (minNs == 0U)) {
+        fprintf(stderr, "usage: %s [numSamples] [minMilliseconds], an even "
+                "numSamples up to %u\n", argv[0], MAX_SAMPLES);
+        return (2);
+    }
+
+    printf("ingest de-interleave, %s, %ld samples per channel\n\n",
+           Precision_NAME, numSamples);
+    printf("%8s %8s %8s %11s %11s\n", "channels", "samples", "errors",
+           "ns/sample", "MS/s");
+
+    for (channels = 1; channels <= MAX_CHANNELS; channels++) {
+        for (i = 0; i < (channels * (uint32_t)numSamples); i++) {
+            codes[i] = codeOf(i % channels, i / channels);
+        }
+        for (i = 0; i < (MAX_CHANNELS * SLOT_WORDS); i++) {
+            block[i] = GUARD;
+        }
+        for (i = 0; i < channels; i++) {
+            Ingest_init(&ingest[i], Ingest_DC_SHIFT_DEFAULT);
+        }
+
+        deinterleave(channels, (uint32_t)numSamples, means);
+        errors = check(channels, (uint32_t)numSamples, means);
+        pass = pass && (errors == 0U);
+
+        repeats = 0;
+        t0 = nowNs();
+        do {
+            deinterleave(channels, (uint32_t)numSamples, means);
+            repeats++;
+            elapsed = nowNs() - t0;
+        } while ((elapsed < minNs) || (repeats < MIN_REPEATS));
+        ns = (double)elapsed / ((double)repeats * channels * numSamples);
+
+        printf("%8u %8lu %8u %11.3f %11.1f  %s\n", channels,
+               channels * numSamples, (unsigned)errors, ns, 1e3 / ns,
+               (errors == 0U) ? "ok" : "FAIL");
+    }
+
+    printf("\nMS/s is the aggregate rate de-interleaved on this host\n%s\n",
+           pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
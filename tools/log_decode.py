@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+#
+#  ======== log_decode.py ========
+#  Turns the deferred log frames of log.c back into text.
+#
+#  Usage: python3 tools/log_decode.py [--clock hz] table [capture|serial port]
+#                                     [baud]
+#         python3 tools/log_decode.py --table executable > table
+#
+#  The first form reads the message table from the executable (.out or
+#  host ELF) or from a table written by the second form, then reads a raw
+#  capture file, a serial port (needs pyserial) or stdin when no source is
+#  given, and prints one line per log record:
+#
+#      [seconds] message
+#
+#  Timestamps are unwrapped from 32 bits and divided by --clock, the tick
+#  rate of Profile_now(): the CPU clock on the target, 120 MHz by default,
+#  and 1e9 for host builds.  Result frames (telemetry.h) on the same link
+#  are skipped; text and damaged frames are counted on stderr.
+#
+#  The second form extracts the table at build time, so the executable
+#  does not have to ship with the decoder.  The frame layout is described
+#  in log.h.
+#
+import re
+import struct
+import sys
+
+import telemetry_decode
+from telemetry_decode import cobs_decode, crc16, frames, unstuff_cr
+
+LOG_FRAME_TYPE = 0x4C
+HEADER = struct.Struct('<BBHII')
+SECTIONS = ('.log_data', 'log_data')
+TABLE_MAGIC = '# log_decode table'
+
+CONVERSION = re.compile(r'%([-+ 0#]*)(\d*)(?:\.(\d+))?(q\d*|[cdiuxXpf%])')
+
+
+def elf_section(data, names):
+    # Little-endian ELF32 (TI .out) or ELF64 (host build)
+    if data[:4] != b'\x7fELF' or data[5] != 1:
+        raise ValueError('not a little-endian ELF file')
+    if data[4] == 1:
+        shoff, = struct.unpack_from('<I', data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x2E)
+        entry = struct.Struct('<IIIIII')
+    else:
+        shoff, = struct.unpack_from('<Q', data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', data, 0x3A)
+        entry = struct.Struct('<IIQQQQ')
+
+    headers = [entry.unpack_from(data, shoff + i * shentsize)
+               for i in range(shnum)]
+    strtab = headers[shstrndx][4]
+    for name, _, _, _, offset, size in headers:
+        end = data.index(b'\0', strtab + name)
+        if data[strtab + name:end].decode() in names:
+            return data[offset:offset + size]
+    raise ValueError('no %s section' % ' or '.join(names))
+
+
+def table_from_section(section):
+    # Every format string is its own object; zeros between are padding
+    table = {}
+    start = None
+    for i, byte in enumerate(section):
+        if byte and start is None:
+            start = i
+        elif not byte and start is not None:
+            table[start] = section[start:i].decode('latin-1')
+            start = None
+    return table
+
+
+def load_table(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data.startswith(TABLE_MAGIC.encode()):
+        table = {}
+        for line in data.decode('latin-1').splitlines()[1:]:
+            msg_id, fmt = line.split('\t', 1)
+            table[int(msg_id)] = fmt.encode('latin-1').decode(
+                'unicode_escape')
+        return table
+    return table_from_section(elf_section(data, SECTIONS))
+
+
+def convert(match, args):
+    flags, width, precision, conv = match.groups()
+    if conv == '%':
+        return '%'
+    value = args.pop(0) if args else 0
+    spec = '%' + flags + width
+
+    if conv in 'di':
+        return (spec + 'd') % (value - (1 << 32) if value >> 31 else value)
+    if conv == 'u':
+        return (spec + 'd') % value
+    if conv in 'xX':
+        return (spec + conv) % value
+    if conv == 'p':
+        return (spec + 's') % ('0x%08x' % value)
+    if conv == 'c':
+        return (spec + 'c') % (value & 0xFF)
+    if conv == 'f':
+        number, = struct.unpack('<f', struct.pack('<I', value))
+        digits = 6
+    else:
+        bits = int(conv[1:]) if len(conv) > 1 else 15
+        if not 1 <= bits <= 31:
+            return 'ERROR'
+        number = (value - (1 << 32) if value >> 31 else value) / (1 << bits)
+        digits = min(((bits * 77) + 255) // 256, 9)
+    if precision is not None:
+        digits = int(precision)
+    return (spec + '.%df' % digits) % number
+
+
+def format_message(fmt, args):
+    args = list(args)
+    return CONVERSION.sub(lambda m: convert(m, args), fmt)
+
+
+def parse(payload):
+    if len(payload) < HEADER.size + 2:
+        return None
+    (crc,) = struct.unpack_from('<H', payload, len(payload) - 2)
+    if crc16(payload[:-2]) != crc:
+        return None
+    frame_type, count, dropped, time, msg_id = HEADER.unpack_from(payload)
+    if (frame_type != LOG_FRAME_TYPE or
+            len(payload) != HEADER.size + 4 * count + 2):
+        return None
+    args = struct.unpack_from('<%dI' % count, payload, HEADER.size)
+    return dropped, time, msg_id, args
+
+
+def decode(block):
+    # Text written just before a frame shares its block; skip over it.
+    # Result frames decode to an empty record.
+    for start in range(len(block)):
+        payload = cobs_decode(block[start:])
+        if not payload:
+            continue
+        record = parse(payload)
+        if record is not None:
+            return record
+        if telemetry_decode.parse(payload) not in (None, telemetry_decode.LOG):
+            return ()
+    return None
+
+
+def write_table(path):
+    table = table_from_section(elf_section(open(path, 'rb').read(),
+                                           SECTIONS))
+    out = sys.stdout
+    out.write(TABLE_MAGIC + '\n')
+    for msg_id in sorted(table):
+        out.write('%d\t%s\n' % (msg_id, table[msg_id].encode(
+            'unicode_escape').decode('latin-1')))
+
+
+def main(argv):
+    clock = 120e6
+    if len(argv) > 2 and argv[1] == '--table':
+        write_table(argv[2])
+        return
+    if len(argv) > 2 and argv[1] == '--clock':
+        clock = float(argv[2])
+        argv = argv[:1] + argv[3:]
+    if len(argv) < 2:
+        sys.stderr.write('usage: %s [--clock hz] table [capture|port] [baud]\n'
+                         '       %s --table executable\n' % (argv[0], argv[0]))
+        sys.exit(1)
+
+    table = load_table(argv[1])
+    if len(argv) > 2 and (argv[2].startswith('/dev/') or
+                          argv[2].upper().startswith('COM')):
+        import serial
+        stream = serial.Serial(argv[2], int(argv[3]) if len(argv) > 3
+                               else 115200, timeout=0.1)
+        live = True
+    elif len(argv) > 2:
+        stream = open(argv[2], 'rb')
+        live = False
+    else:
+        stream = sys.stdin.buffer
+        live = False
+
+    out = sys.stdout
+    bad = 0
+    last = None
+    ticks = 0
+    for block in frames(stream, live):
+        record = decode(unstuff_cr(block))
+        if record is None:
+            bad += 1
+            continue
+        if not record:
+            continue
+
+        dropped, time, msg_id, args = record
+        ticks += (time - last) & 0xFFFFFFFF if last is not None else 0
+        last = time
+        if dropped:
+            out.write('[%.6f] *** %d records dropped\n' % (ticks / clock,
+                                                         dropped))
+        fmt = table.get(msg_id)
+        text = (format_message(fmt, args) if fmt is not None else
+                'unknown message %d, args %s' % (
+                    msg_id, ' '.join('0x%08x' % a for a in args)))
+        out.write('[%.6f] %s\n' % (ticks / clock, text))
+        out.flush()
+
+    sys.stderr.write('%d frames skipped\n' % bad)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -0,0 +1,141 @@
+/*
+ *  ======== log_demo.c ========
+ *  Host round trip and cost of the deferred log in log.h.
+ *
+ *  Logs a fixed set of messages that covers every conversion the decoder
+ *  knows, overflows the ring once so a drop count goes out, and drains it
+ *  all through the real framing of telemetry.c to stdout, where UARTwrite()
+ *  is stood in by a CR LF expanding fwrite().  Then times Log_print*()
+ *  with no drain in the way and reports the cost per call on stderr.
+ *
+ *  Build with tools/Makefile, which also extracts the message table, and
+ *  run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/log_demo | python3 tools/log_decode.py tools/build/log_demo
+ *      tools/build/log_demo | python3 tools/log_decode.py \
+ *          tools/build/log_demo.tbl
+ *
+ *  Both print the same text, timestamps in nanoseconds here.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "log.h"
+#include "uartstdio.h"
+
+/* Timed calls per argument count */
+#define NUM_CALLS   (1000000U)
+
+/* The arena buffer of main_nortos.c */
+static Log_Record records[Log_RING_LEN];
+
+/*
+ *  ======== UARTwrite ========
+ *  Stand-in for uartstdio.c: every LF goes out as CR LF.
+ */
+int UARTwrite(const char *pcBuf, uint32_t ui32Len)
+{
+    uint32_t i;
+
+    for (i = 0; i < ui32Len; i++) {
+        if (pcBuf[i] == '\n') {
+            putchar('\r');
+        }
+        putchar(pcBuf[i]);
+    }
+
+    return ((int)ui32Len);
+}
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ *  ======== timeCalls ========
+ *  Nanoseconds per call with numArgs arguments.  The ring is emptied
+ *  without sending every Log_RING_LEN calls, outside the timed loop.
+ */
+static double timeCalls(uint32_t numArgs)
+{
+    uint64_t elapsed = 0;
+    uint64_t t0;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < NUM_CALLS; i += Log_RING_LEN) {
+        Log_buffer.readIndex = Log_buffer.writeIndex;
+        t0 = nowNs();
+        for (j = 0; j < Log_RING_LEN; j++) {
+            switch (numArgs) {
+                case 0:
+                    Log_print0("bench: no arguments");
+                    break;
+                case 1:
+                    Log_print1("bench: %u", j);
+                    break;
+                case 2:
+                    Log_print2("bench: %u %u", i, j);
+                    break;
+                default:
+                    Log_print4("bench: %u %u %u %u", i, j, i + j, i - j);
+                    break;
+            }
+        }
+        elapsed += nowNs() - t0;
+    }
+    Log_buffer.readIndex = Log_buffer.writeIndex;
+
+    return ((double)elapsed / (double)i);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    uint32_t i;
+
+    Log_init(records);
+
+    Log_print0("demo: start");
+    Log_print4("demo: %d %i %u %c", -42, 7, 3000000000U, 'x');
+    Log_print4("demo: [%5d] [%-5d] [%05u] [%+d]", 42, 42, 42, 42);
+    Log_print3("demo: 0x%08x %X %p", 0xBEEFU, 0xABCDU, 0x20001000U);
+    Log_print2("demo: %f %.2f", Log_float(3.14159265f), Log_float(-0.125f));
+    Log_print3("demo: %q15 %.3q15 %q31", 0x4000, -16384, 0x40000000);
+    Log_print1("demo: 100%% of %u", 5U);
+
+    /* Fill the ring, lose one record, and report the loss with the next */
+    for (i = 0; i < Log_RING_LEN - 7U; i++) {
+        Log_print1("demo: fill %u", i);
+    }
+    Log_print0("demo: never sent, the ring is full");
+    while (Log_drain(8) != 0) {}
+    Log_print0("demo: after the drop");
+    while (Log_drain(8) != 0) {}
+    fflush(stdout);
+
+    fprintf(stderr, "args,ns_per_call\n");
+    fprintf(stderr, "0,%.1f\n", timeCalls(0));
+    fprintf(stderr, "1,%.1f\n", timeCalls(1));
+    fprintf(stderr, "2,%.1f\n", timeCalls(2));
+    fprintf(stderr, "4,%.1f\n", timeCalls(4));
+
+    return (0);
+}
+
+#endif
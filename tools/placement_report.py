@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+#
+#  ======== placement_report.py ========
+#  SRAM cost of the kernels that can run from SRAM (placement.h), against
+#  the cycles they save.
+#
+#  Usage: python3 tools/placement_report.py map [flash.log sram.log] [len]
+#
+#  map is the linker map of the build (Debug/harmonic_wave_measurement.map).
+#  Every candidate found in it is listed with its size, its profile stage
+#  and whether it runs from SRAM (.TI.ramfunc, .TI.ramconst) or flash,
+#  followed by the SRAM the copies take and the SRAM used in total.  len
+#  is the FFT length the tables are looked up for, NUM_SAMPLES (1024) by
+#  default.  The linker copies the CMSIS-DSP tables of 1024 points only
+#  (placement.h); for any other length set on the console the report
+#  gives the table bytes its transform reads from flash.  The window
+#  coefficients are not listed: Analysis_configure() copies them into
+#  the arena for every length.
+#
+#  flash.log and sram.log are UART captures with Profile_REPORT() output
+#  (PROFILE_ENABLE) of the same build with the kernels in flash and in
+#  SRAM: Placement_KERNELS 0 and the RAM_* switches of
+#  MSP_EXP432E401Y_NoRTOS.cmd at 0, then as wanted.  With them, each stage
+#  gets its average cycles from both, the cycles saved and the saving per
+#  KB of SRAM its kernels take, which is what a kernel is kept in SRAM
+#  for.  The stage is the finest unit the profile measures, so try one
+#  group of a stage at a time to split its gain.
+#
+import re
+import sys
+
+SRAM_SECTIONS = ('.TI.ramfunc', '.TI.ramconst')
+STAGES = ('ingest', 'transform', 'magnitude')
+PROFILE_LINE = re.compile(r'^\s*(\w+)\s+(\d+)\s+(\d+)\s+(\d+)\s+(\d+)\s+'
+                          r'(\d+)\s+(\d+)\s+(\d+)\s*$')
+INPUT_LINE = re.compile(r'^\s+[0-9a-f]{8}\s+([0-9a-f]{8})\s+(.+?)\s+'
+                        r'\(([^)]+)\)\s*$')
+OUTPUT_LINE = re.compile(r'^([.$\w]\S*)')
+MEMORY_LINE = re.compile(r'^\s+SRAM\s+[0-9a-f]{8}\s+([0-9a-f]{8})\s+'
+                         r'([0-9a-f]{8})\s+[0-9a-f]{8}')
+
+
+def candidates(fft_len):
+    # Symbol, profile stage; must match MSP_EXP432E401Y_NoRTOS.cmd
+    half = fft_len // 2
+    code = {
+        'ingest': ['Ingest_deinterleave'],
+        'transform': ['Window_apply', 'arm_mult_q15'] + [
+            name % p for p in ('q15', 'q31') for name in (
+                'arm_rfft_%s', 'arm_split_rfft_%s', 'arm_cfft_%s',
+                'arm_cfft_radix4by2_%s', 'arm_radix4_butterfly_%s')] + [
+            'arm_rfft_fast_f32', 'stage_rfft_f32', 'arm_cfft_f32',
+            'arm_cfft_radix8by2_f32', 'arm_cfft_radix8by4_f32',
+            'arm_radix8_butterfly_f32', 'arm_bitreversal_16',
+            'arm_bitreversal_32'],
+        'magnitude': ['arm_cmplx_mag_q15', 'arm_cmplx_mag_q31',
+                      'arm_cmplx_mag_f32'],
+    }
+    result = {}
+    for stage, names in code.items():
+        for name in names:
+            result[name] = stage
+    for name in tables(fft_len):
+        result[name] = 'transform'
+    return result
+
+
+def tables(fft_len):
+    # CMSIS-DSP tables a transform of fft_len points reads
+    half = fft_len // 2
+    return ['twiddleCoef_%d_q15' % half, 'twiddleCoef_%d_q31' % half,
+            'armBitRevIndexTable_fixed_%d' % half,
+            'twiddleCoef_%d' % half, 'armBitRevIndexTable%d' % half,
+            'twiddleCoef_rfft_%d' % fft_len, 'realCoefAQ15',
+            'realCoefBQ15', 'realCoefAQ31', 'realCoefBQ31']
+
+
+def read_map(path, wanted):
+    # Returns {symbol: (bytes, output section)}, SRAM used, SRAM length
+    found = {}
+    used = length = None
+    output = None
+    with open(path, errors='replace') as f:
+        for line in f:
+            m = MEMORY_LINE.match(line)
+            if m and length is None:
+                length, used = int(m.group(1), 16), int(m.group(2), 16)
+                continue
+            m = OUTPUT_LINE.match(line)
+            if m:
+                output = m.group(1)
+                continue
+            m = INPUT_LINE.match(line)
+            if m and output is not None:
+                symbol = m.group(3).split(':')[-1]
+                if symbol in wanted:
+                    size, section = found.get(symbol, (0, output))
+                    found[symbol] = (size + int(m.group(1), 16), section)
+    return found, used, length
+
+
+def read_profile(path):
+    # Returns {stage: average ticks}, weighted by the count of each report
+    sums = {}
+    with open(path, 'rb') as f:
+        text = f.read().decode('latin-1')
+    for line in text.splitlines():
+        m = PROFILE_LINE.match(line)
+        if m:
+            stage = m.group(1)
+            count, avg = int(m.group(2)), int(m.group(4))
+            total, n = sums.get(stage, (0, 0))
+            sums[stage] = (total + count * avg, n + count)
+    return {stage: total / n for stage, (total, n) in sums.items() if n}
+
+
+def main(argv):
+    args = argv[1:]
+    fft_len = 1024
+    if args and args[-1].isdigit():
+        fft_len = int(args.pop())
+    if len(args) not in (1, 3):
+        sys.stderr.write('usage: %s map [flash.log sram.log] [len]\n' %
+                         argv[0])
+        return 2
+
+    wanted = candidates(fft_len)
+    found, used, length = read_map(args[0], wanted)
+
+    print('%-32s %-10s %7s  %s' % ('candidate', 'stage', 'bytes', 'runs'))
+    in_sram = {stage: 0 for stage in STAGES}
+    for symbol in wanted:
+        if symbol not in found:
+            continue
+        size, section = found[symbol]
+        sram = section in SRAM_SECTIONS
+        if sram:
+            in_sram[wanted[symbol]] += size
+        print('%-32s %-10s %7d  %s' % (symbol, wanted[symbol], size,
+                                       'SRAM' if sram else 'flash'))
+
+    print('\nSRAM copies %d bytes' % sum(in_sram.values()), end='')
+    if length:
+        print(', SRAM used %d of %d bytes' % (used, length))
+    else:
+        print()
+
+    in_flash = sum(found[t][0] for t in tables(fft_len)
+                   if t in found and found[t][1] not in SRAM_SECTIONS)
+    if in_flash:
+        print('the %d-point transform reads %d bytes of tables from flash; '
+              'only the 1024-point set is copied (placement.h)' %
+              (fft_len, in_flash))
+    print('window coefficients: copied to the arena by '
+          'Analysis_configure()')
+
+    if len(args) == 3:
+        flash = read_profile(args[1])
+        sram = read_profile(args[2])
+        print('\n%-10s %8s %9s %9s %7s %7s %12s' %
+              ('stage', 'SRAM B', 'flash', 'SRAM', 'saved', 'gain %',
+               'saved / KB'))
+        for stage in STAGES:
+            if stage not in flash or stage not in sram:
+                continue
+            saved = flash[stage] - sram[stage]
+            per_kb = (saved * 1024.0 / in_sram[stage]
+                      if in_sram[stage] else 0.0)
+            print('%-10s %8d %9.0f %9.0f %7.0f %7.1f %12.1f' %
+                  (stage, in_sram[stage], flash[stage], sram[stage], saved,
+                   100.0 * saved / flash[stage] if flash[stage] else 0.0,
+                   per_kb))
+        print('\nticks are cycles per run of the stage, one channel')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,305 @@
+/*
+ *  ======== precision_report.c ========
+ *  Host cost and accuracy report for the analysis precision.
+ *
+ *  Builds the chain of main_nortos.c (ingest, window, real FFT, magnitude,
+ *  and the Goertzel bank) in the precision selected by PRECISION, feeds it
+ *  12-bit ADC codes of a distorted mains waveform at several levels, and
+ *  compares the measured THD with a double-precision DFT of the same
+ *  codes.  ADC quantization is common to both, so the error is that of the
+ *  arithmetic alone.  Run it once per precision and keep the cheapest one
+ *  whose error stays within 0.1 % THD at the lowest level of interest.
+ *
+ *  Build with tools/Makefile (see there for the CMSIS-DSP paths) and run
+ *  once per precision from the repository root:
+ *
+ *      make -C tools
+ *      for p in q15 q31 f32; do
+ *          tools/build/precision_report_$p [fftLen] [fundamentalBin] [window]
+ *      done
+ *
+ *  fftLen defaults to 1024, fundamentalBin to 1 and window to 0
+ *  (Window_Type: 0 rectangular, 1 Hann, 2 flat-top, 3 Blackman-Harris).
+ *  Use a window with a fundamental bin of 4 or more so the harmonics stay
+ *  clear of each other's main lobe.
+ *
+ *  The costs are host nanoseconds per frame and only rank the precisions;
+ *  cycle counts on the target come from the Cortex-M4 itself.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "goertzel.h"
+#include "ingest.h"
+#include "precision.h"
+#include "spectrum.h"
+#include "window.h"
+
+#define MAX_LEN         (4096)
+
+/* Timed repetitions of every stage */
+#define REPEATS         (200)
+
+/* Required THD accuracy, in percentage points */
+#define THD_LIMIT       (0.1)
+
+/* Harmonic content of the test waveform, relative to the fundamental */
+typedef struct {
+    uint_least8_t order;
+    double        level;
+    double        phase;
+} Harmonic;
+
+static const Harmonic profile[] = {
+    {2, 0.002, 0.3},
+    {3, 0.040, 1.1},
+    {5, 0.030, 2.0},
+    {7, 0.020, 0.7},
+    {9, 0.010, 2.9},
+    {11, 0.005, 1.6},
+    {13, 0.003, 0.2}
+};
+
+#define NUM_PROFILE     (sizeof(profile) / sizeof(profile[0]))
+
+/* Fundamental peak, relative to ADC full scale */
+static const double levels[] = {0.9, 0.3, 0.1, 0.03, 0.01};
+
+#define NUM_LEVELS      (sizeof(levels) / sizeof(levels[0]))
+
+static uint16_t codes[MAX_LEN];
+static Precision_Sample frame[MAX_LEN] __attribute__((aligned(4)));
+static Precision_Sample scratch[MAX_LEN] __attribute__((aligned(4)));
+static Precision_Sample work[Spectrum_WORK_LEN(MAX_LEN)];
+static Precision_Sample mag[Spectrum_NUM_BINS(MAX_LEN)];
+static Goertzel_Phasor phasors[Goertzel_MAX_BINS];
+
+static Ingest_Object ingest;
+static Spectrum_Object spectrum;
+static Goertzel_Object goertzel;
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ *  ======== synthesize ========
+ *  Rounded 12-bit codes of the test waveform, clipped like the ADC.
+ */
+static void synthesize(uint16_t len, uint16_t bin, double level)
+{
+    double w = 2.0 * M_PI * bin / len;
+    double x;
+    double code;
+    uint16_t n;
+    uint_least8_t h;
+
+    for (n = 0; n < len; n++) {
+        x = sin(w * n);
+        for (h = 0; h < NUM_PROFILE; h++) {
+            x += profile[h].level * sin((w * profile[h].order * n) +
+                                        profile[h].phase);
+        }
+
+        code = floor((2048.0 * level * x) + 2048.5);
+        codes[n] = (code < 0.0) ? 0 : ((code > 4095.0) ? 4095 : code);
+    }
+}
+
+/*
+ *  ======== reference ========
+ *  Harmonic magnitudes of the codes by a direct double-precision DFT,
+ *  with the given window (NULL for none) and the 1/N scaling of the chain.
+ */
+static void reference(uint16_t len, uint16_t bin, const q15_t *table,
+                      uint_least8_t numHarmonics, double *harmonicMag)
+{
+    double re;
+    double im;
+    double x;
+    double w;
+    uint16_t n;
+    uint_least8_t h;
+
+    for (h = 0; h < numHarmonics; h++) {
+        w = 2.0 * M_PI * bin * (h + 1U) / len;
+        re = 0.0;
+        im = 0.0;
+        for (n = 0; n < len; n++) {
+            x = ((double)codes[n] - Ingest_ADC_OFFSET) / 2048.0;
+            if (table != NULL) {
+                x *= table[n] / 32768.0;
+            }
+            re += x * cos(w * n);
+            im -= x * sin(w * n);
+        }
+        harmonicMag[h] = sqrt((re * re) + (im * im)) / len;
+    }
+}
+
+/*
+ *  ======== thd ========
+ *  THD in percent from the fundamental and harmonic magnitudes.
+ */
+static double thd(const double *harmonicMag, uint_least8_t numHarmonics)
+{
+    double sum = 0.0;
+    uint_least8_t h;
+
+    for (h = 1; h < numHarmonics; h++) {
+        sum += harmonicMag[h] * harmonicMag[h];
+    }
+
+    return ((harmonicMag[0] > 0.0) ?
+            (100.0 * sqrt(sum) / harmonicMag[0]) : 0.0);
+}
+
+/*
+ *  ======== phasorMag ========
+ */
+static double phasorMag(const Goertzel_Phasor *p)
+{
+#if (PRECISION == PRECISION_F32)
+    return (sqrt(((double)p->re * p->re) + ((double)p->im * p->im)));
+#else
+    double re = p->re / 2147483648.0;
+    double im = p->im / 2147483648.0;
+
+    return (sqrt((re * re) + (im * im)));
+#endif
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint16_t fftLen = (argc > 1) ? (uint16_t)atoi(argv[1]) : 1024;
+    uint16_t bin = (argc > 2) ? (uint16_t)atoi(argv[2]) : 1;
+    Window_Type window = (argc > 3) ? (Window_Type)atoi(argv[3]) :
+                         Window_RECTANGULAR;
+    double fftMag[Goertzel_MAX_BINS];
+    double fftRef[Goertzel_MAX_BINS];
+    double gMag[Goertzel_MAX_BINS];
+    double gRef[Goertzel_MAX_BINS];
+    double errFft;
+    double errGoertzel;
+    double worst = 0.0;
+    uint64_t t0;
+    uint64_t costIngest = 0;
+    uint64_t costFft = 0;
+    uint64_t costMag = 0;
+    uint64_t costGoertzel = 0;
+    uint_least8_t numHarmonics;
+    uint_least8_t h;
+    uint_least8_t l;
+    uint16_t r;
+
+    if ((fftLen > MAX_LEN) || (bin == 0) || (window >= Window_COUNT) ||
+        (Spectrum_init(&spectrum, fftLen, work) != Spectrum_STATUS_SUCCESS) ||
+        (Spectrum_setWindow(&spectrum, window) != Spectrum_STATUS_SUCCESS)) {
+        fprintf(stderr, "usage: %s [fftLen] [fundamentalBin] [window]\n",
+                argv[0]);
+        return (1);
+    }
+
+    numHarmonics = (uint_least8_t)(((fftLen / 2U) - 1U) / bin);
+    if (numHarmonics > Goertzel_MAX_BINS) {
+        numHarmonics = Goertzel_MAX_BINS;
+    }
+    if ((numHarmonics < 2) ||
+        (Goertzel_initHarmonics(&goertzel, fftLen, bin, numHarmonics) !=
+         Goertzel_STATUS_SUCCESS)) {
+        fprintf(stderr, "fundamental bin %u too high\n", bin);
+        return (1);
+    }
+
+    Ingest_init(&ingest, Ingest_DC_SHIFT_DEFAULT);
+
+    printf("precision %s, fftLen %u, fundamental bin %u, %u harmonics, "
+           "window %d\n\n", Precision_NAME, fftLen, bin, numHarmonics,
+           (int)window);
+    printf("%8s %10s %10s %10s %10s\n", "level", "thdRef", "thdFft",
+           "errFft", "errGoertz");
+
+    for (l = 0; l < NUM_LEVELS; l++) {
+        synthesize(fftLen, bin, levels[l]);
+        reference(fftLen, bin, spectrum.window, numHarmonics, fftRef);
+        reference(fftLen, bin, NULL, numHarmonics, gRef);
+
+        Ingest_convert(&ingest, codes, frame, fftLen);
+        memcpy(scratch, frame, fftLen * sizeof(Precision_Sample));
+
+        Spectrum_transform(&spectrum, scratch);
+        Spectrum_magnitude(&spectrum, mag);
+        Goertzel_process(&goertzel, frame, phasors);
+
+        for (h = 0; h < numHarmonics; h++) {
+            fftMag[h] = Spectrum_MAG_TO_FLOAT(mag[bin * (h + 1U)]);
+            gMag[h] = phasorMag(&phasors[h]);
+        }
+
+        /* The Goertzel bank sees the unwindowed frame */
+        errFft = fabs(thd(fftMag, numHarmonics) - thd(fftRef, numHarmonics));
+        errGoertzel = fabs(thd(gMag, numHarmonics) -
+                           thd(gRef, numHarmonics));
+
+        printf("%8.3f %10.4f %10.4f %10.4f %10.4f\n", levels[l],
+               thd(gRef, numHarmonics), thd(fftMag, numHarmonics), errFft,
+               errGoertzel);
+
+        if (errFft > worst) {
+            worst = errFft;
+        }
+        if (errGoertzel > worst) {
+            worst = errGoertzel;
+        }
+    }
+
+    /* Cost of every stage over the last waveform */
+    for (r = 0; r < REPEATS; r++) {
+        t0 = nowNs();
+        Ingest_convert(&ingest, codes, frame, fftLen);
+        costIngest += nowNs() - t0;
+
+        memcpy(scratch, frame, fftLen * sizeof(Precision_Sample));
+        t0 = nowNs();
+        Spectrum_transform(&spectrum, scratch);
+        costFft += nowNs() - t0;
+
+        t0 = nowNs();
+        Spectrum_magnitude(&spectrum, mag);
+        costMag += nowNs() - t0;
+
+        t0 = nowNs();
+        Goertzel_process(&goertzel, frame, phasors);
+        costGoertzel += nowNs() - t0;
+    }
+
+    printf("\nns/frame: ingest %llu, window+fft %llu, magnitude %llu, "
+           "goertzel %llu\n",
+           (unsigned long long)(costIngest / REPEATS),
+           (unsigned long long)(costFft / REPEATS),
+           (unsigned long long)(costMag / REPEATS),
+           (unsigned long long)(costGoertzel / REPEATS));
+    printf("worst THD error %.4f %%: %s the %.1f %% limit\n", worst,
+           (worst <= THD_LIMIT) ? "within" : "OUTSIDE", THD_LIMIT);
+
+    return ((worst <= THD_LIMIT) ? 0 : 2);
+}
+
+#endif
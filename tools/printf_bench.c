@@ -0,0 +1,403 @@
+/*
+ *  ======== printf_bench.c ========
+ *  Host benchmark and check of the UARTprintf() number formatting.
+ *
+ *  Builds uartstdio.c in buffered mode against a UART stand-in whose FIFO
+ *  never fills, so every UARTprintf() goes through the transmit buffer to
+ *  a line buffer here.  Times typical result lines:
+ *
+ *      split       values split into integer and fraction by hand, %u.%03u
+ *      float       the same line with %.3f
+ *      q15         harmonic magnitude and phase with %q15
+ *      snprintf    the float line formatted by the C library, then
+ *                  UARTwrite(), as a reference
+ *
+ *  and checks %f and %q against the C library on random values.
+ *
+ *  Output is CSV on stdout, one header line and one line per case:
+ *
+ *      line,bytes,writes,ns_per_line,bytes_per_us
+ *
+ *  writes is the number of UARTwrite() calls per line.  The exit status is
+ *  non-zero if any formatted value was wrong.
+ *
+ *  Build and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/printf_bench [minMilliseconds]
+ */
+#if defined(HOST_BUILD)
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/*
+ *  ======== Stand-in for the driverlib definitions uartstdio.c uses ========
+ */
+#define ASSERT(expr)
+
+#define UART0_BASE              0x4000C000U
+#define UART1_BASE              0x4000D000U
+#define UART2_BASE              0x4000E000U
+#define INT_UART0               21U
+#define INT_UART1               22U
+#define INT_UART2               49U
+#define SYSCTL_PERIPH_UART0     0xF0001800U
+#define SYSCTL_PERIPH_UART1     0xF0001801U
+#define SYSCTL_PERIPH_UART2     0xF0001802U
+
+#define UART_CONFIG_WLEN_8      0x00000060U
+#define UART_CONFIG_STOP_ONE    0x00000000U
+#define UART_CONFIG_PAR_NONE    0x00000000U
+#define UART_FIFO_TX1_8         0x00000000U
+#define UART_FIFO_RX1_8         0x00000000U
+#define UART_INT_RT             0x00000040U
+#define UART_INT_TX             0x00000020U
+#define UART_INT_RX             0x00000010U
+
+/* Everything the UART sent since the last reset, and UARTwrite() calls */
+static char line[1024];
+static uint32_t lineLen;
+static uint32_t writes;
+
+static bool MAP_SysCtlPeripheralPresent(uint32_t periph)
+{
+    (void)periph;
+    return (true);
+}
+
+static void MAP_SysCtlPeripheralEnable(uint32_t periph)
+{
+    (void)periph;
+}
+
+static void MAP_UARTConfigSetExpClk(uint32_t base, uint32_t clock,
+                                    uint32_t baud, uint32_t config)
+{
+    (void)base;
+    (void)clock;
+    (void)baud;
+    (void)config;
+}
+
+static void MAP_UARTFIFOLevelSet(uint32_t base, uint32_t tx, uint32_t rx)
+{
+    (void)base;
+    (void)tx;
+    (void)rx;
+}
+
+static void MAP_UARTEnable(uint32_t base)
+{
+    (void)base;
+}
+
+/* UARTPrimeTransmit() masks the interrupt once per UARTwrite() */
+static void MAP_IntDisable(uint32_t intNum)
+{
+    (void)intNum;
+    writes++;
+}
+
+static void MAP_IntEnable(uint32_t intNum)
+{
+    (void)intNum;
+}
+
+static bool MAP_IntMasterDisable(void)
+{
+    return (false);
+}
+
+static bool MAP_IntMasterEnable(void)
+{
+    return (true);
+}
+
+static void MAP_UARTIntEnable(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    (void)flags;
+}
+
+static void MAP_UARTIntDisable(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    (void)flags;
+}
+
+static uint32_t MAP_UARTIntStatus(uint32_t base, bool masked)
+{
+    (void)base;
+    (void)masked;
+    return (0);
+}
+
+static void MAP_UARTIntClear(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    (void)flags;
+}
+
+static bool MAP_UARTSpaceAvail(uint32_t base)
+{
+    (void)base;
+    return (true);
+}
+
+static bool MAP_UARTCharPutNonBlocking(uint32_t base, unsigned char c)
+{
+    (void)base;
+    line[lineLen++ % sizeof(line)] = (char)c;
+
+    return (true);
+}
+
+static bool MAP_UARTCharsAvail(uint32_t base)
+{
+    (void)base;
+    return (false);
+}
+
+static int32_t MAP_UARTCharGetNonBlocking(uint32_t base)
+{
+    (void)base;
+    return (-1);
+}
+
+#include "../uartstdio.c"
+
+/* Fewest timed repetitions of every case */
+#define MIN_REPEATS     (1000U)
+
+/* Random values checked against the C library, per format */
+#define NUM_CHECKS      (100000U)
+
+typedef enum {
+    Line_SPLIT = 0,
+    Line_FLOAT,
+    Line_Q15,
+    Line_SNPRINTF,
+    Line_COUNT
+} Line;
+
+static const char *lineNames[Line_COUNT] = {
+    "split", "float", "q15", "snprintf"
+};
+
+static uint32_t failures;
+static uint32_t seed = 1;
+
+/*
+ *  ======== nowNs ========
+ */
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ *  ======== randomUnit ========
+ *  Uniform in [0, 1).
+ */
+static double randomUnit(void)
+{
+    seed = (seed * 1103515245U) + 12345U;
+
+    return ((double)(seed >> 8) / 16777216.0);
+}
+
+/*
+ *  ======== capture ========
+ *  What the UART sent since the last call, as a string.
+ */
+static const char *capture(void)
+{
+    line[lineLen % sizeof(line)] = '\0';
+    lineLen = 0;
+
+    return (line);
+}
+
+/*
+ *  ======== printLine ========
+ *  One result line of a three-phase meter.
+ */
+static void printLine(Line type, uint32_t i)
+{
+    char buf[128];
+    uint32_t channel = i % 3U;
+    double rms = 230.0 + (double)(i % 1000U) * 0.0137;
+    double freq = 49.9 + (double)(i % 200U) * 0.001;
+    double thd = 2.0 + (double)(i % 300U) * 0.01;
+    uint32_t mrms = (uint32_t)((rms * 1000.0) + 0.5);
+    uint32_t mfreq = (uint32_t)((freq * 1000.0) + 0.5);
+    uint32_t mthd = (uint32_t)((thd * 1000.0) + 0.5);
+    int16_t mag = (int16_t)(i * 37U);
+    int16_t phase = (int16_t)(i * 1009U);
+    int len;
+
+    switch (type) {
+        case Line_SPLIT:
+            UARTprintf("ch%u rms %u.%03u V f %u.%03u Hz thd %u.%03u %%\n",
+                       channel, mrms / 1000U, mrms % 1000U, mfreq / 1000U,
+                       mfreq % 1000U, mthd / 1000U, mthd % 1000U);
+            break;
+
+        case Line_FLOAT:
+            UARTprintf("ch%u rms %.3f V f %.3f Hz thd %.3f %%\n", channel,
+                       rms, freq, thd);
+            break;
+
+        case Line_Q15:
+            UARTprintf("ch%u h%02u mag %q15 phase %.4q15 pi\n", channel,
+                       i % 50U, mag, phase);
+            break;
+
+        default:
+            len = snprintf(buf, sizeof(buf),
+                           "ch%u rms %.3f V f %.3f Hz thd %.3f %%\n",
+                           (unsigned)channel, rms, freq, thd);
+            UARTwrite(buf, (uint32_t)len);
+            break;
+    }
+}
+
+/*
+ *  ======== expect ========
+ */
+static void expect(const char *got, const char *want)
+{
+    if (strcmp(got, want) != 0) {
+        if (failures++ < 10U) {
+            fprintf(stderr, "FAIL: \"%s\", expected \"%s\"\n", got, want);
+        }
+    }
+}
+
+/*
+ *  ======== expectNear ========
+ *  got must be value rounded to prec digits, give or take the last one
+ *  where the C library rounds an exact binary tie the other way or the
+ *  value has no more significant digits in a double.
+ */
+static void expectNear(const char *got, double value, int prec)
+{
+    char want[64];
+    double tolerance = pow(10.0, -prec);
+
+    snprintf(want, sizeof(want), "%.*f", prec, value);
+    if ((strcmp(got, want) != 0) &&
+        (fabs(strtod(got, NULL) - strtod(want, NULL)) >
+         ((tolerance * 1.01) + (fabs(value) * 1e-15)))) {
+        expect(got, want);
+    }
+}
+
+/*
+ *  ======== check ========
+ */
+static void check(void)
+{
+    char format[8];
+    double value;
+    int32_t q;
+    uint32_t prec;
+    uint32_t i;
+
+    capture();
+
+    UARTprintf("%f", 3.14159265);
+    expect(capture(), "3.141593");
+    UARTprintf("%08.3f|%8.3f|%8.3f", -3.14159, -3.14159, 123456.0);
+    expect(capture(), "-003.142|  -3.142|123456.000");
+    UARTprintf("%.0f %.2f %.1f", 2.5, 0.999, -0.04);
+    expect(capture(), "3 1.00 -0.0");
+    UARTprintf("%.3f %f", 1e300, 0.0 / 0.0);
+    expect(capture(), "inf nan");
+    UARTprintf("%q15 %q15 %q15 %q", 0x4000, -32768, 32767, 1);
+    expect(capture(), "0.50000 -1.00000 0.99997 0.00003");
+    UARTprintf("%.2q15 %8.4q31 %q1 %q0", -16384, 0x40000000, 3, 1);
+    expect(capture(), "-0.50   0.5000 1.5 ERROR");
+    UARTprintf("%q31 %q16", (int32_t)0x80000000, 0x7FFFFFFF);
+    expect(capture(), "-1.000000000 32767.99998");
+
+    for (i = 0; i < NUM_CHECKS; i++) {
+        value = (randomUnit() - 0.5) * pow(10.0, (int)(randomUnit() * 12.0) -
+                                                 3);
+        prec = (uint32_t)(randomUnit() * 10.0);
+        snprintf(format, sizeof(format), "%%.%uf", (unsigned)prec);
+        UARTprintf(format, value);
+        expectNear(capture(), value, (int)prec);
+
+        q = (int32_t)(seed ^ (seed << 13));
+        UARTprintf("%q15", (int16_t)q);
+        expectNear(capture(), (double)(int16_t)q / 32768.0, 5);
+        UARTprintf("%q31", q);
+        expectNear(capture(), (double)q / 2147483648.0, 9);
+    }
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint64_t minNs = (uint64_t)((argc > 1) ? atoi(argv[1]) : 50) * 1000000U;
+    uint64_t t0;
+    uint64_t elapsed;
+    uint32_t repeats;
+    uint32_t bytes;
+    uint32_t calls;
+    int l;
+
+    if (minNs == 0) {
+        fprintf(stderr, "usage: %s [minMilliseconds]\n", argv[0]);
+        return (1);
+    }
+
+    UARTStdioConfig(0, 115200, 120000000);
+    UARTEchoSet(false);
+
+    check();
+
+    printf("line,bytes,writes,ns_per_line,bytes_per_us\n");
+    for (l = 0; l < Line_COUNT; l++) {
+        /* Size of one line, and UARTwrite() calls per line */
+        capture();
+        writes = 0;
+        printLine((Line)l, 0);
+        bytes = (uint32_t)strlen(capture());
+        calls = writes;
+
+        repeats = 0;
+        t0 = nowNs();
+        do {
+            printLine((Line)l, repeats);
+            lineLen = 0;
+            repeats++;
+            elapsed = nowNs() - t0;
+        } while ((elapsed < minNs) || (repeats < MIN_REPEATS));
+
+        printf("%s,%u,%u,%.1f,%.1f\n", lineNames[l], (unsigned)bytes,
+               (unsigned)calls, (double)elapsed / repeats,
+               ((double)bytes * repeats * 1000.0) / (double)elapsed);
+    }
+
+    if (failures != 0U) {
+        fprintf(stderr, "%u formatting errors\n", (unsigned)failures);
+    }
+
+    return ((failures == 0U) ? 0 : 1);
+}
+
+#endif
@@ -0,0 +1,342 @@
+/*
+ *  ======== resampler_chirp.c ========
+ *  Host test of the frequency-tracking resampler (resampler.h) on chirped
+ *  mains.
+ *
+ *  The input is the ADC rate of acquire.c, 51.2 kS/s, carrying a mains
+ *  waveform whose fundamental sweeps linearly from 49 Hz to 51 Hz over
+ *  the run, with the 3rd to 13th odd harmonics.  It is fed to
+ *  Resampler_process() in blocks of 1024 samples, one ADC frame, with
+ *  Resampler_setFrequency() set before each block to the true frequency at
+ *  its middle, as a meter with no lag would report it (frequency_sim.c
+ *  measures the meter itself).  The resampler makes frames of 8 cycles of
+ *  128 samples.
+ *
+ *  Every frame goes through a double DFT without a window, and for every
+ *  quarter hertz of the sweep the table gives
+ *
+ *      spc err    the largest error of the samples per cycle, from the
+ *                 advance of the fundamental phase from one frame to the
+ *                 next; 0 when locked
+ *      leakage    the largest power in the bins between harmonics,
+ *                 relative to the fundamental, in dB
+ *      fixed      the same leakage for frames of every 8th input sample,
+ *                 the 6.4 kS/s a fixed-rate FFT of 1024 points would see
+ *
+ *  The second run adds a tone at 9 kHz, 40 dB below the fundamental.  It
+ *  is above half the 6.4 kS/s output rate, and the 4-point Lagrange
+ *  interpolator alone does not remove it, so it folds into the output
+ *  frames (see resampler.h): the leakage column shows it.  That run is
+ *  reported and not checked.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/resampler_chirp [seconds]
+ *
+ *  seconds of sweep (default 20).  Fails, with a non-zero exit status, if
+ *  in the first run the samples per cycle are ever off by more than
+ *  SPC_LIMIT or the leakage is ever above LEAKAGE_LIMIT_DB.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arm_math.h"
+
+#include "resampler.h"
+
+#define IN_RATE             (51200U)
+#define BLOCK_LEN           (1024U)
+#define SAMPLES_PER_CYCLE   (128U)
+#define FRAME_LEN           (1024U)
+#define CYCLES              (FRAME_LEN / SAMPLES_PER_CYCLE)
+
+#define START_HZ            (49.0)
+#define STOP_HZ             (51.0)
+#define SEGMENT_HZ          (0.25)
+#define NUM_SEGMENTS        (8)
+
+#define ALIAS_HZ            (9000.0)
+#define ALIAS_LEVEL         (0.008)
+
+#define SPC_LIMIT           (0.001)
+#define LEAKAGE_LIMIT_DB    (-70.0)
+
+/* Harmonic content, relative to full scale */
+typedef struct {
+    uint_least8_t order;
+    double        level;
+    double        phase;
+} Harmonic;
+
+static const Harmonic profile[] = {
+    {1, 0.800, 0.0},
+    {3, 0.050, 0.4},
+    {5, 0.030, 1.3},
+    {7, 0.020, 2.1},
+    {9, 0.010, 0.9},
+    {11, 0.008, 2.7},
+    {13, 0.005, 1.8}
+};
+
+#define NUM_PROFILE     (sizeof(profile) / sizeof(profile[0]))
+
+typedef struct {
+    uint32_t frames;
+    double   spcError;              /* Samples per cycle */
+    double   leakage;               /* Power ratio */
+    double   fixedLeakage;
+} Segment;
+
+typedef struct {
+    double   seconds;
+    bool     alias;
+    uint32_t frames;
+    bool     havePhase;
+    double   lastPhase;
+    double   frequency;             /* At the block being resampled */
+    Segment  segments[NUM_SEGMENTS];
+} Run;
+
+static q15_t block[BLOCK_LEN];
+static q15_t frame[FRAME_LEN];
+static q15_t fixedFrame[FRAME_LEN];
+static double cosTable[FRAME_LEN];
+static Resampler_Object resampler;
+
+/*
+ *  ======== frequencyAt ========
+ */
+static double frequencyAt(const Run *run, double t)
+{
+    return (START_HZ + (((STOP_HZ - START_HZ) * t) / run->seconds));
+}
+
+/*
+ *  ======== input ========
+ *  Sample n of the input, from the integral of the sweep.
+ */
+static q15_t input(const Run *run, uint64_t n)
+{
+    double t = (double)n / IN_RATE;
+    double phase = 2.0 * M_PI *
+                   ((START_HZ * t) +
+                    (((STOP_HZ - START_HZ) * t * t) / (2.0 * run->seconds)));
+    double x = 0.0;
+    uint_least8_t h;
+
+    for (h = 0; h < NUM_PROFILE; h++) {
+        x += profile[h].level *
+             sin((profile[h].order * phase) + profile[h].phase);
+    }
+    if (run->alias) {
+        x += ALIAS_LEVEL * sin(2.0 * M_PI * ALIAS_HZ * t);
+    }
+
+    return ((q15_t)lrint(x * 32767.0));
+}
+
+/*
+ *  ======== analyze ========
+ *  Leakage of a frame of CYCLES cycles, and the phase of its fundamental.
+ */
+static double analyze(const q15_t *x, double *phase)
+{
+    double re;
+    double im;
+    double power;
+    double fundamental = 0.0;
+    double worst = 0.0;
+    uint32_t k;
+    uint32_t n;
+
+    for (k = 1; k < (FRAME_LEN / 2U); k++) {
+        re = 0.0;
+        im = 0.0;
+        for (n = 0; n < FRAME_LEN; n++) {
+            re += x[n] * cosTable[(k * n) & (FRAME_LEN - 1U)];
+            im -= x[n] * cosTable[((k * n) - (FRAME_LEN / 4U)) &
+                                  (FRAME_LEN - 1U)];
+        }
+        power = (re * re) + (im * im);
+
+        if (k == CYCLES) {
+            fundamental = power;
+            *phase = atan2(im, re);
+        }
+        else if (((k % CYCLES) != 0U) && (power > worst)) {
+            worst = power;
+        }
+    }
+
+    return (worst / fundamental);
+}
+
+/*
+ *  ======== frameComplete ========
+ */
+static void frameComplete(q15_t *x, uint16_t frameLen, void *arg)
+{
+    Run *run = arg;
+    Segment *segment;
+    double phase;
+    double advance;
+    double spc;
+    double leakage;
+    int_fast16_t s;
+
+    (void)frameLen;
+
+    leakage = analyze(x, &phase);
+    run->frames++;
+
+    /* The first frame holds the start-up of the interpolator */
+    if (run->frames < 2U) {
+        return;
+    }
+
+    s = (int_fast16_t)((run->frequency - START_HZ) / SEGMENT_HZ);
+    segment = &run->segments[(s < 0) ? 0 :
+                             ((s >= NUM_SEGMENTS) ? (NUM_SEGMENTS - 1) : s)];
+    segment->frames++;
+    if (leakage > segment->leakage) {
+        segment->leakage = leakage;
+    }
+
+    /* Locked, the fundamental is at the same phase in every frame */
+    if (run->havePhase) {
+        advance = remainder(phase - run->lastPhase, 2.0 * M_PI);
+        spc = fabs(SAMPLES_PER_CYCLE -
+                   (FRAME_LEN / (CYCLES + (advance / (2.0 * M_PI)))));
+        if (spc > segment->spcError) {
+            segment->spcError = spc;
+        }
+    }
+    run->havePhase = true;
+    run->lastPhase = phase;
+}
+
+/*
+ *  ======== sweep ========
+ */
+static void sweep(Run *run)
+{
+    uint64_t total = (uint64_t)(run->seconds * IN_RATE);
+    uint64_t n = 0;
+    double phase;
+    double leakage;
+    uint32_t fixedCount = 0;
+    uint32_t i;
+    Segment *segment;
+    int_fast16_t s;
+
+    Resampler_init(&resampler, IN_RATE, SAMPLES_PER_CYCLE, frame, FRAME_LEN,
+                   frameComplete, run);
+
+    for (n = 0; (n + BLOCK_LEN) <= total; n += BLOCK_LEN) {
+        for (i = 0; i < BLOCK_LEN; i++) {
+            block[i] = input(run, n + i);
+            if ((i % (IN_RATE / 6400U)) == 0U) {
+                fixedFrame[fixedCount++] = block[i];
+            }
+        }
+
+        run->frequency = frequencyAt(run, (n + (BLOCK_LEN / 2U)) /
+                                          (double)IN_RATE);
+        Resampler_setFrequency(&resampler,
+                               (uint32_t)lrint(run->frequency * 1e6));
+        Resampler_process(&resampler, block, BLOCK_LEN);
+
+        if (fixedCount == FRAME_LEN) {
+            leakage = analyze(fixedFrame, &phase);
+            s = (int_fast16_t)((run->frequency - START_HZ) / SEGMENT_HZ);
+            segment = &run->segments[(s >= NUM_SEGMENTS) ?
+                                     (NUM_SEGMENTS - 1) : s];
+            if (leakage > segment->fixedLeakage) {
+                segment->fixedLeakage = leakage;
+            }
+            fixedCount = 0;
+        }
+    }
+}
+
+/*
+ *  ======== report ========
+ */
+static bool report(const Run *run, bool check)
+{
+    const Segment *segment;
+    bool pass = true;
+    bool ok;
+    uint_least8_t s;
+
+    printf("%-13s %6s %9s %9s %9s\n", "Hz", "frames", "spc err",
+           "leakage", "fixed");
+
+    for (s = 0; s < NUM_SEGMENTS; s++) {
+        segment = &run->segments[s];
+        ok = (segment->frames != 0U) && (segment->spcError <= SPC_LIMIT) &&
+             ((10.0 * log10(segment->leakage)) <= LEAKAGE_LIMIT_DB);
+        pass = pass && ok;
+
+        printf("%5.2f - %5.2f %6u %9.6f %9.1f %9.1f  %s\n",
+               START_HZ + (s * SEGMENT_HZ),
+               START_HZ + ((s + 1U) * SEGMENT_HZ), (unsigned)segment->frames,
+               segment->spcError, 10.0 * log10(segment->leakage),
+               10.0 * log10(segment->fixedLeakage),
+               check ? (ok ? "ok" : "FAIL") : "");
+    }
+
+    return (pass || !check);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 20.0;
+    Run run = {0};
+    bool pass;
+    uint32_t n;
+
+    if (seconds < (2.0 * NUM_SEGMENTS)) {
+        fprintf(stderr, "usage: %s [seconds], at least %d\n", argv[0],
+                2 * NUM_SEGMENTS);
+        return (2);
+    }
+
+    for (n = 0; n < FRAME_LEN; n++) {
+        cosTable[n] = cos((2.0 * M_PI * n) / FRAME_LEN);
+    }
+
+    printf("resampler chirp, %u S/s in, %u samples per cycle, %.0f to %.0f "
+           "Hz over %.0f s\n\n", IN_RATE, SAMPLES_PER_CYCLE, START_HZ,
+           STOP_HZ, seconds);
+
+    run.seconds = seconds;
+    sweep(&run);
+    pass = report(&run, true);
+
+    printf("\nwith a tone at %.0f Hz, %.0f dB below the fundamental, and "
+           "no anti-alias filter\n\n", ALIAS_HZ,
+           20.0 * log10(profile[0].level / ALIAS_LEVEL));
+
+    run = (Run){0};
+    run.seconds = seconds;
+    run.alias = true;
+    sweep(&run);
+    report(&run, false);
+
+    printf("\nspc err in samples, leakage and fixed in dB below the "
+           "fundamental\n%s\n", pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,348 @@
+/*
+ *  ======== ring_stress.c ========
+ *  Host stress test of the single-producer, single-consumer ring.
+ *
+ *  A producer thread and a consumer thread hammer one ring with every way
+ *  in and out of it, chosen at random per call: Ring_putByte()/
+ *  Ring_getByte() on byte rings, Ring_write()/Ring_read() of random
+ *  lengths, and Ring_reserve()/Ring_commit() and Ring_peek()/
+ *  Ring_release() of random parts of the contiguous run.  The producer
+ *  also takes back the newest elements with Ring_retract(), as the UART
+ *  receive interrupt does for a backspace, and writes them again.  The
+ *  element at position i of the stream has contents that only depend on
+ *  i, so the consumer checks every element it takes; an element taken
+ *  both by the consumer and by a retract is taken twice, and the count at
+ *  the end is off.  The consumer also checks Ring_count() never exceeds
+ *  the capacity, as it would with head below tail.  Three rings:
+ *
+ *      bytes       64 bytes, the shape of the uartstdio buffers
+ *      records     16 elements of 12 bytes, like a block queue
+ *      tiny        2 bytes, full or empty nearly all the time
+ *
+ *  The indices start just below 2^32, so every run also crosses the
+ *  wrap of the free-running counters.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/ring_stress [seconds per ring]
+ *
+ *  Output is one line per ring: elements passed, how often the producer
+ *  found it full and the consumer found it empty, the elements retracted,
+ *  the rate and the number of bad elements.  The exit status is non-zero if any check failed.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "ring.h"
+
+/* Largest element and longest Ring_write()/Ring_read() of one call */
+#define MAX_ELEM        (12U)
+#define MAX_BURST       (100U)
+
+/* Where the indices start */
+#define START_INDEX     (0xFFFFFF00U)
+
+typedef struct {
+    const char *name;
+    uint32_t    elemSize;
+    uint32_t    numElems;
+} Case;
+
+static const Case cases[] = {
+    {"bytes",   1U,  64U},
+    {"records", 12U, 16U},
+    {"tiny",    1U,  2U}
+};
+
+static uint8_t storage[64U * MAX_ELEM];
+static Ring_Object ring;
+static uint32_t elemSize;
+
+static volatile bool producing;
+static uint32_t produced;
+static uint32_t consumed;
+static uint32_t fullCount;
+static uint32_t emptyCount;
+static uint32_t retracted;
+static uint32_t errors;
+
+/*
+ *  ======== random32 ========
+ */
+static uint32_t random32(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return (*state);
+}
+
+/*
+ *  ======== fill ========
+ *  Contents of the element at stream position i.
+ */
+static void fill(uint8_t *elem, uint32_t i)
+{
+    uint32_t k;
+
+    for (k = 0; k < elemSize; k++) {
+        elem[k] = (uint8_t)((i * 2654435761U) >> (k % 4U * 8U)) ^ (uint8_t)k;
+    }
+}
+
+/*
+ *  ======== check ========
+ */
+static void check(const uint8_t *elem, uint32_t i)
+{
+    uint8_t want[MAX_ELEM];
+
+    fill(want, i);
+    if (memcmp(elem, want, elemSize) != 0) {
+        if (errors++ < 10U) {
+            fprintf(stderr, "FAIL: bad element %u\n", (unsigned)i);
+        }
+    }
+}
+
+/*
+ *  ======== produceThread ========
+ */
+static void *produceThread(void *arg)
+{
+    uint8_t buf[MAX_BURST * MAX_ELEM];
+    uint32_t state = 0x12345678U;
+    uint8_t *ptr;
+    uint32_t n;
+    uint32_t i;
+
+    (void)arg;
+
+    while (producing) {
+        /* Now and then take back a few of the newest */
+        if ((random32(&state) % 8U) == 0U) {
+            n = Ring_retract(&ring, 1U + (random32(&state) % 4U));
+            produced -= n;
+            retracted += n;
+        }
+
+        switch (random32(&state) % 3U) {
+            case 0:
+                if (elemSize == 1U) {
+                    fill(buf, produced);
+                    n = Ring_putByte(&ring, buf[0]) ? 1U : 0U;
+                }
+                else {
+                    n = Ring_reserve(&ring, (void **)&ptr);
+                    if (n != 0U) {
+                        fill(ptr, produced);
+                        Ring_commit(&ring, 1);
+                        n = 1U;
+                    }
+                }
+                break;
+
+            case 1:
+                n = 1U + (random32(&state) % MAX_BURST);
+                for (i = 0; i < n; i++) {
+                    fill(buf + (i * elemSize), produced + i);
+                }
+                n = Ring_write(&ring, buf, n);
+                break;
+
+            default:
+                n = Ring_reserve(&ring, (void **)&ptr);
+                if (n != 0U) {
+                    n = 1U + (random32(&state) % n);
+                    for (i = 0; i < n; i++) {
+                        fill(ptr + (i * elemSize), produced + i);
+                    }
+                    Ring_commit(&ring, n);
+                }
+                break;
+        }
+
+        /* Let the consumer in on a machine with one core */
+        if (n == 0U) {
+            fullCount++;
+            sched_yield();
+        }
+        produced += n;
+    }
+
+    return (NULL);
+}
+
+/*
+ *  ======== consume ========
+ *  One random call on the consumer side; returns the elements taken.
+ */
+static uint32_t consume(uint32_t *state)
+{
+    uint8_t buf[MAX_BURST * MAX_ELEM];
+    uint8_t *ptr;
+    uint32_t n;
+    uint32_t i;
+
+    switch (random32(state) % 3U) {
+        case 0:
+            if (elemSize == 1U) {
+                n = Ring_getByte(&ring, buf) ? 1U : 0U;
+            }
+            else {
+                n = Ring_read(&ring, buf, 1);
+            }
+            break;
+
+        case 1:
+            n = Ring_read(&ring, buf, 1U + (random32(state) % MAX_BURST));
+            break;
+
+        default:
+            n = Ring_peek(&ring, (void **)&ptr);
+            if (n != 0U) {
+                n = 1U + (random32(state) % n);
+                for (i = 0; i < n; i++) {
+                    check(ptr + (i * elemSize), consumed + i);
+                }
+                Ring_release(&ring, n);
+            }
+            return (n);
+    }
+
+    for (i = 0; i < n; i++) {
+        check(buf + (i * elemSize), consumed + i);
+    }
+
+    return (n);
+}
+
+/*
+ *  ======== runCase ========
+ */
+static bool runCase(const Case *c, double seconds)
+{
+    struct timespec start;
+    struct timespec t;
+    pthread_t producer;
+    uint32_t state = 0x9E3779B9U;
+    uint32_t n;
+    double elapsed;
+    bool pass;
+
+    elemSize = c->elemSize;
+    if (Ring_init(&ring, storage, c->elemSize, c->numElems) !=
+        Ring_STATUS_SUCCESS) {
+        fprintf(stderr, "FAIL: %s rejected\n", c->name);
+        return (false);
+    }
+    ring.head = START_INDEX;
+    ring.tail = START_INDEX;
+    ring.claim = START_INDEX;
+
+    produced = 0;
+    consumed = 0;
+    fullCount = 0;
+    emptyCount = 0;
+    retracted = 0;
+    errors = 0;
+
+    producing = true;
+    pthread_create(&producer, NULL, produceThread, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        if (Ring_count(&ring) > c->numElems) {
+            if (errors++ < 10U) {
+                fprintf(stderr, "FAIL: %u queued\n",
+                        (unsigned)Ring_count(&ring));
+            }
+        }
+        n = consume(&state);
+        if (n == 0U) {
+            emptyCount++;
+            sched_yield();
+        }
+        consumed += n;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        elapsed = (double)(t.tv_sec - start.tv_sec) +
+                  ((double)(t.tv_nsec - start.tv_nsec) * 1e-9);
+    } while (elapsed < seconds);
+
+    producing = false;
+    pthread_join(producer, NULL);
+
+    /* Take whatever is left */
+    while (Ring_count(&ring) != 0U) {
+        consumed += consume(&state);
+    }
+
+    pass = (errors == 0U) && (consumed == produced) &&
+           (ring.head == (START_INDEX + produced)) &&
+           (ring.tail == ring.head);
+
+    printf("%-8s %10u %9u %9u %9u %8.1f %6u %s\n", c->name,
+           (unsigned)consumed, (unsigned)fullCount, (unsigned)emptyCount,
+           (unsigned)retracted, (double)consumed / elapsed / 1e6,
+           (unsigned)errors,
+           pass ? "ok" : "FAIL");
+
+    return (pass);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 1.0;
+    uint8_t dummy[4];
+    void *ptr;
+    uint32_t failures = 0;
+    uint32_t i;
+
+    if (seconds <= 0.0) {
+        fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+        return (1);
+    }
+
+    /* Only powers of two are accepted */
+    if (Ring_init(&ring, dummy, 1, 3) != Ring_STATUS_ERROR) {
+        fprintf(stderr, "FAIL: 3 elements accepted\n");
+        failures++;
+    }
+
+    /* A retract takes back what was not read, and nothing peeked */
+    if ((Ring_init(&ring, storage, 1, 4) != Ring_STATUS_SUCCESS) ||
+        !Ring_putByte(&ring, 1) || !Ring_putByte(&ring, 2) ||
+        !Ring_putByte(&ring, 3) || !Ring_getByte(&ring, dummy) ||
+        (Ring_retract(&ring, 3) != 2U) || (Ring_count(&ring) != 0U) ||
+        !Ring_putByte(&ring, 4) || (Ring_peek(&ring, &ptr) != 1U) ||
+        (Ring_retract(&ring, 1) != 0U) || (Ring_count(&ring) != 1U)) {
+        fprintf(stderr, "FAIL: retract\n");
+        failures++;
+    }
+
+    printf("ring       elements      full     empty retracted  Melem/s    "
+           "bad\n");
+    for (i = 0; i < (sizeof(cases) / sizeof(cases[0])); i++) {
+        if (!runCase(&cases[i], seconds)) {
+            failures++;
+        }
+    }
+    printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+
+    return ((failures == 0U) ? 0 : 1);
+}
+
+#endif
@@ -0,0 +1,188 @@
+/*
+ *  ======== scheduler_sim.c ========
+ *  Host saturation harness for the pipelined scheduler.
+ *
+ *  Replays frame arrivals through the host stand-in of the acquisition at
+ *  increasing frame rates, with a synthetic per-channel job of fixed cost
+ *  on top of the real de-interleave, and reports where the scheduler
+ *  starts missing deadlines, dropping frames or overrunning.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/scheduler_sim [channels] [jobMicroseconds] [frameLen] \
+ *          [seconds]
+ *
+ *  Output is one line per rate: frame rate, frames, misses, dropped,
+ *  overruns, utilization and the sustainable rate measured at that load.
+ *  Run it on a machine with at least two cores, or the stand-in thread and
+ *  the polling loop preempt each other and the saturation point is
+ *  understated.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "acquire.h"
+#include "ingest.h"
+#include "scheduler.h"
+
+#define MAX_FRAME_LEN   (4096)
+
+/* Bisection steps between the last good and first failing rate */
+#define BISECT_STEPS    (4)
+
+static uint16_t buffer[Acquire_BUFFER_LEN(MAX_FRAME_LEN,
+                                          Acquire_MAX_CHANNELS)];
+static Precision_Sample frames[Acquire_MAX_CHANNELS][MAX_FRAME_LEN]
+    __attribute__((aligned(4)));
+static Ingest_Object ingest[Acquire_MAX_CHANNELS];
+static Acquire_Object acquire;
+static Scheduler_Object scheduler;
+static Channels_Config channels[Acquire_MAX_CHANNELS];
+static long jobNs;
+
+/*
+ *  ======== source ========
+ *  Full-scale ramp per channel.
+ */
+static void source(uint_least8_t channel, uint16_t *dst, uint16_t numSamples,
+                   uint16_t stride, void *arg)
+{
+    static uint32_t phase[Acquire_MAX_CHANNELS];
+    uint16_t i;
+
+    (void)arg;
+
+    for (i = 0; i < numSamples; i++) {
+        dst[(uint32_t)i * stride] = phase[channel]++ & 0xFFFU;
+    }
+}
+
+/*
+ *  ======== job ========
+ */
+static void job(int_fast8_t frame, uint_least8_t channel, void *arg)
+{
+    struct timespec start;
+    struct timespec t;
+
+    (void)arg;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    Ingest_deinterleave(&ingest[channel],
+                        Acquire_samples(&acquire, frame, channel),
+                        Acquire_stride(&acquire, channel), frames[channel],
+                        acquire.frameLen);
+
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &t);
+    } while ((((t.tv_sec - start.tv_sec) * 1000000000L) +
+              (t.tv_nsec - start.tv_nsec)) < jobNs);
+}
+
+/*
+ *  ======== runAt ========
+ *  Returns true if the rate was sustained without any fault.
+ */
+static int runAt(uint_least8_t numChannels, uint16_t frameLen,
+                 uint32_t frameRate, double seconds)
+{
+    Scheduler_Stats stats;
+    struct timespec start;
+    struct timespec t;
+    uint_least8_t k;
+
+    for (k = 0; k < numChannels; k++) {
+        Ingest_init(&ingest[k], Ingest_DC_SHIFT_DEFAULT);
+    }
+
+    if (Acquire_init(&acquire, channels, numChannels, buffer, frameLen,
+                     frameRate * frameLen, 0, NULL, NULL) !=
+        Acquire_STATUS_SUCCESS) {
+        printf("%8u  rate not supported by the ADC\n", (unsigned)frameRate);
+        return (0);
+    }
+    Acquire_setSource(&acquire, source, NULL);
+    Scheduler_init(&scheduler, &acquire, 0, job, NULL);
+    Acquire_start(&acquire);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        Scheduler_poll(&scheduler);
+        clock_gettime(CLOCK_MONOTONIC, &t);
+    } while (((double)(t.tv_sec - start.tv_sec) +
+              ((double)(t.tv_nsec - start.tv_nsec) * 1e-9)) < seconds);
+
+    Acquire_stop(&acquire);
+    Scheduler_getStats(&scheduler, &stats);
+
+    printf("%8u %8u %8u %8u %8u %7u%% %8u\n", (unsigned)frameRate,
+           (unsigned)stats.frames, (unsigned)stats.misses,
+           (unsigned)stats.dropped, (unsigned)stats.overruns,
+           (unsigned)stats.utilization, (unsigned)stats.maxFrameRate);
+
+    return ((stats.misses == 0) && (stats.dropped == 0) &&
+            (stats.overruns == 0));
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint_least8_t numChannels = (argc > 1) ? (uint_least8_t)atoi(argv[1]) : 7;
+    long jobUs = (argc > 2) ? atol(argv[2]) : 100;
+    uint16_t frameLen = (argc > 3) ? (uint16_t)atoi(argv[3]) : 256;
+    double seconds = (argc > 4) ? atof(argv[4]) : 1.0;
+    uint32_t rate;
+    uint32_t lastGood = 0;
+    uint32_t firstBad;
+    uint_least8_t k;
+
+    if ((numChannels == 0) || (numChannels > Acquire_MAX_CHANNELS) ||
+        (frameLen > MAX_FRAME_LEN)) {
+        fprintf(stderr, "unsupported configuration\n");
+        return (1);
+    }
+
+    jobNs = jobUs * 1000L;
+    for (k = 0; k < numChannels; k++) {
+        channels[k].adc = k & 1U;
+        channels[k].ain = k;
+    }
+
+    printf("channels %u, job %ld us, frame %u samples\n",
+           (unsigned)numChannels, jobUs, (unsigned)frameLen);
+    printf("    rate   frames   misses  dropped overruns    util  sustain\n");
+
+    /* Double the rate until the first fault, then bisect */
+    for (rate = 10; rate < 1000000; rate *= 2) {
+        if (!runAt(numChannels, frameLen, rate, seconds)) {
+            break;
+        }
+        lastGood = rate;
+    }
+
+    firstBad = rate;
+    for (k = 0; (k < BISECT_STEPS) && (lastGood != 0); k++) {
+        rate = (lastGood + firstBad) / 2U;
+        if (runAt(numChannels, frameLen, rate, seconds)) {
+            lastGood = rate;
+        }
+        else {
+            firstBad = rate;
+        }
+    }
+
+    printf("saturation between %u and %u frames/s\n", (unsigned)lastGood,
+           (unsigned)firstBad);
+
+    return (0);
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,246 @@
+/*
+ *  ======== sdft_drift.c ========
+ *  Long-run drift of the sliding DFT (sdft.h) with and without
+ *  re-anchoring.
+ *
+ *  Two trackers see the same q15 samples through Sdft_update(), one
+ *  re-anchored at the end of every window as in main_nortos.c and one with
+ *  Sdft_ANCHOR_NONE, whose recursive state runs free.  The input is a mains
+ *  cycle a little off the fundamental bin, with the 3rd, 5th and 7th
+ *  harmonics and a dither of two LSB, so the rounding errors do not repeat
+ *  from window to window.
+ *
+ *  At every check the phasors of both are compared with the DFT of the
+ *  same window of samples in double.  The error of a check is the largest
+ *  over all bins, full scale 1.0, and the table gives the rms and the
+ *  largest of them since the previous row.  The rows are 10^5, 10^6 ...
+ *  samples up to the end of the run.  The free tracker drifts: the rounded
+ *  rotation is not exactly of unit length, and the rounding of every step
+ *  stays in the state.  The anchored one starts over from a direct sum
+ *  every window, so its error is that of the q15 cosine table and of at
+ *  most one window of rounding, however long the run.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/sdft_drift [samples] [checkInterval]
+ *
+ *  samples (default 10^8) and the samples between checks (default 10^4).
+ *  Fails, with a non-zero exit status, if an anchored error is over
+ *  ANCHORED_LIMIT, or the anchored rms error of a row over twice that of
+ *  the first row.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arm_math.h"
+
+#include "sdft.h"
+
+#define WIN_LEN         (1024U)
+#define FUNDAMENTAL_BIN (8U)
+#define NUM_HARMONICS   (13U)
+
+/* Cycles per window of the input, a little off FUNDAMENTAL_BIN */
+#define CYCLES          (8.03)
+
+/* Largest anchored error allowed, an eighth of a q15 LSB */
+#define ANCHORED_LIMIT  (1.0 / (8.0 * 32768.0))
+
+typedef struct {
+    uint32_t checks;
+    double   sumSquares;
+    double   max;
+} Row;
+
+static q15_t historyAnchored[WIN_LEN];
+static q15_t historyFree[WIN_LEN];
+static q15_t cosTable[WIN_LEN];
+static uint16_t bins[NUM_HARMONICS];
+static q31_t phasors[2 * NUM_HARMONICS];
+static double refRe[NUM_HARMONICS];
+static double refIm[NUM_HARMONICS];
+
+static Sdft_Object anchored;
+static Sdft_Object drifting;
+
+static uint32_t state = 12345U;
+
+/*
+ *  ======== sample ========
+ *  Sample n of the input.  The phase is kept within a cycle, so it stays
+ *  exact over the whole run.
+ */
+static q15_t sample(uint64_t n)
+{
+    double phase = 2.0 * M_PI * fmod((double)n * (CYCLES / WIN_LEN), 1.0);
+    double x;
+    long code;
+
+    state = (state * 1664525U) + 1013904223U;
+
+    x = (0.8 * sin(phase)) + (0.05 * sin((3.0 * phase) + 0.4)) +
+        (0.03 * sin((5.0 * phase) + 1.3)) + (0.02 * sin((7.0 * phase) + 2.1));
+    code = lrint((x * 32768.0) + (((state >> 8) / 16777216.0) * 4.0) - 2.0);
+
+    return ((q15_t)((code > 32767) ? 32767 : ((code < -32768) ? -32768 :
+                                               code)));
+}
+
+/*
+ *  ======== reference ========
+ *  DFT / N in double of the window the trackers hold, the oldest sample
+ *  at index 0 as in sdft.c.
+ */
+static void reference(const Sdft_Object *obj)
+{
+    double x;
+    double w;
+    uint32_t m;
+    uint_least8_t k;
+
+    for (k = 0; k < NUM_HARMONICS; k++) {
+        refRe[k] = 0.0;
+        refIm[k] = 0.0;
+        w = 2.0 * M_PI * bins[k] / WIN_LEN;
+
+        for (m = 0; m < WIN_LEN; m++) {
+            x = obj->history[(obj->pos + m) & (WIN_LEN - 1U)] / 32768.0;
+            refRe[k] += x * cos(w * m);
+            refIm[k] -= x * sin(w * m);
+        }
+
+        refRe[k] /= WIN_LEN;
+        refIm[k] /= WIN_LEN;
+    }
+}
+
+/*
+ *  ======== error ========
+ *  Largest distance between the phasors of obj and the reference.
+ */
+static double error(const Sdft_Object *obj)
+{
+    double worst = 0.0;
+    double re;
+    double im;
+    uint_least8_t k;
+
+    Sdft_getPhasors(obj, phasors);
+
+    for (k = 0; k < NUM_HARMONICS; k++) {
+        re = (phasors[2U * k] / 2147483648.0) - refRe[k];
+        im = (phasors[(2U * k) + 1U] / 2147483648.0) - refIm[k];
+        if (hypot(re, im) > worst) {
+            worst = hypot(re, im);
+        }
+    }
+
+    return (worst);
+}
+
+/*
+ *  ======== add ========
+ */
+static void add(Row *row, double e)
+{
+    row->checks++;
+    row->sumSquares += e * e;
+    if (e > row->max) {
+        row->max = e;
+    }
+}
+
+/*
+ *  ======== rms ========
+ */
+static double rms(const Row *row)
+{
+    return ((row->checks != 0U) ? sqrt(row->sumSquares / row->checks) : 0.0);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint64_t samples = (argc > 1) ? strtoull(argv[1], NULL, 0) : 100000000U;
+    uint64_t interval = (argc > 2) ? strtoull(argv[2], NULL, 0) : 10000U;
+    uint64_t end = 100000U;
+    uint64_t n;
+    Row anchoredRow = {0};
+    Row freeRow = {0};
+    double first = -1.0;
+    bool pass = true;
+    bool ok;
+    uint_least8_t k;
+    q15_t x;
+
+    if ((samples < end) || (interval == 0U) || (interval > end)) {
+        fprintf(stderr, "usage: %s [samples] [checkInterval]\n", argv[0]);
+        return (2);
+    }
+
+    for (k = 0; k < NUM_HARMONICS; k++) {
+        bins[k] = (uint16_t)(FUNDAMENTAL_BIN * (k + 1U));
+    }
+    if ((Sdft_init(&anchored, WIN_LEN, bins, NUM_HARMONICS, 1,
+                   historyAnchored, cosTable) != Sdft_STATUS_SUCCESS) ||
+        (Sdft_init(&drifting, WIN_LEN, bins, NUM_HARMONICS, Sdft_ANCHOR_NONE,
+                   historyFree, cosTable) != Sdft_STATUS_SUCCESS)) {
+        fprintf(stderr, "invalid sliding DFT configuration\n");
+        return (2);
+    }
+
+    printf("sdft drift, %u-sample window, bins %u to %u, %llu samples, "
+           "checked every %llu\n\n", WIN_LEN, bins[0],
+           bins[NUM_HARMONICS - 1U], (unsigned long long)samples,
+           (unsigned long long)interval);
+    printf("%12s %11s %11s %11s %11s\n", "samples", "anchored", "max",
+           "free", "max");
+
+    for (n = 1; n <= samples; n++) {
+        x = sample(n - 1U);
+        Sdft_update(&anchored, x);
+        Sdft_update(&drifting, x);
+
+        /* Check from the second window on, once the history is full */
+        if ((n > (2U * WIN_LEN)) &&
+            (((n % interval) == 0U) || (n == end) || (n == samples))) {
+            reference(&anchored);
+            add(&anchoredRow, error(&anchored));
+            add(&freeRow, error(&drifting));
+        }
+
+        if ((n != end) && (n != samples)) {
+            continue;
+        }
+
+        if (first < 0.0) {
+            first = rms(&anchoredRow);
+        }
+        ok = (anchoredRow.max <= ANCHORED_LIMIT) &&
+             (rms(&anchoredRow) <= (2.0 * first));
+        pass = pass && ok;
+
+        printf("%12llu %11.3e %11.3e %11.3e %11.3e  %s\n",
+               (unsigned long long)n, rms(&anchoredRow), anchoredRow.max,
+               rms(&freeRow), freeRow.max, ok ? "ok" : "FAIL");
+
+        anchoredRow = (Row){0};
+        freeRow = (Row){0};
+        end = (end > (samples / 10U)) ? samples : (end * 10U);
+    }
+
+    printf("\nrms and largest error since the previous row, full scale "
+           "1.0\n%s\n", pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,133 @@
+/*
+ *  ======== spectrum_test.c ========
+ *  Host test of the spectrum stage (spectrum.h) on the recorded test
+ *  waveform against a DFT in double.
+ *
+ *  The frame is TestWave_bbx, one cycle of 1024 codes, converted by
+ *  Ingest_convert() as main_nortos.c does with SIGNAL_SOURCE_TABLE.  It
+ *  goes through Spectrum_transform() and Spectrum_magnitude() with the
+ *  rectangular window, in the precision selected by PRECISION.  The
+ *  reference is the DFT of the same samples, centered codes / 2048, in
+ *  double: |X[k]| / N for every bin 0 to N/2.
+ *
+ *  The table lists the bins whose reference is above LIST_LEVEL, the
+ *  harmonics of the cycle, with both magnitudes and their difference; the
+ *  summary gives the largest and rms difference over all N/2 + 1 bins, in
+ *  full scale 1.0.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/spectrum_test_q15
+ *
+ *  Fails, with a non-zero exit status, if any bin is off by more than
+ *  BIN_LIMIT of full scale: 5e-4, about 8 LSB of the 2.14 magnitude, in
+ *  q15, and 1e-6 in q31 and f32.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "ingest.h"
+#include "spectrum.h"
+#include "testwave.h"
+
+#define FFT_LEN         (TestWave_LEN)
+#define NUM_BINS        (Spectrum_NUM_BINS(FFT_LEN))
+
+/* Bins listed in the table, full scale 1.0 */
+#define LIST_LEVEL      (1e-3)
+
+/* Largest difference of a bin allowed, full scale 1.0 */
+#if (PRECISION == PRECISION_Q15)
+#define BIN_LIMIT       (5e-4)
+#else
+#define BIN_LIMIT       (1e-6)
+#endif
+
+static Precision_Sample frame[FFT_LEN];
+static Precision_Sample work[Spectrum_WORK_LEN(FFT_LEN)];
+static Precision_Sample mag[NUM_BINS];
+static double reference[NUM_BINS];
+static Spectrum_Object spectrum;
+static Ingest_Object ingest;
+
+/*
+ *  ======== dft ========
+ *  |X[k]| / N of the centered codes for bins 0 to N/2.
+ */
+static void dft(void)
+{
+    double x;
+    double re;
+    double im;
+    double w;
+    uint32_t k;
+    uint32_t n;
+
+    for (k = 0; k < NUM_BINS; k++) {
+        re = 0.0;
+        im = 0.0;
+        for (n = 0; n < FFT_LEN; n++) {
+            x = ((double)TestWave_bbx[n] - Ingest_ADC_OFFSET) / 2048.0;
+            w = (2.0 * M_PI * (double)((k * n) % FFT_LEN)) / FFT_LEN;
+            re += x * cos(w);
+            im -= x * sin(w);
+        }
+        reference[k] = sqrt((re * re) + (im * im)) / FFT_LEN;
+    }
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    double diff;
+    double worst = 0.0;
+    double sumSquares = 0.0;
+    uint32_t worstBin = 0;
+    uint32_t k;
+    bool pass;
+
+    if (Spectrum_init(&spectrum, FFT_LEN, work) != Spectrum_STATUS_SUCCESS) {
+        fprintf(stderr, "fftLen %u not supported\n", FFT_LEN);
+        return (2);
+    }
+
+    Ingest_init(&ingest, Ingest_DC_SHIFT_DEFAULT);
+    Ingest_convert(&ingest, TestWave_bbx, frame, FFT_LEN);
+    Spectrum_transform(&spectrum, frame);
+    Spectrum_magnitude(&spectrum, mag);
+    dft();
+
+    printf("spectrum test, %s, TestWave_bbx, %u points, rectangular\n\n",
+           Precision_NAME, FFT_LEN);
+    printf("%5s %12s %12s %12s\n", "bin", "reference", "spectrum",
+           "difference");
+
+    for (k = 0; k < NUM_BINS; k++) {
+        diff = (double)Spectrum_MAG_TO_FLOAT(mag[k]) - reference[k];
+        sumSquares += diff * diff;
+        if (fabs(diff) > worst) {
+            worst = fabs(diff);
+            worstBin = k;
+        }
+        if (reference[k] > LIST_LEVEL) {
+            printf("%5u %12.7f %12.7f %12.3e\n", (unsigned)k, reference[k],
+                   (double)Spectrum_MAG_TO_FLOAT(mag[k]), diff);
+        }
+    }
+
+    pass = (worst <= BIN_LIMIT);
+    printf("\nbins 0 to %u: largest difference %.3e at bin %u, rms %.3e, "
+           "limit %.0e\n%s\n", NUM_BINS - 1U, worst, (unsigned)worstBin,
+           sqrt(sumSquares / NUM_BINS), BIN_LIMIT, pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
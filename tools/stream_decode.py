@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+#
+#  ======== stream_decode.py ========
+#  Unpacks the raw sample blocks of stream.c into CSV.
+#
+#  Usage: python3 tools/stream_decode.py [capture|serial port] [baud]
+#
+#  Reads a raw capture file, a serial port (needs pyserial; opened with
+#  RTS/CTS flow control at 3 Mbaud unless a baud rate is given) or stdin
+#  when no argument is given, and prints one CSV line per valid block:
+#
+#      sequence,channel,first_index,code0,code1,...
+#
+#  The codes are the raw 12-bit ADC values.  At the end, stderr gets the
+#  number of blocks, the blocks the device dropped because the link fell
+#  behind, the blocks lost on the wire (sequence gaps the device did not
+#  report) and the damaged blocks.  The host build of stream.c writes to a
+#  pseudo-terminal, whose path can be given as the serial port.
+#
+#  The block layout is described in stream.h.
+#
+import struct
+import sys
+
+from telemetry_decode import crc16
+
+SYNC = 0xA55A
+HEADER = struct.Struct('<HBBIHHI')
+MAX_SAMPLES = 512
+
+
+def block_len(count):
+    return HEADER.size + 3 * ((count + 1) // 2) + 2
+
+
+def unpack(data, count):
+    codes = []
+    for i in range(0, 3 * ((count + 1) // 2), 3):
+        a, b, c = data[i:i + 3]
+        codes.append(a | (b & 0x0F) << 8)
+        codes.append(b >> 4 | c << 4)
+    return codes[:count]
+
+
+def blocks(stream, live, stats):
+    # Resynchronize on the sync word; a bad block gives up one byte
+    pending = b''
+    while True:
+        chunk = stream.read(65536)
+        if not chunk:
+            if live:
+                continue
+            break
+        pending += chunk
+        start = 0
+        while len(pending) - start >= HEADER.size:
+            (sync, channel, _, sequence, dropped, count,
+             first) = HEADER.unpack_from(pending, start)
+            if sync != SYNC or count > MAX_SAMPLES:
+                start += 1
+                continue
+            end = start + block_len(count)
+            if end > len(pending):
+                break
+            (crc,) = struct.unpack_from('<H', pending, end - 2)
+            if crc16(pending[start:end - 2]) != crc:
+                stats['damaged'] += 1
+                start += 1
+                continue
+            yield (sequence, channel, dropped, first,
+                   unpack(pending[start + HEADER.size:end - 2], count))
+            start = end
+        pending = pending[start:]
+
+
+def main(argv):
+    if len(argv) > 1 and (argv[1].startswith('/dev/') or
+                          argv[1].upper().startswith('COM')):
+        import serial
+        stream = serial.Serial(argv[1], int(argv[2]) if len(argv) > 2
+                               else 3000000, rtscts=True, timeout=0.1)
+        live = True
+    elif len(argv) > 1:
+        stream = open(argv[1], 'rb')
+        live = False
+    else:
+        stream = sys.stdin.buffer
+        live = False
+
+    out = sys.stdout
+    stats = {'blocks': 0, 'dropped': 0, 'lost': 0, 'damaged': 0}
+    expected = None
+    try:
+        for sequence, channel, dropped, first, codes in blocks(stream, live,
+                                                               stats):
+            if expected is not None:
+                stats['lost'] += (sequence - expected - dropped) & 0xFFFFFFFF
+            expected = (sequence + 1) & 0xFFFFFFFF
+            stats['blocks'] += 1
+            stats['dropped'] += dropped
+            out.write('%d,%d,%d,%s\n' % (sequence, channel, first,
+                                         ','.join(map(str, codes))))
+    except KeyboardInterrupt:
+        pass
+
+    sys.stderr.write('%(blocks)d blocks, %(dropped)d dropped by the device, '
+                     '%(lost)d lost on the link, %(damaged)d damaged\n'
+                     % stats)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
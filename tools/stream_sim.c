@@ -0,0 +1,426 @@
+/*
+ *  ======== stream_sim.c ========
+ *  Host test of the raw sample stream against a pseudo-terminal.
+ *
+ *  Runs the host stand-in of the acquisition at 51.2 kS/s per channel and
+ *  streams every frame through stream.c, whose host build writes the
+ *  blocks to a pseudo-terminal at the configured baud rate.  A reader
+ *  thread on the other side of the terminal parses the blocks, optionally
+ *  reading no faster than a given byte rate to play a receiver that holds
+ *  CTS.  Four loads:
+ *
+ *      light       2 channels at 3 Mbaud, an eager reader: nothing may
+ *                  be dropped on the ring
+ *      skip        as light, but every SKIP_EVERY-th frame is not written,
+ *                  as if the scheduler had dropped it
+ *      overload    4 channels at 1 Mbaud: the link falls behind the ADC
+ *      stall       2 channels at 3 Mbaud, a reader taking 40 kB/s
+ *
+ *  Frames are written with the index of their first sample from
+ *  Acquire_frameNumber(), so a frame the scheduler drops on a busy host
+ *  is counted as skipped blocks, not sent under the wrong index.  Every
+ *  load checks that the skipped blocks are exactly those of the frames
+ *  the job missed, injected or not, so the result does not depend on the
+ *  timing of the host.
+ *
+ *  Checked for every block: the CRC, the sequence number against the last
+ *  one plus the drop count, and every sample against the source at its
+ *  index.  After the run every block produced must have been received or
+ *  counted as dropped; drops after the last queued block have no block
+ *  to report them.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/stream_sim [seconds]
+ *
+ *  Output is one line per load: blocks produced, received, dropped and,
+ *  of those, skipped, CRC errors, sequence errors, sample errors and the payload rate.  The
+ *  exit status is non-zero if any check failed.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "acquire.h"
+#include "scheduler.h"
+#include "stream.h"
+#include "telemetry.h"
+#include "uartstdio.h"
+
+#define FRAME_LEN       (1024U)
+#define SAMPLE_RATE     (51200U)
+#define MAX_CHANNELS    (4U)
+
+/* Longest wait for the last blocks after the acquisition stops */
+#define DRAIN_MS        (5000)
+
+/* Bytes of the header before the samples */
+#define HEADER_LEN      (16U)
+
+/* Blocks of one channel and frame */
+#define FRAME_BLOCKS    \
+    ((FRAME_LEN + Stream_BLOCK_SAMPLES - 1U) / Stream_BLOCK_SAMPLES)
+
+/* Frames of the skip load not written: one in SKIP_EVERY */
+#define SKIP_EVERY      (5U)
+
+typedef struct {
+    const char *name;
+    uint32_t    baudRate;
+    uint32_t    numChannels;
+    uint32_t    readRate;       /* Bytes per second, 0 for no limit */
+    uint32_t    skipEvery;      /* Frames, 0 to write every frame */
+    bool        mayDrop;        /* The ring may be full */
+} Load;
+
+static const Load loads[] = {
+    {"light",    3000000U, 2U, 0U,     0U,         false},
+    {"skip",     3000000U, 2U, 0U,     SKIP_EVERY, false},
+    {"overload", 1000000U, 4U, 0U,     0U,         true},
+    {"stall",    3000000U, 2U, 40000U, 0U,         true}
+};
+
+static uint16_t buffer[Acquire_BUFFER_LEN(FRAME_LEN, MAX_CHANNELS)];
+static Channels_Config channels[MAX_CHANNELS];
+static Acquire_Object acquire;
+static Scheduler_Object scheduler;
+static Stream_Object stream;
+
+/* Next source index per channel */
+static uint32_t sourceIndex[MAX_CHANNELS];
+
+/* Job state: frames not written, next frame number per channel */
+static uint32_t skipEvery;
+static uint32_t injected;
+static uint32_t missedBlocks;
+static uint32_t nextFrame[MAX_CHANNELS];
+
+/* Reader state and results */
+static volatile bool reading;
+static uint32_t readRate;
+static uint64_t received;       /* Bytes */
+static uint32_t blocks;
+static uint32_t droppedSeen;
+static uint32_t crcErrors;
+static uint32_t sequenceErrors;
+static uint32_t sampleErrors;
+static uint32_t nextSequence;
+
+/*
+ *  ======== UARTwrite ========
+ *  telemetry.c is linked for its CRC only; there is no console.
+ */
+int UARTwrite(const char *pcBuf, uint32_t ui32Len)
+{
+    (void)pcBuf;
+
+    return ((int)ui32Len);
+}
+
+/*
+ *  ======== code ========
+ *  Raw code of a channel at a sample index.
+ */
+static uint32_t code(uint_least8_t channel, uint32_t index)
+{
+    return (((index * 7U) + (channel * 1000U)) & 0xFFFU);
+}
+
+/*
+ *  ======== source ========
+ */
+static void source(uint_least8_t channel, uint16_t *dst, uint16_t numSamples,
+                   uint16_t stride, void *arg)
+{
+    uint16_t i;
+
+    (void)arg;
+
+    for (i = 0; i < numSamples; i++) {
+        dst[(uint32_t)i * stride] = code(channel, sourceIndex[channel]++);
+    }
+}
+
+/*
+ *  ======== job ========
+ *  Write the frame unless it is one the skip load leaves out, and count
+ *  the blocks of the frames missed before it, for the check against
+ *  Stream_getStats().
+ */
+static void job(int_fast8_t frame, uint_least8_t channel, void *arg)
+{
+    uint32_t number = Acquire_frameNumber(&acquire, frame);
+
+    (void)arg;
+
+    if ((skipEvery != 0U) && ((number % skipEvery) == (skipEvery - 1U))) {
+        if (channel == 0) {
+            injected++;
+        }
+        return;
+    }
+
+    missedBlocks += (number - nextFrame[channel]) * FRAME_BLOCKS;
+    nextFrame[channel] = number + 1U;
+
+    Stream_write(&stream, channel, number * acquire.frameLen,
+                 Acquire_samples(&acquire, frame, channel),
+                 Acquire_stride(&acquire, channel), acquire.frameLen);
+}
+
+/*
+ *  ======== get16 ========
+ */
+static uint32_t get16(const uint8_t *p)
+{
+    return ((uint32_t)p[0] | ((uint32_t)p[1] << 8));
+}
+
+/*
+ *  ======== get32 ========
+ */
+static uint32_t get32(const uint8_t *p)
+{
+    return (get16(p) | (get16(p + 2) << 16));
+}
+
+/*
+ *  ======== checkBlock ========
+ */
+static void checkBlock(const uint8_t *b)
+{
+    uint_least8_t channel = b[2];
+    uint32_t sequence = get32(b + 4);
+    uint32_t dropped = get16(b + 8);
+    uint32_t numSamples = get16(b + 10);
+    uint32_t first = get32(b + 12);
+    const uint8_t *p = b + HEADER_LEN;
+    uint32_t a;
+    uint32_t c;
+    uint32_t i;
+
+    if ((blocks != 0U) && (sequence != (nextSequence + dropped))) {
+        sequenceErrors++;
+    }
+    nextSequence = sequence + 1U;
+    droppedSeen += dropped;
+    blocks++;
+
+    for (i = 0; i < numSamples; i += 2U) {
+        a = p[0] | ((uint32_t)(p[1] & 0x0FU) << 8);
+        c = (p[1] >> 4) | ((uint32_t)p[2] << 4);
+        p += 3;
+
+        if (a != code(channel, first + i)) {
+            sampleErrors++;
+        }
+        if (((i + 1U) < numSamples) && (c != code(channel, first + i + 1U))) {
+            sampleErrors++;
+        }
+    }
+}
+
+/*
+ *  ======== readThread ========
+ *  Receiver on the slave side: find the sync word, wait for the whole
+ *  block, check its CRC.  A bad block gives up its first byte only.
+ */
+static void *readThread(void *arg)
+{
+    static uint8_t buf[4 * Stream_BLOCK_LEN(Stream_BLOCK_SAMPLES)];
+    struct termios tio;
+    struct timespec start;
+    struct timespec now;
+    size_t fill = 0;
+    size_t len;
+    double elapsed;
+    ssize_t n;
+    int fd;
+
+    fd = open((const char *)arg, O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+        perror("open");
+        return (NULL);
+    }
+    tcgetattr(fd, &tio);
+    cfmakeraw(&tio);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 1;
+    tcsetattr(fd, TCSANOW, &tio);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (reading) {
+        /* A slow reader takes no more than readRate bytes per second */
+        if (readRate != 0U) {
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            elapsed = (double)(now.tv_sec - start.tv_sec) +
+                      ((double)(now.tv_nsec - start.tv_nsec) * 1e-9);
+            if ((double)received > (elapsed * readRate)) {
+                usleep(1000);
+                continue;
+            }
+        }
+
+        n = read(fd, buf + fill, (readRate != 0U) ? 256U :
+                 (sizeof(buf) - fill));
+        if (n <= 0) {
+            continue;
+        }
+        fill += (size_t)n;
+        received += (uint64_t)n;
+
+        while (fill >= 2U) {
+            if (get16(buf) != Stream_SYNC) {
+                memmove(buf, buf + 1, --fill);
+                continue;
+            }
+            if (fill < HEADER_LEN) {
+                break;
+            }
+            len = Stream_BLOCK_LEN(get16(buf + 10));
+            if ((get16(buf + 10) > Stream_BLOCK_SAMPLES) ||
+                ((fill >= len) &&
+                 (Telemetry_crc16(buf, len - 2U) != get16(buf + len - 2U)))) {
+                crcErrors++;
+                memmove(buf, buf + 1, --fill);
+                continue;
+            }
+            if (fill < len) {
+                break;
+            }
+
+            checkBlock(buf);
+            fill -= len;
+            memmove(buf, buf + len, fill);
+        }
+    }
+
+    close(fd);
+
+    return (NULL);
+}
+
+/*
+ *  ======== runLoad ========
+ */
+static bool runLoad(const Load *load, double seconds)
+{
+    Stream_Stats stats;
+    struct timespec start;
+    struct timespec t;
+    pthread_t reader;
+    uint_least8_t k;
+    bool pass;
+    int ms;
+
+    for (k = 0; k < load->numChannels; k++) {
+        channels[k].adc = k & 1U;
+        channels[k].ain = k;
+        sourceIndex[k] = 0;
+        nextFrame[k] = 0;
+    }
+
+    received = 0;
+    blocks = 0;
+    droppedSeen = 0;
+    crcErrors = 0;
+    sequenceErrors = 0;
+    sampleErrors = 0;
+    readRate = load->readRate;
+    skipEvery = load->skipEvery;
+    injected = 0;
+    missedBlocks = 0;
+
+    if (Stream_init(&stream, load->baudRate, 0) != Stream_STATUS_SUCCESS) {
+        fprintf(stderr, "no pseudo-terminal\n");
+        return (false);
+    }
+    reading = true;
+    pthread_create(&reader, NULL, readThread, stream.port);
+
+    Acquire_init(&acquire, channels, (uint_least8_t)load->numChannels,
+                 buffer, FRAME_LEN, SAMPLE_RATE, 0, NULL, NULL);
+    Acquire_setSource(&acquire, source, NULL);
+    Scheduler_init(&scheduler, &acquire, 0, job, NULL);
+    Acquire_start(&acquire);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do {
+        Scheduler_poll(&scheduler);
+        clock_gettime(CLOCK_MONOTONIC, &t);
+    } while (((double)(t.tv_sec - start.tv_sec) +
+              ((double)(t.tv_nsec - start.tv_nsec) * 1e-9)) < seconds);
+    Acquire_stop(&acquire);
+
+    /* Let the link and the reader catch up with the last block */
+    for (ms = 0; ms < DRAIN_MS; ms++) {
+        Stream_getStats(&stream, &stats);
+        if ((stats.sent == stream.queue.head) &&
+            (received == stats.bytes)) {
+            break;
+        }
+        usleep(1000);
+    }
+    usleep(100000);
+
+    reading = false;
+    pthread_join(reader, NULL);
+    Stream_close(&stream);
+    Stream_getStats(&stream, &stats);
+
+    pass = (crcErrors == 0U) && (sequenceErrors == 0U) &&
+           (sampleErrors == 0U) && (received == stats.bytes) &&
+           (blocks == stats.sent) && (droppedSeen <= stats.dropped) &&
+           ((blocks + stats.dropped) == stats.blocks) &&
+           (stats.skipped == missedBlocks) &&
+           ((skipEvery == 0U) || (injected != 0U)) &&
+           (load->mayDrop || (stats.dropped == stats.skipped));
+
+    printf("%-9s %7u %7u %7u %7u %7u %7u %7u %7.1f %s\n", load->name,
+           (unsigned)stats.blocks, (unsigned)blocks, (unsigned)stats.dropped,
+           (unsigned)stats.skipped,
+           (unsigned)crcErrors, (unsigned)sequenceErrors,
+           (unsigned)sampleErrors, (double)received / seconds / 1000.0,
+           pass ? "ok" : "FAIL");
+
+    return (pass);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    double seconds = (argc > 1) ? atof(argv[1]) : 2.0;
+    uint32_t failures = 0;
+    uint32_t i;
+
+    if (seconds <= 0.0) {
+        fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+        return (1);
+    }
+
+    printf("raw sample stream, %u samples per block, %u blocks\n",
+           (unsigned)Stream_BLOCK_SAMPLES, (unsigned)Stream_NUM_BLOCKS);
+    printf("load       blocks   recvd dropped skipped     crc     seq "
+           " sample    kB/s\n");
+    for (i = 0; i < (sizeof(loads) / sizeof(loads[0])); i++) {
+        if (!runLoad(&loads[i], seconds)) {
+            failures++;
+        }
+    }
+    printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+
+    return ((failures == 0U) ? 0 : 1);
+}
+
+#endif
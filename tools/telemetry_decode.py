@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+#
+#  ======== telemetry_decode.py ========
+#  Decodes the binary result frames of telemetry.c into CSV.
+#
+#  Usage: python3 tools/telemetry_decode.py [capture|serial port] [baud]
+#
+#  Reads a raw capture file, a serial port (needs pyserial) or stdin when
+#  no argument is given, and prints one CSV line per valid frame:
+#
+#      sequence,channel,dc,rms,frequency_hz,thd_pct,order,mag,phase,...
+#
+#  with an order, magnitude and phase for every harmonic in the frame.
+#  dc, rms and the magnitudes are in full-scale units, phases in degrees.
+#  THD is taken over the orders above 1 that the frame carries, against
+#  the fundamental, and is 0 if the fundamental is not reported.
+#  Text on the link (the start-up banner, profile reports) and damaged
+#  frames fail the CRC and are skipped; their count goes to stderr.  Log
+#  frames (log.h, decoded by tools/log_decode.py) are skipped silently.
+#
+#  The frame layout is described in telemetry.h.
+#
+import math
+import struct
+import sys
+
+VERSION = 3
+FLAG_ORDERS = 0x01
+LOG_FRAME_TYPE = 0x4C
+LOG = 'log'
+HEADER = struct.Struct('<BBBBIhHI')
+# Version 1 had no order byte, its harmonics were 1 to H; version 2 had
+# one in front of every harmonic; version 3 has an order list after the
+# header when FLAG_ORDERS is set, and harmonics 1 to H otherwise
+HARMONIC = {1: struct.Struct('<Hh'), 2: struct.Struct('<BHh'),
+            3: struct.Struct('<Hh')}
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def unstuff_cr(data):
+    # UARTwrite() sends CR LF for every LF byte; drop the CR
+    out = bytearray()
+    for byte in data:
+        if byte == 0x0A and out:
+            out[-1] = 0x0A
+        else:
+            out.append(byte)
+    return bytes(out)
+
+
+def cobs_decode(block):
+    out = bytearray()
+    i = 0
+    while i < len(block):
+        code = block[i]
+        if code == 0 or i + code > len(block):
+            return None
+        out += block[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(block):
+            out.append(0)
+    return bytes(out)
+
+
+def parse(payload):
+    if len(payload) < 3:
+        return None
+    (crc,) = struct.unpack_from('<H', payload, len(payload) - 2)
+    if crc16(payload[:-2]) != crc:
+        return None
+    if payload[0] == LOG_FRAME_TYPE:
+        return LOG
+    if len(payload) < HEADER.size + 2:
+        return None
+    (version, channel, count, flags, sequence, dc, rms,
+     frequency) = HEADER.unpack_from(payload)
+    if version not in HARMONIC:
+        return None
+    orders = count if version == 3 and flags & FLAG_ORDERS else 0
+    size = HARMONIC[version].size
+    if len(payload) != HEADER.size + orders + size * count + 2:
+        return None
+    start = HEADER.size + orders
+    harmonics = [HARMONIC[version].unpack_from(payload, start + size * h)
+                 for h in range(count)]
+    if orders:
+        harmonics = [(payload[HEADER.size + h],) + v
+                     for h, v in enumerate(harmonics)]
+    elif version != 2:
+        harmonics = [(h + 1,) + v for h, v in enumerate(harmonics)]
+    return sequence, channel, dc, rms, frequency, harmonics
+
+
+def decode(block):
+    # Text written just before a frame shares its block; skip over it
+    for start in range(len(block)):
+        payload = cobs_decode(block[start:])
+        result = parse(payload) if payload else None
+        if result is not None:
+            return result
+    return None
+
+
+def frames(stream, live):
+    pending = b''
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            if live:
+                continue
+            break
+        pending += chunk
+        *blocks, pending = pending.split(b'\0')
+        for block in blocks:
+            yield block
+
+
+def main(argv):
+    if len(argv) > 1 and (argv[1].startswith('/dev/') or
+                          argv[1].upper().startswith('COM')):
+        import serial
+        stream = serial.Serial(argv[1], int(argv[2]) if len(argv) > 2
+                               else 115200, timeout=0.1)
+        live = True
+    elif len(argv) > 1:
+        stream = open(argv[1], 'rb')
+        live = False
+    else:
+        stream = sys.stdin.buffer
+        live = False
+
+    out = sys.stdout
+    bad = 0
+    for block in frames(stream, live):
+        result = decode(unstuff_cr(block))
+        if result is None:
+            bad += 1
+            continue
+        if result == LOG:
+            continue
+
+        sequence, channel, dc, rms, frequency, harmonics = result
+        mags = {order: m / 32768.0 for order, m, _ in harmonics}
+        fundamental = mags.get(1, 0.0)
+        thd = (100.0 * math.sqrt(sum(m * m for order, m in mags.items()
+                                     if order > 1)) / fundamental
+               if fundamental > 0 else 0.0)
+        fields = [str(sequence), str(channel), '%.5f' % (dc / 32768.0),
+                  '%.5f' % (rms / 32768.0), '%.3f' % (frequency / 1000.0),
+                  '%.4f' % thd]
+        for order, mag, phase in harmonics:
+            fields.append(str(order))
+            fields.append('%.5f' % (mag / 32768.0))
+            fields.append('%.2f' % (phase * 180.0 / 32768.0))
+        out.write(','.join(fields) + '\n')
+        out.flush()
+
+    sys.stderr.write('%d frames skipped\n' % bad)
+
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -0,0 +1,614 @@
+/*
+ *  ======== trigger_sim.c ========
+ *  Host simulation of the zero-crossing trigger (trigger.h) with edge
+ *  jitter.
+ *
+ *  The first part plays the rising crossings of the mains in simulated
+ *  time through Trigger_edge() and a model of the triggered capture of
+ *  acquire.c: a frame of 1024 samples at 51.2 kS/s, one cycle at 50 Hz,
+ *  starts one sample after an accepted edge reaches the capture, and
+ *  later edges are ignored until it is complete.  The comparator edges
+ *  carry
+ *
+ *      jitter     normal, JITTER_US rms around the true crossing
+ *      chatter    1 to 4 more edges within CHATTER_US after half of the
+ *                 crossings
+ *      impulses   edges at random times, IMPULSE_RATE per second
+ *      latency    1 to 4 us from the edge to the capture starting, for the
+ *                 GPIO interrupt and callback
+ *
+ *  For each mains frequency and hold-off the same edges are run, and the
+ *  table gives the edges rejected, the frame rate, the frames started by
+ *  chatter or impulses, the crossings whose first edge was rejected, the
+ *  crossings accepted while the frame of the one before was still being
+ *  captured (late), and the spread of the fundamental phase at the first
+ *  sample of every frame, in degrees, for the fundamental and the 50th
+ *  harmonic.  A frame ends just as the next crossing comes, so with a
+ *  hold-off under a cycle that crossing is late about as often as not.
+ *  The hold-off of main_nortos.c, HOLD_OFF_US, skips it and takes every
+ *  other crossing, so none should be late and half are missed.  Without a hold-off, chatter
+ *  that outlasts a frame starts the next one off the crossing.  With one,
+ *  only impulses in the last part of the hold-off can, or chatter at the
+ *  end of a hold-off an impulse restarted, which counts as the impulse.
+ *
+ *  The second part runs the host stand-in of the acquisition in triggered
+ *  mode for real, with a thread posting chattering edges at 45 Hz and
+ *  52 Hz, and HOLD_OFF_US.  Frames should start on every other crossing at
+ *  both; the frequencies are well clear of the limits so that thread
+ *  wake-up times on the host do not decide.
+ *
+ *  The third part runs triggered frames of a waveform with harmonics 1 to
+ *  50 through the ingest and Analysis_run(), set up as main_nortos.c does
+ *  with Analysis_setTriggered(), and compares the magnitude of every
+ *  harmonic with the waveform.  A frame is a whole cycle at 50 Hz only,
+ *  so the check is made there, to MAG_LIMIT of full scale; 49.8 and
+ *  50.2 Hz are shown for the leakage of the rectangular window off the
+ *  nominal frequency.  A window of two cycles must be refused.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/trigger_sim [seconds] [jitterUs] [holdOffUs...]
+ *
+ *  seconds of simulated mains per run (default 60), the comparator jitter
+ *  (default 20) and the hold-offs to compare (default 0, 1000, 15000 and
+ *  35000, the one of main_nortos.c).  Fails, with a non-zero exit status,
+ *  if chatter started a frame with a hold-off past CHATTER_US, a crossing
+ *  was late with HOLD_OFF_US, the live run did not start frames on the
+ *  expected edges, or a harmonic was off at 50 Hz.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "acquire.h"
+#include "analysis.h"
+#include "ingest.h"
+#include "trigger.h"
+
+/* As main_nortos.c with TRIGGER_ENABLE */
+#define FRAME_LEN       (1024U)
+#define SAMPLE_RATE     (51200U)
+#define MAINS_FREQ      (50.0)
+#define HOLD_OFF_US     (35000U)
+#define NUM_CHANNELS    (7U)
+#define NUM_HARMONICS   (50U)
+
+/* Largest error of a harmonic magnitude at MAINS_FREQ, full scale 1.0 */
+#define MAG_LIMIT       (5e-4)
+
+#define CHATTER_US      (500.0)
+#define IMPULSE_RATE    (0.5)
+#define LATENCY_MIN_US  (1.0)
+#define LATENCY_MAX_US  (4.0)
+
+#define MAX_HOLD_OFFS   (8)
+
+/* Edge sources */
+#define EDGE_CROSSING   (0)
+#define EDGE_CHATTER    (1)
+#define EDGE_IMPULSE    (2)
+
+typedef struct {
+    double   t;                     /* Seconds */
+    uint8_t  kind;
+} Edge;
+
+typedef struct {
+    uint32_t edges;
+    uint32_t rejected;
+    uint32_t frames;
+    uint32_t byChatter;
+    uint32_t byImpulse;
+    uint32_t missed;
+    uint32_t late;                  /* Crossings during a crossing's frame */
+    double   sumSquares;            /* Of the alignment error, seconds */
+    double   maxError;
+} Result;
+
+static uint32_t state;
+
+static uint16_t buffer[Acquire_BUFFER_LEN(FRAME_LEN, NUM_CHANNELS)];
+static Channels_Config channels[NUM_CHANNELS];
+static Acquire_Object acquire;
+static Trigger_Object trigger;
+static volatile uint32_t liveFrames;
+static volatile uint32_t liveStarted;
+static volatile uint32_t liveCrossings;
+static volatile bool running;
+
+static uint16_t codes[FRAME_LEN];
+static Precision_Sample frame[FRAME_LEN] __attribute__((aligned(4)));
+static Precision_Sample history[Analysis_HISTORY_LEN]
+    __attribute__((aligned(4)));
+static Precision_Sample work[Analysis_WORK_LEN] __attribute__((aligned(4)));
+static q15_t windowTable[Analysis_WINDOW_TABLE_LEN];
+static Analysis_Object analysis;
+static Ingest_Object ingest;
+
+/*
+ *  ======== uniform ========
+ *  From a fixed-seed generator, so every hold-off sees the same edges.
+ */
+static double uniform(void)
+{
+    state = (state * 1664525U) + 1013904223U;
+
+    return ((state >> 8) / 16777216.0);
+}
+
+/*
+ *  ======== gaussian ========
+ */
+static double gaussian(void)
+{
+    double u1 = ((uniform() * 16777216.0) + 1.0) / 16777217.0;
+    double u2 = uniform();
+
+    return (sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2));
+}
+
+/*
+ *  ======== compareEdges ========
+ */
+static int compareEdges(const void *a, const void *b)
+{
+    double ta = ((const Edge *)a)->t;
+    double tb = ((const Edge *)b)->t;
+
+    return ((ta > tb) - (ta < tb));
+}
+
+/*
+ *  ======== makeEdges ========
+ *  Rising edges of the comparator over the run, in time order, in an
+ *  array the caller frees.
+ */
+static Edge *makeEdges(double freq, double seconds, double jitterUs,
+                       uint32_t *numEdges)
+{
+    uint32_t cycles = (uint32_t)(seconds * freq);
+    Edge *edges = malloc(((size_t)cycles * 6U) * sizeof(Edge));
+    double period = 1.0 / freq;
+    double first;
+    uint32_t n = 0;
+    uint32_t k;
+    uint32_t extra;
+    uint32_t i;
+
+    state = 12345U;
+    for (k = 1; k < cycles; k++) {
+        first = (k * period) + (jitterUs * 1e-6 * gaussian());
+        edges[n++] = (Edge){first, EDGE_CROSSING};
+        if (uniform() < 0.5) {
+            extra = 1U + (uint32_t)(uniform() * 4.0);
+            for (i = 0; i < extra; i++) {
+                edges[n++] = (Edge){first + (CHATTER_US * 1e-6 * uniform()),
+                                    EDGE_CHATTER};
+            }
+        }
+        if (uniform() < (IMPULSE_RATE * period)) {
+            edges[n++] = (Edge){(k + uniform()) * period, EDGE_IMPULSE};
+        }
+    }
+
+    qsort(edges, n, sizeof(Edge), compareEdges);
+    *numEdges = n;
+
+    return (edges);
+}
+
+/*
+ *  ======== simulate ========
+ *  The capture takes the accepted edges that come while it waits, like
+ *  Acquire_trigger(), and the timer starts over from a full sample period.
+ *  The alignment error of a frame is the time from the last true crossing
+ *  to its first sample, less the mean of that time.
+ */
+static void simulate(const Edge *edges, uint32_t numEdges, double freq,
+                     uint32_t holdOffUs, Result *r)
+{
+    double period = 1.0 / freq;
+    double ideal = (1.0 / SAMPLE_RATE) +
+                   ((LATENCY_MIN_US + LATENCY_MAX_US) * 0.5e-6);
+    double readyAt = 0.0;
+    double start;
+    double sample;
+    double error;
+    bool byCrossing = false;
+    uint8_t lastAccepted = EDGE_CROSSING;
+    uint8_t kind;
+    uint32_t i;
+
+    Trigger_init(&trigger, holdOffUs, 0);
+    *r = (Result){0};
+    state = 54321U;
+
+    for (i = 0; i < numEdges; i++) {
+        /* Nanoseconds, wrapping like Trigger_now() */
+        if (!Trigger_edge(&trigger,
+                          (uint32_t)(uint64_t)llround(edges[i].t * 1e9))) {
+            r->rejected++;
+            if (edges[i].kind == EDGE_CROSSING) {
+                r->missed++;
+            }
+            continue;
+        }
+
+        /* Chatter is only past the hold-off when an impulse restarted it */
+        kind = ((edges[i].kind == EDGE_CHATTER) &&
+                (lastAccepted == EDGE_IMPULSE)) ? EDGE_IMPULSE :
+               edges[i].kind;
+        lastAccepted = edges[i].kind;
+
+        if (edges[i].t < readyAt) {
+            if (byCrossing && (edges[i].kind == EDGE_CROSSING)) {
+                r->late++;
+            }
+            continue;
+        }
+        byCrossing = (edges[i].kind == EDGE_CROSSING);
+
+        start = edges[i].t + (1e-6 * (LATENCY_MIN_US +
+                              ((LATENCY_MAX_US - LATENCY_MIN_US) *
+                               uniform())));
+        sample = start + (1.0 / SAMPLE_RATE);
+        readyAt = start + ((double)FRAME_LEN / SAMPLE_RATE);
+
+        error = (sample - (floor(sample * freq) * period)) - ideal;
+        if (error > (period * 0.5)) {
+            error -= period;
+        }
+
+        r->frames++;
+        r->sumSquares += error * error;
+        if (fabs(error) > r->maxError) {
+            r->maxError = fabs(error);
+        }
+        if (kind == EDGE_CHATTER) {
+            r->byChatter++;
+        }
+        else if (kind == EDGE_IMPULSE) {
+            r->byImpulse++;
+        }
+    }
+    r->edges = numEdges;
+}
+
+/*
+ *  ======== source ========
+ */
+static void source(uint_least8_t channel, uint16_t *dst, uint16_t numSamples,
+                   uint16_t stride, void *arg)
+{
+    uint16_t i;
+
+    (void)channel;
+    (void)arg;
+
+    for (i = 0; i < numSamples; i++) {
+        dst[(uint32_t)i * stride] = 2048U;
+    }
+}
+
+/*
+ *  ======== frameReady ========
+ */
+static void frameReady(int_fast8_t frame, void *arg)
+{
+    (void)frame;
+    (void)arg;
+
+    liveFrames++;
+}
+
+/*
+ *  ======== zeroCrossing ========
+ *  As in main_nortos.c.
+ */
+static void zeroCrossing(void)
+{
+    if (Trigger_edge(&trigger, Trigger_now()) && Acquire_trigger(&acquire)) {
+        liveStarted++;
+    }
+}
+
+/*
+ *  ======== sleepUntil ========
+ */
+static void sleepUntil(const struct timespec *base, double seconds)
+{
+    struct timespec t = *base;
+    uint64_t ns = (uint64_t)(seconds * 1e9);
+
+    t.tv_sec += (time_t)(ns / 1000000000ULL);
+    t.tv_nsec += (long)(ns % 1000000000ULL);
+    if (t.tv_nsec >= 1000000000L) {
+        t.tv_nsec -= 1000000000L;
+        t.tv_sec++;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL);
+}
+
+/*
+ *  ======== edgeThread ========
+ *  A crossing every period, with chatter 50 and 120 us later on every
+ *  other one.
+ */
+static void *edgeThread(void *arg)
+{
+    double period = 1.0 / *(const double *)arg;
+    struct timespec base;
+    uint32_t k;
+
+    clock_gettime(CLOCK_MONOTONIC, &base);
+    for (k = 1; running; k++) {
+        sleepUntil(&base, k * period);
+        liveCrossings++;
+        zeroCrossing();
+        if ((k & 1U) != 0U) {
+            sleepUntil(&base, (k * period) + 50e-6);
+            zeroCrossing();
+            sleepUntil(&base, (k * period) + 120e-6);
+            zeroCrossing();
+        }
+    }
+
+    return (NULL);
+}
+
+/*
+ *  ======== live ========
+ *  Returns true if frames started on the expected share of the crossings.
+ */
+static bool live(double freq, double seconds, double expected)
+{
+    pthread_t thread;
+    struct timespec delay;
+    double ratio;
+    bool pass;
+
+    Acquire_init(&acquire, channels, NUM_CHANNELS, buffer, FRAME_LEN,
+                 SAMPLE_RATE, 0, frameReady, NULL);
+    Acquire_setSource(&acquire, source, NULL);
+    Acquire_setTriggered(&acquire, true);
+    Trigger_init(&trigger, HOLD_OFF_US, 0);
+    liveFrames = 0;
+    liveStarted = 0;
+    liveCrossings = 0;
+
+    running = true;
+    Acquire_start(&acquire);
+    pthread_create(&thread, NULL, edgeThread, &freq);
+
+    delay.tv_sec = (time_t)seconds;
+    delay.tv_nsec = (long)((seconds - (double)delay.tv_sec) * 1e9);
+    nanosleep(&delay, NULL);
+
+    running = false;
+    pthread_join(thread, NULL);
+    Acquire_stop(&acquire);
+
+    /* The last frame started may still have been filling */
+    ratio = (double)liveStarted / liveCrossings;
+    pass = ((liveStarted - liveFrames) <= 1U) &&
+           (fabs(ratio - expected) < 0.05) &&
+           (trigger.accepted < trigger.edges);
+
+    printf("live %.1f Hz: %u crossings, %u edges, %u accepted, %u frames "
+           "started, %u complete, %.2f frames per crossing (%.2f "
+           "expected): %s\n", freq, (unsigned)liveCrossings,
+           (unsigned)trigger.edges, (unsigned)trigger.accepted,
+           (unsigned)liveStarted, (unsigned)liveFrames, ratio, expected,
+           pass ? "ok" : "FAIL");
+
+    return (pass);
+}
+
+/*
+ *  ======== amplitude ========
+ *  Peak amplitude of harmonic h of the test waveform, full scale 1.0.
+ */
+static double amplitude(uint32_t h)
+{
+    return ((h == 1U) ? 0.6 : (0.1 / h));
+}
+
+/*
+ *  ======== harmonics ========
+ *  One triggered frame of the test waveform at freq through the analysis.
+ *  The fundamental rises through zero at the accepted edge, and the first
+ *  sample comes a sample period and the mean latency later.  Returns the
+ *  largest magnitude error in full scale, or a negative value if the
+ *  analysis gave no result for all NUM_HARMONICS.
+ */
+static double harmonics(double freq, double *h1, double *h50)
+{
+    double t0 = (1.0 / SAMPLE_RATE) +
+                ((LATENCY_MIN_US + LATENCY_MAX_US) * 0.5e-6);
+    double x;
+    double error;
+    double worst = 0.0;
+    float32_t re;
+    float32_t im;
+    uint32_t h;
+    uint32_t n;
+    long code;
+
+    for (n = 0; n < FRAME_LEN; n++) {
+        x = 0.0;
+        for (h = 1; h <= NUM_HARMONICS; h++) {
+            x += amplitude(h) * sin((2.0 * M_PI * h * freq *
+                                     (t0 + ((double)n / SAMPLE_RATE))) +
+                                    (h * 0.7));
+        }
+        code = lround(Ingest_ADC_OFFSET + (2048.0 * x));
+        codes[n] = (uint16_t)((code < 0) ? 0 : ((code > 4095) ? 4095 : code));
+    }
+
+    Ingest_convert(&ingest, codes, frame, FRAME_LEN);
+    Analysis_push(&analysis, 0, frame, FRAME_LEN);
+    if (!Analysis_run(&analysis, 0, Window_INTERP_2POINT) ||
+        (analysis.numReported != NUM_HARMONICS)) {
+        return (-1.0);
+    }
+
+    for (h = 0; h < NUM_HARMONICS; h++) {
+        Analysis_harmonic(&analysis, (uint_least8_t)h, &re, &im);
+        error = (2.0 * sqrt(((double)re * re) + ((double)im * im))) -
+                amplitude(analysis.orders[h]);
+        if (h == 0U) {
+            *h1 = error;
+        }
+        *h50 = error;
+        if (fabs(error) > worst) {
+            worst = fabs(error);
+        }
+    }
+
+    return (worst);
+}
+
+/*
+ *  ======== checkHarmonics ========
+ *  Returns true if every harmonic is within MAG_LIMIT at MAINS_FREQ and a
+ *  window of two cycles is refused.
+ */
+static bool checkHarmonics(const double *freqs, uint_least8_t numFreqs)
+{
+    Analysis_Config config;
+    double worst;
+    double h1 = 0.0;
+    double h50 = 0.0;
+    bool pass = true;
+    uint_least8_t f;
+    uint_least8_t i;
+
+    config.fftLen = FRAME_LEN;
+    config.cycles = 1;
+    config.window = Window_RECTANGULAR;
+    config.numHarmonics = NUM_HARMONICS;
+    for (i = 0; i < NUM_HARMONICS; i++) {
+        config.orders[i] = i + 1U;
+    }
+    Ingest_init(&ingest, Ingest_DC_SHIFT_DEFAULT);
+    Analysis_init(&analysis, 1, history, work, windowTable, FRAME_LEN,
+                  SAMPLE_RATE);
+    Analysis_setTriggered(&analysis, true);
+    Analysis_configure(&analysis, &config);
+
+    printf("\nharmonics 1 to %u of one triggered frame, %s, magnitude "
+           "errors in full scale\n\n", NUM_HARMONICS, Precision_NAME);
+    printf("%5s %10s %10s %10s\n", "Hz", "h1", "h50", "worst");
+    for (f = 0; f < numFreqs; f++) {
+        worst = harmonics(freqs[f], &h1, &h50);
+        if (worst < 0.0) {
+            printf("%5.1f no result\n", freqs[f]);
+            pass = false;
+            continue;
+        }
+        printf("%5.1f %10.2e %10.2e %10.2e%s\n", freqs[f], h1, h50, worst,
+               (freqs[f] == MAINS_FREQ) ? ((worst <= MAG_LIMIT) ? "  ok" :
+                                           "  FAIL") : "");
+        if ((freqs[f] == MAINS_FREQ) && (worst > MAG_LIMIT)) {
+            pass = false;
+        }
+    }
+
+    config.cycles = 2;
+    if (Analysis_check(&analysis, &config) != Analysis_STATUS_TRIGGERED) {
+        printf("FAIL: a window of 2 cycles was not refused\n");
+        pass = false;
+    }
+    printf("\nlimit %.0e at %.1f Hz, where a frame is one cycle\n\n",
+           MAG_LIMIT, MAINS_FREQ);
+
+    return (pass);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    static const double freqs[] = {49.8, 50.0, 50.2};
+    uint32_t holdOffs[MAX_HOLD_OFFS] = {0, 1000, 15000, HOLD_OFF_US};
+    uint_least8_t numHoldOffs = 4;
+    double seconds = (argc > 1) ? atof(argv[1]) : 60.0;
+    double jitterUs = (argc > 2) ? atof(argv[2]) : 20.0;
+    double toDeg;
+    double rms;
+    uint32_t numEdges;
+    Result r;
+    Edge *edges;
+    bool pass = true;
+    uint_least8_t f;
+    uint_least8_t h;
+    uint_least8_t k;
+
+    if (argc > 3) {
+        numHoldOffs = 0;
+        for (k = 3; (k < argc) && (numHoldOffs < MAX_HOLD_OFFS); k++) {
+            holdOffs[numHoldOffs++] = (uint32_t)atol(argv[k]);
+        }
+    }
+    if ((seconds <= 0.0) || (jitterUs < 0.0)) {
+        fprintf(stderr, "usage: %s [seconds] [jitterUs] [holdOffUs...]\n",
+                argv[0]);
+        return (2);
+    }
+
+    printf("trigger sim, %.0f s per run, %u samples at %u Hz, jitter %.1f "
+           "us rms, chatter within %.0f us on half the crossings, "
+           "%.1f impulses/s, latency %.0f to %.0f us\n\n", seconds,
+           FRAME_LEN, SAMPLE_RATE, jitterUs, CHATTER_US, IMPULSE_RATE,
+           LATENCY_MIN_US, LATENCY_MAX_US);
+    printf("%5s %8s %7s %8s %8s %7s %7s %6s %5s %8s %8s %8s\n", "Hz",
+           "hold us", "edges", "rejected", "frames/s", "chatter", "impulse",
+           "missed", "late", "h1 rms", "h1 max", "h50 rms");
+
+    for (f = 0; f < (sizeof(freqs) / sizeof(freqs[0])); f++) {
+        edges = makeEdges(freqs[f], seconds, jitterUs, &numEdges);
+        toDeg = 360.0 * freqs[f];
+
+        for (h = 0; h < numHoldOffs; h++) {
+            simulate(edges, numEdges, freqs[f], holdOffs[h], &r);
+            rms = (r.frames != 0U) ? sqrt(r.sumSquares / r.frames) : 0.0;
+            printf("%5.1f %8u %7u %8u %8.2f %7u %7u %6u %5u %8.3f %8.3f "
+                   "%8.2f\n", freqs[f], (unsigned)holdOffs[h],
+                   (unsigned)r.edges, (unsigned)r.rejected,
+                   r.frames / seconds, (unsigned)r.byChatter,
+                   (unsigned)r.byImpulse, (unsigned)r.missed,
+                   (unsigned)r.late, rms * toDeg, r.maxError * toDeg,
+                   50.0 * rms * toDeg);
+
+            if (((holdOffs[h] > CHATTER_US) && (r.byChatter != 0U)) ||
+                ((holdOffs[h] == HOLD_OFF_US) && (r.late != 0U))) {
+                pass = false;
+            }
+        }
+        free(edges);
+    }
+    printf("\nphases in degrees at the first sample of each frame, about "
+           "their mean\n\n");
+
+    for (k = 0; k < NUM_CHANNELS; k++) {
+        channels[k].adc = k & 1U;
+        channels[k].ain = k;
+    }
+    pass = live(45.0, 2.0, 0.5) && pass;
+    pass = live(52.0, 2.0, 0.5) && pass;
+    pass = checkHarmonics(freqs, sizeof(freqs) / sizeof(freqs[0])) && pass;
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
@@ -0,0 +1,539 @@
+/*
+ *  ======== uart_sim.c ========
+ *  Host test of the uartstdio transmit buffer.
+ *
+ *  Builds uartstdio.c against a stand-in for the UART, its interrupt and
+ *  the uDMA channel, and pushes random UARTwrite() traffic through it at
+ *  light and overload rates.  The stand-in moves one byte per bit-time
+ *  tick out of a 16-deep TX FIFO; the FIFO is refilled either by the
+ *  interrupt handler (UART_BUFFERED) or by basic-mode uDMA transfers that
+ *  raise UART_INT_DMATX on completion (UART_BUFFERED_DMA).
+ *
+ *  Checked on every tick:
+ *  - the wire carries exactly the accepted bytes, in order, with the CR
+ *    that UARTwrite() puts before each LF, and nothing else
+ *  - a uDMA transfer never runs past the end of the buffer or past the
+ *    head, and its bytes stay reserved until it completes
+ *  - UARTTxBytesFree() matches the ring indices
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/uart_sim_irq [seed] [ticks]
+ *      tools/build/uart_sim_dma [seed] [ticks]
+ *
+ *  Output is one line per load: bytes sent, bytes dropped, interrupts,
+ *  interrupts per kB and the deepest buffer fill.  The exit status is
+ *  non-zero if any check failed.
+ */
+#if defined(HOST_BUILD)
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ *  ======== Stand-in for the driverlib definitions uartstdio.c uses ========
+ */
+#define ASSERT(expr)
+
+#define UART0_BASE              0x4000C000U
+#define UART1_BASE              0x4000D000U
+#define UART2_BASE              0x4000E000U
+#define INT_UART0               21U
+#define INT_UART1               22U
+#define INT_UART2               49U
+#define SYSCTL_PERIPH_UART0     0xF0001800U
+#define SYSCTL_PERIPH_UART1     0xF0001801U
+#define SYSCTL_PERIPH_UART2     0xF0001802U
+
+#define UART_CONFIG_WLEN_8      0x00000060U
+#define UART_CONFIG_STOP_ONE    0x00000000U
+#define UART_CONFIG_PAR_NONE    0x00000000U
+#define UART_FIFO_TX1_8         0x00000000U
+#define UART_FIFO_RX1_8         0x00000000U
+#define UART_INT_DMATX          0x00020000U
+#define UART_INT_RT             0x00000040U
+#define UART_INT_TX             0x00000020U
+#define UART_INT_RX             0x00000010U
+#define UART_DMA_TX             0x00000002U
+
+#define UDMA_CH9_UART0TX        0x00000009U
+#define UDMA_CH23_UART1TX       0x00000017U
+#define UDMA_CH1_UART2TX        0x00010001U
+#define UDMA_PRI_SELECT         0x00000000U
+#define UDMA_MODE_BASIC         0x00000001U
+#define UDMA_ATTR_ALL           0x0000000FU
+#define UDMA_SIZE_8             0x00000000U
+#define UDMA_SRC_INC_8          0x00000000U
+#define UDMA_DST_INC_NONE       0xC0000000U
+#define UDMA_ARB_4              0x00008000U
+
+typedef struct {
+    volatile uint32_t DR;
+} UART0_Type;
+
+#define FIFO_DEPTH      (16U)
+
+/* TX FIFO level whose crossing raises UART_INT_TX (TX1_8) */
+#define FIFO_TRIGGER    (2U)
+
+/* The UART, its NVIC line and the uDMA channel */
+static struct {
+    uint8_t        fifo[FIFO_DEPTH];
+    uint32_t       fifoHead;
+    uint32_t       fifoCount;
+    uint32_t       ris;
+    uint32_t       im;
+    bool           intEnabled;
+    bool           masterDisabled;
+    bool           inHandler;
+    bool           dmaEnabled;
+    const uint8_t *dmaSrc;
+    uint32_t       dmaCount;
+    uint32_t       interrupts;
+} hw;
+
+static void raise(void);
+
+static bool MAP_SysCtlPeripheralPresent(uint32_t periph)
+{
+    (void)periph;
+    return (true);
+}
+
+static void MAP_SysCtlPeripheralEnable(uint32_t periph)
+{
+    (void)periph;
+}
+
+static void MAP_UARTConfigSetExpClk(uint32_t base, uint32_t clock,
+                                    uint32_t baud, uint32_t config)
+{
+    (void)base;
+    (void)clock;
+    (void)baud;
+    (void)config;
+}
+
+static void MAP_UARTFIFOLevelSet(uint32_t base, uint32_t tx, uint32_t rx)
+{
+    (void)base;
+    (void)tx;
+    (void)rx;
+}
+
+static void MAP_UARTEnable(uint32_t base)
+{
+    (void)base;
+}
+
+static void MAP_IntEnable(uint32_t intNum)
+{
+    (void)intNum;
+    hw.intEnabled = true;
+
+    /* A pending interrupt is taken as soon as it is enabled */
+    raise();
+}
+
+static void MAP_IntDisable(uint32_t intNum)
+{
+    (void)intNum;
+    hw.intEnabled = false;
+}
+
+static bool MAP_IntMasterDisable(void)
+{
+    bool wasDisabled = hw.masterDisabled;
+
+    hw.masterDisabled = true;
+
+    return (wasDisabled);
+}
+
+static bool MAP_IntMasterEnable(void)
+{
+    bool wasDisabled = hw.masterDisabled;
+
+    hw.masterDisabled = false;
+    raise();
+
+    return (wasDisabled);
+}
+
+static void MAP_UARTIntEnable(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    hw.im |= flags;
+}
+
+static void MAP_UARTIntDisable(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    hw.im &= ~flags;
+}
+
+static uint32_t MAP_UARTIntStatus(uint32_t base, bool masked)
+{
+    (void)base;
+    return (masked ? (hw.ris & hw.im) : hw.ris);
+}
+
+static void MAP_UARTIntClear(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    hw.ris &= ~flags;
+}
+
+static bool MAP_UARTCharPutNonBlocking(uint32_t base, unsigned char c)
+{
+    (void)base;
+    if (hw.fifoCount == FIFO_DEPTH) {
+        return (false);
+    }
+    hw.fifo[(hw.fifoHead + hw.fifoCount++) % FIFO_DEPTH] = c;
+
+    return (true);
+}
+
+static bool MAP_UARTCharsAvail(uint32_t base)
+{
+    (void)base;
+    return (false);
+}
+
+static int32_t MAP_UARTCharGetNonBlocking(uint32_t base)
+{
+    (void)base;
+    return (-1);
+}
+
+#ifdef UART_BUFFERED_DMA
+static void MAP_UARTDMAEnable(uint32_t base, uint32_t flags)
+{
+    (void)base;
+    (void)flags;
+}
+
+static void MAP_uDMAChannelAssign(uint32_t mapping)
+{
+    (void)mapping;
+}
+
+static void MAP_uDMAChannelAttributeDisable(uint32_t channel, uint32_t attr)
+{
+    (void)channel;
+    (void)attr;
+}
+
+static void MAP_uDMAChannelControlSet(uint32_t channel, uint32_t control)
+{
+    (void)channel;
+    (void)control;
+}
+
+static void MAP_uDMAChannelTransferSet(uint32_t channel, uint32_t mode,
+                                       void *src, void *dst, uint32_t count);
+
+static void MAP_uDMAChannelEnable(uint32_t channel)
+{
+    (void)channel;
+    hw.dmaEnabled = true;
+}
+
+static void MAP_uDMAChannelDisable(uint32_t channel)
+{
+    (void)channel;
+    hw.dmaEnabled = false;
+}
+
+static bool MAP_uDMAChannelIsEnabled(uint32_t channel)
+{
+    (void)channel;
+    return (hw.dmaEnabled);
+}
+#else
+static bool MAP_UARTSpaceAvail(uint32_t base)
+{
+    (void)base;
+    return (hw.fifoCount < FIFO_DEPTH);
+}
+#endif
+
+#include "../uartstdio.c"
+
+#define TX_SIZE         (UART_TX_BUFFER_SIZE)
+
+/* Longest message of one UARTwrite() call */
+#define MAX_MESSAGE     (300U)
+
+/* Every byte that UARTwrite() accepted, in order, and how many were sent */
+static uint8_t *expected;
+static uint32_t expectedLen;
+static uint32_t sentLen;
+
+static uint32_t dropped;
+static uint32_t failures;
+static uint32_t maxUsed;
+static uint32_t seed;
+
+/*
+ *  ======== fail ========
+ */
+static void fail(const char *what)
+{
+    if (failures++ < 10U) {
+        fprintf(stderr, "FAIL after %u bytes: %s\n", (unsigned)sentLen, what);
+    }
+}
+
+#ifdef UART_BUFFERED_DMA
+/*
+ *  ======== MAP_uDMAChannelTransferSet ========
+ *  A transfer must start at the read index and stay inside the bytes
+ *  queued in front of it, without wrapping.
+ */
+static void MAP_uDMAChannelTransferSet(uint32_t channel, uint32_t mode,
+                                       void *src, void *dst, uint32_t count)
+{
+    uint32_t offset = (uint32_t)((uint8_t *)src - g_pcUARTTxBuffer);
+
+    (void)channel;
+    (void)mode;
+
+    if (dst != (void *)&((UART0_Type *)UART0_BASE)->DR) {
+        fail("transfer not to the data register");
+    }
+    if (hw.dmaEnabled) {
+        fail("transfer set up while one is in flight");
+    }
+    if (offset != (g_sUARTTxRing.tail & (TX_SIZE - 1U))) {
+        fail("transfer does not start at the tail");
+    }
+    if ((count == 0U) || ((offset + count) > TX_SIZE) ||
+        (count > Ring_count(&g_sUARTTxRing))) {
+        fail("transfer outside the queued bytes");
+    }
+
+    hw.dmaSrc = src;
+    hw.dmaCount = count;
+}
+#endif
+
+/*
+ *  ======== raise ========
+ *  Run the handler while an enabled interrupt is pending.
+ */
+static void raise(void)
+{
+    while (hw.intEnabled && !hw.masterDisabled && !hw.inHandler &&
+           ((hw.ris & hw.im) != 0U)) {
+        hw.inHandler = true;
+        hw.interrupts++;
+        UART0_IRQHandler();
+        hw.inHandler = false;
+    }
+}
+
+/*
+ *  ======== tick ========
+ *  One byte time: the uDMA tops up the FIFO, one byte goes out on the wire.
+ */
+static void tick(void)
+{
+    uint8_t c;
+
+    if (hw.dmaEnabled) {
+        while ((hw.dmaCount > 0U) && (hw.fifoCount < FIFO_DEPTH)) {
+            MAP_UARTCharPutNonBlocking(UART0_BASE, *hw.dmaSrc++);
+            hw.dmaCount--;
+        }
+        if (hw.dmaCount == 0U) {
+            hw.dmaEnabled = false;
+            hw.ris |= UART_INT_DMATX;
+        }
+    }
+
+    if (hw.fifoCount > 0U) {
+        c = hw.fifo[hw.fifoHead];
+        hw.fifoHead = (hw.fifoHead + 1U) % FIFO_DEPTH;
+        hw.fifoCount--;
+        if ((sentLen >= expectedLen) || (expected[sentLen] != c)) {
+            fail("wrong byte on the wire");
+        }
+        sentLen++;
+        if (hw.fifoCount == FIFO_TRIGGER) {
+            hw.ris |= UART_INT_TX;
+        }
+    }
+
+    raise();
+}
+
+/*
+ *  ======== check ========
+ *  Ring invariants between ticks.
+ */
+static void check(void)
+{
+    uint32_t used = Ring_count(&g_sUARTTxRing);
+    uint32_t queued;
+
+    if (used > maxUsed) {
+        maxUsed = used;
+    }
+    if ((uint32_t)UARTTxBytesFree() != (TX_SIZE - used)) {
+        fail("UARTTxBytesFree() does not match the indices");
+    }
+
+    /* Everything accepted is on the wire, in the FIFO or in the buffer */
+    queued = sentLen + hw.fifoCount + used;
+#ifdef UART_BUFFERED_DMA
+    if (g_ui32UARTTxDMACount != 0U) {
+        queued -= g_ui32UARTTxDMACount - hw.dmaCount;
+    }
+    if (g_ui32UARTTxDMACount > used) {
+        fail("transfer larger than the buffered bytes");
+    }
+    if (!hw.dmaEnabled && (g_ui32UARTTxDMACount != 0U) &&
+        ((hw.ris & UART_INT_DMATX) == 0U)) {
+        fail("transfer done but never completed");
+    }
+    if ((used != 0U) && (g_ui32UARTTxDMACount == 0U)) {
+        fail("buffered bytes but the uDMA is idle");
+    }
+#endif
+    if (queued != expectedLen) {
+        fail("bytes lost or duplicated");
+    }
+}
+
+/*
+ *  ======== writeMessage ========
+ *  One UARTwrite() of random bytes, about one in sixteen of them a LF.
+ */
+static void writeMessage(void)
+{
+    char msg[MAX_MESSAGE];
+    uint32_t len = 1U + ((seed = (seed * 1103515245U) + 12345U) >> 16) %
+                        MAX_MESSAGE;
+    uint32_t before = g_sUARTTxRing.head;
+    uint32_t added;
+    uint32_t accepted;
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        seed = (seed * 1103515245U) + 12345U;
+        msg[i] = ((seed >> 16) % 16U == 0U) ? '\n' : (char)(seed >> 24);
+    }
+
+    accepted = (uint32_t)UARTwrite(msg, len);
+    dropped += len - accepted;
+    added = 0;
+    for (i = 0; i < accepted; i++) {
+        if (msg[i] == '\n') {
+            expected[expectedLen + added++] = '\r';
+        }
+        expected[expectedLen + added++] = (uint8_t)msg[i];
+    }
+
+    /* A LF that did not fit may still have queued its CR */
+    if ((accepted < len) && (msg[accepted] == '\n') &&
+        ((g_sUARTTxRing.head - before) > added)) {
+        expected[expectedLen + added++] = '\r';
+    }
+    expectedLen += added;
+}
+
+/*
+ *  ======== run ========
+ *  A message every `period` ticks on average, then drain.
+ */
+static void run(const char *name, uint32_t ticks, uint32_t period)
+{
+    uint32_t startSent = sentLen;
+    uint32_t startInterrupts = hw.interrupts;
+    uint32_t interrupts;
+    uint32_t bytes;
+    uint32_t t;
+
+    dropped = 0;
+    maxUsed = 0;
+    for (t = 0; t < ticks; t++) {
+        seed = (seed * 1103515245U) + 12345U;
+        if ((seed >> 16) % period == 0U) {
+            writeMessage();
+        }
+        tick();
+        check();
+    }
+    while ((sentLen < expectedLen) && (t++ < (ticks + (4U * TX_SIZE)))) {
+        tick();
+        check();
+    }
+    if (sentLen != expectedLen) {
+        fail("buffer did not drain");
+    }
+
+    bytes = sentLen - startSent;
+    interrupts = hw.interrupts - startInterrupts;
+    printf("%-9s %8u %8u %10u %7.1f %8u\n", name, (unsigned)bytes,
+           (unsigned)dropped, (unsigned)interrupts,
+           (bytes > 0U) ? (1024.0 * (double)interrupts / (double)bytes) : 0.0,
+           (unsigned)maxUsed);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t ticks;
+
+    seed = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 1U;
+    ticks = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 200000U;
+
+    /* The wire carries at most one byte per tick of the four runs */
+    expected = malloc((4U * ((size_t)ticks + (8U * TX_SIZE))) +
+                      (2U * MAX_MESSAGE));
+    if (expected == NULL) {
+        return (1);
+    }
+
+    UARTStdioConfig(0, 115200, 120000000);
+    UARTEchoSet(false);
+
+#ifdef UART_BUFFERED_DMA
+    printf("uartstdio transmit buffer, %u bytes, uDMA\n", (unsigned)TX_SIZE);
+#else
+    printf("uartstdio transmit buffer, %u bytes, TX interrupt\n",
+           (unsigned)TX_SIZE);
+#endif
+    printf("load         bytes  dropped interrupts  int/kB  maxUsed\n");
+
+    /* Well below, just below and far above the line rate */
+    run("light", ticks, 1500);
+    run("heavy", ticks, 170);
+    run("overload", ticks, 40);
+
+    /* A discard in the middle of a transfer */
+    writeMessage();
+    tick();
+    UARTFlushTx(true);
+    expectedLen = sentLen + hw.fifoCount;
+    while (hw.fifoCount > 0U) {
+        tick();
+    }
+    check();
+    run("restart", ticks / 4U, 400);
+
+    printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+    free(expected);
+
+    return ((failures == 0U) ? 0 : 1);
+}
+
+#endif
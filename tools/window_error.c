@@ -0,0 +1,210 @@
+/*
+ *  ======== window_error.c ========
+ *  Host table of the peak estimation error of every window against the
+ *  cycles in the frame.
+ *
+ *  A tone at 0.8 full scale, with a 3rd harmonic at 5% of it, is placed at
+ *  a fractional number of cycles per frame, from CYCLES_FROM to CYCLES_TO.
+ *  Each frame goes through the spectrum stage as in analysis.c: the window
+ *  from its generated table, the real FFT and the magnitudes in the
+ *  precision selected by PRECISION, then the peak search and
+ *  Window_estimate() with both methods,
+ *
+ *      2pt     the ratio of the peak and its larger neighbour, inverted
+ *              with the window kernel (solveRatio() in window.c)
+ *      3pt     a parabola through the log magnitudes of three bins
+ *
+ *  For every window there is one table, a row per number of cycles, with
+ *  the amplitude error in percent and the frequency error in bins of each
+ *  method.  The summary gives the largest of each over the sweep.
+ *
+ *  Build with tools/Makefile and run on Linux from the repository root:
+ *
+ *      make -C tools
+ *      tools/build/window_error_q15 [fftLen]
+ *
+ *  fftLen defaults to 1024.  Fails, with a non-zero exit status, if the
+ *  2-point estimate of a window other than the rectangular one is ever off
+ *  by more than AMPLITUDE_LIMIT or FREQUENCY_LIMIT; the 3-point estimate
+ *  and the rectangular window are reported and not checked.
+ */
+#if defined(HOST_BUILD)
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "precision.h"
+#include "spectrum.h"
+#include "window.h"
+
+#define MAX_LEN         (4096)
+
+#define AMPLITUDE       (0.8)
+#define THIRD           (0.05)
+
+/* The sweep, in cycles per frame */
+#define CYCLES_FROM     (8.0)
+#define CYCLES_TO       (9.0)
+#define CYCLES_STEP     (0.05)
+
+/*
+ *  Largest 2-point error of the checked windows, percent and bins.  The
+ *  flat top of the flat-top window leaves little in the ratio for the
+ *  frequency, and in q15 its estimate is off by up to 0.01 bins.
+ */
+#define AMPLITUDE_LIMIT (0.1)
+#define FREQUENCY_LIMIT (0.02)
+
+#define NUM_METHODS     (2)
+
+static const char *const windowNames[Window_COUNT] = {
+    "rectangular", "hann", "flat-top", "blackman-harris"
+};
+
+static const char *const methodNames[NUM_METHODS] = {"2pt", "3pt"};
+
+typedef struct {
+    double amplitude;               /* Percent */
+    double frequency;               /* Bins */
+} Error;
+
+static Precision_Sample frame[MAX_LEN];
+static Precision_Sample work[Spectrum_WORK_LEN(MAX_LEN)];
+static Precision_Sample mag[Spectrum_NUM_BINS(MAX_LEN)];
+static Spectrum_Object spectrum;
+
+/*
+ *  ======== toSample ========
+ */
+static Precision_Sample toSample(double x)
+{
+#if (PRECISION == PRECISION_F32)
+    return ((Precision_Sample)x);
+#elif (PRECISION == PRECISION_Q31)
+    return ((Precision_Sample)lrint(x * 2147483647.0));
+#else
+    return ((Precision_Sample)lrint(x * 32767.0));
+#endif
+}
+
+/*
+ *  ======== measure ========
+ *  Errors of both methods for a tone at cycles per frame, with the
+ *  spectrum stage set to the window type.  A tone on a bin leaves the
+ *  neighbours of the rectangular window empty, and the 3-point estimate
+ *  then falls back to the peak bin.
+ */
+static void measure(Window_Type type, uint16_t len, double cycles,
+                   Error *errors)
+{
+    Window_Estimate estimate;
+    Precision_Sample maxValue;
+    uint32_t maxIndex;
+    double w = (2.0 * M_PI * cycles) / len;
+    uint16_t n;
+    uint_least8_t m;
+
+    for (n = 0; n < len; n++) {
+        frame[n] = toSample((AMPLITUDE * sin(w * n)) +
+                            (AMPLITUDE * THIRD * sin((3.0 * w * n) + 0.7)));
+    }
+
+    Spectrum_transform(&spectrum, frame);
+    Spectrum_magnitude(&spectrum, mag);
+    Precision_max(&mag[1], Spectrum_NUM_BINS(len) - 1U, &maxValue,
+                  &maxIndex);
+    maxIndex += 1U;
+
+    for (m = 0; m < NUM_METHODS; m++) {
+        if (Window_estimate(type, (Window_Interp)m,
+                            Spectrum_MAG_TO_FLOAT(mag[maxIndex - 1U]),
+                            Spectrum_MAG_TO_FLOAT(maxValue),
+                            Spectrum_MAG_TO_FLOAT(mag[maxIndex + 1U]),
+                            &estimate) != Window_STATUS_SUCCESS) {
+            /* As analysis.c, the peak bin itself */
+            estimate.offset = 0.0f;
+            estimate.amplitude = Spectrum_MAG_TO_FLOAT(maxValue) /
+                                 Window_coherentGain(type);
+        }
+
+        /* Window_estimate() gives A/2 */
+        errors[m].amplitude = 100.0 *
+                              (((2.0 * estimate.amplitude) - AMPLITUDE) /
+                               AMPLITUDE);
+        errors[m].frequency = (maxIndex + estimate.offset) - cycles;
+    }
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    long len = (argc > 1) ? atol(argv[1]) : 1024;
+    Error errors[NUM_METHODS];
+    Error worst[Window_COUNT][NUM_METHODS] = {{{0}}};
+    double cycles;
+    bool pass = true;
+    bool ok;
+    int type;
+    uint_least8_t m;
+
+    if ((len < Window_MIN_LEN) || (len > MAX_LEN) ||
+        (Spectrum_init(&spectrum, (uint16_t)len, work) !=
+         Spectrum_STATUS_SUCCESS)) {
+        fprintf(stderr, "usage: %s [fftLen], a power of two from %d to %d\n",
+                argv[0], Window_MIN_LEN, MAX_LEN);
+        return (2);
+    }
+
+    printf("window error, %s, %ld points, tone at %.1f full scale with a "
+           "3rd harmonic at %.0f%%\n", Precision_NAME, len, AMPLITUDE,
+           100.0 * THIRD);
+
+    for (type = 0; type < Window_COUNT; type++) {
+        Spectrum_setWindow(&spectrum, (Window_Type)type);
+
+        printf("\n%s\n%7s %11s %11s %11s %11s\n", windowNames[type],
+               "cycles", "2pt amp %", "2pt bins", "3pt amp %", "3pt bins");
+
+        for (cycles = CYCLES_FROM; cycles <= (CYCLES_TO + 1e-9);
+             cycles += CYCLES_STEP) {
+            measure((Window_Type)type, (uint16_t)len, cycles, errors);
+            printf("%7.2f", cycles);
+            for (m = 0; m < NUM_METHODS; m++) {
+                printf(" %11.4f %11.5f", errors[m].amplitude,
+                       errors[m].frequency);
+                if (fabs(errors[m].amplitude) > worst[type][m].amplitude) {
+                    worst[type][m].amplitude = fabs(errors[m].amplitude);
+                }
+                if (fabs(errors[m].frequency) > worst[type][m].frequency) {
+                    worst[type][m].frequency = fabs(errors[m].frequency);
+                }
+            }
+            printf("\n");
+        }
+    }
+
+    printf("\nlargest error over %.2f to %.2f cycles\n%-16s %6s %11s %11s\n",
+           CYCLES_FROM, CYCLES_TO, "window", "method", "amp %", "bins");
+    for (type = 0; type < Window_COUNT; type++) {
+        for (m = 0; m < NUM_METHODS; m++) {
+            ok = (type == Window_RECTANGULAR) || (m != 0U) ||
+                 ((worst[type][m].amplitude <= AMPLITUDE_LIMIT) &&
+                  (worst[type][m].frequency <= FREQUENCY_LIMIT));
+            pass = pass && ok;
+
+            printf("%-16s %6s %11.4f %11.5f  %s\n", windowNames[type],
+                   methodNames[m], worst[type][m].amplitude,
+                   worst[type][m].frequency, ok ? "ok" : "FAIL");
+        }
+    }
+    printf("%s\n", pass ? "PASS" : "FAIL");
+
+    return (pass ? 0 : 1);
+}
+
+#endif /* HOST_BUILD */
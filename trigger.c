@@ -0,0 +1,92 @@
+/*
+ *  ======== trigger.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(HOST_BUILD)
+#include <time.h>
+#else
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "trigger.h"
+
+/*
+ *  ======== Trigger_init ========
+ */
+int_fast16_t Trigger_init(Trigger_Object *obj, uint32_t holdOffUs,
+                          uint32_t systemClock)
+{
+    uint64_t holdOff;
+
+#if defined(HOST_BUILD)
+    (void)systemClock;
+
+    obj->tickRate = 1000000000U;
+#else
+    obj->tickRate = systemClock;
+#endif
+
+    /* Keep clear of the wrap, so the hold-off is always measurable */
+    holdOff = ((uint64_t)holdOffUs * obj->tickRate) / 1000000U;
+    if (holdOff >= 0x80000000ULL) {
+        return (Trigger_STATUS_ERROR);
+    }
+
+    obj->holdOff = (uint32_t)holdOff;
+    obj->last = 0;
+    obj->started = false;
+    obj->edges = 0;
+    obj->accepted = 0;
+
+#if !defined(HOST_BUILD)
+    /* Free-running 32-bit count at the system clock */
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER1);
+    while (!MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_TIMER1)) {
+    }
+    MAP_TimerConfigure(TIMER1_BASE, TIMER_CFG_PERIODIC_UP);
+    MAP_TimerLoadSet(TIMER1_BASE, TIMER_A, 0xFFFFFFFFU);
+    MAP_TimerEnable(TIMER1_BASE, TIMER_A);
+#endif
+
+    return (Trigger_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== Trigger_now ========
+ */
+uint32_t Trigger_now(void)
+{
+#if defined(HOST_BUILD)
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint32_t)(((uint64_t)ts.tv_sec * 1000000000ULL) +
+                       (uint64_t)ts.tv_nsec));
+#else
+    return (MAP_TimerValueGet(TIMER1_BASE, TIMER_A));
+#endif
+}
+
+/*
+ *  ======== Trigger_edge ========
+ *  The hold-off runs from the last accepted edge, not the last edge, so a
+ *  chattering crossing cannot keep pushing the next one away.
+ */
+bool Trigger_edge(Trigger_Object *obj, uint32_t now)
+{
+    obj->edges++;
+
+    if (obj->started && ((now - obj->last) < obj->holdOff)) {
+        return (false);
+    }
+
+    obj->started = true;
+    obj->last = now;
+    obj->accepted++;
+
+    return (true);
+}
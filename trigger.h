@@ -0,0 +1,101 @@
+/*
+ *  ======== trigger.h ========
+ *  Zero-crossing trigger with hold-off.
+ *
+ *  A comparator on the fundamental drives a GPIO pin, and its edge at a
+ *  zero crossing starts the capture of the next frame (see
+ *  Acquire_setTriggered()).  Every frame then begins at the same phase of
+ *  the fundamental, so the harmonic phases of one frame compare directly
+ *  with those of the next, with no phase unwrapping.
+ *
+ *  Noise on the slow slope around the crossing makes the comparator
+ *  chatter, and impulses on the line give edges in between.
+ *  Trigger_edge() accepts an edge only once the hold-off has passed since
+ *  the last accepted one.  Set the hold-off to most of a mains period, for
+ *  example 15 ms at 50 Hz.  It then accepts the first edge of each
+ *  crossing and ignores any edge until just before the next crossing.
+ *  Most of two periods, 35 ms in main_nortos.c, takes every other
+ *  crossing instead, for frames as long as a cycle.
+ *
+ *  Edges are timestamped with Trigger_now(), a free-running 32-bit
+ *  general-purpose timer (Timer 1) at the system clock.  The cycle counter
+ *  of Profile_now() stops while the event loop sleeps, so it cannot be
+ *  used here.  The timer wraps every 35.8 s at 120 MHz, so an edge after a
+ *  longer silence may be taken for one within the hold-off and be
+ *  rejected once.
+ *
+ *  tools/trigger_sim.c plays mains crossings with comparator jitter,
+ *  chatter and impulses through the hold-off and the triggered capture,
+ *  and reports how well the frames line up.
+ *
+ *  Building with HOST_BUILD timestamps with CLOCK_MONOTONIC in
+ *  nanoseconds.
+ */
+#ifndef TRIGGER_H_
+#define TRIGGER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Trigger_init().
+ */
+#define Trigger_STATUS_SUCCESS      (0)
+
+/*!
+ *  @brief  Returned by Trigger_init() for a hold-off out of range.
+ */
+#define Trigger_STATUS_ERROR        (-1)
+
+/*!
+ *  @brief  Trigger state
+ */
+typedef struct {
+    uint32_t          tickRate;     /*!< Trigger_now() ticks per second */
+    uint32_t          holdOff;      /*!< Ticks from an accepted edge on */
+    uint32_t          last;         /*!< Time of the last accepted edge */
+    bool              started;      /*!< An edge has been accepted */
+    volatile uint32_t edges;        /*!< Edges seen */
+    volatile uint32_t accepted;     /*!< Edges past the hold-off */
+} Trigger_Object;
+
+/*!
+ *  @brief  Start the timestamp timer and set the hold-off.
+ *
+ *  @param  obj          Trigger object to initialize
+ *  @param  holdOffUs    Time after an accepted edge in which further edges
+ *                       are ignored, in microseconds; 0 accepts them all
+ *  @param  systemClock  System clock in Hz (ignored on the host)
+ *
+ *  @return Trigger_STATUS_SUCCESS, or Trigger_STATUS_ERROR if the hold-off
+ *          does not fit in the timer
+ */
+extern int_fast16_t Trigger_init(Trigger_Object *obj, uint32_t holdOffUs,
+                                 uint32_t systemClock);
+
+/*!
+ *  @brief  Current time in ticks of obj->tickRate, for Trigger_edge().
+ */
+extern uint32_t Trigger_now(void);
+
+/*!
+ *  @brief  Count an edge and check it against the hold-off.
+ *
+ *  Called from the GPIO callback, in interrupt context.
+ *
+ *  @param  obj     Trigger object
+ *  @param  now     Time of the edge, from Trigger_now()
+ *
+ *  @return true if the edge is the first one of a crossing
+ */
+extern bool Trigger_edge(Trigger_Object *obj, uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRIGGER_H_ */
@@ -23,8 +23,16 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdarg.h>
+#ifndef HOST_BUILD
 #include "ti/devices/msp432e4/driverlib/driverlib.h"
+#endif
 #include "uartstdio.h"
+#ifdef UART_BUFFERED
+#include "ring.h"
+#endif
+#ifdef UART_BUFFERED_DMA
+#include "udma.h"
+#endif
 
 //*****************************************************************************
 //
@@ -54,57 +62,63 @@ static bool g_bDisableEcho;
 
 //*****************************************************************************
 //
-// Output ring buffer.  Buffer is full if g_ui32UARTTxReadIndex is one ahead of
-// g_ui32UARTTxWriteIndex.  Buffer is empty if the two indices are the same.
+// The function told about received lines and a drained transmit buffer, or
+// NULL.
+//
+//*****************************************************************************
+static tUARTEventCallback g_pfnEventCallback;
+
+//*****************************************************************************
+//
+// The ring buffers are indexed by masking, so their sizes must be powers of
+// two.
+//
+//*****************************************************************************
+#if ((UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1)) != 0) || \
+    ((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) != 0)
+#error "UART_TX_BUFFER_SIZE and UART_RX_BUFFER_SIZE must be powers of two"
+#endif
+
+//*****************************************************************************
+//
+// Output ring buffer.  UARTwrite() produces into it and UARTPrimeTransmit()
+// consumes from it.  Both run either in the interrupt handler or with the
+// UART interrupt disabled, since the handler echoes through UARTwrite() and
+// primes the transmitter itself.  All of its bytes can be used.
 //
 //*****************************************************************************
 static unsigned char g_pcUARTTxBuffer[UART_TX_BUFFER_SIZE];
-static volatile uint32_t g_ui32UARTTxWriteIndex = 0;
-static volatile uint32_t g_ui32UARTTxReadIndex = 0;
+static Ring_Object g_sUARTTxRing;
 
 //*****************************************************************************
 //
-// Input ring buffer.  Buffer is full if g_ui32UARTTxReadIndex is one ahead of
-// g_ui32UARTTxWriteIndex.  Buffer is empty if the two indices are the same.
+// Input ring buffer.  The interrupt handler produces into it and
+// UARTgets(), UARTgetc() and UARTPeek() consume from it.
 //
 //*****************************************************************************
 static unsigned char g_pcUARTRxBuffer[UART_RX_BUFFER_SIZE];
-static volatile uint32_t g_ui32UARTRxWriteIndex = 0;
-static volatile uint32_t g_ui32UARTRxReadIndex = 0;
+static Ring_Object g_sUARTRxRing;
 
+#ifdef UART_BUFFERED_DMA
 //*****************************************************************************
 //
-// Macros to determine number of free and used bytes in the transmit buffer.
+// The number of bytes, starting at the tail of g_sUARTTxRing, that the uDMA
+// is currently moving to the UART, or 0 if it is idle.  The tail is only
+// advanced once the transfer completes, so these bytes stay reserved in the
+// transmit buffer until then.
 //
 //*****************************************************************************
-#define TX_BUFFER_USED          (GetBufferCount(&g_ui32UARTTxReadIndex,  \
-                                                &g_ui32UARTTxWriteIndex, \
-                                                UART_TX_BUFFER_SIZE))
-#define TX_BUFFER_FREE          (UART_TX_BUFFER_SIZE - TX_BUFFER_USED)
-#define TX_BUFFER_EMPTY         (IsBufferEmpty(&g_ui32UARTTxReadIndex,   \
-                                               &g_ui32UARTTxWriteIndex))
-#define TX_BUFFER_FULL          (IsBufferFull(&g_ui32UARTTxReadIndex,  \
-                                              &g_ui32UARTTxWriteIndex, \
-                                              UART_TX_BUFFER_SIZE))
-#define ADVANCE_TX_BUFFER_INDEX(Index) \
-                                (Index) = ((Index) + 1) % UART_TX_BUFFER_SIZE
+static volatile uint32_t g_ui32UARTTxDMACount = 0;
 
 //*****************************************************************************
 //
-// Macros to determine number of free and used bytes in the receive buffer.
+// One uDMA transfer moves at most 1024 items.
 //
 //*****************************************************************************
-#define RX_BUFFER_USED          (GetBufferCount(&g_ui32UARTRxReadIndex,  \
-                                                &g_ui32UARTRxWriteIndex, \
-                                                UART_RX_BUFFER_SIZE))
-#define RX_BUFFER_FREE          (UART_RX_BUFFER_SIZE - RX_BUFFER_USED)
-#define RX_BUFFER_EMPTY         (IsBufferEmpty(&g_ui32UARTRxReadIndex,   \
-                                               &g_ui32UARTRxWriteIndex))
-#define RX_BUFFER_FULL          (IsBufferFull(&g_ui32UARTRxReadIndex,  \
-                                              &g_ui32UARTRxWriteIndex, \
-                                              UART_RX_BUFFER_SIZE))
-#define ADVANCE_RX_BUFFER_INDEX(Index) \
-                                (Index) = ((Index) + 1) % UART_RX_BUFFER_SIZE
+#if UART_TX_DMA_RUN_SIZE > 1024
+#error "UART_TX_DMA_RUN_SIZE must not exceed 1024"
+#endif
+#endif
 #endif
 
 //*****************************************************************************
@@ -151,129 +165,99 @@ static const uint32_t g_ui32UARTInt[3] =
 static uint32_t g_ui32PortNum;
 #endif
 
+#ifdef UART_BUFFERED_DMA
 //*****************************************************************************
 //
-// The list of UART peripherals.
+// The list of uDMA transmit channels for the console UART.
 //
 //*****************************************************************************
-static const uint32_t g_ui32UARTPeriph[3] =
+static const uint32_t g_ui32UARTTxDMAChannel[3] =
 {
-    SYSCTL_PERIPH_UART0, SYSCTL_PERIPH_UART1, SYSCTL_PERIPH_UART2
+    UDMA_CH9_UART0TX, UDMA_CH23_UART1TX, UDMA_CH1_UART2TX
 };
-
-//*****************************************************************************
-//
-//! Determines whether the ring buffer whose pointers and size are provided
-//! is full or not.
-//!
-//! \param pui32Read points to the read index for the buffer.
-//! \param pui32Write points to the write index for the buffer.
-//! \param ui32Size is the size of the buffer in bytes.
-//!
-//! This function is used to determine whether or not a given ring buffer is
-//! full.  The structure of the code is specifically to ensure that we do not
-//! see warnings from the compiler related to the order of volatile accesses
-//! being undefined.
-//!
-//! \return Returns \b true if the buffer is full or \b false otherwise.
-//
-//*****************************************************************************
-#ifdef UART_BUFFERED
-static bool
-IsBufferFull(volatile uint32_t *pui32Read,
-             volatile uint32_t *pui32Write, uint32_t ui32Size)
-{
-    uint32_t ui32Write;
-    uint32_t ui32Read;
-
-    ui32Write = *pui32Write;
-    ui32Read = *pui32Read;
-
-    return((((ui32Write + 1) % ui32Size) == ui32Read) ? true : false);
-}
 #endif
 
 //*****************************************************************************
 //
-//! Determines whether the ring buffer whose pointers and size are provided
-//! is empty or not.
-//!
-//! \param pui32Read points to the read index for the buffer.
-//! \param pui32Write points to the write index for the buffer.
-//!
-//! This function is used to determine whether or not a given ring buffer is
-//! empty.  The structure of the code is specifically to ensure that we do not
-//! see warnings from the compiler related to the order of volatile accesses
-//! being undefined.
-//!
-//! \return Returns \b true if the buffer is empty or \b false otherwise.
+// The list of UART peripherals.
 //
 //*****************************************************************************
-#ifdef UART_BUFFERED
-static bool
-IsBufferEmpty(volatile uint32_t *pui32Read,
-              volatile uint32_t *pui32Write)
+static const uint32_t g_ui32UARTPeriph[3] =
 {
-    uint32_t ui32Write;
-    uint32_t ui32Read;
-
-    ui32Write = *pui32Write;
-    ui32Read = *pui32Read;
-
-    return((ui32Write == ui32Read) ? true : false);
-}
-#endif
+    SYSCTL_PERIPH_UART0, SYSCTL_PERIPH_UART1, SYSCTL_PERIPH_UART2
+};
 
 //*****************************************************************************
 //
-//! Determines the number of bytes of data contained in a ring buffer.
-//!
-//! \param pui32Read points to the read index for the buffer.
-//! \param pui32Write points to the write index for the buffer.
-//! \param ui32Size is the size of the buffer in bytes.
-//!
-//! This function is used to determine how many bytes of data a given ring
-//! buffer currently contains.  The structure of the code is specifically to
-//! ensure that we do not see warnings from the compiler related to the order
-//! of volatile accesses being undefined.
-//!
-//! \return Returns the number of bytes of data currently in the buffer.
+// Take as many bytes from the transmit buffer as we have space for and move
+// them into the UART transmit FIFO.
+//
+// With UART_BUFFERED_DMA, hand the uDMA the contiguous run of bytes that
+// starts at the tail instead, unless a transfer is already in flight.
+// The run ends at the head or, if the data wraps around, at the end
+// of the buffer; the remainder then goes as a second transfer once the
+// first completes.  The only interrupt is UART_INT_DMATX on completion.
+// Runs are capped at UART_TX_DMA_RUN_SIZE bytes, since the buffer space of
+// a run is only released when all of it has been sent.
 //
 //*****************************************************************************
-#ifdef UART_BUFFERED
-static uint32_t
-GetBufferCount(volatile uint32_t *pui32Read,
-               volatile uint32_t *pui32Write, uint32_t ui32Size)
+#ifdef UART_BUFFERED_DMA
+static void
+UARTPrimeTransmit(uint32_t ui32Base)
 {
-    uint32_t ui32Write;
-    uint32_t ui32Read;
+    volatile uint32_t *pui32Data;
+    uint32_t ui32Channel;
+    uint32_t ui32Count;
+    void *pvData;
 
-    ui32Write = *pui32Write;
-    ui32Read = *pui32Read;
+    //
+    // Disable the UART interrupt so that a completing transfer cannot move
+    // the tail while we look at it.
+    //
+    MAP_IntDisable(g_ui32UARTInt[g_ui32PortNum]);
 
-    return((ui32Write >= ui32Read) ? (ui32Write - ui32Read) :
-           (ui32Size - (ui32Read - ui32Write)));
-}
-#endif
+    //
+    // Is the uDMA idle and do we have any data to transmit?  The queued run
+    // ends at the head or, if the data wraps around, at the end of the
+    // buffer.
+    //
+    ui32Count = Ring_peek(&g_sUARTTxRing, &pvData);
+    if((g_ui32UARTTxDMACount == 0) && (ui32Count != 0))
+    {
+        if(ui32Count > UART_TX_DMA_RUN_SIZE)
+        {
+            ui32Count = UART_TX_DMA_RUN_SIZE;
+        }
+        g_ui32UARTTxDMACount = ui32Count;
+
+        ui32Channel = g_ui32UARTTxDMAChannel[g_ui32PortNum];
+        pui32Data = &((UART0_Type *)(uintptr_t)ui32Base)->DR;
+        MAP_uDMAChannelTransferSet(ui32Channel | UDMA_PRI_SELECT,
+                                   UDMA_MODE_BASIC, pvData,
+                                   (void *)pui32Data, ui32Count);
+        MAP_uDMAChannelEnable(ui32Channel);
+        MAP_UARTIntEnable(ui32Base, UART_INT_DMATX);
+    }
 
-//*****************************************************************************
-//
-// Take as many bytes from the transmit buffer as we have space for and move
-// them into the UART transmit FIFO.
-//
-//*****************************************************************************
-#ifdef UART_BUFFERED
+    //
+    // Reenable the UART interrupt.
+    //
+    MAP_IntEnable(g_ui32UARTInt[g_ui32PortNum]);
+}
+#elif defined(UART_BUFFERED)
 static void
 UARTPrimeTransmit(uint32_t ui32Base)
 {
+    uint8_t ui8Char;
+
     //
     // Do we have any data to transmit?
     //
-    if(!TX_BUFFER_EMPTY)
+    if(Ring_count(&g_sUARTTxRing) != 0)
     {
         //
-        // Disable the UART interrupt.  If we don't do this there is a race
-        // condition which can cause the read index to be corrupted.
+        // Disable the UART interrupt.  The ring has a single consumer, and
+        // both the interrupt handler and UARTwrite() call this.
         //
         MAP_IntDisable(g_ui32UARTInt[g_ui32PortNum]);
 
@@ -281,11 +265,10 @@ UARTPrimeTransmit(uint32_t ui32Base)
         // Yes - take some characters out of the transmit buffer and feed
         // them to the UART transmit FIFO.
         //
-        while(MAP_UARTSpaceAvail(ui32Base) && !TX_BUFFER_EMPTY)
+        while(MAP_UARTSpaceAvail(ui32Base) &&
+              Ring_getByte(&g_sUARTTxRing, &ui8Char))
         {
-            MAP_UARTCharPutNonBlocking(ui32Base,
-                                      g_pcUARTTxBuffer[g_ui32UARTTxReadIndex]);
-            ADVANCE_TX_BUFFER_INDEX(g_ui32UARTTxReadIndex);
+            MAP_UARTCharPutNonBlocking(ui32Base, ui8Char);
         }
 
         //
@@ -368,15 +351,34 @@ UARTStdioConfig(uint32_t ui32PortNum, uint32_t ui32Baud, uint32_t ui32SrcClock)
     MAP_UARTFIFOLevelSet(g_ui32Base, UART_FIFO_TX1_8, UART_FIFO_RX1_8);
 
     //
-    // Flush both the buffers.
+    // Remember which interrupt we are dealing with.
     //
-    UARTFlushRx();
-    UARTFlushTx(true);
+    g_ui32PortNum = ui32PortNum;
+
+#ifdef UART_BUFFERED_DMA
+    //
+    // Set up the transmit channel for byte transfers from the buffer to the
+    // data register, four at a time while the FIFO is below its trigger
+    // level, and let the UART request them.
+    //
+    Udma_init();
+    MAP_uDMAChannelAssign(g_ui32UARTTxDMAChannel[ui32PortNum]);
+    MAP_uDMAChannelAttributeDisable(g_ui32UARTTxDMAChannel[ui32PortNum],
+                                    UDMA_ATTR_ALL);
+    MAP_uDMAChannelControlSet(g_ui32UARTTxDMAChannel[ui32PortNum] |
+                              UDMA_PRI_SELECT,
+                              (UDMA_SIZE_8 | UDMA_SRC_INC_8 |
+                               UDMA_DST_INC_NONE | UDMA_ARB_4));
+    MAP_UARTDMAEnable(g_ui32Base, UART_DMA_TX);
+#endif
 
     //
-    // Remember which interrupt we are dealing with.
+    // Set up and flush both the buffers.
     //
-    g_ui32PortNum = ui32PortNum;
+    Ring_init(&g_sUARTTxRing, g_pcUARTTxBuffer, 1, UART_TX_BUFFER_SIZE);
+    Ring_init(&g_sUARTRxRing, g_pcUARTRxBuffer, 1, UART_RX_BUFFER_SIZE);
+    UARTFlushRx();
+    UARTFlushTx(true);
 
     //
     // We are configured for buffered output so enable the master interrupt
@@ -426,6 +428,8 @@ UARTwrite(const char *pcBuf, uint32_t ui32Len)
 {
 #ifdef UART_BUFFERED
     unsigned int uIdx;
+    uint32_t ui32Run;
+    uint32_t ui32Count;
 
     //
     // Check for valid arguments.
@@ -434,55 +438,59 @@ UARTwrite(const char *pcBuf, uint32_t ui32Len)
     ASSERT(g_ui32Base != 0);
 
     //
-    // Send the characters
+    // The interrupt handler writes its echo through here as well, so keep it
+    // out while we produce into the transmit buffer.
     //
-    for(uIdx = 0; uIdx < ui32Len; uIdx++)
+    MAP_IntDisable(g_ui32UARTInt[g_ui32PortNum]);
+
+    //
+    // Copy the characters in runs that end at the next \n.
+    //
+    uIdx = 0;
+    while(uIdx < ui32Len)
     {
-        //
-        // If the character to the UART is \n, then add a \r before it so that
-        // \n is translated to \n\r in the output.
-        //
-        if(pcBuf[uIdx] == '\n')
+        for(ui32Run = 0; (uIdx + ui32Run) < ui32Len; ui32Run++)
         {
-            if(!TX_BUFFER_FULL)
-            {
-                g_pcUARTTxBuffer[g_ui32UARTTxWriteIndex] = '\r';
-                ADVANCE_TX_BUFFER_INDEX(g_ui32UARTTxWriteIndex);
-            }
-            else
+            if(pcBuf[uIdx + ui32Run] == '\n')
             {
-                //
-                // Buffer is full - discard remaining characters and return.
-                //
                 break;
             }
         }
 
         //
-        // Send the character to the UART output.
+        // If the buffer fills up, discard the remaining characters.
         //
-        if(!TX_BUFFER_FULL)
+        ui32Count = Ring_write(&g_sUARTTxRing, pcBuf + uIdx, ui32Run);
+        uIdx += ui32Count;
+        if((ui32Count < ui32Run) || (uIdx == ui32Len))
         {
-            g_pcUARTTxBuffer[g_ui32UARTTxWriteIndex] = pcBuf[uIdx];
-            ADVANCE_TX_BUFFER_INDEX(g_ui32UARTTxWriteIndex);
+            break;
         }
-        else
+
+        //
+        // The character to the UART is \n, so add a \r before it so that
+        // \n is translated to \n\r in the output.  If only the \r fits, it
+        // is sent but the \n is not counted.
+        //
+        if(Ring_write(&g_sUARTTxRing, "\r\n", 2) < 2)
         {
-            //
-            // Buffer is full - discard remaining characters and return.
-            //
             break;
         }
+        uIdx++;
     }
 
+    MAP_IntEnable(g_ui32UARTInt[g_ui32PortNum]);
+
     //
     // If we have anything in the buffer, make sure that the UART is set
     // up to transmit it.
     //
-    if(!TX_BUFFER_EMPTY)
+    if(Ring_count(&g_sUARTTxRing) != 0)
     {
         UARTPrimeTransmit(g_ui32Base);
+#ifndef UART_BUFFERED_DMA
         MAP_UARTIntEnable(g_ui32Base, UART_INT_TX);
+#endif
     }
 
     //
@@ -559,6 +567,7 @@ UARTgets(char *pcBuf, uint32_t ui32Len)
 {
 #ifdef UART_BUFFERED
     uint32_t ui32Count = 0;
+    uint8_t ui8Char;
     int8_t cChar;
 
     //
@@ -582,10 +591,9 @@ UARTgets(char *pcBuf, uint32_t ui32Len)
         //
         // Read the next character from the receive buffer.
         //
-        if(!RX_BUFFER_EMPTY)
+        if(Ring_getByte(&g_sUARTRxRing, &ui8Char))
         {
-            cChar = g_pcUARTRxBuffer[g_ui32UARTRxReadIndex];
-            ADVANCE_RX_BUFFER_INDEX(g_ui32UARTRxReadIndex);
+            cChar = (int8_t)ui8Char;
 
             //
             // See if a newline or escape character was received.
@@ -780,7 +788,7 @@ UARTgetc(void)
     //
     // Wait for a character to be received.
     //
-    while(RX_BUFFER_EMPTY)
+    while(!Ring_getByte(&g_sUARTRxRing, &cChar))
     {
         //
         // Block waiting for a character to be received (if the buffer is
@@ -788,12 +796,6 @@ UARTgetc(void)
         //
     }
 
-    //
-    // Read a character from the buffer.
-    //
-    cChar = g_pcUARTRxBuffer[g_ui32UARTRxReadIndex];
-    ADVANCE_RX_BUFFER_INDEX(g_ui32UARTRxReadIndex);
-
     //
     // Return the character to the caller.
     //
@@ -809,8 +811,134 @@ UARTgetc(void)
 
 //*****************************************************************************
 //
-//! A simple UART based vprintf function supporting \%c, \%d, \%p, \%s, \%u,
-//! \%x, and \%X.
+// Powers of ten up to the largest number of fraction digits printed by \%f
+// and \%q.
+//
+//*****************************************************************************
+#define UART_PRINTF_MAX_PRECISION   9
+
+static const uint32_t g_pui32Pow10[UART_PRINTF_MAX_PRECISION + 1] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+    1000000000
+};
+
+//*****************************************************************************
+//
+// The output of one UARTvprintf() call, staged so that it goes to UARTwrite()
+// in one piece.
+//
+//*****************************************************************************
+typedef struct
+{
+    uint32_t ui32Len;
+    char pcBuf[UART_PRINTF_BUFFER_SIZE];
+}
+tUARTPrintfBuffer;
+
+//*****************************************************************************
+//
+// Appends characters to the staged output.  If the stage fills up, it is
+// written out and reused, so output of any length works; it just takes more
+// than one UARTwrite().
+//
+//*****************************************************************************
+static void
+UARTPrintfPut(tUARTPrintfBuffer *psOut, const char *pcData, uint32_t ui32Len)
+{
+    uint32_t ui32Idx;
+
+    for(ui32Idx = 0; ui32Idx < ui32Len; ui32Idx++)
+    {
+        if(psOut->ui32Len == UART_PRINTF_BUFFER_SIZE)
+        {
+            UARTwrite(psOut->pcBuf, psOut->ui32Len);
+            psOut->ui32Len = 0;
+        }
+        psOut->pcBuf[psOut->ui32Len++] = pcData[ui32Idx];
+    }
+}
+
+//*****************************************************************************
+//
+// Appends ui32Count copies of a fill character to the staged output.
+//
+//*****************************************************************************
+static void
+UARTPrintfFill(tUARTPrintfBuffer *psOut, char cFill, uint32_t ui32Count)
+{
+    while(ui32Count--)
+    {
+        UARTPrintfPut(psOut, &cFill, 1);
+    }
+}
+
+//*****************************************************************************
+//
+// Appends a fixed-point number to the staged output.  The value is given as
+// its integer part and its fraction already scaled to ui32Prec decimal
+// digits; it is padded to ui32Count characters like \%d.  Only integer
+// arithmetic is used, and 64-bit division only for integer parts of 2^32 or
+// more.
+//
+//*****************************************************************************
+static void
+UARTPrintfFixed(tUARTPrintfBuffer *psOut, uint64_t ui64Int, uint32_t ui32Frac,
+                uint32_t ui32Prec, uint32_t ui32Neg, uint32_t ui32Count,
+                char cFill)
+{
+    char pcBuf[32];
+    uint32_t ui32Pos, ui32Int, ui32Len;
+
+    //
+    // Build the digits from the right: fraction, point, integer part.
+    //
+    ui32Pos = sizeof(pcBuf);
+    for(ui32Len = 0; ui32Len < ui32Prec; ui32Len++)
+    {
+        pcBuf[--ui32Pos] = '0' + (ui32Frac % 10);
+        ui32Frac /= 10;
+    }
+    if(ui32Prec)
+    {
+        pcBuf[--ui32Pos] = '.';
+    }
+    while(ui64Int > 0xFFFFFFFF)
+    {
+        pcBuf[--ui32Pos] = '0' + (char)(ui64Int % 10);
+        ui64Int /= 10;
+    }
+    ui32Int = (uint32_t)ui64Int;
+    do
+    {
+        pcBuf[--ui32Pos] = '0' + (ui32Int % 10);
+        ui32Int /= 10;
+    }
+    while(ui32Int);
+
+    //
+    // Pad like the integer conversions: zeros go between the minus sign and
+    // the digits, spaces in front of the sign.
+    //
+    ui32Len = sizeof(pcBuf) - ui32Pos + ui32Neg;
+    ui32Count = (ui32Count > ui32Len) ? (ui32Count - ui32Len) : 0;
+    if(cFill == '0')
+    {
+        UARTPrintfPut(psOut, "-", ui32Neg);
+        UARTPrintfFill(psOut, '0', ui32Count);
+    }
+    else
+    {
+        UARTPrintfFill(psOut, ' ', ui32Count);
+        UARTPrintfPut(psOut, "-", ui32Neg);
+    }
+    UARTPrintfPut(psOut, pcBuf + ui32Pos, sizeof(pcBuf) - ui32Pos);
+}
+
+//*****************************************************************************
+//
+//! A simple UART based vprintf function supporting \%c, \%d, \%f, \%p, \%q,
+//! \%s, \%u, \%x, and \%X.
 //!
 //! \param pcString is the format string.
 //! \param vaArgP is a variable argument list pointer whose content will depend
@@ -822,6 +950,9 @@ UARTgetc(void)
 //!
 //! - \%c to print a character
 //! - \%d or \%i to print a decimal value
+//! - \%f to print a double (or float) value in fixed notation
+//! - \%q\e n to print a signed fixed-point value with \e n fraction bits
+//! (1-31), for example \%q15 for a q15_t; a plain \%q is \%q15
 //! - \%s to print a string
 //! - \%u to print an unsigned decimal value
 //! - \%x to print a hexadecimal value using lower case letters
@@ -830,18 +961,27 @@ UARTgetc(void)
 //! - \%p to print a pointer as a hexadecimal value
 //! - \%\% to print out a \% character
 //!
-//! For \%s, \%d, \%i, \%u, \%p, \%x, and \%X, an optional number may reside
-//! between the \% and the format character, which specifies the minimum number
-//! of characters to use for that value; if preceded by a 0 then the extra
-//! characters will be filled with zeros instead of spaces.  For example,
+//! For \%s, \%d, \%i, \%f, \%q, \%u, \%p, \%x, and \%X, an optional number
+//! may reside between the \% and the format character, which specifies the
+//! minimum number of characters to use for that value; if preceded by a 0 then
+//! the extra characters will be filled with zeros instead of spaces.  For example,
 //! ``\%8d'' will use eight characters to print the decimal value with spaces
 //! added to reach eight; ``\%08d'' will use eight characters as well but will
 //! add zeroes instead of spaces.
 //!
+//! \%f and \%q also take a number of fraction digits after a period, as in
+//! ``\%8.3f'' or ``\%.4q15'', up to nine.  \%f defaults to six; \%q defaults
+//! to the digits needed to resolve one LSB, five for q15.  The digits are
+//! generated with integer arithmetic, without the C library.
+//!
 //! The type of the arguments in the variable arguments list must match the
 //! requirements of the format string.  For example, if an integer was passed
 //! where a string was expected, an error of some kind will most likely occur.
 //!
+//! The output is collected in a buffer of \b UART_PRINTF_BUFFER_SIZE bytes on
+//! the stack and written with a single call to UARTwrite(), or one call per
+//! buffer-full for longer output.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -849,13 +989,22 @@ void
 UARTvprintf(const char *pcString, va_list vaArgP)
 {
     uint32_t ui32Idx, ui32Value, ui32Pos, ui32Count, ui32Base, ui32Neg;
+    uint32_t ui32Prec, ui32Bits, ui32Frac;
+    uint64_t ui64Int;
+    double dValue;
     char *pcStr, pcBuf[16], cFill;
+    tUARTPrintfBuffer sOut;
 
     //
     // Check the arguments.
     //
     ASSERT(pcString != 0);
 
+    //
+    // Start with an empty output stage.
+    //
+    sOut.ui32Len = 0;
+
     //
     // Loop while there are more characters in the string.
     //
@@ -873,7 +1022,7 @@ UARTvprintf(const char *pcString, va_list vaArgP)
         //
         // Write this portion of the string.
         //
-        UARTwrite(pcString, ui32Idx);
+        UARTPrintfPut(&sOut, pcString, ui32Idx);
 
         //
         // Skip the portion of the string that was written.
@@ -891,11 +1040,13 @@ UARTvprintf(const char *pcString, va_list vaArgP)
             pcString++;
 
             //
-            // Set the digit count to zero, and the fill character to space
-            // (in other words, to the defaults).
+            // Set the digit count to zero, the fill character to space and
+            // the precision to unspecified (in other words, to the
+            // defaults).
             //
             ui32Count = 0;
             cFill = ' ';
+            ui32Prec = 0xFFFFFFFF;
 
             //
             // It may be necessary to get back here to process more characters.
@@ -944,6 +1095,27 @@ again:
                     goto again;
                 }
 
+                //
+                // Handle the precision of %f and %q.
+                //
+                case '.':
+                {
+                    //
+                    // Read the number of fraction digits that follows.
+                    //
+                    for(ui32Prec = 0;
+                        (*pcString >= '0') && (*pcString <= '9');
+                        pcString++)
+                    {
+                        ui32Prec = (ui32Prec * 10) + (*pcString - '0');
+                    }
+
+                    //
+                    // Get the next character.
+                    //
+                    goto again;
+                }
+
                 //
                 // Handle the %c command.
                 //
@@ -957,7 +1129,7 @@ again:
                     //
                     // Print out the character.
                     //
-                    UARTwrite((char *)&ui32Value, 1);
+                    UARTPrintfPut(&sOut, (char *)&ui32Value, 1);
 
                     //
                     // This command has been handled.
@@ -1037,7 +1209,7 @@ again:
                     //
                     // Write the string.
                     //
-                    UARTwrite(pcStr, ui32Idx);
+                    UARTPrintfPut(&sOut, pcStr, ui32Idx);
 
                     //
                     // Write any required padding spaces
@@ -1047,7 +1219,7 @@ again:
                         ui32Count -= ui32Idx;
                         while(ui32Count--)
                         {
-                            UARTwrite(" ", 1);
+                            UARTPrintfPut(&sOut, " ", 1);
                         }
                     }
 
@@ -1195,7 +1367,153 @@ convert:
                     //
                     // Write the string.
                     //
-                    UARTwrite(pcBuf, ui32Pos);
+                    UARTPrintfPut(&sOut, pcBuf, ui32Pos);
+
+                    //
+                    // This command has been handled.
+                    //
+                    break;
+                }
+
+                //
+                // Handle the %f command.
+                //
+                case 'f':
+                {
+                    //
+                    // Get the value from the varargs.
+                    //
+                    dValue = va_arg(vaArgP, double);
+
+                    //
+                    // Six fraction digits by default, as in the C library.
+                    //
+                    if(ui32Prec == 0xFFFFFFFF)
+                    {
+                        ui32Prec = 6;
+                    }
+                    else if(ui32Prec > UART_PRINTF_MAX_PRECISION)
+                    {
+                        ui32Prec = UART_PRINTF_MAX_PRECISION;
+                    }
+
+                    //
+                    // Make the value positive and remember the sign.
+                    //
+                    ui32Neg = (dValue < 0) ? 1 : 0;
+                    if(ui32Neg)
+                    {
+                        dValue = -dValue;
+                    }
+
+                    //
+                    // Values that do not fit the 64-bit integer part are
+                    // printed as nan or inf.
+                    //
+                    if(dValue != dValue)
+                    {
+                        UARTPrintfPut(&sOut, "nan", 3);
+                        break;
+                    }
+                    if(dValue >= 18446744073709551616.0)
+                    {
+                        UARTPrintfPut(&sOut, "-inf" + 1 - ui32Neg, 3 + ui32Neg);
+                        break;
+                    }
+
+                    //
+                    // Split off the integer part and round the fraction to
+                    // the precision; this is the only floating-point work.
+                    //
+                    ui64Int = (uint64_t)dValue;
+                    ui32Frac = (uint32_t)(((dValue - (double)ui64Int) *
+                                           g_pui32Pow10[ui32Prec]) + 0.5);
+
+                    //
+                    // Convert the value to ASCII.
+                    //
+                    goto fixed;
+                }
+
+                //
+                // Handle the %q command, a signed fixed-point value with the
+                // number of fraction bits given after the q (%q15, %q31).  A
+                // plain %q is %q15.
+                //
+                case 'q':
+                {
+                    //
+                    // Read the number of fraction bits.
+                    //
+                    for(ui32Bits = 0, ui32Idx = 0;
+                        (*pcString >= '0') && (*pcString <= '9');
+                        pcString++, ui32Idx++)
+                    {
+                        ui32Bits = (ui32Bits * 10) + (*pcString - '0');
+                    }
+                    if(ui32Idx == 0)
+                    {
+                        ui32Bits = 15;
+                    }
+                    if((ui32Bits == 0) || (ui32Bits > 31))
+                    {
+                        UARTPrintfPut(&sOut, "ERROR", 5);
+                        break;
+                    }
+
+                    //
+                    // Get the value from the varargs.  A q15 argument is
+                    // promoted to int like any other short.
+                    //
+                    ui32Value = va_arg(vaArgP, uint32_t);
+
+                    //
+                    // By default, print enough fraction digits to resolve
+                    // one LSB: ceil(bits * log10(2)), capped at nine.
+                    //
+                    if(ui32Prec == 0xFFFFFFFF)
+                    {
+                        ui32Prec = ((ui32Bits * 77) + 255) / 256;
+                    }
+                    if(ui32Prec > UART_PRINTF_MAX_PRECISION)
+                    {
+                        ui32Prec = UART_PRINTF_MAX_PRECISION;
+                    }
+
+                    //
+                    // Make the value positive and remember the sign.
+                    //
+                    ui32Neg = ((int32_t)ui32Value < 0) ? 1 : 0;
+                    if(ui32Neg)
+                    {
+                        ui32Value = 0 - ui32Value;
+                    }
+
+                    //
+                    // Split off the integer part and scale the fraction bits
+                    // to decimal digits, rounding to nearest.
+                    //
+                    ui64Int = ui32Value >> ui32Bits;
+                    ui32Frac = (uint32_t)
+                        ((((uint64_t)(ui32Value & ((1U << ui32Bits) - 1)) *
+                           g_pui32Pow10[ui32Prec]) +
+                          (1U << (ui32Bits - 1))) >> ui32Bits);
+
+fixed:
+                    //
+                    // Rounding may carry into the integer part.
+                    //
+                    if(ui32Frac >= g_pui32Pow10[ui32Prec])
+                    {
+                        ui32Frac -= g_pui32Pow10[ui32Prec];
+                        ui64Int++;
+                    }
+
+                    //
+                    // Write the number.
+                    //
+                    UARTPrintfFixed(&sOut, ui64Int, ui32Frac, ui32Prec,
+                                    ui32Neg, ui32Count, cFill);
 
                     //
                     // This command has been handled.
@@ -1211,7 +1529,7 @@ convert:
                     //
                     // Simply write a single %.
                     //
-                    UARTwrite(pcString - 1, 1);
+                    UARTPrintfPut(&sOut, pcString - 1, 1);
 
                     //
                     // This command has been handled.
@@ -1227,7 +1545,7 @@ convert:
                     //
                     // Indicate an error.
                     //
-                    UARTwrite("ERROR", 5);
+                    UARTPrintfPut(&sOut, "ERROR", 5);
 
                     //
                     // This command has been handled.
@@ -1237,12 +1555,20 @@ convert:
             }
         }
     }
+
+    //
+    // Write everything in one piece.
+    //
+    if(sOut.ui32Len)
+    {
+        UARTwrite(sOut.pcBuf, sOut.ui32Len);
+    }
 }
 
 //*****************************************************************************
 //
-//! A simple UART based printf function supporting \%c, \%d, \%p, \%s, \%u,
-//! \%x, and \%X.
+//! A simple UART based printf function supporting \%c, \%d, \%f, \%p, \%q,
+//! \%s, \%u, \%x, and \%X.
 //!
 //! \param pcString is the format string.
 //! \param ... are the optional arguments, which depend on the contents of the
@@ -1254,6 +1580,9 @@ convert:
 //!
 //! - \%c to print a character
 //! - \%d or \%i to print a decimal value
+//! - \%f to print a double (or float) value in fixed notation
+//! - \%q\e n to print a signed fixed-point value with \e n fraction bits
+//! (1-31), for example \%q15 for a q15_t; a plain \%q is \%q15
 //! - \%s to print a string
 //! - \%u to print an unsigned decimal value
 //! - \%x to print a hexadecimal value using lower case letters
@@ -1262,14 +1591,19 @@ convert:
 //! - \%p to print a pointer as a hexadecimal value
 //! - \%\% to print out a \% character
 //!
-//! For \%s, \%d, \%i, \%u, \%p, \%x, and \%X, an optional number may reside
-//! between the \% and the format character, which specifies the minimum number
-//! of characters to use for that value; if preceded by a 0 then the extra
-//! characters will be filled with zeros instead of spaces.  For example,
+//! For \%s, \%d, \%i, \%f, \%q, \%u, \%p, \%x, and \%X, an optional number
+//! may reside between the \% and the format character, which specifies the
+//! minimum number of characters to use for that value; if preceded by a 0 then
+//! the extra characters will be filled with zeros instead of spaces.  For example,
 //! ``\%8d'' will use eight characters to print the decimal value with spaces
 //! added to reach eight; ``\%08d'' will use eight characters as well but will
 //! add zeroes instead of spaces.
 //!
+//! \%f and \%q also take a number of fraction digits after a period, as in
+//! ``\%8.3f'' or ``\%.4q15'', up to nine.  \%f defaults to six; \%q defaults
+//! to the digits needed to resolve one LSB, five for q15.  The digits are
+//! generated with integer arithmetic, without the C library.
+//!
 //! The type of the arguments after \e pcString must match the requirements of
 //! the format string.  For example, if an integer was passed where a string
 //! was expected, an error of some kind will most likely occur.
@@ -1310,7 +1644,7 @@ UARTprintf(const char *pcString, ...)
 int
 UARTRxBytesAvail(void)
 {
-    return(RX_BUFFER_USED);
+    return(Ring_count(&g_sUARTRxRing));
 }
 #endif
 
@@ -1329,7 +1663,7 @@ UARTRxBytesAvail(void)
 int
 UARTTxBytesFree(void)
 {
-    return(TX_BUFFER_FREE);
+    return(Ring_space(&g_sUARTTxRing));
 }
 #endif
 
@@ -1358,33 +1692,25 @@ UARTPeek(unsigned char ucChar)
 {
     int iCount;
     int iAvail;
-    uint32_t ui32ReadIndex;
 
     //
     // How many characters are there in the receive buffer?
     //
-    iAvail = (int)RX_BUFFER_USED;
-    ui32ReadIndex = g_ui32UARTRxReadIndex;
+    iAvail = (int)Ring_count(&g_sUARTRxRing);
 
     //
     // Check all the unread characters looking for the one passed.
     //
     for(iCount = 0; iCount < iAvail; iCount++)
     {
-        if(g_pcUARTRxBuffer[ui32ReadIndex] == ucChar)
+        if(*(unsigned char *)Ring_at(&g_sUARTRxRing, (uint32_t)iCount) ==
+           ucChar)
         {
             //
             // We found it so return the index
             //
             return(iCount);
         }
-        else
-        {
-            //
-            // This one didn't match so move on to the next character.
-            //
-            ADVANCE_RX_BUFFER_INDEX(ui32ReadIndex);
-        }
     }
 
     //
@@ -1420,8 +1746,7 @@ UARTFlushRx(void)
     //
     // Flush the receive buffer.
     //
-    g_ui32UARTRxReadIndex = 0;
-    g_ui32UARTRxWriteIndex = 0;
+    Ring_reset(&g_sUARTRxRing);
 
     //
     // If interrupts were enabled when we turned them off, turn them
@@ -1467,11 +1792,20 @@ UARTFlushTx(bool bDiscard)
         //
         ui32Int = MAP_IntMasterDisable();
 
+#ifdef UART_BUFFERED_DMA
+        //
+        // Stop any transfer in flight.  Bytes already in the FIFO still go
+        // out.
+        //
+        MAP_uDMAChannelDisable(g_ui32UARTTxDMAChannel[g_ui32PortNum]);
+        MAP_UARTIntDisable(g_ui32Base, UART_INT_DMATX);
+        g_ui32UARTTxDMACount = 0;
+#endif
+
         //
         // Flush the transmit buffer.
         //
-        g_ui32UARTTxReadIndex = 0;
-        g_ui32UARTTxWriteIndex = 0;
+        Ring_reset(&g_sUARTTxRing);
 
         //
         // If interrupts were enabled when we turned them off, turn them
@@ -1487,7 +1821,7 @@ UARTFlushTx(bool bDiscard)
         //
         // Wait for all remaining data to be transmitted before returning.
         //
-        while(!TX_BUFFER_EMPTY)
+        while(Ring_count(&g_sUARTTxRing) != 0)
         {
         }
     }
@@ -1522,6 +1856,31 @@ UARTEchoSet(bool bEnable)
 }
 #endif
 
+//*****************************************************************************
+//
+//! Sets the function told about UART events.
+//!
+//! \param pfnCallback is the function to call, or NULL for none.
+//!
+//! This function, available only when the module is built to operate in
+//! buffered mode using \b UART_BUFFERED, lets an event-driven application
+//! sleep instead of polling the buffers.  The callback runs in the UART
+//! interrupt handler, once per interrupt, with \b UART_EVENT_RX_LINE set if a
+//! line end was stored in the receive buffer, so that UARTgets() will not
+//! block, and \b UART_EVENT_TX_EMPTY set if the transmit buffer ran empty.
+//! It should only post work for later.
+//!
+//! \return None.
+//
+//*****************************************************************************
+#if defined(UART_BUFFERED) || defined(DOXYGEN)
+void
+UARTEventCallbackSet(tUARTEventCallback pfnCallback)
+{
+    g_pfnEventCallback = pfnCallback;
+}
+#endif
+
 //*****************************************************************************
 //
 //! Handles UART interrupts.
@@ -1531,6 +1890,10 @@ UARTEchoSet(bool bEnable)
 //! will copy data from the UART receive FIFO to the receive buffer if data is
 //! available.
 //!
+//! When built with \b UART_BUFFERED_DMA, the uDMA copies the transmit
+//! buffer to the FIFO and this function only runs when a transfer completes,
+//! to release the sent bytes and start the next transfer.
+//!
 //! \return None.
 //
 //*****************************************************************************
@@ -1539,6 +1902,7 @@ void
 UART0_IRQHandler(void)
 {
     uint32_t ui32Ints;
+    uint32_t ui32Events = 0;
     int8_t cChar;
     int32_t i32Char;
     static bool bLastWasCR = false;
@@ -1549,6 +1913,31 @@ UART0_IRQHandler(void)
     ui32Ints = MAP_UARTIntStatus(g_ui32Base, true);
     MAP_UARTIntClear(g_ui32Base, ui32Ints);
 
+#ifdef UART_BUFFERED_DMA
+    //
+    // Are we being interrupted because a transmit transfer completed?
+    //
+    if((ui32Ints & UART_INT_DMATX) &&
+       !MAP_uDMAChannelIsEnabled(g_ui32UARTTxDMAChannel[g_ui32PortNum]))
+    {
+        //
+        // Release the bytes it sent and start on the next run, which is the
+        // wrapped remainder if the data ran past the end of the buffer.
+        //
+        MAP_UARTIntDisable(g_ui32Base, UART_INT_DMATX);
+        Ring_release(&g_sUARTTxRing, g_ui32UARTTxDMACount);
+        g_ui32UARTTxDMACount = 0;
+        UARTPrimeTransmit(g_ui32Base);
+
+        //
+        // Nothing left to start another transfer with?
+        //
+        if(Ring_count(&g_sUARTTxRing) == 0)
+        {
+            ui32Events |= UART_EVENT_TX_EMPTY;
+        }
+    }
+#else
     //
     // Are we being interrupted because the TX FIFO has space available?
     //
@@ -1562,11 +1951,13 @@ UART0_IRQHandler(void)
         //
         // If the output buffer is empty, turn off the transmit interrupt.
         //
-        if(TX_BUFFER_EMPTY)
+        if(Ring_count(&g_sUARTTxRing) == 0)
         {
             MAP_UARTIntDisable(g_ui32Base, UART_INT_TX);
+            ui32Events |= UART_EVENT_TX_EMPTY;
         }
     }
+#endif
 
     //
     // Are we being interrupted due to a received character?
@@ -1599,27 +1990,16 @@ UART0_IRQHandler(void)
                 {
                     //
                     // If there are any characters already in the buffer, then
-                    // delete the last.
+                    // delete the last.  The ring refuses to take back one
+                    // UARTgets() may already have read.
                     //
-                    if(!RX_BUFFER_EMPTY)
+                    if(Ring_retract(&g_sUARTRxRing, 1) != 0)
                     {
                         //
                         // Rub out the previous character on the users
                         // terminal.
                         //
                         UARTwrite("\b \b", 3);
-
-                        //
-                        // Decrement the number of characters in the buffer.
-                        //
-                        if(g_ui32UARTRxWriteIndex == 0)
-                        {
-                            g_ui32UARTRxWriteIndex = UART_RX_BUFFER_SIZE - 1;
-                        }
-                        else
-                        {
-                            g_ui32UARTRxWriteIndex--;
-                        }
                     }
 
                     //
@@ -1671,14 +2051,8 @@ UART0_IRQHandler(void)
             // If there is space in the receive buffer, put the character
             // there, otherwise throw it away.
             //
-            if(!RX_BUFFER_FULL)
+            if(Ring_putByte(&g_sUARTRxRing, (uint8_t)(i32Char & 0xFF)))
             {
-                //
-                // Store the new character in the receive buffer
-                //
-                g_pcUARTRxBuffer[g_ui32UARTRxWriteIndex] =
-                    (unsigned char)(i32Char & 0xFF);
-                ADVANCE_RX_BUFFER_INDEX(g_ui32UARTRxWriteIndex);
 
                 //
                 // If echo is enabled, write the character to the transmit
@@ -1688,6 +2062,14 @@ UART0_IRQHandler(void)
                 {
                     UARTwrite((const char *)&cChar, 1);
                 }
+
+                //
+                // A whole line is now waiting for UARTgets().
+                //
+                if((cChar == '\r') || (cChar == '\n'))
+                {
+                    ui32Events |= UART_EVENT_RX_LINE;
+                }
             }
         }
 
@@ -1696,7 +2078,17 @@ UART0_IRQHandler(void)
         // gets transmitted.
         //
         UARTPrimeTransmit(g_ui32Base);
+#ifndef UART_BUFFERED_DMA
         MAP_UARTIntEnable(g_ui32Base, UART_INT_TX);
+#endif
+    }
+
+    //
+    // Tell the application what happened, once for this interrupt.
+    //
+    if((ui32Events != 0) && (g_pfnEventCallback != NULL))
+    {
+        g_pfnEventCallback(ui32Events);
     }
 }
 #endif
@@ -36,6 +36,16 @@ extern "C"
 {
 #endif
 
+//*****************************************************************************
+//
+// UART_BUFFERED_DMA is buffered operation with the transmit buffer drained by
+// the uDMA instead of the TX FIFO interrupt.  It implies UART_BUFFERED.
+//
+//*****************************************************************************
+#if defined(UART_BUFFERED_DMA) && !defined(UART_BUFFERED)
+#define UART_BUFFERED
+#endif
+
 //*****************************************************************************
 //
 // If built for buffered operation, the following labels define the sizes of
@@ -51,6 +61,43 @@ extern "C"
 #endif
 #endif
 
+//*****************************************************************************
+//
+// In buffered operation, the interrupt handler reports these events to the
+// callback set with UARTEventCallbackSet(), from interrupt context.
+//
+//*****************************************************************************
+#ifdef UART_BUFFERED
+#define UART_EVENT_RX_LINE      0x00000001  // A line end was received
+#define UART_EVENT_TX_EMPTY     0x00000002  // The transmit buffer drained
+
+typedef void (*tUARTEventCallback)(uint32_t ui32Events);
+#endif
+
+//*****************************************************************************
+//
+// UARTvprintf() collects its output in a buffer of this many bytes on the
+// stack, and writes it with one UARTwrite() call per buffer-full.
+//
+//*****************************************************************************
+#ifndef UART_PRINTF_BUFFER_SIZE
+#define UART_PRINTF_BUFFER_SIZE 128
+#endif
+
+//*****************************************************************************
+//
+// If built for uDMA transmit, the following label defines the largest number
+// of bytes moved by one transfer, and so taken out of the transmit buffer
+// until it completes.  Larger runs mean fewer interrupts but release the
+// buffer in coarser steps.
+//
+//*****************************************************************************
+#ifdef UART_BUFFERED_DMA
+#ifndef UART_TX_DMA_RUN_SIZE
+#define UART_TX_DMA_RUN_SIZE    128
+#endif
+#endif
+
 //*****************************************************************************
 //
 // Prototypes for the APIs.
@@ -70,6 +117,7 @@ extern void UARTFlushRx(void);
 extern int UARTRxBytesAvail(void);
 extern int UARTTxBytesFree(void);
 extern void UARTEchoSet(bool bEnable);
+extern void UARTEventCallbackSet(tUARTEventCallback pfnCallback);
 #endif
 
 //*****************************************************************************
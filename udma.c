@@ -0,0 +1,39 @@
+/*
+ *  ======== udma.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#if !defined(HOST_BUILD)
+#include <ti/devices/msp432e4/driverlib/driverlib.h>
+#endif
+
+#include "udma.h"
+
+#if !defined(HOST_BUILD)
+/* The uDMA control table must be aligned to its own size */
+static tDMAControlTable controlTable[64] __attribute__((aligned(1024)));
+
+static bool initialized = false;
+#endif
+
+/*
+ *  ======== Udma_init ========
+ */
+void Udma_init(void)
+{
+#if !defined(HOST_BUILD)
+    if (initialized) {
+        return;
+    }
+
+    MAP_SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    while (!MAP_SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA)) {
+    }
+
+    MAP_uDMAEnable();
+    MAP_uDMAControlBaseSet(controlTable);
+
+    initialized = true;
+#endif
+}
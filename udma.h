@@ -0,0 +1,29 @@
+/*
+ *  ======== udma.h ========
+ *  Shared setup of the uDMA controller.
+ *
+ *  The device has one uDMA control table for all 32 channels.  Every
+ *  module that owns a channel (the ADC streams in acquire.c, the console
+ *  transmit path of uartstdio.c built with UART_BUFFERED_DMA) calls
+ *  Udma_init() before configuring it, in any order.
+ *
+ *  With HOST_BUILD there is no controller and Udma_init() does nothing.
+ */
+#ifndef UDMA_H_
+#define UDMA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Enable the uDMA controller and install the control table.
+ *          Only the first call has an effect.
+ */
+extern void Udma_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UDMA_H_ */
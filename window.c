@@ -0,0 +1,239 @@
+/*
+ *  ======== window.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "placement.h"
+#include "window.h"
+
+/* Bisection steps for the 2-point ratio; 2^-24 bins is below float32 noise */
+#define RATIO_ITERATIONS    (24)
+
+/*
+ *  Cosine-sum terms, w[n] = sum_m (-1)^m a[m] cos(2 pi m n / N).  These must
+ *  match tools/gen_window_tables.py.
+ */
+static const float32_t rectangularTerms[] = {1.0f};
+static const float32_t hannTerms[] = {0.5f, 0.5f};
+static const float32_t flatTopTerms[] = {
+    0.21557895f, 0.41663158f, 0.277263158f, 0.083578947f, 0.006947368f
+};
+static const float32_t blackmanHarrisTerms[] = {
+    0.35875f, 0.48829f, 0.14128f, 0.01168f
+};
+
+typedef struct {
+    const float32_t  *terms;
+    uint_least8_t     numTerms;
+    const q15_t      *tables[7];    /* 64 to 4096 points */
+} WindowDesc;
+
+static const WindowDesc windows[Window_COUNT] = {
+    {rectangularTerms, 1, {NULL, NULL, NULL, NULL, NULL, NULL, NULL}},
+    {hannTerms, 2,
+     {Window_hann64, Window_hann128, Window_hann256, Window_hann512,
+      Window_hann1024, Window_hann2048, Window_hann4096}},
+    {flatTopTerms, 5,
+     {Window_flatTop64, Window_flatTop128, Window_flatTop256,
+      Window_flatTop512, Window_flatTop1024, Window_flatTop2048,
+      Window_flatTop4096}},
+    {blackmanHarrisTerms, 4,
+     {Window_blackmanHarris64, Window_blackmanHarris128,
+      Window_blackmanHarris256, Window_blackmanHarris512,
+      Window_blackmanHarris1024, Window_blackmanHarris2048,
+      Window_blackmanHarris4096}}
+};
+
+/*
+ *  ======== kernel ========
+ *  For a tone x bins away, the windowed DFT bin is, up to a phase factor
+ *  and for large N,
+ *
+ *      W(x) = sin(pi x) / pi * sum_{m=-M..M} (-1)^m c[|m|] / (x - m)
+ *
+ *  with c[0] = a[0] and c[m] = a[m] / 2.  This returns the sum; x must not
+ *  be an integer in [-M, M].
+ */
+static float32_t kernel(const WindowDesc *desc, float32_t x)
+{
+    float32_t sum = desc->terms[0] / x;
+    float32_t half;
+    uint_least8_t m;
+
+    for (m = 1; m < desc->numTerms; m++) {
+        half = 0.5f * desc->terms[m];
+        if (m & 1) {
+            half = -half;
+        }
+        sum += (half / (x - (float32_t)m)) + (half / (x + (float32_t)m));
+    }
+
+    return (sum);
+}
+
+/*
+ *  ======== response ========
+ *  |W(x)| for 0 <= x <= 0.5; W(0) = a[0], the coherent gain.
+ */
+static float32_t response(const WindowDesc *desc, float32_t x)
+{
+    if (x < 1.0e-6f) {
+        return (desc->terms[0]);
+    }
+
+    return (fabsf((arm_sin_f32(PI * x) / PI) * kernel(desc, x)));
+}
+
+/*
+ *  ======== solveRatio ========
+ *  Find 0 <= d <= 0.5 with |W(d - 1)| / |W(d)| = ratio.  The ratio grows
+ *  monotonically from 0 to 1 over that interval for all supported windows;
+ *  the sin terms cancel, leaving the kernel sums.
+ */
+static float32_t solveRatio(const WindowDesc *desc, float32_t ratio)
+{
+    float32_t lo = 0.0f;
+    float32_t hi = 0.5f;
+    float32_t mid;
+    uint_least8_t i;
+
+    if (ratio <= 0.0f) {
+        return (0.0f);
+    }
+    if (ratio >= 1.0f) {
+        return (0.5f);
+    }
+
+    for (i = 0; i < RATIO_ITERATIONS; i++) {
+        mid = 0.5f * (lo + hi);
+        if (fabsf(kernel(desc, mid - 1.0f)) <
+            (ratio * fabsf(kernel(desc, mid)))) {
+            lo = mid;
+        }
+        else {
+            hi = mid;
+        }
+    }
+
+    return (0.5f * (lo + hi));
+}
+
+/*
+ *  ======== Window_table ========
+ */
+const q15_t *Window_table(Window_Type type, uint16_t len)
+{
+    uint_least8_t idx = 0;
+    uint16_t n;
+
+    if ((type >= Window_COUNT) || (len < Window_MIN_LEN) ||
+        (len > Window_MAX_LEN) || ((len & (len - 1)) != 0)) {
+        return (NULL);
+    }
+
+    for (n = Window_MIN_LEN; n < len; n <<= 1) {
+        idx++;
+    }
+
+    return (windows[type].tables[idx]);
+}
+
+/*
+ *  ======== Window_apply ========
+ *  Runs from SRAM with Placement_WINDOW.
+ */
+Placement_WINDOW_FXN
+void Window_apply(const q15_t *table, Precision_Sample *frame,
+                  uint16_t len)
+{
+#if (PRECISION == PRECISION_F32)
+    uint16_t i;
+
+    for (i = 0; i < len; i++) {
+        frame[i] *= (float32_t)table[i] * (1.0f / 32768.0f);
+    }
+#elif (PRECISION == PRECISION_Q31)
+    uint16_t i;
+
+    /* q31 x q15 >> 15 is q31; the coefficients are below 1.0 */
+    for (i = 0; i < len; i++) {
+        frame[i] = (q31_t)(((int64_t)frame[i] * table[i]) >> 15);
+    }
+#else
+    arm_mult_q15(frame, (q15_t *)table, frame, len);
+#endif
+}
+
+/*
+ *  ======== Window_coherentGain ========
+ */
+float32_t Window_coherentGain(Window_Type type)
+{
+    if (type >= Window_COUNT) {
+        return (0.0f);
+    }
+
+    return (windows[type].terms[0]);
+}
+
+/*
+ *  ======== Window_spread ========
+ */
+uint_least8_t Window_spread(Window_Type type)
+{
+    if (type >= Window_COUNT) {
+        return (0);
+    }
+
+    return (windows[type].numTerms - 1U);
+}
+
+/*
+ *  ======== Window_estimate ========
+ *  2-point: the larger neighbour and the peak give |W(d - 1)| / |W(d)|,
+ *  which is inverted with the window kernel.  Exact for a single tone.
+ *
+ *  3-point: a parabola through the log magnitudes (Gaussian
+ *  interpolation).  Cheaper and window-agnostic, with a small bias.
+ *
+ *  Either way the amplitude is the peak magnitude divided by |W(d)|.
+ */
+int_fast16_t Window_estimate(Window_Type type, Window_Interp method,
+                             float32_t magPrev, float32_t magPeak,
+                             float32_t magNext, Window_Estimate *estimate)
+{
+    const WindowDesc *desc;
+    float32_t offset;
+    float32_t denom;
+
+    if ((type >= Window_COUNT) || (estimate == NULL) || (magPeak <= 0.0f) ||
+        (magPrev < 0.0f) || (magNext < 0.0f) || (magPrev > magPeak) ||
+        (magNext > magPeak)) {
+        return (Window_STATUS_ERROR);
+    }
+
+    desc = &windows[type];
+
+    if (method == Window_INTERP_3POINT) {
+        if ((magPrev <= 0.0f) || (magNext <= 0.0f)) {
+            return (Window_STATUS_ERROR);
+        }
+
+        denom = 2.0f * ((2.0f * logf(magPeak)) - logf(magPrev) -
+                        logf(magNext));
+        offset = (denom > 0.0f) ? (logf(magNext / magPrev) / denom) : 0.0f;
+    }
+    else if (magNext >= magPrev) {
+        offset = solveRatio(desc, magNext / magPeak);
+    }
+    else {
+        offset = -solveRatio(desc, magPrev / magPeak);
+    }
+
+    estimate->offset = offset;
+    estimate->amplitude = magPeak / response(desc, fabsf(offset));
+
+    return (Window_STATUS_SUCCESS);
+}
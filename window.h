@@ -0,0 +1,154 @@
+/*
+ *  ======== window.h ========
+ *  Analysis windows and interpolated harmonic peak estimation.
+ *
+ *  Window coefficients are generated ahead of time by
+ *  tools/gen_window_tables.py into window_tables.c as const q15 tables, one
+ *  per window and supported FFT length, so they are placed in flash (.const)
+ *  and startup does no trig and no RAM copy.  The q31 and f32 analysis
+ *  paths widen the same tables on the fly; their 16-bit coefficients put
+ *  the window's own error near -90 dB, well below the harmonics measured.
+ *
+ *  For frames that do not hold a whole number of cycles, the harmonic peak
+ *  falls between bins.  Window_estimate() recovers the true frequency offset
+ *  and amplitude from the peak bin and its neighbours using the spectral
+ *  kernel of the selected window.  tools/window_error.c tables the error of
+ *  every window and method against the cycles in the frame.
+ */
+#ifndef WINDOW_H_
+#define WINDOW_H_
+
+#include <stdint.h>
+
+#include "arm_math.h"
+
+#include "precision.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief  Successful status code returned by Window_estimate().
+ */
+#define Window_STATUS_SUCCESS   (0)
+
+/*!
+ *  @brief  Returned by Window_estimate() for unusable magnitudes.
+ */
+#define Window_STATUS_ERROR     (-1)
+
+/*!
+ *  @brief  Shortest and longest FFT length with generated tables
+ */
+#define Window_MIN_LEN          (64)
+#define Window_MAX_LEN          (4096)
+
+/*!
+ *  @brief  Supported windows
+ */
+typedef enum {
+    Window_RECTANGULAR = 0,     /*!< No window */
+    Window_HANN,                /*!< Hann */
+    Window_FLAT_TOP,            /*!< 5-term flat-top, for amplitude accuracy */
+    Window_BLACKMAN_HARRIS,     /*!< 4-term Blackman-Harris, for leakage */
+    Window_COUNT
+} Window_Type;
+
+/*!
+ *  @brief  Peak interpolation methods
+ */
+typedef enum {
+    Window_INTERP_2POINT = 0,   /*!< Ratio of the peak and larger neighbour */
+    Window_INTERP_3POINT        /*!< Log-parabola through three bins */
+} Window_Interp;
+
+/*!
+ *  @brief  Interpolated peak
+ */
+typedef struct {
+    float32_t offset;       /*!< True peak position minus peak bin, in bins */
+    float32_t amplitude;    /*!< Amplitude on the scale of an unwindowed bin
+                                 holding the whole tone (A/2) */
+} Window_Estimate;
+
+/*!
+ *  @brief  Look up the coefficient table of a window.
+ *
+ *  @param  type    Window type
+ *  @param  len     FFT length (power of two, Window_MIN_LEN to
+ *                  Window_MAX_LEN)
+ *
+ *  @return The table of @p len q15 coefficients, or NULL for
+ *          Window_RECTANGULAR or an unsupported length
+ */
+extern const q15_t *Window_table(Window_Type type, uint16_t len);
+
+/*!
+ *  @brief  Multiply a frame by a window in place.
+ *
+ *  In q15 this uses the CMSIS SIMD multiply, two samples per 32-bit word.
+ *
+ *  @param  table   Coefficient table from Window_table()
+ *  @param  frame   len samples in the analysis precision
+ *  @param  len     Frame length
+ */
+extern void Window_apply(const q15_t *table, Precision_Sample *frame,
+                         uint16_t len);
+
+/*!
+ *  @brief  Coherent gain (mean coefficient) of a window.
+ */
+extern float32_t Window_coherentGain(Window_Type type);
+
+/*!
+ *  @brief  Bins on each side of a tone centred on a bin that the window
+ *          spreads it into, one less than its cosine terms.
+ */
+extern uint_least8_t Window_spread(Window_Type type);
+
+/*!
+ *  @brief  Estimate the true frequency and amplitude of a spectral peak.
+ *
+ *  @param  type      Window the frame was multiplied with
+ *  @param  method    Window_INTERP_2POINT or Window_INTERP_3POINT
+ *  @param  magPrev   Magnitude of the bin below the peak
+ *  @param  magPeak   Magnitude of the peak bin
+ *  @param  magNext   Magnitude of the bin above the peak
+ *  @param  estimate  Result
+ *
+ *  @return Window_STATUS_SUCCESS or Window_STATUS_ERROR
+ */
+extern int_fast16_t Window_estimate(Window_Type type, Window_Interp method,
+                                    float32_t magPrev, float32_t magPeak,
+                                    float32_t magNext,
+                                    Window_Estimate *estimate);
+
+/* Generated tables, see window_tables.c */
+extern const q15_t Window_hann64[64];
+extern const q15_t Window_hann128[128];
+extern const q15_t Window_hann256[256];
+extern const q15_t Window_hann512[512];
+extern const q15_t Window_hann1024[1024];
+extern const q15_t Window_hann2048[2048];
+extern const q15_t Window_hann4096[4096];
+extern const q15_t Window_flatTop64[64];
+extern const q15_t Window_flatTop128[128];
+extern const q15_t Window_flatTop256[256];
+extern const q15_t Window_flatTop512[512];
+extern const q15_t Window_flatTop1024[1024];
+extern const q15_t Window_flatTop2048[2048];
+extern const q15_t Window_flatTop4096[4096];
+extern const q15_t Window_blackmanHarris64[64];
+extern const q15_t Window_blackmanHarris128[128];
+extern const q15_t Window_blackmanHarris256[256];
+extern const q15_t Window_blackmanHarris512[512];
+extern const q15_t Window_blackmanHarris1024[1024];
+extern const q15_t Window_blackmanHarris2048[2048];
+extern const q15_t Window_blackmanHarris4096[4096];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WINDOW_H_ */
@@ -0,0 +1,2539 @@
+/*
+ *  ======== window_tables.c ========
+ *  Generated by tools/gen_window_tables.py -- do not edit.
+ */
+#include <stdint.h>
+
+#include "window.h"
+
+/* Hann, 64 points */
+const q15_t Window_hann64[64] __attribute__((aligned(4))) = {
+    0, 79, 315, 705, 1247, 1935, 2761, 3719, 4799, 5990,
+    7282, 8661, 10114, 11628, 13188, 14778, 16384, 17990, 19580, 21140,
+    22654, 24107, 25486, 26778, 27969, 29049, 30007, 30833, 31521, 32063,
+    32453, 32689, 32767, 32689, 32453, 32063, 31521, 30833, 30007, 29049,
+    27969, 26778, 25486, 24107, 22654, 21140, 19580, 17990, 16384, 14778,
+    13188, 11628, 10114, 8661, 7282, 5990, 4799, 3719, 2761, 1935,
+    1247, 705, 315, 79
+};
+
+/* Hann, 128 points */
+const q15_t Window_hann128[128] __attribute__((aligned(4))) = {
+    0, 20, 79, 177, 315, 491, 705, 958, 1247, 1573,
+    1935, 2331, 2761, 3224, 3719, 4244, 4799, 5381, 5990, 6624,
+    7282, 7961, 8661, 9379, 10114, 10864, 11628, 12403, 13188, 13980,
+    14778, 15580, 16384, 17188, 17990, 18788, 19580, 20365, 21140, 21904,
+    22654, 23389, 24107, 24807, 25486, 26144, 26778, 27387, 27969, 28524,
+    29049, 29544, 30007, 30437, 30833, 31195, 31521, 31810, 32063, 32277,
+    32453, 32591, 32689, 32748, 32767, 32748, 32689, 32591, 32453, 32277,
+    32063, 31810, 31521, 31195, 30833, 30437, 30007, 29544, 29049, 28524,
+    27969, 27387, 26778, 26144, 25486, 24807, 24107, 23389, 22654, 21904,
+    21140, 20365, 19580, 18788, 17990, 17188, 16384, 15580, 14778, 13980,
+    13188, 12403, 11628, 10864, 10114, 9379, 8661, 7961, 7282, 6624,
+    5990, 5381, 4799, 4244, 3719, 3224, 2761, 2331, 1935, 1573,
+    1247, 958, 705, 491, 315, 177, 79, 20
+};
+
+/* Hann, 256 points */
+const q15_t Window_hann256[256] __attribute__((aligned(4))) = {
+    0, 5, 20, 44, 79, 123, 177, 241, 315, 398,
+    491, 593, 705, 827, 958, 1098, 1247, 1406, 1573, 1749,
+    1935, 2128, 2331, 2542, 2761, 2989, 3224, 3468, 3719, 3978,
+    4244, 4518, 4799, 5087, 5381, 5682, 5990, 6304, 6624, 6950,
+    7282, 7619, 7961, 8308, 8661, 9018, 9379, 9745, 10114, 10487,
+    10864, 11245, 11628, 12014, 12403, 12794, 13188, 13583, 13980, 14378,
+    14778, 15179, 15580, 15982, 16384, 16786, 17188, 17589, 17990, 18390,
+    18788, 19185, 19580, 19974, 20365, 20754, 21140, 21523, 21904, 22281,
+    22654, 23023, 23389, 23750, 24107, 24460, 24807, 25149, 25486, 25818,
+    26144, 26464, 26778, 27086, 27387, 27681, 27969, 28250, 28524, 28790,
+    29049, 29300, 29544, 29779, 30007, 30226, 30437, 30640, 30833, 31019,
+    31195, 31362, 31521, 31670, 31810, 31941, 32063, 32175, 32277, 32370,
+    32453, 32527, 32591, 32645, 32689, 32724, 32748, 32763, 32767, 32763,
+    32748, 32724, 32689, 32645, 32591, 32527, 32453, 32370, 32277, 32175,
+    32063, 31941, 31810, 31670, 31521, 31362, 31195, 31019, 30833, 30640,
+    30437, 30226, 30007, 29779, 29544, 29300, 29049, 28790, 28524, 28250,
+    27969, 27681, 27387, 27086, 26778, 26464, 26144, 25818, 25486, 25149,
+    24807, 24460, 24107, 23750, 23389, 23023, 22654, 22281, 21904, 21523,
+    21140, 20754, 20365, 19974, 19580, 19185, 18788, 18390, 17990, 17589,
+    17188, 16786, 16384, 15982, 15580, 15179, 14778, 14378, 13980, 13583,
+    13188, 12794, 12403, 12014, 11628, 11245, 10864, 10487, 10114, 9745,
+    9379, 9018, 8661, 8308, 7961, 7619, 7282, 6950, 6624, 6304,
+    5990, 5682, 5381, 5087, 4799, 4518, 4244, 3978, 3719, 3468,
+    3224, 2989, 2761, 2542, 2331, 2128, 1935, 1749, 1573, 1406,
+    1247, 1098, 958, 827, 705, 593, 491, 398, 315, 241,
+    177, 123, 79, 44, 20, 5
+};
+
+/* Hann, 512 points */
+const q15_t Window_hann512[512] __attribute__((aligned(4))) = {
+    0, 1, 5, 11, 20, 31, 44, 60, 79, 100,
+    123, 149, 177, 208, 241, 277, 315, 355, 398, 443,
+    491, 541, 593, 648, 705, 765, 827, 891, 958, 1027,
+    1098, 1171, 1247, 1325, 1406, 1488, 1573, 1660, 1749, 1841,
+    1935, 2030, 2128, 2229, 2331, 2435, 2542, 2651, 2761, 2874,
+    2989, 3105, 3224, 3345, 3468, 3592, 3719, 3847, 3978, 4110,
+    4244, 4380, 4518, 4657, 4799, 4942, 5087, 5233, 5381, 5531,
+    5682, 5835, 5990, 6146, 6304, 6463, 6624, 6786, 6950, 7115,
+    7282, 7449, 7619, 7789, 7961, 8134, 8308, 8484, 8661, 8839,
+    9018, 9198, 9379, 9561, 9745, 9929, 10114, 10300, 10487, 10676,
+    10864, 11054, 11245, 11436, 11628, 11821, 12014, 12208, 12403, 12598,
+    12794, 12991, 13188, 13385, 13583, 13781, 13980, 14179, 14378, 14578,
+    14778, 14978, 15179, 15379, 15580, 15781, 15982, 16183, 16384, 16585,
+    16786, 16987, 17188, 17389, 17589, 17790, 17990, 18190, 18390, 18589,
+    18788, 18987, 19185, 19383, 19580, 19777, 19974, 20170, 20365, 20560,
+    20754, 20947, 21140, 21332, 21523, 21714, 21904, 22092, 22281, 22468,
+    22654, 22839, 23023, 23207, 23389, 23570, 23750, 23929, 24107, 24284,
+    24460, 24634, 24807, 24979, 25149, 25319, 25486, 25653, 25818, 25982,
+    26144, 26305, 26464, 26622, 26778, 26933, 27086, 27237, 27387, 27535,
+    27681, 27826, 27969, 28111, 28250, 28388, 28524, 28658, 28790, 28921,
+    29049, 29176, 29300, 29423, 29544, 29663, 29779, 29894, 30007, 30117,
+    30226, 30333, 30437, 30539, 30640, 30738, 30833, 30927, 31019, 31108,
+    31195, 31280, 31362, 31443, 31521, 31597, 31670, 31741, 31810, 31877,
+    31941, 32003, 32063, 32120, 32175, 32227, 32277, 32325, 32370, 32413,
+    32453, 32491, 32527, 32560, 32591, 32619, 32645, 32668, 32689, 32708,
+    32724, 32737, 32748, 32757, 32763, 32767, 32767, 32767, 32763, 32757,
+    32748, 32737, 32724, 32708, 32689, 32668, 32645, 32619, 32591, 32560,
+    32527, 32491, 32453, 32413, 32370, 32325, 32277, 32227, 32175, 32120,
+    32063, 32003, 31941, 31877, 31810, 31741, 31670, 31597, 31521, 31443,
+    31362, 31280, 31195, 31108, 31019, 30927, 30833, 30738, 30640, 30539,
+    30437, 30333, 30226, 30117, 30007, 29894, 29779, 29663, 29544, 29423,
+    29300, 29176, 29049, 28921, 28790, 28658, 28524, 28388, 28250, 28111,
+    27969, 27826, 27681, 27535, 27387, 27237, 27086, 26933, 26778, 26622,
+    26464, 26305, 26144, 25982, 25818, 25653, 25486, 25319, 25149, 24979,
+    24807, 24634, 24460, 24284, 24107, 23929, 23750, 23570, 23389, 23207,
+    23023, 22839, 22654, 22468, 22281, 22092, 21904, 21714, 21523, 21332,
+    21140, 20947, 20754, 20560, 20365, 20170, 19974, 19777, 19580, 19383,
+    19185, 18987, 18788, 18589, 18390, 18190, 17990, 17790, 17589, 17389,
+    17188, 16987, 16786, 16585, 16384, 16183, 15982, 15781, 15580, 15379,
+    15179, 14978, 14778, 14578, 14378, 14179, 13980, 13781, 13583, 13385,
+    13188, 12991, 12794, 12598, 12403, 12208, 12014, 11821, 11628, 11436,
+    11245, 11054, 10864, 10676, 10487, 10300, 10114, 9929, 9745, 9561,
+    9379, 9198, 9018, 8839, 8661, 8484, 8308, 8134, 7961, 7789,
+    7619, 7449, 7282, 7115, 6950, 6786, 6624, 6463, 6304, 6146,
+    5990, 5835, 5682, 5531, 5381, 5233, 5087, 4942, 4799, 4657,
+    4518, 4380, 4244, 4110, 3978, 3847, 3719, 3592, 3468, 3345,
+    3224, 3105, 2989, 2874, 2761, 2651, 2542, 2435, 2331, 2229,
+    2128, 2030, 1935, 1841, 1749, 1660, 1573, 1488, 1406, 1325,
+    1247, 1171, 1098, 1027, 958, 891, 827, 765, 705, 648,
+    593, 541, 491, 443, 398, 355, 315, 277, 241, 208,
+    177, 149, 123, 100, 79, 60, 44, 31, 20, 11,
+    5, 1
+};
+
+/* Hann, 1024 points */
+const q15_t Window_hann1024[1024] __attribute__((aligned(4))) = {
+    0, 0, 1, 3, 5, 8, 11, 15, 20, 25,
+    31, 37, 44, 52, 60, 69, 79, 89, 100, 111,
+    123, 136, 149, 163, 177, 192, 208, 224, 241, 259,
+    277, 296, 315, 335, 355, 376, 398, 420, 443, 467,
+    491, 516, 541, 567, 593, 621, 648, 677, 705, 735,
+    765, 796, 827, 859, 891, 924, 958, 992, 1027, 1062,
+    1098, 1134, 1171, 1209, 1247, 1286, 1325, 1365, 1406, 1447,
+    1488, 1530, 1573, 1616, 1660, 1704, 1749, 1795, 1841, 1887,
+    1935, 1982, 2030, 2079, 2128, 2178, 2229, 2280, 2331, 2383,
+    2435, 2488, 2542, 2596, 2651, 2706, 2761, 2817, 2874, 2931,
+    2989, 3047, 3105, 3165, 3224, 3284, 3345, 3406, 3468, 3530,
+    3592, 3655, 3719, 3783, 3847, 3912, 3978, 4044, 4110, 4177,
+    4244, 4312, 4380, 4449, 4518, 4587, 4657, 4728, 4799, 4870,
+    4942, 5014, 5087, 5160, 5233, 5307, 5381, 5456, 5531, 5606,
+    5682, 5759, 5835, 5913, 5990, 6068, 6146, 6225, 6304, 6383,
+    6463, 6543, 6624, 6705, 6786, 6868, 6950, 7032, 7115, 7198,
+    7282, 7365, 7449, 7534, 7619, 7704, 7789, 7875, 7961, 8047,
+    8134, 8221, 8308, 8396, 8484, 8572, 8661, 8749, 8839, 8928,
+    9018, 9108, 9198, 9288, 9379, 9470, 9561, 9653, 9745, 9837,
+    9929, 10021, 10114, 10207, 10300, 10394, 10487, 10581, 10676, 10770,
+    10864, 10959, 11054, 11149, 11245, 11340, 11436, 11532, 11628, 11724,
+    11821, 11917, 12014, 12111, 12208, 12306, 12403, 12501, 12598, 12696,
+    12794, 12892, 12991, 13089, 13188, 13286, 13385, 13484, 13583, 13682,
+    13781, 13881, 13980, 14079, 14179, 14279, 14378, 14478, 14578, 14678,
+    14778, 14878, 14978, 15078, 15179, 15279, 15379, 15480, 15580, 15680,
+    15781, 15881, 15982, 16082, 16183, 16283, 16384, 16485, 16585, 16686,
+    16786, 16887, 16987, 17088, 17188, 17288, 17389, 17489, 17589, 17690,
+    17790, 17890, 17990, 18090, 18190, 18290, 18390, 18489, 18589, 18689,
+    18788, 18887, 18987, 19086, 19185, 19284, 19383, 19482, 19580, 19679,
+    19777, 19876, 19974, 20072, 20170, 20267, 20365, 20462, 20560, 20657,
+    20754, 20851, 20947, 21044, 21140, 21236, 21332, 21428, 21523, 21619,
+    21714, 21809, 21904, 21998, 22092, 22187, 22281, 22374, 22468, 22561,
+    22654, 22747, 22839, 22931, 23023, 23115, 23207, 23298, 23389, 23480,
+    23570, 23660, 23750, 23840, 23929, 24019, 24107, 24196, 24284, 24372,
+    24460, 24547, 24634, 24721, 24807, 24893, 24979, 25064, 25149, 25234,
+    25319, 25403, 25486, 25570, 25653, 25736, 25818, 25900, 25982, 26063,
+    26144, 26225, 26305, 26385, 26464, 26543, 26622, 26700, 26778, 26855,
+    26933, 27009, 27086, 27162, 27237, 27312, 27387, 27461, 27535, 27608,
+    27681, 27754, 27826, 27898, 27969, 28040, 28111, 28181, 28250, 28319,
+    28388, 28456, 28524, 28591, 28658, 28724, 28790, 28856, 28921, 28985,
+    29049, 29113, 29176, 29238, 29300, 29362, 29423, 29484, 29544, 29603,
+    29663, 29721, 29779, 29837, 29894, 29951, 30007, 30062, 30117, 30172,
+    30226, 30280, 30333, 30385, 30437, 30488, 30539, 30590, 30640, 30689,
+    30738, 30786, 30833, 30881, 30927, 30973, 31019, 31064, 31108, 31152,
+    31195, 31238, 31280, 31321, 31362, 31403, 31443, 31482, 31521, 31559,
+    31597, 31634, 31670, 31706, 31741, 31776, 31810, 31844, 31877, 31909,
+    31941, 31972, 32003, 32033, 32063, 32091, 32120, 32147, 32175, 32201,
+    32227, 32252, 32277, 32301, 32325, 32348, 32370, 32392, 32413, 32433,
+    32453, 32472, 32491, 32509, 32527, 32544, 32560, 32576, 32591, 32605,
+    32619, 32632, 32645, 32657, 32668, 32679, 32689, 32699, 32708, 32716,
+    32724, 32731, 32737, 32743, 32748, 32753, 32757, 32760, 32763, 32765,
+    32767, 32767, 32767, 32767, 32767, 32765, 32763, 32760, 32757, 32753,
+    32748, 32743, 32737, 32731, 32724, 32716, 32708, 32699, 32689, 32679,
+    32668, 32657, 32645, 32632, 32619, 32605, 32591, 32576, 32560, 32544,
+    32527, 32509, 32491, 32472, 32453, 32433, 32413, 32392, 32370, 32348,
+    32325, 32301, 32277, 32252, 32227, 32201, 32175, 32147, 32120, 32091,
+    32063, 32033, 32003, 31972, 31941, 31909, 31877, 31844, 31810, 31776,
+    31741, 31706, 31670, 31634, 31597, 31559, 31521, 31482, 31443, 31403,
+    31362, 31321, 31280, 31238, 31195, 31152, 31108, 31064, 31019, 30973,
+    30927, 30881, 30833, 30786, 30738, 30689, 30640, 30590, 30539, 30488,
+    30437, 30385, 30333, 30280, 30226, 30172, 30117, 30062, 30007, 29951,
+    29894, 29837, 29779, 29721, 29663, 29603, 29544, 29484, 29423, 29362,
+    29300, 29238, 29176, 29113, 29049, 28985, 28921, 28856, 28790, 28724,
+    28658, 28591, 28524, 28456, 28388, 28319, 28250, 28181, 28111, 28040,
+    27969, 27898, 27826, 27754, 27681, 27608, 27535, 27461, 27387, 27312,
+    27237, 27162, 27086, 27009, 26933, 26855, 26778, 26700, 26622, 26543,
+    26464, 26385, 26305, 26225, 26144, 26063, 25982, 25900, 25818, 25736,
+    25653, 25570, 25486, 25403, 25319, 25234, 25149, 25064, 24979, 24893,
+    24807, 24721, 24634, 24547, 24460, 24372, 24284, 24196, 24107, 24019,
+    23929, 23840, 23750, 23660, 23570, 23480, 23389, 23298, 23207, 23115,
+    23023, 22931, 22839, 22747, 22654, 22561, 22468, 22374, 22281, 22187,
+    22092, 21998, 21904, 21809, 21714, 21619, 21523, 21428, 21332, 21236,
+    21140, 21044, 20947, 20851, 20754, 20657, 20560, 20462, 20365, 20267,
+    20170, 20072, 19974, 19876, 19777, 19679, 19580, 19482, 19383, 19284,
+    19185, 19086, 18987, 18887, 18788, 18689, 18589, 18489, 18390, 18290,
+    18190, 18090, 17990, 17890, 17790, 17690, 17589, 17489, 17389, 17288,
+    17188, 17088, 16987, 16887, 16786, 16686, 16585, 16485, 16384, 16283,
+    16183, 16082, 15982, 15881, 15781, 15680, 15580, 15480, 15379, 15279,
+    15179, 15078, 14978, 14878, 14778, 14678, 14578, 14478, 14378, 14279,
+    14179, 14079, 13980, 13881, 13781, 13682, 13583, 13484, 13385, 13286,
+    13188, 13089, 12991, 12892, 12794, 12696, 12598, 12501, 12403, 12306,
+    12208, 12111, 12014, 11917, 11821, 11724, 11628, 11532, 11436, 11340,
+    11245, 11149, 11054, 10959, 10864, 10770, 10676, 10581, 10487, 10394,
+    10300, 10207, 10114, 10021, 9929, 9837, 9745, 9653, 9561, 9470,
+    9379, 9288, 9198, 9108, 9018, 8928, 8839, 8749, 8661, 8572,
+    8484, 8396, 8308, 8221, 8134, 8047, 7961, 7875, 7789, 7704,
+    7619, 7534, 7449, 7365, 7282, 7198, 7115, 7032, 6950, 6868,
+    6786, 6705, 6624, 6543, 6463, 6383, 6304, 6225, 6146, 6068,
+    5990, 5913, 5835, 5759, 5682, 5606, 5531, 5456, 5381, 5307,
+    5233, 5160, 5087, 5014, 4942, 4870, 4799, 4728, 4657, 4587,
+    4518, 4449, 4380, 4312, 4244, 4177, 4110, 4044, 3978, 3912,
+    3847, 3783, 3719, 3655, 3592, 3530, 3468, 3406, 3345, 3284,
+    3224, 3165, 3105, 3047, 2989, 2931, 2874, 2817, 2761, 2706,
+    2651, 2596, 2542, 2488, 2435, 2383, 2331, 2280, 2229, 2178,
+    2128, 2079, 2030, 1982, 1935, 1887, 1841, 1795, 1749, 1704,
+    1660, 1616, 1573, 1530, 1488, 1447, 1406, 1365, 1325, 1286,
+    1247, 1209, 1171, 1134, 1098, 1062, 1027, 992, 958, 924,
+    891, 859, 827, 796, 765, 735, 705, 677, 648, 621,
+    593, 567, 541, 516, 491, 467, 443, 420, 398, 376,
+    355, 335, 315, 296, 277, 259, 241, 224, 208, 192,
+    177, 163, 149, 136, 123, 111, 100, 89, 79, 69,
+    60, 52, 44, 37, 31, 25, 20, 15, 11, 8,
+    5, 3, 1, 0
+};
+
+/* Hann, 2048 points */
+const q15_t Window_hann2048[2048] __attribute__((aligned(4))) = {
+    0, 0, 0, 1, 1, 2, 3, 4, 5, 6,
+    8, 9, 11, 13, 15, 17, 20, 22, 25, 28,
+    31, 34, 37, 41, 44, 48, 52, 56, 60, 65,
+    69, 74, 79, 84, 89, 94, 100, 105, 111, 117,
+    123, 129, 136, 142, 149, 156, 163, 170, 177, 185,
+    192, 200, 208, 216, 224, 233, 241, 250, 259, 268,
+    277, 286, 296, 305, 315, 325, 335, 345, 355, 366,
+    376, 387, 398, 409, 420, 432, 443, 455, 467, 479,
+    491, 503, 516, 528, 541, 554, 567, 580, 593, 607,
+    621, 634, 648, 662, 677, 691, 705, 720, 735, 750,
+    765, 780, 796, 811, 827, 843, 859, 875, 891, 908,
+    924, 941, 958, 975, 992, 1009, 1027, 1044, 1062, 1080,
+    1098, 1116, 1134, 1153, 1171, 1190, 1209, 1228, 1247, 1266,
+    1286, 1306, 1325, 1345, 1365, 1385, 1406, 1426, 1447, 1467,
+    1488, 1509, 1530, 1552, 1573, 1595, 1616, 1638, 1660, 1682,
+    1704, 1727, 1749, 1772, 1795, 1818, 1841, 1864, 1887, 1911,
+    1935, 1958, 1982, 2006, 2030, 2055, 2079, 2104, 2128, 2153,
+    2178, 2203, 2229, 2254, 2280, 2305, 2331, 2357, 2383, 2409,
+    2435, 2462, 2488, 2515, 2542, 2569, 2596, 2623, 2651, 2678,
+    2706, 2733, 2761, 2789, 2817, 2846, 2874, 2902, 2931, 2960,
+    2989, 3018, 3047, 3076, 3105, 3135, 3165, 3194, 3224, 3254,
+    3284, 3315, 3345, 3376, 3406, 3437, 3468, 3499, 3530, 3561,
+    3592, 3624, 3655, 3687, 3719, 3751, 3783, 3815, 3847, 3880,
+    3912, 3945, 3978, 4011, 4044, 4077, 4110, 4144, 4177, 4211,
+    4244, 4278, 4312, 4346, 4380, 4414, 4449, 4483, 4518, 4553,
+    4587, 4622, 4657, 4693, 4728, 4763, 4799, 4834, 4870, 4906,
+    4942, 4978, 5014, 5050, 5087, 5123, 5160, 5196, 5233, 5270,
+    5307, 5344, 5381, 5418, 5456, 5493, 5531, 5569, 5606, 5644,
+    5682, 5721, 5759, 5797, 5835, 5874, 5913, 5951, 5990, 6029,
+    6068, 6107, 6146, 6186, 6225, 6264, 6304, 6344, 6383, 6423,
+    6463, 6503, 6543, 6584, 6624, 6664, 6705, 6746, 6786, 6827,
+    6868, 6909, 6950, 6991, 7032, 7074, 7115, 7157, 7198, 7240,
+    7282, 7323, 7365, 7407, 7449, 7492, 7534, 7576, 7619, 7661,
+    7704, 7746, 7789, 7832, 7875, 7918, 7961, 8004, 8047, 8091,
+    8134, 8177, 8221, 8265, 8308, 8352, 8396, 8440, 8484, 8528,
+    8572, 8616, 8661, 8705, 8749, 8794, 8839, 8883, 8928, 8973,
+    9018, 9063, 9108, 9153, 9198, 9243, 9288, 9334, 9379, 9424,
+    9470, 9516, 9561, 9607, 9653, 9699, 9745, 9791, 9837, 9883,
+    9929, 9975, 10021, 10068, 10114, 10161, 10207, 10254, 10300, 10347,
+    10394, 10441, 10487, 10534, 10581, 10628, 10676, 10723, 10770, 10817,
+    10864, 10912, 10959, 11007, 11054, 11102, 11149, 11197, 11245, 11292,
+    11340, 11388, 11436, 11484, 11532, 11580, 11628, 11676, 11724, 11772,
+    11821, 11869, 11917, 11966, 12014, 12063, 12111, 12160, 12208, 12257,
+    12306, 12354, 12403, 12452, 12501, 12549, 12598, 12647, 12696, 12745,
+    12794, 12843, 12892, 12942, 12991, 13040, 13089, 13138, 13188, 13237,
+    13286, 13336, 13385, 13435, 13484, 13533, 13583, 13632, 13682, 13732,
+    13781, 13831, 13881, 13930, 13980, 14030, 14079, 14129, 14179, 14229,
+    14279, 14329, 14378, 14428, 14478, 14528, 14578, 14628, 14678, 14728,
+    14778, 14828, 14878, 14928, 14978, 15028, 15078, 15129, 15179, 15229,
+    15279, 15329, 15379, 15429, 15480, 15530, 15580, 15630, 15680, 15731,
+    15781, 15831, 15881, 15932, 15982, 16032, 16082, 16133, 16183, 16233,
+    16283, 16334, 16384, 16434, 16485, 16535, 16585, 16635, 16686, 16736,
+    16786, 16836, 16887, 16937, 16987, 17037, 17088, 17138, 17188, 17238,
+    17288, 17339, 17389, 17439, 17489, 17539, 17589, 17639, 17690, 17740,
+    17790, 17840, 17890, 17940, 17990, 18040, 18090, 18140, 18190, 18240,
+    18290, 18340, 18390, 18439, 18489, 18539, 18589, 18639, 18689, 18738,
+    18788, 18838, 18887, 18937, 18987, 19036, 19086, 19136, 19185, 19235,
+    19284, 19333, 19383, 19432, 19482, 19531, 19580, 19630, 19679, 19728,
+    19777, 19826, 19876, 19925, 19974, 20023, 20072, 20121, 20170, 20219,
+    20267, 20316, 20365, 20414, 20462, 20511, 20560, 20608, 20657, 20705,
+    20754, 20802, 20851, 20899, 20947, 20996, 21044, 21092, 21140, 21188,
+    21236, 21284, 21332, 21380, 21428, 21476, 21523, 21571, 21619, 21666,
+    21714, 21761, 21809, 21856, 21904, 21951, 21998, 22045, 22092, 22140,
+    22187, 22234, 22281, 22327, 22374, 22421, 22468, 22514, 22561, 22607,
+    22654, 22700, 22747, 22793, 22839, 22885, 22931, 22977, 23023, 23069,
+    23115, 23161, 23207, 23252, 23298, 23344, 23389, 23434, 23480, 23525,
+    23570, 23615, 23660, 23705, 23750, 23795, 23840, 23885, 23929, 23974,
+    24019, 24063, 24107, 24152, 24196, 24240, 24284, 24328, 24372, 24416,
+    24460, 24503, 24547, 24591, 24634, 24677, 24721, 24764, 24807, 24850,
+    24893, 24936, 24979, 25022, 25064, 25107, 25149, 25192, 25234, 25276,
+    25319, 25361, 25403, 25445, 25486, 25528, 25570, 25611, 25653, 25694,
+    25736, 25777, 25818, 25859, 25900, 25941, 25982, 26022, 26063, 26104,
+    26144, 26184, 26225, 26265, 26305, 26345, 26385, 26424, 26464, 26504,
+    26543, 26582, 26622, 26661, 26700, 26739, 26778, 26817, 26855, 26894,
+    26933, 26971, 27009, 27047, 27086, 27124, 27162, 27199, 27237, 27275,
+    27312, 27350, 27387, 27424, 27461, 27498, 27535, 27572, 27608, 27645,
+    27681, 27718, 27754, 27790, 27826, 27862, 27898, 27934, 27969, 28005,
+    28040, 28075, 28111, 28146, 28181, 28215, 28250, 28285, 28319, 28354,
+    28388, 28422, 28456, 28490, 28524, 28557, 28591, 28624, 28658, 28691,
+    28724, 28757, 28790, 28823, 28856, 28888, 28921, 28953, 28985, 29017,
+    29049, 29081, 29113, 29144, 29176, 29207, 29238, 29269, 29300, 29331,
+    29362, 29392, 29423, 29453, 29484, 29514, 29544, 29574, 29603, 29633,
+    29663, 29692, 29721, 29750, 29779, 29808, 29837, 29866, 29894, 29922,
+    29951, 29979, 30007, 30035, 30062, 30090, 30117, 30145, 30172, 30199,
+    30226, 30253, 30280, 30306, 30333, 30359, 30385, 30411, 30437, 30463,
+    30488, 30514, 30539, 30565, 30590, 30615, 30640, 30664, 30689, 30713,
+    30738, 30762, 30786, 30810, 30833, 30857, 30881, 30904, 30927, 30950,
+    30973, 30996, 31019, 31041, 31064, 31086, 31108, 31130, 31152, 31173,
+    31195, 31216, 31238, 31259, 31280, 31301, 31321, 31342, 31362, 31383,
+    31403, 31423, 31443, 31462, 31482, 31502, 31521, 31540, 31559, 31578,
+    31597, 31615, 31634, 31652, 31670, 31688, 31706, 31724, 31741, 31759,
+    31776, 31793, 31810, 31827, 31844, 31860, 31877, 31893, 31909, 31925,
+    31941, 31957, 31972, 31988, 32003, 32018, 32033, 32048, 32063, 32077,
+    32091, 32106, 32120, 32134, 32147, 32161, 32175, 32188, 32201, 32214,
+    32227, 32240, 32252, 32265, 32277, 32289, 32301, 32313, 32325, 32336,
+    32348, 32359, 32370, 32381, 32392, 32402, 32413, 32423, 32433, 32443,
+    32453, 32463, 32472, 32482, 32491, 32500, 32509, 32518, 32527, 32535,
+    32544, 32552, 32560, 32568, 32576, 32583, 32591, 32598, 32605, 32612,
+    32619, 32626, 32632, 32639, 32645, 32651, 32657, 32663, 32668, 32674,
+    32679, 32684, 32689, 32694, 32699, 32703, 32708, 32712, 32716, 32720,
+    32724, 32727, 32731, 32734, 32737, 32740, 32743, 32746, 32748, 32751,
+    32753, 32755, 32757, 32759, 32760, 32762, 32763, 32764, 32765, 32766,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32766,
+    32765, 32764, 32763, 32762, 32760, 32759, 32757, 32755, 32753, 32751,
+    32748, 32746, 32743, 32740, 32737, 32734, 32731, 32727, 32724, 32720,
+    32716, 32712, 32708, 32703, 32699, 32694, 32689, 32684, 32679, 32674,
+    32668, 32663, 32657, 32651, 32645, 32639, 32632, 32626, 32619, 32612,
+    32605, 32598, 32591, 32583, 32576, 32568, 32560, 32552, 32544, 32535,
+    32527, 32518, 32509, 32500, 32491, 32482, 32472, 32463, 32453, 32443,
+    32433, 32423, 32413, 32402, 32392, 32381, 32370, 32359, 32348, 32336,
+    32325, 32313, 32301, 32289, 32277, 32265, 32252, 32240, 32227, 32214,
+    32201, 32188, 32175, 32161, 32147, 32134, 32120, 32106, 32091, 32077,
+    32063, 32048, 32033, 32018, 32003, 31988, 31972, 31957, 31941, 31925,
+    31909, 31893, 31877, 31860, 31844, 31827, 31810, 31793, 31776, 31759,
+    31741, 31724, 31706, 31688, 31670, 31652, 31634, 31615, 31597, 31578,
+    31559, 31540, 31521, 31502, 31482, 31462, 31443, 31423, 31403, 31383,
+    31362, 31342, 31321, 31301, 31280, 31259, 31238, 31216, 31195, 31173,
+    31152, 31130, 31108, 31086, 31064, 31041, 31019, 30996, 30973, 30950,
+    30927, 30904, 30881, 30857, 30833, 30810, 30786, 30762, 30738, 30713,
+    30689, 30664, 30640, 30615, 30590, 30565, 30539, 30514, 30488, 30463,
+    30437, 30411, 30385, 30359, 30333, 30306, 30280, 30253, 30226, 30199,
+    30172, 30145, 30117, 30090, 30062, 30035, 30007, 29979, 29951, 29922,
+    29894, 29866, 29837, 29808, 29779, 29750, 29721, 29692, 29663, 29633,
+    29603, 29574, 29544, 29514, 29484, 29453, 29423, 29392, 29362, 29331,
+    29300, 29269, 29238, 29207, 29176, 29144, 29113, 29081, 29049, 29017,
+    28985, 28953, 28921, 28888, 28856, 28823, 28790, 28757, 28724, 28691,
+    28658, 28624, 28591, 28557, 28524, 28490, 28456, 28422, 28388, 28354,
+    28319, 28285, 28250, 28215, 28181, 28146, 28111, 28075, 28040, 28005,
+    27969, 27934, 27898, 27862, 27826, 27790, 27754, 27718, 27681, 27645,
+    27608, 27572, 27535, 27498, 27461, 27424, 27387, 27350, 27312, 27275,
+    27237, 27199, 27162, 27124, 27086, 27047, 27009, 26971, 26933, 26894,
+    26855, 26817, 26778, 26739, 26700, 26661, 26622, 26582, 26543, 26504,
+    26464, 26424, 26385, 26345, 26305, 26265, 26225, 26184, 26144, 26104,
+    26063, 26022, 25982, 25941, 25900, 25859, 25818, 25777, 25736, 25694,
+    25653, 25611, 25570, 25528, 25486, 25445, 25403, 25361, 25319, 25276,
+    25234, 25192, 25149, 25107, 25064, 25022, 24979, 24936, 24893, 24850,
+    24807, 24764, 24721, 24677, 24634, 24591, 24547, 24503, 24460, 24416,
+    24372, 24328, 24284, 24240, 24196, 24152, 24107, 24063, 24019, 23974,
+    23929, 23885, 23840, 23795, 23750, 23705, 23660, 23615, 23570, 23525,
+    23480, 23434, 23389, 23344, 23298, 23252, 23207, 23161, 23115, 23069,
+    23023, 22977, 22931, 22885, 22839, 22793, 22747, 22700, 22654, 22607,
+    22561, 22514, 22468, 22421, 22374, 22327, 22281, 22234, 22187, 22140,
+    22092, 22045, 21998, 21951, 21904, 21856, 21809, 21761, 21714, 21666,
+    21619, 21571, 21523, 21476, 21428, 21380, 21332, 21284, 21236, 21188,
+    21140, 21092, 21044, 20996, 20947, 20899, 20851, 20802, 20754, 20705,
+    20657, 20608, 20560, 20511, 20462, 20414, 20365, 20316, 20267, 20219,
+    20170, 20121, 20072, 20023, 19974, 19925, 19876, 19826, 19777, 19728,
+    19679, 19630, 19580, 19531, 19482, 19432, 19383, 19333, 19284, 19235,
+    19185, 19136, 19086, 19036, 18987, 18937, 18887, 18838, 18788, 18738,
+    18689, 18639, 18589, 18539, 18489, 18439, 18390, 18340, 18290, 18240,
+    18190, 18140, 18090, 18040, 17990, 17940, 17890, 17840, 17790, 17740,
+    17690, 17639, 17589, 17539, 17489, 17439, 17389, 17339, 17288, 17238,
+    17188, 17138, 17088, 17037, 16987, 16937, 16887, 16836, 16786, 16736,
+    16686, 16635, 16585, 16535, 16485, 16434, 16384, 16334, 16283, 16233,
+    16183, 16133, 16082, 16032, 15982, 15932, 15881, 15831, 15781, 15731,
+    15680, 15630, 15580, 15530, 15480, 15429, 15379, 15329, 15279, 15229,
+    15179, 15129, 15078, 15028, 14978, 14928, 14878, 14828, 14778, 14728,
+    14678, 14628, 14578, 14528, 14478, 14428, 14378, 14329, 14279, 14229,
+    14179, 14129, 14079, 14030, 13980, 13930, 13881, 13831, 13781, 13732,
+    13682, 13632, 13583, 13533, 13484, 13435, 13385, 13336, 13286, 13237,
+    13188, 13138, 13089, 13040, 12991, 12942, 12892, 12843, 12794, 12745,
+    12696, 12647, 12598, 12549, 12501, 12452, 12403, 12354, 12306, 12257,
+    12208, 12160, 12111, 12063, 12014, 11966, 11917, 11869, 11821, 11772,
+    11724, 11676, 11628, 11580, 11532, 11484, 11436, 11388, 11340, 11292,
+    11245, 11197, 11149, 11102, 11054, 11007, 10959, 10912, 10864, 10817,
+    10770, 10723, 10676, 10628, 10581, 10534, 10487, 10441, 10394, 10347,
+    10300, 10254, 10207, 10161, 10114, 10068, 10021, 9975, 9929, 9883,
+    9837, 9791, 9745, 9699, 9653, 9607, 9561, 9516, 9470, 9424,
+    9379, 9334, 9288, 9243, 9198, 9153, 9108, 9063, 9018, 8973,
+    8928, 8883, 8839, 8794, 8749, 8705, 8661, 8616, 8572, 8528,
+    8484, 8440, 8396, 8352, 8308, 8265, 8221, 8177, 8134, 8091,
+    8047, 8004, 7961, 7918, 7875, 7832, 7789, 7746, 7704, 7661,
+    7619, 7576, 7534, 7492, 7449, 7407, 7365, 7323, 7282, 7240,
+    7198, 7157, 7115, 7074, 7032, 6991, 6950, 6909, 6868, 6827,
+    6786, 6746, 6705, 6664, 6624, 6584, 6543, 6503, 6463, 6423,
+    6383, 6344, 6304, 6264, 6225, 6186, 6146, 6107, 6068, 6029,
+    5990, 5951, 5913, 5874, 5835, 5797, 5759, 5721, 5682, 5644,
+    5606, 5569, 5531, 5493, 5456, 5418, 5381, 5344, 5307, 5270,
+    5233, 5196, 5160, 5123, 5087, 5050, 5014, 4978, 4942, 4906,
+    4870, 4834, 4799, 4763, 4728, 4693, 4657, 4622, 4587, 4553,
+    4518, 4483, 4449, 4414, 4380, 4346, 4312, 4278, 4244, 4211,
+    4177, 4144, 4110, 4077, 4044, 4011, 3978, 3945, 3912, 3880,
+    3847, 3815, 3783, 3751, 3719, 3687, 3655, 3624, 3592, 3561,
+    3530, 3499, 3468, 3437, 3406, 3376, 3345, 3315, 3284, 3254,
+    3224, 3194, 3165, 3135, 3105, 3076, 3047, 3018, 2989, 2960,
+    2931, 2902, 2874, 2846, 2817, 2789, 2761, 2733, 2706, 2678,
+    2651, 2623, 2596, 2569, 2542, 2515, 2488, 2462, 2435, 2409,
+    2383, 2357, 2331, 2305, 2280, 2254, 2229, 2203, 2178, 2153,
+    2128, 2104, 2079, 2055, 2030, 2006, 1982, 1958, 1935, 1911,
+    1887, 1864, 1841, 1818, 1795, 1772, 1749, 1727, 1704, 1682,
+    1660, 1638, 1616, 1595, 1573, 1552, 1530, 1509, 1488, 1467,
+    1447, 1426, 1406, 1385, 1365, 1345, 1325, 1306, 1286, 1266,
+    1247, 1228, 1209, 1190, 1171, 1153, 1134, 1116, 1098, 1080,
+    1062, 1044, 1027, 1009, 992, 975, 958, 941, 924, 908,
+    891, 875, 859, 843, 827, 811, 796, 780, 765, 750,
+    735, 720, 705, 691, 677, 662, 648, 634, 621, 607,
+    593, 580, 567, 554, 541, 528, 516, 503, 491, 479,
+    467, 455, 443, 432, 420, 409, 398, 387, 376, 366,
+    355, 345, 335, 325, 315, 305, 296, 286, 277, 268,
+    259, 250, 241, 233, 224, 216, 208, 200, 192, 185,
+    177, 170, 163, 156, 149, 142, 136, 129, 123, 117,
+    111, 105, 100, 94, 89, 84, 79, 74, 69, 65,
+    60, 56, 52, 48, 44, 41, 37, 34, 31, 28,
+    25, 22, 20, 17, 15, 13, 11, 9, 8, 6,
+    5, 4, 3, 2, 1, 1, 0, 0
+};
+
+/* Hann, 4096 points */
+const q15_t Window_hann4096[4096] __attribute__((aligned(4))) = {
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 2,
+    2, 2, 3, 3, 4, 4, 5, 6, 6, 7,
+    8, 9, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 19, 20, 21, 22, 24, 25, 26, 28, 29,
+    31, 32, 34, 36, 37, 39, 41, 43, 44, 46,
+    48, 50, 52, 54, 56, 58, 60, 63, 65, 67,
+    69, 72, 74, 76, 79, 81, 84, 86, 89, 92,
+    94, 97, 100, 103, 105, 108, 111, 114, 117, 120,
+    123, 126, 129, 133, 136, 139, 142, 146, 149, 152,
+    156, 159, 163, 166, 170, 174, 177, 181, 185, 189,
+    192, 196, 200, 204, 208, 212, 216, 220, 224, 228,
+    233, 237, 241, 246, 250, 254, 259, 263, 268, 272,
+    277, 281, 286, 291, 296, 300, 305, 310, 315, 320,
+    325, 330, 335, 340, 345, 350, 355, 360, 366, 371,
+    376, 382, 387, 393, 398, 404, 409, 415, 420, 426,
+    432, 438, 443, 449, 455, 461, 467, 473, 479, 485,
+    491, 497, 503, 509, 516, 522, 528, 535, 541, 547,
+    554, 560, 567, 574, 580, 587, 593, 600, 607, 614,
+    621, 627, 634, 641, 648, 655, 662, 669, 677, 684,
+    691, 698, 705, 713, 720, 728, 735, 742, 750, 757,
+    765, 773, 780, 788, 796, 803, 811, 819, 827, 835,
+    843, 851, 859, 867, 875, 883, 891, 899, 908, 916,
+    924, 933, 941, 949, 958, 966, 975, 983, 992, 1001,
+    1009, 1018, 1027, 1035, 1044, 1053, 1062, 1071, 1080, 1089,
+    1098, 1107, 1116, 1125, 1134, 1144, 1153, 1162, 1171, 1181,
+    1190, 1200, 1209, 1218, 1228, 1238, 1247, 1257, 1266, 1276,
+    1286, 1296, 1306, 1315, 1325, 1335, 1345, 1355, 1365, 1375,
+    1385, 1395, 1406, 1416, 1426, 1436, 1447, 1457, 1467, 1478,
+    1488, 1499, 1509, 1520, 1530, 1541, 1552, 1562, 1573, 1584,
+    1595, 1605, 1616, 1627, 1638, 1649, 1660, 1671, 1682, 1693,
+    1704, 1716, 1727, 1738, 1749, 1761, 1772, 1783, 1795, 1806,
+    1818, 1829, 1841, 1853, 1864, 1876, 1887, 1899, 1911, 1923,
+    1935, 1946, 1958, 1970, 1982, 1994, 2006, 2018, 2030, 2043,
+    2055, 2067, 2079, 2091, 2104, 2116, 2128, 2141, 2153, 2166,
+    2178, 2191, 2203, 2216, 2229, 2241, 2254, 2267, 2280, 2292,
+    2305, 2318, 2331, 2344, 2357, 2370, 2383, 2396, 2409, 2422,
+    2435, 2449, 2462, 2475, 2488, 2502, 2515, 2528, 2542, 2555,
+    2569, 2582, 2596, 2610, 2623, 2637, 2651, 2664, 2678, 2692,
+    2706, 2719, 2733, 2747, 2761, 2775, 2789, 2803, 2817, 2831,
+    2846, 2860, 2874, 2888, 2902, 2917, 2931, 2945, 2960, 2974,
+    2989, 3003, 3018, 3032, 3047, 3061, 3076, 3091, 3105, 3120,
+    3135, 3150, 3165, 3179, 3194, 3209, 3224, 3239, 3254, 3269,
+    3284, 3299, 3315, 3330, 3345, 3360, 3376, 3391, 3406, 3421,
+    3437, 3452, 3468, 3483, 3499, 3514, 3530, 3545, 3561, 3577,
+    3592, 3608, 3624, 3640, 3655, 3671, 3687, 3703, 3719, 3735,
+    3751, 3767, 3783, 3799, 3815, 3831, 3847, 3864, 3880, 3896,
+    3912, 3929, 3945, 3961, 3978, 3994, 4011, 4027, 4044, 4060,
+    4077, 4094, 4110, 4127, 4144, 4160, 4177, 4194, 4211, 4227,
+    4244, 4261, 4278, 4295, 4312, 4329, 4346, 4363, 4380, 4397,
+    4414, 4432, 4449, 4466, 4483, 4501, 4518, 4535, 4553, 4570,
+    4587, 4605, 4622, 4640, 4657, 4675, 4693, 4710, 4728, 4746,
+    4763, 4781, 4799, 4817, 4834, 4852, 4870, 4888, 4906, 4924,
+    4942, 4960, 4978, 4996, 5014, 5032, 5050, 5068, 5087, 5105,
+    5123, 5141, 5160, 5178, 5196, 5215, 5233, 5251, 5270, 5288,
+    5307, 5325, 5344, 5363, 5381, 5400, 5418, 5437, 5456, 5475,
+    5493, 5512, 5531, 5550, 5569, 5588, 5606, 5625, 5644, 5663,
+    5682, 5701, 5721, 5740, 5759, 5778, 5797, 5816, 5835, 5855,
+    5874, 5893, 5913, 5932, 5951, 5971, 5990, 6010, 6029, 6048,
+    6068, 6088, 6107, 6127, 6146, 6166, 6186, 6205, 6225, 6245,
+    6264, 6284, 6304, 6324, 6344, 6364, 6383, 6403, 6423, 6443,
+    6463, 6483, 6503, 6523, 6543, 6564, 6584, 6604, 6624, 6644,
+    6664, 6685, 6705, 6725, 6746, 6766, 6786, 6807, 6827, 6847,
+    6868, 6888, 6909, 6929, 6950, 6971, 6991, 7012, 7032, 7053,
+    7074, 7094, 7115, 7136, 7157, 7177, 7198, 7219, 7240, 7261,
+    7282, 7302, 7323, 7344, 7365, 7386, 7407, 7428, 7449, 7470,
+    7492, 7513, 7534, 7555, 7576, 7597, 7619, 7640, 7661, 7682,
+    7704, 7725, 7746, 7768, 7789, 7811, 7832, 7853, 7875, 7896,
+    7918, 7939, 7961, 7983, 8004, 8026, 8047, 8069, 8091, 8112,
+    8134, 8156, 8177, 8199, 8221, 8243, 8265, 8286, 8308, 8330,
+    8352, 8374, 8396, 8418, 8440, 8462, 8484, 8506, 8528, 8550,
+    8572, 8594, 8616, 8638, 8661, 8683, 8705, 8727, 8749, 8772,
+    8794, 8816, 8839, 8861, 8883, 8906, 8928, 8950, 8973, 8995,
+    9018, 9040, 9063, 9085, 9108, 9130, 9153, 9175, 9198, 9220,
+    9243, 9266, 9288, 9311, 9334, 9356, 9379, 9402, 9424, 9447,
+    9470, 9493, 9516, 9538, 9561, 9584, 9607, 9630, 9653, 9676,
+    9699, 9722, 9745, 9768, 9791, 9814, 9837, 9860, 9883, 9906,
+    9929, 9952, 9975, 9998, 10021, 10045, 10068, 10091, 10114, 10137,
+    10161, 10184, 10207, 10230, 10254, 10277, 10300, 10324, 10347, 10370,
+    10394, 10417, 10441, 10464, 10487, 10511, 10534, 10558, 10581, 10605,
+    10628, 10652, 10676, 10699, 10723, 10746, 10770, 10793, 10817, 10841,
+    10864, 10888, 10912, 10935, 10959, 10983, 11007, 11030, 11054, 11078,
+    11102, 11125, 11149, 11173, 11197, 11221, 11245, 11269, 11292, 11316,
+    11340, 11364, 11388, 11412, 11436, 11460, 11484, 11508, 11532, 11556,
+    11580, 11604, 11628, 11652, 11676, 11700, 11724, 11748, 11772, 11797,
+    11821, 11845, 11869, 11893, 11917, 11942, 11966, 11990, 12014, 12038,
+    12063, 12087, 12111, 12135, 12160, 12184, 12208, 12233, 12257, 12281,
+    12306, 12330, 12354, 12379, 12403, 12427, 12452, 12476, 12501, 12525,
+    12549, 12574, 12598, 12623, 12647, 12672, 12696, 12721, 12745, 12770,
+    12794, 12819, 12843, 12868, 12892, 12917, 12942, 12966, 12991, 13015,
+    13040, 13064, 13089, 13114, 13138, 13163, 13188, 13212, 13237, 13262,
+    13286, 13311, 13336, 13360, 13385, 13410, 13435, 13459, 13484, 13509,
+    13533, 13558, 13583, 13608, 13632, 13657, 13682, 13707, 13732, 13756,
+    13781, 13806, 13831, 13856, 13881, 13905, 13930, 13955, 13980, 14005,
+    14030, 14055, 14079, 14104, 14129, 14154, 14179, 14204, 14229, 14254,
+    14279, 14304, 14329, 14353, 14378, 14403, 14428, 14453, 14478, 14503,
+    14528, 14553, 14578, 14603, 14628, 14653, 14678, 14703, 14728, 14753,
+    14778, 14803, 14828, 14853, 14878, 14903, 14928, 14953, 14978, 15003,
+    15028, 15053, 15078, 15104, 15129, 15154, 15179, 15204, 15229, 15254,
+    15279, 15304, 15329, 15354, 15379, 15404, 15429, 15455, 15480, 15505,
+    15530, 15555, 15580, 15605, 15630, 15655, 15680, 15706, 15731, 15756,
+    15781, 15806, 15831, 15856, 15881, 15907, 15932, 15957, 15982, 16007,
+    16032, 16057, 16082, 16108, 16133, 16158, 16183, 16208, 16233, 16258,
+    16283, 16309, 16334, 16359, 16384, 16409, 16434, 16459, 16485, 16510,
+    16535, 16560, 16585, 16610, 16635, 16660, 16686, 16711, 16736, 16761,
+    16786, 16811, 16836, 16861, 16887, 16912, 16937, 16962, 16987, 17012,
+    17037, 17062, 17088, 17113, 17138, 17163, 17188, 17213, 17238, 17263,
+    17288, 17313, 17339, 17364, 17389, 17414, 17439, 17464, 17489, 17514,
+    17539, 17564, 17589, 17614, 17639, 17664, 17690, 17715, 17740, 17765,
+    17790, 17815, 17840, 17865, 17890, 17915, 17940, 17965, 17990, 18015,
+    18040, 18065, 18090, 18115, 18140, 18165, 18190, 18215, 18240, 18265,
+    18290, 18315, 18340, 18365, 18390, 18415, 18439, 18464, 18489, 18514,
+    18539, 18564, 18589, 18614, 18639, 18664, 18689, 18713, 18738, 18763,
+    18788, 18813, 18838, 18863, 18887, 18912, 18937, 18962, 18987, 19012,
+    19036, 19061, 19086, 19111, 19136, 19160, 19185, 19210, 19235, 19259,
+    19284, 19309, 19333, 19358, 19383, 19408, 19432, 19457, 19482, 19506,
+    19531, 19556, 19580, 19605, 19630, 19654, 19679, 19704, 19728, 19753,
+    19777, 19802, 19826, 19851, 19876, 19900, 19925, 19949, 19974, 19998,
+    20023, 20047, 20072, 20096, 20121, 20145, 20170, 20194, 20219, 20243,
+    20267, 20292, 20316, 20341, 20365, 20389, 20414, 20438, 20462, 20487,
+    20511, 20535, 20560, 20584, 20608, 20633, 20657, 20681, 20705, 20730,
+    20754, 20778, 20802, 20826, 20851, 20875, 20899, 20923, 20947, 20971,
+    20996, 21020, 21044, 21068, 21092, 21116, 21140, 21164, 21188, 21212,
+    21236, 21260, 21284, 21308, 21332, 21356, 21380, 21404, 21428, 21452,
+    21476, 21499, 21523, 21547, 21571, 21595, 21619, 21643, 21666, 21690,
+    21714, 21738, 21761, 21785, 21809, 21833, 21856, 21880, 21904, 21927,
+    21951, 21975, 21998, 22022, 22045, 22069, 22092, 22116, 22140, 22163,
+    22187, 22210, 22234, 22257, 22281, 22304, 22327, 22351, 22374, 22398,
+    22421, 22444, 22468, 22491, 22514, 22538, 22561, 22584, 22607, 22631,
+    22654, 22677, 22700, 22723, 22747, 22770, 22793, 22816, 22839, 22862,
+    22885, 22908, 22931, 22954, 22977, 23000, 23023, 23046, 23069, 23092,
+    23115, 23138, 23161, 23184, 23207, 23230, 23252, 23275, 23298, 23321,
+    23344, 23366, 23389, 23412, 23434, 23457, 23480, 23502, 23525, 23548,
+    23570, 23593, 23615, 23638, 23660, 23683, 23705, 23728, 23750, 23773,
+    23795, 23818, 23840, 23862, 23885, 23907, 23929, 23952, 23974, 23996,
+    24019, 24041, 24063, 24085, 24107, 24130, 24152, 24174, 24196, 24218,
+    24240, 24262, 24284, 24306, 24328, 24350, 24372, 24394, 24416, 24438,
+    24460, 24482, 24503, 24525, 24547, 24569, 24591, 24612, 24634, 24656,
+    24677, 24699, 24721, 24742, 24764, 24785, 24807, 24829, 24850, 24872,
+    24893, 24915, 24936, 24957, 24979, 25000, 25022, 25043, 25064, 25086,
+    25107, 25128, 25149, 25171, 25192, 25213, 25234, 25255, 25276, 25298,
+    25319, 25340, 25361, 25382, 25403, 25424, 25445, 25466, 25486, 25507,
+    25528, 25549, 25570, 25591, 25611, 25632, 25653, 25674, 25694, 25715,
+    25736, 25756, 25777, 25797, 25818, 25839, 25859, 25880, 25900, 25921,
+    25941, 25961, 25982, 26002, 26022, 26043, 26063, 26083, 26104, 26124,
+    26144, 26164, 26184, 26204, 26225, 26245, 26265, 26285, 26305, 26325,
+    26345, 26365, 26385, 26404, 26424, 26444, 26464, 26484, 26504, 26523,
+    26543, 26563, 26582, 26602, 26622, 26641, 26661, 26680, 26700, 26720,
+    26739, 26758, 26778, 26797, 26817, 26836, 26855, 26875, 26894, 26913,
+    26933, 26952, 26971, 26990, 27009, 27028, 27047, 27067, 27086, 27105,
+    27124, 27143, 27162, 27180, 27199, 27218, 27237, 27256, 27275, 27293,
+    27312, 27331, 27350, 27368, 27387, 27405, 27424, 27443, 27461, 27480,
+    27498, 27517, 27535, 27553, 27572, 27590, 27608, 27627, 27645, 27663,
+    27681, 27700, 27718, 27736, 27754, 27772, 27790, 27808, 27826, 27844,
+    27862, 27880, 27898, 27916, 27934, 27951, 27969, 27987, 28005, 28022,
+    28040, 28058, 28075, 28093, 28111, 28128, 28146, 28163, 28181, 28198,
+    28215, 28233, 28250, 28267, 28285, 28302, 28319, 28336, 28354, 28371,
+    28388, 28405, 28422, 28439, 28456, 28473, 28490, 28507, 28524, 28541,
+    28557, 28574, 28591, 28608, 28624, 28641, 28658, 28674, 28691, 28708,
+    28724, 28741, 28757, 28774, 28790, 28807, 28823, 28839, 28856, 28872,
+    28888, 28904, 28921, 28937, 28953, 28969, 28985, 29001, 29017, 29033,
+    29049, 29065, 29081, 29097, 29113, 29128, 29144, 29160, 29176, 29191,
+    29207, 29223, 29238, 29254, 29269, 29285, 29300, 29316, 29331, 29347,
+    29362, 29377, 29392, 29408, 29423, 29438, 29453, 29469, 29484, 29499,
+    29514, 29529, 29544, 29559, 29574, 29589, 29603, 29618, 29633, 29648,
+    29663, 29677, 29692, 29707, 29721, 29736, 29750, 29765, 29779, 29794,
+    29808, 29823, 29837, 29851, 29866, 29880, 29894, 29908, 29922, 29937,
+    29951, 29965, 29979, 29993, 30007, 30021, 30035, 30049, 30062, 30076,
+    30090, 30104, 30117, 30131, 30145, 30158, 30172, 30186, 30199, 30213,
+    30226, 30240, 30253, 30266, 30280, 30293, 30306, 30319, 30333, 30346,
+    30359, 30372, 30385, 30398, 30411, 30424, 30437, 30450, 30463, 30476,
+    30488, 30501, 30514, 30527, 30539, 30552, 30565, 30577, 30590, 30602,
+    30615, 30627, 30640, 30652, 30664, 30677, 30689, 30701, 30713, 30725,
+    30738, 30750, 30762, 30774, 30786, 30798, 30810, 30822, 30833, 30845,
+    30857, 30869, 30881, 30892, 30904, 30915, 30927, 30939, 30950, 30962,
+    30973, 30985, 30996, 31007, 31019, 31030, 31041, 31052, 31064, 31075,
+    31086, 31097, 31108, 31119, 31130, 31141, 31152, 31163, 31173, 31184,
+    31195, 31206, 31216, 31227, 31238, 31248, 31259, 31269, 31280, 31290,
+    31301, 31311, 31321, 31332, 31342, 31352, 31362, 31373, 31383, 31393,
+    31403, 31413, 31423, 31433, 31443, 31453, 31462, 31472, 31482, 31492,
+    31502, 31511, 31521, 31530, 31540, 31550, 31559, 31568, 31578, 31587,
+    31597, 31606, 31615, 31624, 31634, 31643, 31652, 31661, 31670, 31679,
+    31688, 31697, 31706, 31715, 31724, 31733, 31741, 31750, 31759, 31767,
+    31776, 31785, 31793, 31802, 31810, 31819, 31827, 31835, 31844, 31852,
+    31860, 31869, 31877, 31885, 31893, 31901, 31909, 31917, 31925, 31933,
+    31941, 31949, 31957, 31965, 31972, 31980, 31988, 31995, 32003, 32011,
+    32018, 32026, 32033, 32040, 32048, 32055, 32063, 32070, 32077, 32084,
+    32091, 32099, 32106, 32113, 32120, 32127, 32134, 32141, 32147, 32154,
+    32161, 32168, 32175, 32181, 32188, 32194, 32201, 32208, 32214, 32221,
+    32227, 32233, 32240, 32246, 32252, 32259, 32265, 32271, 32277, 32283,
+    32289, 32295, 32301, 32307, 32313, 32319, 32325, 32330, 32336, 32342,
+    32348, 32353, 32359, 32364, 32370, 32375, 32381, 32386, 32392, 32397,
+    32402, 32408, 32413, 32418, 32423, 32428, 32433, 32438, 32443, 32448,
+    32453, 32458, 32463, 32468, 32472, 32477, 32482, 32487, 32491, 32496,
+    32500, 32505, 32509, 32514, 32518, 32522, 32527, 32531, 32535, 32540,
+    32544, 32548, 32552, 32556, 32560, 32564, 32568, 32572, 32576, 32579,
+    32583, 32587, 32591, 32594, 32598, 32602, 32605, 32609, 32612, 32616,
+    32619, 32622, 32626, 32629, 32632, 32635, 32639, 32642, 32645, 32648,
+    32651, 32654, 32657, 32660, 32663, 32665, 32668, 32671, 32674, 32676,
+    32679, 32682, 32684, 32687, 32689, 32692, 32694, 32696, 32699, 32701,
+    32703, 32705, 32708, 32710, 32712, 32714, 32716, 32718, 32720, 32722,
+    32724, 32725, 32727, 32729, 32731, 32732, 32734, 32736, 32737, 32739,
+    32740, 32742, 32743, 32744, 32746, 32747, 32748, 32749, 32751, 32752,
+    32753, 32754, 32755, 32756, 32757, 32758, 32759, 32759, 32760, 32761,
+    32762, 32762, 32763, 32764, 32764, 32765, 32765, 32766, 32766, 32766,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766,
+    32765, 32765, 32764, 32764, 32763, 32762, 32762, 32761, 32760, 32759,
+    32759, 32758, 32757, 32756, 32755, 32754, 32753, 32752, 32751, 32749,
+    32748, 32747, 32746, 32744, 32743, 32742, 32740, 32739, 32737, 32736,
+    32734, 32732, 32731, 32729, 32727, 32725, 32724, 32722, 32720, 32718,
+    32716, 32714, 32712, 32710, 32708, 32705, 32703, 32701, 32699, 32696,
+    32694, 32692, 32689, 32687, 32684, 32682, 32679, 32676, 32674, 32671,
+    32668, 32665, 32663, 32660, 32657, 32654, 32651, 32648, 32645, 32642,
+    32639, 32635, 32632, 32629, 32626, 32622, 32619, 32616, 32612, 32609,
+    32605, 32602, 32598, 32594, 32591, 32587, 32583, 32579, 32576, 32572,
+    32568, 32564, 32560, 32556, 32552, 32548, 32544, 32540, 32535, 32531,
+    32527, 32522, 32518, 32514, 32509, 32505, 32500, 32496, 32491, 32487,
+    32482, 32477, 32472, 32468, 32463, 32458, 32453, 32448, 32443, 32438,
+    32433, 32428, 32423, 32418, 32413, 32408, 32402, 32397, 32392, 32386,
+    32381, 32375, 32370, 32364, 32359, 32353, 32348, 32342, 32336, 32330,
+    32325, 32319, 32313, 32307, 32301, 32295, 32289, 32283, 32277, 32271,
+    32265, 32259, 32252, 32246, 32240, 32233, 32227, 32221, 32214, 32208,
+    32201, 32194, 32188, 32181, 32175, 32168, 32161, 32154, 32147, 32141,
+    32134, 32127, 32120, 32113, 32106, 32099, 32091, 32084, 32077, 32070,
+    32063, 32055, 32048, 32040, 32033, 32026, 32018, 32011, 32003, 31995,
+    31988, 31980, 31972, 31965, 31957, 31949, 31941, 31933, 31925, 31917,
+    31909, 31901, 31893, 31885, 31877, 31869, 31860, 31852, 31844, 31835,
+    31827, 31819, 31810, 31802, 31793, 31785, 31776, 31767, 31759, 31750,
+    31741, 31733, 31724, 31715, 31706, 31697, 31688, 31679, 31670, 31661,
+    31652, 31643, 31634, 31624, 31615, 31606, 31597, 31587, 31578, 31568,
+    31559, 31550, 31540, 31530, 31521, 31511, 31502, 31492, 31482, 31472,
+    31462, 31453, 31443, 31433, 31423, 31413, 31403, 31393, 31383, 31373,
+    31362, 31352, 31342, 31332, 31321, 31311, 31301, 31290, 31280, 31269,
+    31259, 31248, 31238, 31227, 31216, 31206, 31195, 31184, 31173, 31163,
+    31152, 31141, 31130, 31119, 31108, 31097, 31086, 31075, 31064, 31052,
+    31041, 31030, 31019, 31007, 30996, 30985, 30973, 30962, 30950, 30939,
+    30927, 30915, 30904, 30892, 30881, 30869, 30857, 30845, 30833, 30822,
+    30810, 30798, 30786, 30774, 30762, 30750, 30738, 30725, 30713, 30701,
+    30689, 30677, 30664, 30652, 30640, 30627, 30615, 30602, 30590, 30577,
+    30565, 30552, 30539, 30527, 30514, 30501, 30488, 30476, 30463, 30450,
+    30437, 30424, 30411, 30398, 30385, 30372, 30359, 30346, 30333, 30319,
+    30306, 30293, 30280, 30266, 30253, 30240, 30226, 30213, 30199, 30186,
+    30172, 30158, 30145, 30131, 30117, 30104, 30090, 30076, 30062, 30049,
+    30035, 30021, 30007, 29993, 29979, 29965, 29951, 29937, 29922, 29908,
+    29894, 29880, 29866, 29851, 29837, 29823, 29808, 29794, 29779, 29765,
+    29750, 29736, 29721, 29707, 29692, 29677, 29663, 29648, 29633, 29618,
+    29603, 29589, 29574, 29559, 29544, 29529, 29514, 29499, 29484, 29469,
+    29453, 29438, 29423, 29408, 29392, 29377, 29362, 29347, 29331, 29316,
+    29300, 29285, 29269, 29254, 29238, 29223, 29207, 29191, 29176, 29160,
+    29144, 29128, 29113, 29097, 29081, 29065, 29049, 29033, 29017, 29001,
+    28985, 28969, 28953, 28937, 28921, 28904, 28888, 28872, 28856, 28839,
+    28823, 28807, 28790, 28774, 28757, 28741, 28724, 28708, 28691, 28674,
+    28658, 28641, 28624, 28608, 28591, 28574, 28557, 28541, 28524, 28507,
+    28490, 28473, 28456, 28439, 28422, 28405, 28388, 28371, 28354, 28336,
+    28319, 28302, 28285, 28267, 28250, 28233, 28215, 28198, 28181, 28163,
+    28146, 28128, 28111, 28093, 28075, 28058, 28040, 28022, 28005, 27987,
+    27969, 27951, 27934, 27916, 27898, 27880, 27862, 27844, 27826, 27808,
+    27790, 27772, 27754, 27736, 27718, 27700, 27681, 27663, 27645, 27627,
+    27608, 27590, 27572, 27553, 27535, 27517, 27498, 27480, 27461, 27443,
+    27424, 27405, 27387, 27368, 27350, 27331, 27312, 27293, 27275, 27256,
+    27237, 27218, 27199, 27180, 27162, 27143, 27124, 27105, 27086, 27067,
+    27047, 27028, 27009, 26990, 26971, 26952, 26933, 26913, 26894, 26875,
+    26855, 26836, 26817, 26797, 26778, 26758, 26739, 26720, 26700, 26680,
+    26661, 26641, 26622, 26602, 26582, 26563, 26543, 26523, 26504, 26484,
+    26464, 26444, 26424, 26404, 26385, 26365, 26345, 26325, 26305, 26285,
+    26265, 26245, 26225, 26204, 26184, 26164, 26144, 26124, 26104, 26083,
+    26063, 26043, 26022, 26002, 25982, 25961, 25941, 25921, 25900, 25880,
+    25859, 25839, 25818, 25797, 25777, 25756, 25736, 25715, 25694, 25674,
+    25653, 25632, 25611, 25591, 25570, 25549, 25528, 25507, 25486, 25466,
+    25445, 25424, 25403, 25382, 25361, 25340, 25319, 25298, 25276, 25255,
+    25234, 25213, 25192, 25171, 25149, 25128, 25107, 25086, 25064, 25043,
+    25022, 25000, 24979, 24957, 24936, 24915, 24893, 24872, 24850, 24829,
+    24807, 24785, 24764, 24742, 24721, 24699, 24677, 24656, 24634, 24612,
+    24591, 24569, 24547, 24525, 24503, 24482, 24460, 24438, 24416, 24394,
+    24372, 24350, 24328, 24306, 24284, 24262, 24240, 24218, 24196, 24174,
+    24152, 24130, 24107, 24085, 24063, 24041, 24019, 23996, 23974, 23952,
+    23929, 23907, 23885, 23862, 23840, 23818, 23795, 23773, 23750, 23728,
+    23705, 23683, 23660, 23638, 23615, 23593, 23570, 23548, 23525, 23502,
+    23480, 23457, 23434, 23412, 23389, 23366, 23344, 23321, 23298, 23275,
+    23252, 23230, 23207, 23184, 23161, 23138, 23115, 23092, 23069, 23046,
+    23023, 23000, 22977, 22954, 22931, 22908, 22885, 22862, 22839, 22816,
+    22793, 22770, 22747, 22723, 22700, 22677, 22654, 22631, 22607, 22584,
+    22561, 22538, 22514, 22491, 22468, 22444, 22421, 22398, 22374, 22351,
+    22327, 22304, 22281, 22257, 22234, 22210, 22187, 22163, 22140, 22116,
+    22092, 22069, 22045, 22022, 21998, 21975, 21951, 21927, 21904, 21880,
+    21856, 21833, 21809, 21785, 21761, 21738, 21714, 21690, 21666, 21643,
+    21619, 21595, 21571, 21547, 21523, 21499, 21476, 21452, 21428, 21404,
+    21380, 21356, 21332, 21308, 21284, 21260, 21236, 21212, 21188, 21164,
+    21140, 21116, 21092, 21068, 21044, 21020, 20996, 20971, 20947, 20923,
+    20899, 20875, 20851, 20826, 20802, 20778, 20754, 20730, 20705, 20681,
+    20657, 20633, 20608, 20584, 20560, 20535, 20511, 20487, 20462, 20438,
+    20414, 20389, 20365, 20341, 20316, 20292, 20267, 20243, 20219, 20194,
+    20170, 20145, 20121, 20096, 20072, 20047, 20023, 19998, 19974, 19949,
+    19925, 19900, 19876, 19851, 19826, 19802, 19777, 19753, 19728, 19704,
+    19679, 19654, 19630, 19605, 19580, 19556, 19531, 19506, 19482, 19457,
+    19432, 19408, 19383, 19358, 19333, 19309, 19284, 19259, 19235, 19210,
+    19185, 19160, 19136, 19111, 19086, 19061, 19036, 19012, 18987, 18962,
+    18937, 18912, 18887, 18863, 18838, 18813, 18788, 18763, 18738, 18713,
+    18689, 18664, 18639, 18614, 18589, 18564, 18539, 18514, 18489, 18464,
+    18439, 18415, 18390, 18365, 18340, 18315, 18290, 18265, 18240, 18215,
+    18190, 18165, 18140, 18115, 18090, 18065, 18040, 18015, 17990, 17965,
+    17940, 17915, 17890, 17865, 17840, 17815, 17790, 17765, 17740, 17715,
+    17690, 17664, 17639, 17614, 17589, 17564, 17539, 17514, 17489, 17464,
+    17439, 17414, 17389, 17364, 17339, 17313, 17288, 17263, 17238, 17213,
+    17188, 17163, 17138, 17113, 17088, 17062, 17037, 17012, 16987, 16962,
+    16937, 16912, 16887, 16861, 16836, 16811, 16786, 16761, 16736, 16711,
+    16686, 16660, 16635, 16610, 16585, 16560, 16535, 16510, 16485, 16459,
+    16434, 16409, 16384, 16359, 16334, 16309, 16283, 16258, 16233, 16208,
+    16183, 16158, 16133, 16108, 16082, 16057, 16032, 16007, 15982, 15957,
+    15932, 15907, 15881, 15856, 15831, 15806, 15781, 15756, 15731, 15706,
+    15680, 15655, 15630, 15605, 15580, 15555, 15530, 15505, 15480, 15455,
+    15429, 15404, 15379, 15354, 15329, 15304, 15279, 15254, 15229, 15204,
+    15179, 15154, 15129, 15104, 15078, 15053, 15028, 15003, 14978, 14953,
+    14928, 14903, 14878, 14853, 14828, 14803, 14778, 14753, 14728, 14703,
+    14678, 14653, 14628, 14603, 14578, 14553, 14528, 14503, 14478, 14453,
+    14428, 14403, 14378, 14353, 14329, 14304, 14279, 14254, 14229, 14204,
+    14179, 14154, 14129, 14104, 14079, 14055, 14030, 14005, 13980, 13955,
+    13930, 13905, 13881, 13856, 13831, 13806, 13781, 13756, 13732, 13707,
+    13682, 13657, 13632, 13608, 13583, 13558, 13533, 13509, 13484, 13459,
+    13435, 13410, 13385, 13360, 13336, 13311, 13286, 13262, 13237, 13212,
+    13188, 13163, 13138, 13114, 13089, 13064, 13040, 13015, 12991, 12966,
+    12942, 12917, 12892, 12868, 12843, 12819, 12794, 12770, 12745, 12721,
+    12696, 12672, 12647, 12623, 12598, 12574, 12549, 12525, 12501, 12476,
+    12452, 12427, 12403, 12379, 12354, 12330, 12306, 12281, 12257, 12233,
+    12208, 12184, 12160, 12135, 12111, 12087, 12063, 12038, 12014, 11990,
+    11966, 11942, 11917, 11893, 11869, 11845, 11821, 11797, 11772, 11748,
+    11724, 11700, 11676, 11652, 11628, 11604, 11580, 11556, 11532, 11508,
+    11484, 11460, 11436, 11412, 11388, 11364, 11340, 11316, 11292, 11269,
+    11245, 11221, 11197, 11173, 11149, 11125, 11102, 11078, 11054, 11030,
+    11007, 10983, 10959, 10935, 10912, 10888, 10864, 10841, 10817, 10793,
+    10770, 10746, 10723, 10699, 10676, 10652, 10628, 10605, 10581, 10558,
+    10534, 10511, 10487, 10464, 10441, 10417, 10394, 10370, 10347, 10324,
+    10300, 10277, 10254, 10230, 10207, 10184, 10161, 10137, 10114, 10091,
+    10068, 10045, 10021, 9998, 9975, 9952, 9929, 9906, 9883, 9860,
+    9837, 9814, 9791, 9768, 9745, 9722, 9699, 9676, 9653, 9630,
+    9607, 9584, 9561, 9538, 9516, 9493, 9470, 9447, 9424, 9402,
+    9379, 9356, 9334, 9311, 9288, 9266, 9243, 9220, 9198, 9175,
+    9153, 9130, 9108, 9085, 9063, 9040, 9018, 8995, 8973, 8950,
+    8928, 8906, 8883, 8861, 8839, 8816, 8794, 8772, 8749, 8727,
+    8705, 8683, 8661, 8638, 8616, 8594, 8572, 8550, 8528, 8506,
+    8484, 8462, 8440, 8418, 8396, 8374, 8352, 8330, 8308, 8286,
+    8265, 8243, 8221, 8199, 8177, 8156, 8134, 8112, 8091, 8069,
+    8047, 8026, 8004, 7983, 7961, 7939, 7918, 7896, 7875, 7853,
+    7832, 7811, 7789, 7768, 7746, 7725, 7704, 7682, 7661, 7640,
+    7619, 7597, 7576, 7555, 7534, 7513, 7492, 7470, 7449, 7428,
+    7407, 7386, 7365, 7344, 7323, 7302, 7282, 7261, 7240, 7219,
+    7198, 7177, 7157, 7136, 7115, 7094, 7074, 7053, 7032, 7012,
+    6991, 6971, 6950, 6929, 6909, 6888, 6868, 6847, 6827, 6807,
+    6786, 6766, 6746, 6725, 6705, 6685, 6664, 6644, 6624, 6604,
+    6584, 6564, 6543, 6523, 6503, 6483, 6463, 6443, 6423, 6403,
+    6383, 6364, 6344, 6324, 6304, 6284, 6264, 6245, 6225, 6205,
+    6186, 6166, 6146, 6127, 6107, 6088, 6068, 6048, 6029, 6010,
+    5990, 5971, 5951, 5932, 5913, 5893, 5874, 5855, 5835, 5816,
+    5797, 5778, 5759, 5740, 5721, 5701, 5682, 5663, 5644, 5625,
+    5606, 5588, 5569, 5550, 5531, 5512, 5493, 5475, 5456, 5437,
+    5418, 5400, 5381, 5363, 5344, 5325, 5307, 5288, 5270, 5251,
+    5233, 5215, 5196, 5178, 5160, 5141, 5123, 5105, 5087, 5068,
+    5050, 5032, 5014, 4996, 4978, 4960, 4942, 4924, 4906, 4888,
+    4870, 4852, 4834, 4817, 4799, 4781, 4763, 4746, 4728, 4710,
+    4693, 4675, 4657, 4640, 4622, 4605, 4587, 4570, 4553, 4535,
+    4518, 4501, 4483, 4466, 4449, 4432, 4414, 4397, 4380, 4363,
+    4346, 4329, 4312, 4295, 4278, 4261, 4244, 4227, 4211, 4194,
+    4177, 4160, 4144, 4127, 4110, 4094, 4077, 4060, 4044, 4027,
+    4011, 3994, 3978, 3961, 3945, 3929, 3912, 3896, 3880, 3864,
+    3847, 3831, 3815, 3799, 3783, 3767, 3751, 3735, 3719, 3703,
+    3687, 3671, 3655, 3640, 3624, 3608, 3592, 3577, 3561, 3545,
+    3530, 3514, 3499, 3483, 3468, 3452, 3437, 3421, 3406, 3391,
+    3376, 3360, 3345, 3330, 3315, 3299, 3284, 3269, 3254, 3239,
+    3224, 3209, 3194, 3179, 3165, 3150, 3135, 3120, 3105, 3091,
+    3076, 3061, 3047, 3032, 3018, 3003, 2989, 2974, 2960, 2945,
+    2931, 2917, 2902, 2888, 2874, 2860, 2846, 2831, 2817, 2803,
+    2789, 2775, 2761, 2747, 2733, 2719, 2706, 2692, 2678, 2664,
+    2651, 2637, 2623, 2610, 2596, 2582, 2569, 2555, 2542, 2528,
+    2515, 2502, 2488, 2475, 2462, 2449, 2435, 2422, 2409, 2396,
+    2383, 2370, 2357, 2344, 2331, 2318, 2305, 2292, 2280, 2267,
+    2254, 2241, 2229, 2216, 2203, 2191, 2178, 2166, 2153, 2141,
+    2128, 2116, 2104, 2091, 2079, 2067, 2055, 2043, 2030, 2018,
+    2006, 1994, 1982, 1970, 1958, 1946, 1935, 1923, 1911, 1899,
+    1887, 1876, 1864, 1853, 1841, 1829, 1818, 1806, 1795, 1783,
+    1772, 1761, 1749, 1738, 1727, 1716, 1704, 1693, 1682, 1671,
+    1660, 1649, 1638, 1627, 1616, 1605, 1595, 1584, 1573, 1562,
+    1552, 1541, 1530, 1520, 1509, 1499, 1488, 1478, 1467, 1457,
+    1447, 1436, 1426, 1416, 1406, 1395, 1385, 1375, 1365, 1355,
+    1345, 1335, 1325, 1315, 1306, 1296, 1286, 1276, 1266, 1257,
+    1247, 1238, 1228, 1218, 1209, 1200, 1190, 1181, 1171, 1162,
+    1153, 1144, 1134, 1125, 1116, 1107, 1098, 1089, 1080, 1071,
+    1062, 1053, 1044, 1035, 1027, 1018, 1009, 1001, 992, 983,
+    975, 966, 958, 949, 941, 933, 924, 916, 908, 899,
+    891, 883, 875, 867, 859, 851, 843, 835, 827, 819,
+    811, 803, 796, 788, 780, 773, 765, 757, 750, 742,
+    735, 728, 720, 713, 705, 698, 691, 684, 677, 669,
+    662, 655, 648, 641, 634, 627, 621, 614, 607, 600,
+    593, 587, 580, 574, 567, 560, 554, 547, 541, 535,
+    528, 522, 516, 509, 503, 497, 491, 485, 479, 473,
+    467, 461, 455, 449, 443, 438, 432, 426, 420, 415,
+    409, 404, 398, 393, 387, 382, 376, 371, 366, 360,
+    355, 350, 345, 340, 335, 330, 325, 320, 315, 310,
+    305, 300, 296, 291, 286, 281, 277, 272, 268, 263,
+    259, 254, 250, 246, 241, 237, 233, 228, 224, 220,
+    216, 212, 208, 204, 200, 196, 192, 189, 185, 181,
+    177, 174, 170, 166, 163, 159, 156, 152, 149, 146,
+    142, 139, 136, 133, 129, 126, 123, 120, 117, 114,
+    111, 108, 105, 103, 100, 97, 94, 92, 89, 86,
+    84, 81, 79, 76, 74, 72, 69, 67, 65, 63,
+    60, 58, 56, 54, 52, 50, 48, 46, 44, 43,
+    41, 39, 37, 36, 34, 32, 31, 29, 28, 26,
+    25, 24, 22, 21, 20, 19, 17, 16, 15, 14,
+    13, 12, 11, 10, 9, 9, 8, 7, 6, 6,
+    5, 4, 4, 3, 3, 2, 2, 2, 1, 1,
+    1, 0, 0, 0, 0, 0
+};
+
+/* Flat-top, 64 points */
+const q15_t Window_flatTop64[64] __attribute__((aligned(4))) = {
+    -14, -22, -48, -96, -173, -284, -437, -636, -881, -1164,
+    -1472, -1781, -2054, -2249, -2311, -2180, -1794, -1093, -27, 1443,
+    3334, 5639, 8325, 11327, 14553, 17888, 21197, 24333, 27149, 29507,
+    31286, 32392, 32767, 32392, 31286, 29507, 27149, 24333, 21197, 17888,
+    14553, 11327, 8325, 5639, 3334, 1443, -27, -1093, -1794, -2180,
+    -2311, -2249, -2054, -1781, -1472, -1164, -881, -636, -437, -284,
+    -173, -96, -48, -22
+};
+
+/* Flat-top, 128 points */
+const q15_t Window_flatTop128[128] __attribute__((aligned(4))) = {
+    -14, -16, -22, -33, -48, -69, -96, -131, -173, -224,
+    -284, -355, -437, -531, -636, -753, -881, -1018, -1164, -1317,
+    -1472, -1628, -1781, -1924, -2054, -2165, -2249, -2300, -2311, -2273,
+    -2180, -2022, -1794, -1486, -1093, -609, -27, 656, 1443, 2336,
+    3334, 4436, 5639, 6938, 8325, 9791, 11327, 12919, 14553, 16215,
+    17888, 19555, 21197, 22796, 24333, 25790, 27149, 28394, 29507, 30475,
+    31286, 31928, 32392, 32674, 32767, 32674, 32392, 31928, 31286, 30475,
+    29507, 28394, 27149, 25790, 24333, 22796, 21197, 19555, 17888, 16215,
+    14553, 12919, 11327, 9791, 8325, 6938, 5639, 4436, 3334, 2336,
+    1443, 656, -27, -609, -1093, -1486, -1794, -2022, -2180, -2273,
+    -2311, -2300, -2249, -2165, -2054, -1924, -1781, -1628, -1472, -1317,
+    -1164, -1018, -881, -753, -636, -531, -437, -355, -284, -224,
+    -173, -131, -96, -69, -48, -33, -22, -16
+};
+
+/* Flat-top, 256 points */
+const q15_t Window_flatTop256[256] __attribute__((aligned(4))) = {
+    -14, -14, -16, -18, -22, -27, -33, -40, -48, -58,
+    -69, -82, -96, -113, -131, -151, -173, -197, -224, -253,
+    -284, -318, -355, -395, -437, -482, -531, -582, -636, -693,
+    -753, -815, -881, -948, -1018, -1090, -1164, -1240, -1317, -1394,
+    -1472, -1551, -1628, -1705, -1781, -1854, -1924, -1992, -2054, -2112,
+    -2165, -2211, -2249, -2279, -2300, -2311, -2311, -2298, -2273, -2234,
+    -2180, -2109, -2022, -1917, -1794, -1650, -1486, -1301, -1093, -863,
+    -609, -330, -27, 302, 656, 1036, 1443, 1876, 2336, 2822,
+    3334, 3872, 4436, 5026, 5639, 6277, 6938, 7621, 8325, 9049,
+    9791, 10551, 11327, 12117, 12919, 13732, 14553, 15382, 16215, 17052,
+    17888, 18724, 19555, 20380, 21197, 22003, 22796, 23573, 24333, 25073,
+    25790, 26483, 27149, 27787, 28394, 28968, 29507, 30010, 30475, 30901,
+    31286, 31628, 31928, 32183, 32392, 32556, 32674, 32744, 32767, 32744,
+    32674, 32556, 32392, 32183, 31928, 31628, 31286, 30901, 30475, 30010,
+    29507, 28968, 28394, 27787, 27149, 26483, 25790, 25073, 24333, 23573,
+    22796, 22003, 21197, 20380, 19555, 18724, 17888, 17052, 16215, 15382,
+    14553, 13732, 12919, 12117, 11327, 10551, 9791, 9049, 8325, 7621,
+    6938, 6277, 5639, 5026, 4436, 3872, 3334, 2822, 2336, 1876,
+    1443, 1036, 656, 302, -27, -330, -609, -863, -1093, -1301,
+    -1486, -1650, -1794, -1917, -2022, -2109, -2180, -2234, -2273, -2298,
+    -2311, -2311, -2300, -2279, -2249, -2211, -2165, -2112, -2054, -1992,
+    -1924, -1854, -1781, -1705, -1628, -1551, -1472, -1394, -1317, -1240,
+    -1164, -1090, -1018, -948, -881, -815, -753, -693, -636, -582,
+    -531, -482, -437, -395, -355, -318, -284, -253, -224, -197,
+    -173, -151, -131, -113, -96, -82, -69, -58, -48, -40,
+    -33, -27, -22, -18, -16, -14
+};
+
+/* Flat-top, 512 points */
+const q15_t Window_flatTop512[512] __attribute__((aligned(4))) = {
+    -14, -14, -14, -15, -16, -17, -18, -20, -22, -24,
+    -27, -30, -33, -36, -40, -44, -48, -53, -58, -63,
+    -69, -75, -82, -89, -96, -104, -113, -121, -131, -140,
+    -151, -161, -173, -184, -197, -210, -224, -238, -253, -268,
+    -284, -301, -318, -336, -355, -375, -395, -416, -437, -459,
+    -482, -506, -531, -556, -582, -609, -636, -664, -693, -723,
+    -753, -784, -815, -848, -881, -914, -948, -983, -1018, -1054,
+    -1090, -1127, -1164, -1202, -1240, -1278, -1317, -1355, -1394, -1433,
+    -1472, -1511, -1551, -1590, -1628, -1667, -1705, -1743, -1781, -1818,
+    -1854, -1890, -1924, -1958, -1992, -2024, -2054, -2084, -2112, -2139,
+    -2165, -2189, -2211, -2231, -2249, -2265, -2279, -2291, -2300, -2307,
+    -2311, -2312, -2311, -2306, -2298, -2287, -2273, -2255, -2234, -2209,
+    -2180, -2146, -2109, -2068, -2022, -1972, -1917, -1858, -1794, -1724,
+    -1650, -1571, -1486, -1396, -1301, -1200, -1093, -981, -863, -739,
+    -609, -472, -330, -182, -27, 134, 302, 476, 656, 843,
+    1036, 1236, 1443, 1656, 1876, 2103, 2336, 2575, 2822, 3075,
+    3334, 3600, 3872, 4151, 4436, 4728, 5026, 5330, 5639, 5955,
+    6277, 6605, 6938, 7277, 7621, 7970, 8325, 8685, 9049, 9418,
+    9791, 10169, 10551, 10937, 11327, 11720, 12117, 12516, 12919, 13324,
+    13732, 14142, 14553, 14967, 15382, 15798, 16215, 16633, 17052, 17470,
+    17888, 18306, 18724, 19140, 19555, 19969, 20380, 20790, 21197, 21602,
+    22003, 22401, 22796, 23187, 23573, 23956, 24333, 24706, 25073, 25434,
+    25790, 26140, 26483, 26820, 27149, 27472, 27787, 28094, 28394, 28685,
+    28968, 29242, 29507, 29763, 30010, 30248, 30475, 30693, 30901, 31099,
+    31286, 31463, 31628, 31784, 31928, 32061, 32183, 32293, 32392, 32480,
+    32556, 32621, 32674, 32715, 32744, 32762, 32767, 32762, 32744, 32715,
+    32674, 32621, 32556, 32480, 32392, 32293, 32183, 32061, 31928, 31784,
+    31628, 31463, 31286, 31099, 30901, 30693, 30475, 30248, 30010, 29763,
+    29507, 29242, 28968, 28685, 28394, 28094, 27787, 27472, 27149, 26820,
+    26483, 26140, 25790, 25434, 25073, 24706, 24333, 23956, 23573, 23187,
+    22796, 22401, 22003, 21602, 21197, 20790, 20380, 19969, 19555, 19140,
+    18724, 18306, 17888, 17470, 17052, 16633, 16215, 15798, 15382, 14967,
+    14553, 14142, 13732, 13324, 12919, 12516, 12117, 11720, 11327, 10937,
+    10551, 10169, 9791, 9418, 9049, 8685, 8325, 7970, 7621, 7277,
+    6938, 6605, 6277, 5955, 5639, 5330, 5026, 4728, 4436, 4151,
+    3872, 3600, 3334, 3075, 2822, 2575, 2336, 2103, 1876, 1656,
+    1443, 1236, 1036, 843, 656, 476, 302, 134, -27, -182,
+    -330, -472, -609, -739, -863, -981, -1093, -1200, -1301, -1396,
+    -1486, -1571, -1650, -1724, -1794, -1858, -1917, -1972, -2022, -2068,
+    -2109, -2146, -2180, -2209, -2234, -2255, -2273, -2287, -2298, -2306,
+    -2311, -2312, -2311, -2307, -2300, -2291, -2279, -2265, -2249, -2231,
+    -2211, -2189, -2165, -2139, -2112, -2084, -2054, -2024, -1992, -1958,
+    -1924, -1890, -1854, -1818, -1781, -1743, -1705, -1667, -1628, -1590,
+    -1551, -1511, -1472, -1433, -1394, -1355, -1317, -1278, -1240, -1202,
+    -1164, -1127, -1090, -1054, -1018, -983, -948, -914, -881, -848,
+    -815, -784, -753, -723, -693, -664, -636, -609, -582, -556,
+    -531, -506, -482, -459, -437, -416, -395, -375, -355, -336,
+    -318, -301, -284, -268, -253, -238, -224, -210, -197, -184,
+    -173, -161, -151, -140, -131, -121, -113, -104, -96, -89,
+    -82, -75, -69, -63, -58, -53, -48, -44, -40, -36,
+    -33, -30, -27, -24, -22, -20, -18, -17, -16, -15,
+    -14, -14
+};
+
+/* Flat-top, 1024 points */
+const q15_t Window_flatTop1024[1024] __attribute__((aligned(4))) = {
+    -14, -14, -14, -14, -14, -15, -15, -15, -16, -16,
+    -17, -18, -18, -19, -20, -21, -22, -23, -24, -25,
+    -27, -28, -30, -31, -33, -34, -36, -38, -40, -42,
+    -44, -46, -48, -50, -53, -55, -58, -61, -63, -66,
+    -69, -72, -75, -79, -82, -85, -89, -93, -96, -100,
+    -104, -108, -113, -117, -121, -126, -131, -135, -140, -145,
+    -151, -156, -161, -167, -173, -178, -184, -191, -197, -203,
+    -210, -217, -224, -231, -238, -245, -253, -260, -268, -276,
+    -284, -292, -301, -309, -318, -327, -336, -346, -355, -365,
+    -375, -385, -395, -405, -416, -426, -437, -448, -459, -471,
+    -482, -494, -506, -518, -531, -543, -556, -569, -582, -595,
+    -609, -622, -636, -650, -664, -678, -693, -708, -723, -738,
+    -753, -768, -784, -799, -815, -831, -848, -864, -881, -897,
+    -914, -931, -948, -966, -983, -1000, -1018, -1036, -1054, -1072,
+    -1090, -1109, -1127, -1146, -1164, -1183, -1202, -1221, -1240, -1259,
+    -1278, -1297, -1317, -1336, -1355, -1375, -1394, -1414, -1433, -1453,
+    -1472, -1492, -1511, -1531, -1551, -1570, -1590, -1609, -1628, -1648,
+    -1667, -1686, -1705, -1724, -1743, -1762, -1781, -1799, -1818, -1836,
+    -1854, -1872, -1890, -1907, -1924, -1942, -1958, -1975, -1992, -2008,
+    -2024, -2039, -2054, -2069, -2084, -2098, -2112, -2126, -2139, -2152,
+    -2165, -2177, -2189, -2200, -2211, -2221, -2231, -2240, -2249, -2257,
+    -2265, -2272, -2279, -2285, -2291, -2296, -2300, -2304, -2307, -2309,
+    -2311, -2312, -2312, -2312, -2311, -2309, -2306, -2303, -2298, -2293,
+    -2287, -2281, -2273, -2265, -2255, -2245, -2234, -2222, -2209, -2195,
+    -2180, -2164, -2146, -2128, -2109, -2089, -2068, -2046, -2022, -1998,
+    -1972, -1945, -1917, -1888, -1858, -1826, -1794, -1760, -1724, -1688,
+    -1650, -1611, -1571, -1529, -1486, -1442, -1396, -1349, -1301, -1251,
+    -1200, -1147, -1093, -1038, -981, -923, -863, -801, -739, -674,
+    -609, -541, -472, -402, -330, -257, -182, -105, -27, 53,
+    134, 217, 302, 388, 476, 565, 656, 749, 843, 939,
+    1036, 1136, 1236, 1339, 1443, 1549, 1656, 1765, 1876, 1988,
+    2103, 2218, 2336, 2455, 2575, 2698, 2822, 2947, 3075, 3203,
+    3334, 3466, 3600, 3735, 3872, 4011, 4151, 4293, 4436, 4581,
+    4728, 4876, 5026, 5177, 5330, 5484, 5639, 5797, 5955, 6116,
+    6277, 6440, 6605, 6771, 6938, 7107, 7277, 7448, 7621, 7795,
+    7970, 8147, 8325, 8504, 8685, 8866, 9049, 9233, 9418, 9604,
+    9791, 9980, 10169, 10360, 10551, 10744, 10937, 11132, 11327, 11523,
+    11720, 11918, 12117, 12316, 12516, 12717, 12919, 13121, 13324, 13528,
+    13732, 13936, 14142, 14347, 14553, 14760, 14967, 15174, 15382, 15590,
+    15798, 16007, 16215, 16424, 16633, 16842, 17052, 17261, 17470, 17679,
+    17888, 18098, 18306, 18515, 18724, 18932, 19140, 19348, 19555, 19762,
+    19969, 20175, 20380, 20585, 20790, 20994, 21197, 21400, 21602, 21803,
+    22003, 22203, 22401, 22599, 22796, 22992, 23187, 23381, 23573, 23765,
+    23956, 24145, 24333, 24520, 24706, 24890, 25073, 25254, 25434, 25613,
+    25790, 25966, 26140, 26312, 26483, 26652, 26820, 26985, 27149, 27312,
+    27472, 27630, 27787, 27942, 28094, 28245, 28394, 28540, 28685, 28827,
+    28968, 29106, 29242, 29376, 29507, 29636, 29763, 29888, 30010, 30130,
+    30248, 30363, 30475, 30586, 30693, 30798, 30901, 31001, 31099, 31194,
+    31286, 31376, 31463, 31547, 31628, 31707, 31784, 31857, 31928, 31996,
+    32061, 32123, 32183, 32239, 32293, 32344, 32392, 32438, 32480, 32520,
+    32556, 32590, 32621, 32649, 32674, 32696, 32715, 32731, 32744, 32755,
+    32762, 32767, 32767, 32767, 32762, 32755, 32744, 32731, 32715, 32696,
+    32674, 32649, 32621, 32590, 32556, 32520, 32480, 32438, 32392, 32344,
+    32293, 32239, 32183, 32123, 32061, 31996, 31928, 31857, 31784, 31707,
+    31628, 31547, 31463, 31376, 31286, 31194, 31099, 31001, 30901, 30798,
+    30693, 30586, 30475, 30363, 30248, 30130, 30010, 29888, 29763, 29636,
+    29507, 29376, 29242, 29106, 28968, 28827, 28685, 28540, 28394, 28245,
+    28094, 27942, 27787, 27630, 27472, 27312, 27149, 26985, 26820, 26652,
+    26483, 26312, 26140, 25966, 25790, 25613, 25434, 25254, 25073, 24890,
+    24706, 24520, 24333, 24145, 23956, 23765, 23573, 23381, 23187, 22992,
+    22796, 22599, 22401, 22203, 22003, 21803, 21602, 21400, 21197, 20994,
+    20790, 20585, 20380, 20175, 19969, 19762, 19555, 19348, 19140, 18932,
+    18724, 18515, 18306, 18098, 17888, 17679, 17470, 17261, 17052, 16842,
+    16633, 16424, 16215, 16007, 15798, 15590, 15382, 15174, 14967, 14760,
+    14553, 14347, 14142, 13936, 13732, 13528, 13324, 13121, 12919, 12717,
+    12516, 12316, 12117, 11918, 11720, 11523, 11327, 11132, 10937, 10744,
+    10551, 10360, 10169, 9980, 9791, 9604, 9418, 9233, 9049, 8866,
+    8685, 8504, 8325, 8147, 7970, 7795, 7621, 7448, 7277, 7107,
+    6938, 6771, 6605, 6440, 6277, 6116, 5955, 5797, 5639, 5484,
+    5330, 5177, 5026, 4876, 4728, 4581, 4436, 4293, 4151, 4011,
+    3872, 3735, 3600, 3466, 3334, 3203, 3075, 2947, 2822, 2698,
+    2575, 2455, 2336, 2218, 2103, 1988, 1876, 1765, 1656, 1549,
+    1443, 1339, 1236, 1136, 1036, 939, 843, 749, 656, 565,
+    476, 388, 302, 217, 134, 53, -27, -105, -182, -257,
+    -330, -402, -472, -541, -609, -674, -739, -801, -863, -923,
+    -981, -1038, -1093, -1147, -1200, -1251, -1301, -1349, -1396, -1442,
+    -1486, -1529, -1571, -1611, -1650, -1688, -1724, -1760, -1794, -1826,
+    -1858, -1888, -1917, -1945, -1972, -1998, -2022, -2046, -2068, -2089,
+    -2109, -2128, -2146, -2164, -2180, -2195, -2209, -2222, -2234, -2245,
+    -2255, -2265, -2273, -2281, -2287, -2293, -2298, -2303, -2306, -2309,
+    -2311, -2312, -2312, -2312, -2311, -2309, -2307, -2304, -2300, -2296,
+    -2291, -2285, -2279, -2272, -2265, -2257, -2249, -2240, -2231, -2221,
+    -2211, -2200, -2189, -2177, -2165, -2152, -2139, -2126, -2112, -2098,
+    -2084, -2069, -2054, -2039, -2024, -2008, -1992, -1975, -1958, -1942,
+    -1924, -1907, -1890, -1872, -1854, -1836, -1818, -1799, -1781, -1762,
+    -1743, -1724, -1705, -1686, -1667, -1648, -1628, -1609, -1590, -1570,
+    -1551, -1531, -1511, -1492, -1472, -1453, -1433, -1414, -1394, -1375,
+    -1355, -1336, -1317, -1297, -1278, -1259, -1240, -1221, -1202, -1183,
+    -1164, -1146, -1127, -1109, -1090, -1072, -1054, -1036, -1018, -1000,
+    -983, -966, -948, -931, -914, -897, -881, -864, -848, -831,
+    -815, -799, -784, -768, -753, -738, -723, -708, -693, -678,
+    -664, -650, -636, -622, -609, -595, -582, -569, -556, -543,
+    -531, -518, -506, -494, -482, -471, -459, -448, -437, -426,
+    -416, -405, -395, -385, -375, -365, -355, -346, -336, -327,
+    -318, -309, -301, -292, -284, -276, -268, -260, -253, -245,
+    -238, -231, -224, -217, -210, -203, -197, -191, -184, -178,
+    -173, -167, -161, -156, -151, -145, -140, -135, -131, -126,
+    -121, -117, -113, -108, -104, -100, -96, -93, -89, -85,
+    -82, -79, -75, -72, -69, -66, -63, -61, -58, -55,
+    -53, -50, -48, -46, -44, -42, -40, -38, -36, -34,
+    -33, -31, -30, -28, -27, -25, -24, -23, -22, -21,
+    -20, -19, -18, -18, -17, -16, -16, -15, -15, -15,
+    -14, -14, -14, -14
+};
+
+/* Flat-top, 2048 points */
+const q15_t Window_flatTop2048[2048] __attribute__((aligned(4))) = {
+    -14, -14, -14, -14, -14, -14, -14, -14, -14, -14,
+    -15, -15, -15, -15, -15, -16, -16, -16, -16, -17,
+    -17, -17, -18, -18, -18, -19, -19, -20, -20, -21,
+    -21, -22, -22, -23, -23, -24, -24, -25, -25, -26,
+    -27, -27, -28, -29, -30, -30, -31, -32, -33, -33,
+    -34, -35, -36, -37, -38, -39, -40, -41, -42, -43,
+    -44, -45, -46, -47, -48, -49, -50, -52, -53, -54,
+    -55, -57, -58, -59, -61, -62, -63, -65, -66, -68,
+    -69, -71, -72, -74, -75, -77, -79, -80, -82, -84,
+    -85, -87, -89, -91, -93, -94, -96, -98, -100, -102,
+    -104, -106, -108, -110, -113, -115, -117, -119, -121, -124,
+    -126, -128, -131, -133, -135, -138, -140, -143, -145, -148,
+    -151, -153, -156, -159, -161, -164, -167, -170, -173, -176,
+    -178, -181, -184, -188, -191, -194, -197, -200, -203, -207,
+    -210, -213, -217, -220, -224, -227, -231, -234, -238, -241,
+    -245, -249, -253, -256, -260, -264, -268, -272, -276, -280,
+    -284, -288, -292, -297, -301, -305, -309, -314, -318, -323,
+    -327, -332, -336, -341, -346, -350, -355, -360, -365, -370,
+    -375, -379, -385, -390, -395, -400, -405, -410, -416, -421,
+    -426, -432, -437, -443, -448, -454, -459, -465, -471, -477,
+    -482, -488, -494, -500, -506, -512, -518, -525, -531, -537,
+    -543, -550, -556, -562, -569, -575, -582, -589, -595, -602,
+    -609, -615, -622, -629, -636, -643, -650, -657, -664, -671,
+    -678, -686, -693, -700, -708, -715, -723, -730, -738, -745,
+    -753, -760, -768, -776, -784, -792, -799, -807, -815, -823,
+    -831, -840, -848, -856, -864, -872, -881, -889, -897, -906,
+    -914, -923, -931, -940, -948, -957, -966, -974, -983, -992,
+    -1000, -1009, -1018, -1027, -1036, -1045, -1054, -1063, -1072, -1081,
+    -1090, -1099, -1109, -1118, -1127, -1136, -1146, -1155, -1164, -1174,
+    -1183, -1192, -1202, -1211, -1221, -1230, -1240, -1249, -1259, -1268,
+    -1278, -1288, -1297, -1307, -1317, -1326, -1336, -1346, -1355, -1365,
+    -1375, -1384, -1394, -1404, -1414, -1423, -1433, -1443, -1453, -1463,
+    -1472, -1482, -1492, -1502, -1511, -1521, -1531, -1541, -1551, -1560,
+    -1570, -1580, -1590, -1599, -1609, -1619, -1628, -1638, -1648, -1657,
+    -1667, -1677, -1686, -1696, -1705, -1715, -1724, -1734, -1743, -1753,
+    -1762, -1771, -1781, -1790, -1799, -1808, -1818, -1827, -1836, -1845,
+    -1854, -1863, -1872, -1881, -1890, -1898, -1907, -1916, -1924, -1933,
+    -1942, -1950, -1958, -1967, -1975, -1983, -1992, -2000, -2008, -2016,
+    -2024, -2031, -2039, -2047, -2054, -2062, -2069, -2077, -2084, -2091,
+    -2098, -2106, -2112, -2119, -2126, -2133, -2139, -2146, -2152, -2159,
+    -2165, -2171, -2177, -2183, -2189, -2194, -2200, -2205, -2211, -2216,
+    -2221, -2226, -2231, -2235, -2240, -2245, -2249, -2253, -2257, -2261,
+    -2265, -2269, -2272, -2276, -2279, -2282, -2285, -2288, -2291, -2293,
+    -2296, -2298, -2300, -2302, -2304, -2305, -2307, -2308, -2309, -2310,
+    -2311, -2311, -2312, -2312, -2312, -2312, -2312, -2311, -2311, -2310,
+    -2309, -2307, -2306, -2304, -2303, -2301, -2298, -2296, -2293, -2290,
+    -2287, -2284, -2281, -2277, -2273, -2269, -2265, -2260, -2255, -2250,
+    -2245, -2239, -2234, -2228, -2222, -2215, -2209, -2202, -2195, -2187,
+    -2180, -2172, -2164, -2155, -2146, -2138, -2128, -2119, -2109, -2099,
+    -2089, -2079, -2068, -2057, -2046, -2034, -2022, -2010, -1998, -1985,
+    -1972, -1959, -1945, -1931, -1917, -1903, -1888, -1873, -1858, -1842,
+    -1826, -1810, -1794, -1777, -1760, -1742, -1724, -1706, -1688, -1669,
+    -1650, -1631, -1611, -1591, -1571, -1550, -1529, -1508, -1486, -1464,
+    -1442, -1419, -1396, -1373, -1349, -1325, -1301, -1276, -1251, -1226,
+    -1200, -1174, -1147, -1120, -1093, -1066, -1038, -1010, -981, -952,
+    -923, -893, -863, -832, -801, -770, -739, -707, -674, -642,
+    -609, -575, -541, -507, -472, -437, -402, -366, -330, -294,
+    -257, -219, -182, -144, -105, -66, -27, 13, 53, 93,
+    134, 176, 217, 259, 302, 345, 388, 432, 476, 520,
+    565, 610, 656, 702, 749, 796, 843, 891, 939, 987,
+    1036, 1086, 1136, 1186, 1236, 1287, 1339, 1391, 1443, 1496,
+    1549, 1602, 1656, 1711, 1765, 1820, 1876, 1932, 1988, 2045,
+    2103, 2160, 2218, 2277, 2336, 2395, 2455, 2515, 2575, 2636,
+    2698, 2759, 2822, 2884, 2947, 3011, 3075, 3139, 3203, 3269,
+    3334, 3400, 3466, 3533, 3600, 3667, 3735, 3804, 3872, 3941,
+    4011, 4081, 4151, 4222, 4293, 4365, 4436, 4509, 4581, 4654,
+    4728, 4802, 4876, 4951, 5026, 5101, 5177, 5253, 5330, 5406,
+    5484, 5561, 5639, 5718, 5797, 5876, 5955, 6035, 6116, 6196,
+    6277, 6359, 6440, 6522, 6605, 6688, 6771, 6854, 6938, 7022,
+    7107, 7192, 7277, 7362, 7448, 7534, 7621, 7708, 7795, 7883,
+    7970, 8059, 8147, 8236, 8325, 8414, 8504, 8594, 8685, 8775,
+    8866, 8957, 9049, 9141, 9233, 9325, 9418, 9511, 9604, 9698,
+    9791, 9886, 9980, 10074, 10169, 10264, 10360, 10455, 10551, 10647,
+    10744, 10840, 10937, 11034, 11132, 11229, 11327, 11425, 11523, 11621,
+    11720, 11819, 11918, 12017, 12117, 12216, 12316, 12416, 12516, 12617,
+    12717, 12818, 12919, 13020, 13121, 13222, 13324, 13426, 13528, 13630,
+    13732, 13834, 13936, 14039, 14142, 14244, 14347, 14450, 14553, 14657,
+    14760, 14863, 14967, 15071, 15174, 15278, 15382, 15486, 15590, 15694,
+    15798, 15903, 16007, 16111, 16215, 16320, 16424, 16529, 16633, 16738,
+    16842, 16947, 17052, 17156, 17261, 17366, 17470, 17575, 17679, 17784,
+    17888, 17993, 18098, 18202, 18306, 18411, 18515, 18619, 18724, 18828,
+    18932, 19036, 19140, 19244, 19348, 19451, 19555, 19659, 19762, 19865,
+    19969, 20072, 20175, 20278, 20380, 20483, 20585, 20688, 20790, 20892,
+    20994, 21095, 21197, 21298, 21400, 21501, 21602, 21702, 21803, 21903,
+    22003, 22103, 22203, 22302, 22401, 22500, 22599, 22698, 22796, 22894,
+    22992, 23089, 23187, 23284, 23381, 23477, 23573, 23669, 23765, 23860,
+    23956, 24050, 24145, 24239, 24333, 24427, 24520, 24613, 24706, 24798,
+    24890, 24982, 25073, 25164, 25254, 25345, 25434, 25524, 25613, 25702,
+    25790, 25878, 25966, 26053, 26140, 26226, 26312, 26398, 26483, 26568,
+    26652, 26736, 26820, 26903, 26985, 27068, 27149, 27231, 27312, 27392,
+    27472, 27551, 27630, 27709, 27787, 27865, 27942, 28018, 28094, 28170,
+    28245, 28320, 28394, 28467, 28540, 28613, 28685, 28756, 28827, 28898,
+    28968, 29037, 29106, 29174, 29242, 29309, 29376, 29442, 29507, 29572,
+    29636, 29700, 29763, 29826, 29888, 29949, 30010, 30071, 30130, 30189,
+    30248, 30306, 30363, 30419, 30475, 30531, 30586, 30640, 30693, 30746,
+    30798, 30850, 30901, 30951, 31001, 31050, 31099, 31146, 31194, 31240,
+    31286, 31331, 31376, 31419, 31463, 31505, 31547, 31588, 31628, 31668,
+    31707, 31746, 31784, 31821, 31857, 31893, 31928, 31962, 31996, 32029,
+    32061, 32092, 32123, 32153, 32183, 32211, 32239, 32267, 32293, 32319,
+    32344, 32369, 32392, 32415, 32438, 32459, 32480, 32500, 32520, 32538,
+    32556, 32574, 32590, 32606, 32621, 32635, 32649, 32662, 32674, 32685,
+    32696, 32706, 32715, 32723, 32731, 32738, 32744, 32750, 32755, 32759,
+    32762, 32765, 32767, 32767, 32767, 32767, 32767, 32765, 32762, 32759,
+    32755, 32750, 32744, 32738, 32731, 32723, 32715, 32706, 32696, 32685,
+    32674, 32662, 32649, 32635, 32621, 32606, 32590, 32574, 32556, 32538,
+    32520, 32500, 32480, 32459, 32438, 32415, 32392, 32369, 32344, 32319,
+    32293, 32267, 32239, 32211, 32183, 32153, 32123, 32092, 32061, 32029,
+    31996, 31962, 31928, 31893, 31857, 31821, 31784, 31746, 31707, 31668,
+    31628, 31588, 31547, 31505, 31463, 31419, 31376, 31331, 31286, 31240,
+    31194, 31146, 31099, 31050, 31001, 30951, 30901, 30850, 30798, 30746,
+    30693, 30640, 30586, 30531, 30475, 30419, 30363, 30306, 30248, 30189,
+    30130, 30071, 30010, 29949, 29888, 29826, 29763, 29700, 29636, 29572,
+    29507, 29442, 29376, 29309, 29242, 29174, 29106, 29037, 28968, 28898,
+    28827, 28756, 28685, 28613, 28540, 28467, 28394, 28320, 28245, 28170,
+    28094, 28018, 27942, 27865, 27787, 27709, 27630, 27551, 27472, 27392,
+    27312, 27231, 27149, 27068, 26985, 26903, 26820, 26736, 26652, 26568,
+    26483, 26398, 26312, 26226, 26140, 26053, 25966, 25878, 25790, 25702,
+    25613, 25524, 25434, 25345, 25254, 25164, 25073, 24982, 24890, 24798,
+    24706, 24613, 24520, 24427, 24333, 24239, 24145, 24050, 23956, 23860,
+    23765, 23669, 23573, 23477, 23381, 23284, 23187, 23089, 22992, 22894,
+    22796, 22698, 22599, 22500, 22401, 22302, 22203, 22103, 22003, 21903,
+    21803, 21702, 21602, 21501, 21400, 21298, 21197, 21095, 20994, 20892,
+    20790, 20688, 20585, 20483, 20380, 20278, 20175, 20072, 19969, 19865,
+    19762, 19659, 19555, 19451, 19348, 19244, 19140, 19036, 18932, 18828,
+    18724, 18619, 18515, 18411, 18306, 18202, 18098, 17993, 17888, 17784,
+    17679, 17575, 17470, 17366, 17261, 17156, 17052, 16947, 16842, 16738,
+    16633, 16529, 16424, 16320, 16215, 16111, 16007, 15903, 15798, 15694,
+    15590, 15486, 15382, 15278, 15174, 15071, 14967, 14863, 14760, 14657,
+    14553, 14450, 14347, 14244, 14142, 14039, 13936, 13834, 13732, 13630,
+    13528, 13426, 13324, 13222, 13121, 13020, 12919, 12818, 12717, 12617,
+    12516, 12416, 12316, 12216, 12117, 12017, 11918, 11819, 11720, 11621,
+    11523, 11425, 11327, 11229, 11132, 11034, 10937, 10840, 10744, 10647,
+    10551, 10455, 10360, 10264, 10169, 10074, 9980, 9886, 9791, 9698,
+    9604, 9511, 9418, 9325, 9233, 9141, 9049, 8957, 8866, 8775,
+    8685, 8594, 8504, 8414, 8325, 8236, 8147, 8059, 7970, 7883,
+    7795, 7708, 7621, 7534, 7448, 7362, 7277, 7192, 7107, 7022,
+    6938, 6854, 6771, 6688, 6605, 6522, 6440, 6359, 6277, 6196,
+    6116, 6035, 5955, 5876, 5797, 5718, 5639, 5561, 5484, 5406,
+    5330, 5253, 5177, 5101, 5026, 4951, 4876, 4802, 4728, 4654,
+    4581, 4509, 4436, 4365, 4293, 4222, 4151, 4081, 4011, 3941,
+    3872, 3804, 3735, 3667, 3600, 3533, 3466, 3400, 3334, 3269,
+    3203, 3139, 3075, 3011, 2947, 2884, 2822, 2759, 2698, 2636,
+    2575, 2515, 2455, 2395, 2336, 2277, 2218, 2160, 2103, 2045,
+    1988, 1932, 1876, 1820, 1765, 1711, 1656, 1602, 1549, 1496,
+    1443, 1391, 1339, 1287, 1236, 1186, 1136, 1086, 1036, 987,
+    939, 891, 843, 796, 749, 702, 656, 610, 565, 520,
+    476, 432, 388, 345, 302, 259, 217, 176, 134, 93,
+    53, 13, -27, -66, -105, -144, -182, -219, -257, -294,
+    -330, -366, -402, -437, -472, -507, -541, -575, -609, -642,
+    -674, -707, -739, -770, -801, -832, -863, -893, -923, -952,
+    -981, -1010, -1038, -1066, -1093, -1120, -1147, -1174, -1200, -1226,
+    -1251, -1276, -1301, -1325, -1349, -1373, -1396, -1419, -1442, -1464,
+    -1486, -1508, -1529, -1550, -1571, -1591, -1611, -1631, -1650, -1669,
+    -1688, -1706, -1724, -1742, -1760, -1777, -1794, -1810, -1826, -1842,
+    -1858, -1873, -1888, -1903, -1917, -1931, -1945, -1959, -1972, -1985,
+    -1998, -2010, -2022, -2034, -2046, -2057, -2068, -2079, -2089, -2099,
+    -2109, -2119, -2128, -2138, -2146, -2155, -2164, -2172, -2180, -2187,
+    -2195, -2202, -2209, -2215, -2222, -2228, -2234, -2239, -2245, -2250,
+    -2255, -2260, -2265, -2269, -2273, -2277, -2281, -2284, -2287, -2290,
+    -2293, -2296, -2298, -2301, -2303, -2304, -2306, -2307, -2309, -2310,
+    -2311, -2311, -2312, -2312, -2312, -2312, -2312, -2311, -2311, -2310,
+    -2309, -2308, -2307, -2305, -2304, -2302, -2300, -2298, -2296, -2293,
+    -2291, -2288, -2285, -2282, -2279, -2276, -2272, -2269, -2265, -2261,
+    -2257, -2253, -2249, -2245, -2240, -2235, -2231, -2226, -2221, -2216,
+    -2211, -2205, -2200, -2194, -2189, -2183, -2177, -2171, -2165, -2159,
+    -2152, -2146, -2139, -2133, -2126, -2119, -2112, -2106, -2098, -2091,
+    -2084, -2077, -2069, -2062, -2054, -2047, -2039, -2031, -2024, -2016,
+    -2008, -2000, -1992, -1983, -1975, -1967, -1958, -1950, -1942, -1933,
+    -1924, -1916, -1907, -1898, -1890, -1881, -1872, -1863, -1854, -1845,
+    -1836, -1827, -1818, -1808, -1799, -1790, -1781, -1771, -1762, -1753,
+    -1743, -1734, -1724, -1715, -1705, -1696, -1686, -1677, -1667, -1657,
+    -1648, -1638, -1628, -1619, -1609, -1599, -1590, -1580, -1570, -1560,
+    -1551, -1541, -1531, -1521, -1511, -1502, -1492, -1482, -1472, -1463,
+    -1453, -1443, -1433, -1423, -1414, -1404, -1394, -1384, -1375, -1365,
+    -1355, -1346, -1336, -1326, -1317, -1307, -1297, -1288, -1278, -1268,
+    -1259, -1249, -1240, -1230, -1221, -1211, -1202, -1192, -1183, -1174,
+    -1164, -1155, -1146, -1136, -1127, -1118, -1109, -1099, -1090, -1081,
+    -1072, -1063, -1054, -1045, -1036, -1027, -1018, -1009, -1000, -992,
+    -983, -974, -966, -957, -948, -940, -931, -923, -914, -906,
+    -897, -889, -881, -872, -864, -856, -848, -840, -831, -823,
+    -815, -807, -799, -792, -784, -776, -768, -760, -753, -745,
+    -738, -730, -723, -715, -708, -700, -693, -686, -678, -671,
+    -664, -657, -650, -643, -636, -629, -622, -615, -609, -602,
+    -595, -589, -582, -575, -569, -562, -556, -550, -543, -537,
+    -531, -525, -518, -512, -506, -500, -494, -488, -482, -477,
+    -471, -465, -459, -454, -448, -443, -437, -432, -426, -421,
+    -416, -410, -405, -400, -395, -390, -385, -379, -375, -370,
+    -365, -360, -355, -350, -346, -341, -336, -332, -327, -323,
+    -318, -314, -309, -305, -301, -297, -292, -288, -284, -280,
+    -276, -272, -268, -264, -260, -256, -253, -249, -245, -241,
+    -238, -234, -231, -227, -224, -220, -217, -213, -210, -207,
+    -203, -200, -197, -194, -191, -188, -184, -181, -178, -176,
+    -173, -170, -167, -164, -161, -159, -156, -153, -151, -148,
+    -145, -143, -140, -138, -135, -133, -131, -128, -126, -124,
+    -121, -119, -117, -115, -113, -110, -108, -106, -104, -102,
+    -100, -98, -96, -94, -93, -91, -89, -87, -85, -84,
+    -82, -80, -79, -77, -75, -74, -72, -71, -69, -68,
+    -66, -65, -63, -62, -61, -59, -58, -57, -55, -54,
+    -53, -52, -50, -49, -48, -47, -46, -45, -44, -43,
+    -42, -41, -40, -39, -38, -37, -36, -35, -34, -33,
+    -33, -32, -31, -30, -30, -29, -28, -27, -27, -26,
+    -25, -25, -24, -24, -23, -23, -22, -22, -21, -21,
+    -20, -20, -19, -19, -18, -18, -18, -17, -17, -17,
+    -16, -16, -16, -16, -15, -15, -15, -15, -15, -14,
+    -14, -14, -14, -14, -14, -14, -14, -14
+};
+
+/* Flat-top, 4096 points */
+const q15_t Window_flatTop4096[4096] __attribute__((aligned(4))) = {
+    -14, -14, -14, -14, -14, -14, -14, -14, -14, -14,
+    -14, -14, -14, -14, -14, -14, -14, -14, -14, -15,
+    -15, -15, -15, -15, -15, -15, -15, -15, -15, -15,
+    -16, -16, -16, -16, -16, -16, -16, -17, -17, -17,
+    -17, -17, -17, -17, -18, -18, -18, -18, -18, -19,
+    -19, -19, -19, -19, -20, -20, -20, -20, -21, -21,
+    -21, -21, -22, -22, -22, -22, -23, -23, -23, -23,
+    -24, -24, -24, -25, -25, -25, -25, -26, -26, -26,
+    -27, -27, -27, -28, -28, -28, -29, -29, -30, -30,
+    -30, -31, -31, -31, -32, -32, -33, -33, -33, -34,
+    -34, -35, -35, -36, -36, -37, -37, -37, -38, -38,
+    -39, -39, -40, -40, -41, -41, -42, -42, -43, -43,
+    -44, -44, -45, -45, -46, -47, -47, -48, -48, -49,
+    -49, -50, -50, -51, -52, -52, -53, -53, -54, -55,
+    -55, -56, -57, -57, -58, -59, -59, -60, -61, -61,
+    -62, -63, -63, -64, -65, -65, -66, -67, -68, -68,
+    -69, -70, -71, -71, -72, -73, -74, -75, -75, -76,
+    -77, -78, -79, -79, -80, -81, -82, -83, -84, -84,
+    -85, -86, -87, -88, -89, -90, -91, -92, -93, -94,
+    -94, -95, -96, -97, -98, -99, -100, -101, -102, -103,
+    -104, -105, -106, -107, -108, -109, -110, -111, -113, -114,
+    -115, -116, -117, -118, -119, -120, -121, -122, -124, -125,
+    -126, -127, -128, -129, -131, -132, -133, -134, -135, -137,
+    -138, -139, -140, -142, -143, -144, -145, -147, -148, -149,
+    -151, -152, -153, -155, -156, -157, -159, -160, -161, -163,
+    -164, -165, -167, -168, -170, -171, -173, -174, -176, -177,
+    -178, -180, -181, -183, -184, -186, -188, -189, -191, -192,
+    -194, -195, -197, -199, -200, -202, -203, -205, -207, -208,
+    -210, -212, -213, -215, -217, -218, -220, -222, -224, -225,
+    -227, -229, -231, -232, -234, -236, -238, -240, -241, -243,
+    -245, -247, -249, -251, -253, -254, -256, -258, -260, -262,
+    -264, -266, -268, -270, -272, -274, -276, -278, -280, -282,
+    -284, -286, -288, -290, -292, -294, -297, -299, -301, -303,
+    -305, -307, -309, -312, -314, -316, -318, -320, -323, -325,
+    -327, -329, -332, -334, -336, -339, -341, -343, -346, -348,
+    -350, -353, -355, -357, -360, -362, -365, -367, -370, -372,
+    -375, -377, -379, -382, -385, -387, -390, -392, -395, -397,
+    -400, -402, -405, -408, -410, -413, -416, -418, -421, -424,
+    -426, -429, -432, -434, -437, -440, -443, -445, -448, -451,
+    -454, -457, -459, -462, -465, -468, -471, -474, -477, -480,
+    -482, -485, -488, -491, -494, -497, -500, -503, -506, -509,
+    -512, -515, -518, -521, -525, -528, -531, -534, -537, -540,
+    -543, -546, -550, -553, -556, -559, -562, -566, -569, -572,
+    -575, -579, -582, -585, -589, -592, -595, -599, -602, -605,
+    -609, -612, -615, -619, -622, -626, -629, -633, -636, -640,
+    -643, -646, -650, -654, -657, -661, -664, -668, -671, -675,
+    -678, -682, -686, -689, -693, -697, -700, -704, -708, -711,
+    -715, -719, -723, -726, -730, -734, -738, -741, -745, -749,
+    -753, -757, -760, -764, -768, -772, -776, -780, -784, -788,
+    -792, -796, -799, -803, -807, -811, -815, -819, -823, -827,
+    -831, -835, -840, -844, -848, -852, -856, -860, -864, -868,
+    -872, -876, -881, -885, -889, -893, -897, -901, -906, -910,
+    -914, -918, -923, -927, -931, -935, -940, -944, -948, -953,
+    -957, -961, -966, -970, -974, -979, -983, -987, -992, -996,
+    -1000, -1005, -1009, -1014, -1018, -1023, -1027, -1032, -1036, -1041,
+    -1045, -1049, -1054, -1058, -1063, -1068, -1072, -1077, -1081, -1086,
+    -1090, -1095, -1099, -1104, -1109, -1113, -1118, -1122, -1127, -1132,
+    -1136, -1141, -1146, -1150, -1155, -1160, -1164, -1169, -1174, -1178,
+    -1183, -1188, -1192, -1197, -1202, -1207, -1211, -1216, -1221, -1225,
+    -1230, -1235, -1240, -1245, -1249, -1254, -1259, -1264, -1268, -1273,
+    -1278, -1283, -1288, -1292, -1297, -1302, -1307, -1312, -1317, -1321,
+    -1326, -1331, -1336, -1341, -1346, -1350, -1355, -1360, -1365, -1370,
+    -1375, -1380, -1384, -1389, -1394, -1399, -1404, -1409, -1414, -1419,
+    -1423, -1428, -1433, -1438, -1443, -1448, -1453, -1458, -1463, -1467,
+    -1472, -1477, -1482, -1487, -1492, -1497, -1502, -1507, -1511, -1516,
+    -1521, -1526, -1531, -1536, -1541, -1546, -1551, -1555, -1560, -1565,
+    -1570, -1575, -1580, -1585, -1590, -1594, -1599, -1604, -1609, -1614,
+    -1619, -1624, -1628, -1633, -1638, -1643, -1648, -1653, -1657, -1662,
+    -1667, -1672, -1677, -1681, -1686, -1691, -1696, -1701, -1705, -1710,
+    -1715, -1720, -1724, -1729, -1734, -1738, -1743, -1748, -1753, -1757,
+    -1762, -1767, -1771, -1776, -1781, -1785, -1790, -1795, -1799, -1804,
+    -1808, -1813, -1818, -1822, -1827, -1831, -1836, -1840, -1845, -1849,
+    -1854, -1858, -1863, -1867, -1872, -1876, -1881, -1885, -1890, -1894,
+    -1898, -1903, -1907, -1911, -1916, -1920, -1924, -1929, -1933, -1937,
+    -1942, -1946, -1950, -1954, -1958, -1963, -1967, -1971, -1975, -1979,
+    -1983, -1987, -1992, -1996, -2000, -2004, -2008, -2012, -2016, -2020,
+    -2024, -2027, -2031, -2035, -2039, -2043, -2047, -2051, -2054, -2058,
+    -2062, -2066, -2069, -2073, -2077, -2080, -2084, -2088, -2091, -2095,
+    -2098, -2102, -2106, -2109, -2112, -2116, -2119, -2123, -2126, -2129,
+    -2133, -2136, -2139, -2143, -2146, -2149, -2152, -2155, -2159, -2162,
+    -2165, -2168, -2171, -2174, -2177, -2180, -2183, -2186, -2189, -2191,
+    -2194, -2197, -2200, -2203, -2205, -2208, -2211, -2213, -2216, -2218,
+    -2221, -2223, -2226, -2228, -2231, -2233, -2235, -2238, -2240, -2242,
+    -2245, -2247, -2249, -2251, -2253, -2255, -2257, -2259, -2261, -2263,
+    -2265, -2267, -2269, -2271, -2272, -2274, -2276, -2277, -2279, -2281,
+    -2282, -2284, -2285, -2287, -2288, -2289, -2291, -2292, -2293, -2295,
+    -2296, -2297, -2298, -2299, -2300, -2301, -2302, -2303, -2304, -2305,
+    -2305, -2306, -2307, -2307, -2308, -2309, -2309, -2310, -2310, -2310,
+    -2311, -2311, -2311, -2312, -2312, -2312, -2312, -2312, -2312, -2312,
+    -2312, -2312, -2312, -2312, -2311, -2311, -2311, -2310, -2310, -2309,
+    -2309, -2308, -2307, -2307, -2306, -2305, -2304, -2303, -2303, -2302,
+    -2301, -2299, -2298, -2297, -2296, -2295, -2293, -2292, -2290, -2289,
+    -2287, -2286, -2284, -2282, -2281, -2279, -2277, -2275, -2273, -2271,
+    -2269, -2267, -2265, -2262, -2260, -2258, -2255, -2253, -2250, -2248,
+    -2245, -2242, -2239, -2237, -2234, -2231, -2228, -2225, -2222, -2218,
+    -2215, -2212, -2209, -2205, -2202, -2198, -2195, -2191, -2187, -2183,
+    -2180, -2176, -2172, -2168, -2164, -2159, -2155, -2151, -2146, -2142,
+    -2138, -2133, -2128, -2124, -2119, -2114, -2109, -2104, -2099, -2094,
+    -2089, -2084, -2079, -2073, -2068, -2063, -2057, -2051, -2046, -2040,
+    -2034, -2028, -2022, -2016, -2010, -2004, -1998, -1991, -1985, -1979,
+    -1972, -1966, -1959, -1952, -1945, -1938, -1931, -1924, -1917, -1910,
+    -1903, -1896, -1888, -1881, -1873, -1866, -1858, -1850, -1842, -1834,
+    -1826, -1818, -1810, -1802, -1794, -1785, -1777, -1768, -1760, -1751,
+    -1742, -1733, -1724, -1715, -1706, -1697, -1688, -1679, -1669, -1660,
+    -1650, -1641, -1631, -1621, -1611, -1601, -1591, -1581, -1571, -1561,
+    -1550, -1540, -1529, -1519, -1508, -1497, -1486, -1475, -1464, -1453,
+    -1442, -1431, -1419, -1408, -1396, -1385, -1373, -1361, -1349, -1337,
+    -1325, -1313, -1301, -1289, -1276, -1264, -1251, -1238, -1226, -1213,
+    -1200, -1187, -1174, -1161, -1147, -1134, -1120, -1107, -1093, -1080,
+    -1066, -1052, -1038, -1024, -1010, -995, -981, -966, -952, -937,
+    -923, -908, -893, -878, -863, -848, -832, -817, -801, -786,
+    -770, -754, -739, -723, -707, -691, -674, -658, -642, -625,
+    -609, -592, -575, -558, -541, -524, -507, -490, -472, -455,
+    -437, -420, -402, -384, -366, -348, -330, -312, -294, -275,
+    -257, -238, -219, -201, -182, -163, -144, -124, -105, -86,
+    -66, -47, -27, -7, 13, 33, 53, 73, 93, 114,
+    134, 155, 176, 196, 217, 238, 259, 280, 302, 323,
+    345, 366, 388, 410, 432, 454, 476, 498, 520, 542,
+    565, 588, 610, 633, 656, 679, 702, 725, 749, 772,
+    796, 819, 843, 867, 891, 915, 939, 963, 987, 1012,
+    1036, 1061, 1086, 1111, 1136, 1161, 1186, 1211, 1236, 1262,
+    1287, 1313, 1339, 1365, 1391, 1417, 1443, 1469, 1496, 1522,
+    1549, 1575, 1602, 1629, 1656, 1683, 1711, 1738, 1765, 1793,
+    1820, 1848, 1876, 1904, 1932, 1960, 1988, 2017, 2045, 2074,
+    2103, 2131, 2160, 2189, 2218, 2247, 2277, 2306, 2336, 2365,
+    2395, 2425, 2455, 2485, 2515, 2545, 2575, 2606, 2636, 2667,
+    2698, 2729, 2759, 2791, 2822, 2853, 2884, 2916, 2947, 2979,
+    3011, 3043, 3075, 3107, 3139, 3171, 3203, 3236, 3269, 3301,
+    3334, 3367, 3400, 3433, 3466, 3499, 3533, 3566, 3600, 3634,
+    3667, 3701, 3735, 3769, 3804, 3838, 3872, 3907, 3941, 3976,
+    4011, 4046, 4081, 4116, 4151, 4187, 4222, 4257, 4293, 4329,
+    4365, 4400, 4436, 4473, 4509, 4545, 4581, 4618, 4654, 4691,
+    4728, 4765, 4802, 4839, 4876, 4913, 4951, 4988, 5026, 5063,
+    5101, 5139, 5177, 5215, 5253, 5291, 5330, 5368, 5406, 5445,
+    5484, 5523, 5561, 5600, 5639, 5679, 5718, 5757, 5797, 5836,
+    5876, 5916, 5955, 5995, 6035, 6075, 6116, 6156, 6196, 6237,
+    6277, 6318, 6359, 6399, 6440, 6481, 6522, 6564, 6605, 6646,
+    6688, 6729, 6771, 6812, 6854, 6896, 6938, 6980, 7022, 7064,
+    7107, 7149, 7192, 7234, 7277, 7320, 7362, 7405, 7448, 7491,
+    7534, 7578, 7621, 7664, 7708, 7751, 7795, 7839, 7883, 7926,
+    7970, 8014, 8059, 8103, 8147, 8191, 8236, 8280, 8325, 8370,
+    8414, 8459, 8504, 8549, 8594, 8639, 8685, 8730, 8775, 8821,
+    8866, 8912, 8957, 9003, 9049, 9095, 9141, 9187, 9233, 9279,
+    9325, 9372, 9418, 9464, 9511, 9557, 9604, 9651, 9698, 9745,
+    9791, 9838, 9886, 9933, 9980, 10027, 10074, 10122, 10169, 10217,
+    10264, 10312, 10360, 10408, 10455, 10503, 10551, 10599, 10647, 10696,
+    10744, 10792, 10840, 10889, 10937, 10986, 11034, 11083, 11132, 11180,
+    11229, 11278, 11327, 11376, 11425, 11474, 11523, 11572, 11621, 11671,
+    11720, 11769, 11819, 11868, 11918, 11967, 12017, 12067, 12117, 12166,
+    12216, 12266, 12316, 12366, 12416, 12466, 12516, 12566, 12617, 12667,
+    12717, 12767, 12818, 12868, 12919, 12969, 13020, 13070, 13121, 13172,
+    13222, 13273, 13324, 13375, 13426, 13477, 13528, 13579, 13630, 13681,
+    13732, 13783, 13834, 13885, 13936, 13988, 14039, 14090, 14142, 14193,
+    14244, 14296, 14347, 14399, 14450, 14502, 14553, 14605, 14657, 14708,
+    14760, 14812, 14863, 14915, 14967, 15019, 15071, 15122, 15174, 15226,
+    15278, 15330, 15382, 15434, 15486, 15538, 15590, 15642, 15694, 15746,
+    15798, 15850, 15903, 15955, 16007, 16059, 16111, 16163, 16215, 16268,
+    16320, 16372, 16424, 16477, 16529, 16581, 16633, 16686, 16738, 16790,
+    16842, 16895, 16947, 16999, 17052, 17104, 17156, 17209, 17261, 17313,
+    17366, 17418, 17470, 17522, 17575, 17627, 17679, 17732, 17784, 17836,
+    17888, 17941, 17993, 18045, 18098, 18150, 18202, 18254, 18306, 18359,
+    18411, 18463, 18515, 18567, 18619, 18672, 18724, 18776, 18828, 18880,
+    18932, 18984, 19036, 19088, 19140, 19192, 19244, 19296, 19348, 19400,
+    19451, 19503, 19555, 19607, 19659, 19710, 19762, 19814, 19865, 19917,
+    19969, 20020, 20072, 20123, 20175, 20226, 20278, 20329, 20380, 20432,
+    20483, 20534, 20585, 20637, 20688, 20739, 20790, 20841, 20892, 20943,
+    20994, 21045, 21095, 21146, 21197, 21248, 21298, 21349, 21400, 21450,
+    21501, 21551, 21602, 21652, 21702, 21752, 21803, 21853, 21903, 21953,
+    22003, 22053, 22103, 22153, 22203, 22252, 22302, 22352, 22401, 22451,
+    22500, 22550, 22599, 22648, 22698, 22747, 22796, 22845, 22894, 22943,
+    22992, 23041, 23089, 23138, 23187, 23235, 23284, 23332, 23381, 23429,
+    23477, 23525, 23573, 23621, 23669, 23717, 23765, 23813, 23860, 23908,
+    23956, 24003, 24050, 24098, 24145, 24192, 24239, 24286, 24333, 24380,
+    24427, 24473, 24520, 24567, 24613, 24659, 24706, 24752, 24798, 24844,
+    24890, 24936, 24982, 25027, 25073, 25118, 25164, 25209, 25254, 25300,
+    25345, 25390, 25434, 25479, 25524, 25569, 25613, 25658, 25702, 25746,
+    25790, 25834, 25878, 25922, 25966, 26010, 26053, 26097, 26140, 26183,
+    26226, 26269, 26312, 26355, 26398, 26441, 26483, 26526, 26568, 26610,
+    26652, 26694, 26736, 26778, 26820, 26861, 26903, 26944, 26985, 27027,
+    27068, 27109, 27149, 27190, 27231, 27271, 27312, 27352, 27392, 27432,
+    27472, 27512, 27551, 27591, 27630, 27670, 27709, 27748, 27787, 27826,
+    27865, 27903, 27942, 27980, 28018, 28056, 28094, 28132, 28170, 28208,
+    28245, 28282, 28320, 28357, 28394, 28431, 28467, 28504, 28540, 28577,
+    28613, 28649, 28685, 28721, 28756, 28792, 28827, 28863, 28898, 28933,
+    28968, 29002, 29037, 29072, 29106, 29140, 29174, 29208, 29242, 29276,
+    29309, 29342, 29376, 29409, 29442, 29474, 29507, 29540, 29572, 29604,
+    29636, 29668, 29700, 29732, 29763, 29795, 29826, 29857, 29888, 29919,
+    29949, 29980, 30010, 30040, 30071, 30100, 30130, 30160, 30189, 30219,
+    30248, 30277, 30306, 30334, 30363, 30391, 30419, 30448, 30475, 30503,
+    30531, 30558, 30586, 30613, 30640, 30667, 30693, 30720, 30746, 30772,
+    30798, 30824, 30850, 30876, 30901, 30926, 30951, 30976, 31001, 31026,
+    31050, 31075, 31099, 31123, 31146, 31170, 31194, 31217, 31240, 31263,
+    31286, 31309, 31331, 31353, 31376, 31398, 31419, 31441, 31463, 31484,
+    31505, 31526, 31547, 31567, 31588, 31608, 31628, 31648, 31668, 31688,
+    31707, 31727, 31746, 31765, 31784, 31802, 31821, 31839, 31857, 31875,
+    31893, 31910, 31928, 31945, 31962, 31979, 31996, 32012, 32029, 32045,
+    32061, 32077, 32092, 32108, 32123, 32138, 32153, 32168, 32183, 32197,
+    32211, 32225, 32239, 32253, 32267, 32280, 32293, 32306, 32319, 32332,
+    32344, 32357, 32369, 32381, 32392, 32404, 32415, 32427, 32438, 32449,
+    32459, 32470, 32480, 32490, 32500, 32510, 32520, 32529, 32538, 32547,
+    32556, 32565, 32574, 32582, 32590, 32598, 32606, 32613, 32621, 32628,
+    32635, 32642, 32649, 32655, 32662, 32668, 32674, 32680, 32685, 32691,
+    32696, 32701, 32706, 32710, 32715, 32719, 32723, 32727, 32731, 32735,
+    32738, 32741, 32744, 32747, 32750, 32752, 32755, 32757, 32759, 32761,
+    32762, 32763, 32765, 32766, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32766, 32765, 32763, 32762, 32761, 32759, 32757,
+    32755, 32752, 32750, 32747, 32744, 32741, 32738, 32735, 32731, 32727,
+    32723, 32719, 32715, 32710, 32706, 32701, 32696, 32691, 32685, 32680,
+    32674, 32668, 32662, 32655, 32649, 32642, 32635, 32628, 32621, 32613,
+    32606, 32598, 32590, 32582, 32574, 32565, 32556, 32547, 32538, 32529,
+    32520, 32510, 32500, 32490, 32480, 32470, 32459, 32449, 32438, 32427,
+    32415, 32404, 32392, 32381, 32369, 32357, 32344, 32332, 32319, 32306,
+    32293, 32280, 32267, 32253, 32239, 32225, 32211, 32197, 32183, 32168,
+    32153, 32138, 32123, 32108, 32092, 32077, 32061, 32045, 32029, 32012,
+    31996, 31979, 31962, 31945, 31928, 31910, 31893, 31875, 31857, 31839,
+    31821, 31802, 31784, 31765, 31746, 31727, 31707, 31688, 31668, 31648,
+    31628, 31608, 31588, 31567, 31547, 31526, 31505, 31484, 31463, 31441,
+    31419, 31398, 31376, 31353, 31331, 31309, 31286, 31263, 31240, 31217,
+    31194, 31170, 31146, 31123, 31099, 31075, 31050, 31026, 31001, 30976,
+    30951, 30926, 30901, 30876, 30850, 30824, 30798, 30772, 30746, 30720,
+    30693, 30667, 30640, 30613, 30586, 30558, 30531, 30503, 30475, 30448,
+    30419, 30391, 30363, 30334, 30306, 30277, 30248, 30219, 30189, 30160,
+    30130, 30100, 30071, 30040, 30010, 29980, 29949, 29919, 29888, 29857,
+    29826, 29795, 29763, 29732, 29700, 29668, 29636, 29604, 29572, 29540,
+    29507, 29474, 29442, 29409, 29376, 29342, 29309, 29276, 29242, 29208,
+    29174, 29140, 29106, 29072, 29037, 29002, 28968, 28933, 28898, 28863,
+    28827, 28792, 28756, 28721, 28685, 28649, 28613, 28577, 28540, 28504,
+    28467, 28431, 28394, 28357, 28320, 28282, 28245, 28208, 28170, 28132,
+    28094, 28056, 28018, 27980, 27942, 27903, 27865, 27826, 27787, 27748,
+    27709, 27670, 27630, 27591, 27551, 27512, 27472, 27432, 27392, 27352,
+    27312, 27271, 27231, 27190, 27149, 27109, 27068, 27027, 26985, 26944,
+    26903, 26861, 26820, 26778, 26736, 26694, 26652, 26610, 26568, 26526,
+    26483, 26441, 26398, 26355, 26312, 26269, 26226, 26183, 26140, 26097,
+    26053, 26010, 25966, 25922, 25878, 25834, 25790, 25746, 25702, 25658,
+    25613, 25569, 25524, 25479, 25434, 25390, 25345, 25300, 25254, 25209,
+    25164, 25118, 25073, 25027, 24982, 24936, 24890, 24844, 24798, 24752,
+    24706, 24659, 24613, 24567, 24520, 24473, 24427, 24380, 24333, 24286,
+    24239, 24192, 24145, 24098, 24050, 24003, 23956, 23908, 23860, 23813,
+    23765, 23717, 23669, 23621, 23573, 23525, 23477, 23429, 23381, 23332,
+    23284, 23235, 23187, 23138, 23089, 23041, 22992, 22943, 22894, 22845,
+    22796, 22747, 22698, 22648, 22599, 22550, 22500, 22451, 22401, 22352,
+    22302, 22252, 22203, 22153, 22103, 22053, 22003, 21953, 21903, 21853,
+    21803, 21752, 21702, 21652, 21602, 21551, 21501, 21450, 21400, 21349,
+    21298, 21248, 21197, 21146, 21095, 21045, 20994, 20943, 20892, 20841,
+    20790, 20739, 20688, 20637, 20585, 20534, 20483, 20432, 20380, 20329,
+    20278, 20226, 20175, 20123, 20072, 20020, 19969, 19917, 19865, 19814,
+    19762, 19710, 19659, 19607, 19555, 19503, 19451, 19400, 19348, 19296,
+    19244, 19192, 19140, 19088, 19036, 18984, 18932, 18880, 18828, 18776,
+    18724, 18672, 18619, 18567, 18515, 18463, 18411, 18359, 18306, 18254,
+    18202, 18150, 18098, 18045, 17993, 17941, 17888, 17836, 17784, 17732,
+    17679, 17627, 17575, 17522, 17470, 17418, 17366, 17313, 17261, 17209,
+    17156, 17104, 17052, 16999, 16947, 16895, 16842, 16790, 16738, 16686,
+    16633, 16581, 16529, 16477, 16424, 16372, 16320, 16268, 16215, 16163,
+    16111, 16059, 16007, 15955, 15903, 15850, 15798, 15746, 15694, 15642,
+    15590, 15538, 15486, 15434, 15382, 15330, 15278, 15226, 15174, 15122,
+    15071, 15019, 14967, 14915, 14863, 14812, 14760, 14708, 14657, 14605,
+    14553, 14502, 14450, 14399, 14347, 14296, 14244, 14193, 14142, 14090,
+    14039, 13988, 13936, 13885, 13834, 13783, 13732, 13681, 13630, 13579,
+    13528, 13477, 13426, 13375, 13324, 13273, 13222, 13172, 13121, 13070,
+    13020, 12969, 12919, 12868, 12818, 12767, 12717, 12667, 12617, 12566,
+    12516, 12466, 12416, 12366, 12316, 12266, 12216, 12166, 12117, 12067,
+    12017, 11967, 11918, 11868, 11819, 11769, 11720, 11671, 11621, 11572,
+    11523, 11474, 11425, 11376, 11327, 11278, 11229, 11180, 11132, 11083,
+    11034, 10986, 10937, 10889, 10840, 10792, 10744, 10696, 10647, 10599,
+    10551, 10503, 10455, 10408, 10360, 10312, 10264, 10217, 10169, 10122,
+    10074, 10027, 9980, 9933, 9886, 9838, 9791, 9745, 9698, 9651,
+    9604, 9557, 9511, 9464, 9418, 9372, 9325, 9279, 9233, 9187,
+    9141, 9095, 9049, 9003, 8957, 8912, 8866, 8821, 8775, 8730,
+    8685, 8639, 8594, 8549, 8504, 8459, 8414, 8370, 8325, 8280,
+    8236, 8191, 8147, 8103, 8059, 8014, 7970, 7926, 7883, 7839,
+    7795, 7751, 7708, 7664, 7621, 7578, 7534, 7491, 7448, 7405,
+    7362, 7320, 7277, 7234, 7192, 7149, 7107, 7064, 7022, 6980,
+    6938, 6896, 6854, 6812, 6771, 6729, 6688, 6646, 6605, 6564,
+    6522, 6481, 6440, 6399, 6359, 6318, 6277, 6237, 6196, 6156,
+    6116, 6075, 6035, 5995, 5955, 5916, 5876, 5836, 5797, 5757,
+    5718, 5679, 5639, 5600, 5561, 5523, 5484, 5445, 5406, 5368,
+    5330, 5291, 5253, 5215, 5177, 5139, 5101, 5063, 5026, 4988,
+    4951, 4913, 4876, 4839, 4802, 4765, 4728, 4691, 4654, 4618,
+    4581, 4545, 4509, 4473, 4436, 4400, 4365, 4329, 4293, 4257,
+    4222, 4187, 4151, 4116, 4081, 4046, 4011, 3976, 3941, 3907,
+    3872, 3838, 3804, 3769, 3735, 3701, 3667, 3634, 3600, 3566,
+    3533, 3499, 3466, 3433, 3400, 3367, 3334, 3301, 3269, 3236,
+    3203, 3171, 3139, 3107, 3075, 3043, 3011, 2979, 2947, 2916,
+    2884, 2853, 2822, 2791, 2759, 2729, 2698, 2667, 2636, 2606,
+    2575, 2545, 2515, 2485, 2455, 2425, 2395, 2365, 2336, 2306,
+    2277, 2247, 2218, 2189, 2160, 2131, 2103, 2074, 2045, 2017,
+    1988, 1960, 1932, 1904, 1876, 1848, 1820, 1793, 1765, 1738,
+    1711, 1683, 1656, 1629, 1602, 1575, 1549, 1522, 1496, 1469,
+    1443, 1417, 1391, 1365, 1339, 1313, 1287, 1262, 1236, 1211,
+    1186, 1161, 1136, 1111, 1086, 1061, 1036, 1012, 987, 963,
+    939, 915, 891, 867, 843, 819, 796, 772, 749, 725,
+    702, 679, 656, 633, 610, 588, 565, 542, 520, 498,
+    476, 454, 432, 410, 388, 366, 345, 323, 302, 280,
+    259, 238, 217, 196, 176, 155, 134, 114, 93, 73,
+    53, 33, 13, -7, -27, -47, -66, -86, -105, -124,
+    -144, -163, -182, -201, -219, -238, -257, -275, -294, -312,
+    -330, -348, -366, -384, -402, -420, -437, -455, -472, -490,
+    -507, -524, -541, -558, -575, -592, -609, -625, -642, -658,
+    -674, -691, -707, -723, -739, -754, -770, -786, -801, -817,
+    -832, -848, -863, -878, -893, -908, -923, -937, -952, -966,
+    -981, -995, -1010, -1024, -1038, -1052, -1066, -1080, -1093, -1107,
+    -1120, -1134, -1147, -1161, -1174, -1187, -1200, -1213, -1226, -1238,
+    -1251, -1264, -1276, -1289, -1301, -1313, -1325, -1337, -1349, -1361,
+    -1373, -1385, -1396, -1408, -1419, -1431, -1442, -1453, -1464, -1475,
+    -1486, -1497, -1508, -1519, -1529, -1540, -1550, -1561, -1571, -1581,
+    -1591, -1601, -1611, -1621, -1631, -1641, -1650, -1660, -1669, -1679,
+    -1688, -1697, -1706, -1715, -1724, -1733, -1742, -1751, -1760, -1768,
+    -1777, -1785, -1794, -1802, -1810, -1818, -1826, -1834, -1842, -1850,
+    -1858, -1866, -1873, -1881, -1888, -1896, -1903, -1910, -1917, -1924,
+    -1931, -1938, -1945, -1952, -1959, -1966, -1972, -1979, -1985, -1991,
+    -1998, -2004, -2010, -2016, -2022, -2028, -2034, -2040, -2046, -2051,
+    -2057, -2063, -2068, -2073, -2079, -2084, -2089, -2094, -2099, -2104,
+    -2109, -2114, -2119, -2124, -2128, -2133, -2138, -2142, -2146, -2151,
+    -2155, -2159, -2164, -2168, -2172, -2176, -2180, -2183, -2187, -2191,
+    -2195, -2198, -2202, -2205, -2209, -2212, -2215, -2218, -2222, -2225,
+    -2228, -2231, -2234, -2237, -2239, -2242, -2245, -2248, -2250, -2253,
+    -2255, -2258, -2260, -2262, -2265, -2267, -2269, -2271, -2273, -2275,
+    -2277, -2279, -2281, -2282, -2284, -2286, -2287, -2289, -2290, -2292,
+    -2293, -2295, -2296, -2297, -2298, -2299, -2301, -2302, -2303, -2303,
+    -2304, -2305, -2306, -2307, -2307, -2308, -2309, -2309, -2310, -2310,
+    -2311, -2311, -2311, -2312, -2312, -2312, -2312, -2312, -2312, -2312,
+    -2312, -2312, -2312, -2312, -2311, -2311, -2311, -2310, -2310, -2310,
+    -2309, -2309, -2308, -2307, -2307, -2306, -2305, -2305, -2304, -2303,
+    -2302, -2301, -2300, -2299, -2298, -2297, -2296, -2295, -2293, -2292,
+    -2291, -2289, -2288, -2287, -2285, -2284, -2282, -2281, -2279, -2277,
+    -2276, -2274, -2272, -2271, -2269, -2267, -2265, -2263, -2261, -2259,
+    -2257, -2255, -2253, -2251, -2249, -2247, -2245, -2242, -2240, -2238,
+    -2235, -2233, -2231, -2228, -2226, -2223, -2221, -2218, -2216, -2213,
+    -2211, -2208, -2205, -2203, -2200, -2197, -2194, -2191, -2189, -2186,
+    -2183, -2180, -2177, -2174, -2171, -2168, -2165, -2162, -2159, -2155,
+    -2152, -2149, -2146, -2143, -2139, -2136, -2133, -2129, -2126, -2123,
+    -2119, -2116, -2112, -2109, -2106, -2102, -2098, -2095, -2091, -2088,
+    -2084, -2080, -2077, -2073, -2069, -2066, -2062, -2058, -2054, -2051,
+    -2047, -2043, -2039, -2035, -2031, -2027, -2024, -2020, -2016, -2012,
+    -2008, -2004, -2000, -1996, -1992, -1987, -1983, -1979, -1975, -1971,
+    -1967, -1963, -1958, -1954, -1950, -1946, -1942, -1937, -1933, -1929,
+    -1924, -1920, -1916, -1911, -1907, -1903, -1898, -1894, -1890, -1885,
+    -1881, -1876, -1872, -1867, -1863, -1858, -1854, -1849, -1845, -1840,
+    -1836, -1831, -1827, -1822, -1818, -1813, -1808, -1804, -1799, -1795,
+    -1790, -1785, -1781, -1776, -1771, -1767, -1762, -1757, -1753, -1748,
+    -1743, -1738, -1734, -1729, -1724, -1720, -1715, -1710, -1705, -1701,
+    -1696, -1691, -1686, -1681, -1677, -1672, -1667, -1662, -1657, -1653,
+    -1648, -1643, -1638, -1633, -1628, -1624, -1619, -1614, -1609, -1604,
+    -1599, -1594, -1590, -1585, -1580, -1575, -1570, -1565, -1560, -1555,
+    -1551, -1546, -1541, -1536, -1531, -1526, -1521, -1516, -1511, -1507,
+    -1502, -1497, -1492, -1487, -1482, -1477, -1472, -1467, -1463, -1458,
+    -1453, -1448, -1443, -1438, -1433, -1428, -1423, -1419, -1414, -1409,
+    -1404, -1399, -1394, -1389, -1384, -1380, -1375, -1370, -1365, -1360,
+    -1355, -1350, -1346, -1341, -1336, -1331, -1326, -1321, -1317, -1312,
+    -1307, -1302, -1297, -1292, -1288, -1283, -1278, -1273, -1268, -1264,
+    -1259, -1254, -1249, -1245, -1240, -1235, -1230, -1225, -1221, -1216,
+    -1211, -1207, -1202, -1197, -1192, -1188, -1183, -1178, -1174, -1169,
+    -1164, -1160, -1155, -1150, -1146, -1141, -1136, -1132, -1127, -1122,
+    -1118, -1113, -1109, -1104, -1099, -1095, -1090, -1086, -1081, -1077,
+    -1072, -1068, -1063, -1058, -1054, -1049, -1045, -1041, -1036, -1032,
+    -1027, -1023, -1018, -1014, -1009, -1005, -1000, -996, -992, -987,
+    -983, -979, -974, -970, -966, -961, -957, -953, -948, -944,
+    -940, -935, -931, -927, -923, -918, -914, -910, -906, -901,
+    -897, -893, -889, -885, -881, -876, -872, -868, -864, -860,
+    -856, -852, -848, -844, -840, -835, -831, -827, -823, -819,
+    -815, -811, -807, -803, -799, -796, -792, -788, -784, -780,
+    -776, -772, -768, -764, -760, -757, -753, -749, -745, -741,
+    -738, -734, -730, -726, -723, -719, -715, -711, -708, -704,
+    -700, -697, -693, -689, -686, -682, -678, -675, -671, -668,
+    -664, -661, -657, -654, -650, -646, -643, -640, -636, -633,
+    -629, -626, -622, -619, -615, -612, -609, -605, -602, -599,
+    -595, -592, -589, -585, -582, -579, -575, -572, -569, -566,
+    -562, -559, -556, -553, -550, -546, -543, -540, -537, -534,
+    -531, -528, -525, -521, -518, -515, -512, -509, -506, -503,
+    -500, -497, -494, -491, -488, -485, -482, -480, -477, -474,
+    -471, -468, -465, -462, -459, -457, -454, -451, -448, -445,
+    -443, -440, -437, -434, -432, -429, -426, -424, -421, -418,
+    -416, -413, -410, -408, -405, -402, -400, -397, -395, -392,
+    -390, -387, -385, -382, -379, -377, -375, -372, -370, -367,
+    -365, -362, -360, -357, -355, -353, -350, -348, -346, -343,
+    -341, -339, -336, -334, -332, -329, -327, -325, -323, -320,
+    -318, -316, -314, -312, -309, -307, -305, -303, -301, -299,
+    -297, -294, -292, -290, -288, -286, -284, -282, -280, -278,
+    -276, -274, -272, -270, -268, -266, -264, -262, -260, -258,
+    -256, -254, -253, -251, -249, -247, -245, -243, -241, -240,
+    -238, -236, -234, -232, -231, -229, -227, -225, -224, -222,
+    -220, -218, -217, -215, -213, -212, -210, -208, -207, -205,
+    -203, -202, -200, -199, -197, -195, -194, -192, -191, -189,
+    -188, -186, -184, -183, -181, -180, -178, -177, -176, -174,
+    -173, -171, -170, -168, -167, -165, -164, -163, -161, -160,
+    -159, -157, -156, -155, -153, -152, -151, -149, -148, -147,
+    -145, -144, -143, -142, -140, -139, -138, -137, -135, -134,
+    -133, -132, -131, -129, -128, -127, -126, -125, -124, -122,
+    -121, -120, -119, -118, -117, -116, -115, -114, -113, -111,
+    -110, -109, -108, -107, -106, -105, -104, -103, -102, -101,
+    -100, -99, -98, -97, -96, -95, -94, -94, -93, -92,
+    -91, -90, -89, -88, -87, -86, -85, -84, -84, -83,
+    -82, -81, -80, -79, -79, -78, -77, -76, -75, -75,
+    -74, -73, -72, -71, -71, -70, -69, -68, -68, -67,
+    -66, -65, -65, -64, -63, -63, -62, -61, -61, -60,
+    -59, -59, -58, -57, -57, -56, -55, -55, -54, -53,
+    -53, -52, -52, -51, -50, -50, -49, -49, -48, -48,
+    -47, -47, -46, -45, -45, -44, -44, -43, -43, -42,
+    -42, -41, -41, -40, -40, -39, -39, -38, -38, -37,
+    -37, -37, -36, -36, -35, -35, -34, -34, -33, -33,
+    -33, -32, -32, -31, -31, -31, -30, -30, -30, -29,
+    -29, -28, -28, -28, -27, -27, -27, -26, -26, -26,
+    -25, -25, -25, -25, -24, -24, -24, -23, -23, -23,
+    -23, -22, -22, -22, -22, -21, -21, -21, -21, -20,
+    -20, -20, -20, -19, -19, -19, -19, -19, -18, -18,
+    -18, -18, -18, -17, -17, -17, -17, -17, -17, -17,
+    -16, -16, -16, -16, -16, -16, -16, -15, -15, -15,
+    -15, -15, -15, -15, -15, -15, -15, -15, -14, -14,
+    -14, -14, -14, -14, -14, -14, -14, -14, -14, -14,
+    -14, -14, -14, -14, -14, -14
+};
+
+/* 4-term Blackman-Harris, 64 points */
+const q15_t Window_blackmanHarris64[64] __attribute__((aligned(4))) = {
+    2, 7, 22, 51, 100, 179, 298, 471, 712, 1039,
+    1470, 2022, 2713, 3557, 4570, 5758, 7126, 8672, 10387, 12255,
+    14251, 16345, 18498, 20665, 22799, 24847, 26756, 28476, 29958, 31159,
+    32044, 32586, 32767, 32586, 32044, 31159, 29958, 28476, 26756, 24847,
+    22799, 20665, 18498, 16345, 14251, 12255, 10387, 8672, 7126, 5758,
+    4570, 3557, 2713, 2022, 1470, 1039, 712, 471, 298, 179,
+    100, 51, 22, 7
+};
+
+/* 4-term Blackman-Harris, 128 points */
+const q15_t Window_blackmanHarris128[128] __attribute__((aligned(4))) = {
+    2, 3, 7, 13, 22, 34, 51, 72, 100, 135,
+    179, 233, 298, 377, 471, 582, 712, 864, 1039, 1241,
+    1470, 1730, 2022, 2349, 2713, 3115, 3557, 4042, 4570, 5141,
+    5758, 6419, 7126, 7877, 8672, 9509, 10387, 11303, 12255, 13239,
+    14251, 15288, 16345, 17417, 18498, 19583, 20665, 21739, 22799, 23837,
+    24847, 25822, 26756, 27643, 28476, 29250, 29958, 30596, 31159, 31643,
+    32044, 32359, 32586, 32722, 32767, 32722, 32586, 32359, 32044, 31643,
+    31159, 30596, 29958, 29250, 28476, 27643, 26756, 25822, 24847, 23837,
+    22799, 21739, 20665, 19583, 18498, 17417, 16345, 15288, 14251, 13239,
+    12255, 11303, 10387, 9509, 8672, 7877, 7126, 6419, 5758, 5141,
+    4570, 4042, 3557, 3115, 2713, 2349, 2022, 1730, 1470, 1241,
+    1039, 864, 712, 582, 471, 377, 298, 233, 179, 135,
+    100, 72, 51, 34, 22, 13, 7, 3
+};
+
+/* 4-term Blackman-Harris, 256 points */
+const q15_t Window_blackmanHarris256[256] __attribute__((aligned(4))) = {
+    2, 2, 3, 5, 7, 9, 13, 17, 22, 27,
+    34, 42, 51, 61, 72, 85, 100, 117, 135, 156,
+    179, 205, 233, 264, 298, 336, 377, 422, 471, 524,
+    582, 645, 712, 785, 864, 949, 1039, 1137, 1241, 1352,
+    1470, 1596, 1730, 1872, 2022, 2181, 2349, 2526, 2713, 2909,
+    3115, 3331, 3557, 3794, 4042, 4300, 4570, 4850, 5141, 5444,
+    5758, 6083, 6419, 6767, 7126, 7496, 7877, 8269, 8672, 9086,
+    9509, 9943, 10387, 10841, 11303, 11775, 12255, 12743, 13239, 13742,
+    14251, 14767, 15288, 15815, 16345, 16879, 17417, 17956, 18498, 19040,
+    19583, 20125, 20665, 21204, 21739, 22271, 22799, 23321, 23837, 24346,
+    24847, 25339, 25822, 26295, 26756, 27206, 27643, 28067, 28476, 28871,
+    29250, 29612, 29958, 30286, 30596, 30887, 31159, 31411, 31643, 31854,
+    32044, 32212, 32359, 32483, 32586, 32665, 32722, 32757, 32767, 32757,
+    32722, 32665, 32586, 32483, 32359, 32212, 32044, 31854, 31643, 31411,
+    31159, 30887, 30596, 30286, 29958, 29612, 29250, 28871, 28476, 28067,
+    27643, 27206, 26756, 26295, 25822, 25339, 24847, 24346, 23837, 23321,
+    22799, 22271, 21739, 21204, 20665, 20125, 19583, 19040, 18498, 17956,
+    17417, 16879, 16345, 15815, 15288, 14767, 14251, 13742, 13239, 12743,
+    12255, 11775, 11303, 10841, 10387, 9943, 9509, 9086, 8672, 8269,
+    7877, 7496, 7126, 6767, 6419, 6083, 5758, 5444, 5141, 4850,
+    4570, 4300, 4042, 3794, 3557, 3331, 3115, 2909, 2713, 2526,
+    2349, 2181, 2022, 1872, 1730, 1596, 1470, 1352, 1241, 1137,
+    1039, 949, 864, 785, 712, 645, 582, 524, 471, 422,
+    377, 336, 298, 264, 233, 205, 179, 156, 135, 117,
+    100, 85, 72, 61, 51, 42, 34, 27, 22, 17,
+    13, 9, 7, 5, 3, 2
+};
+
+/* 4-term Blackman-Harris, 512 points */
+const q15_t Window_blackmanHarris512[512] __attribute__((aligned(4))) = {
+    2, 2, 2, 3, 3, 4, 5, 5, 7, 8,
+    9, 11, 13, 14, 17, 19, 22, 24, 27, 30,
+    34, 38, 42, 46, 51, 56, 61, 66, 72, 79,
+    85, 93, 100, 108, 117, 126, 135, 145, 156, 167,
+    179, 191, 205, 218, 233, 248, 264, 281, 298, 316,
+    336, 356, 377, 399, 422, 446, 471, 497, 524, 552,
+    582, 613, 645, 678, 712, 748, 785, 824, 864, 906,
+    949, 993, 1039, 1087, 1137, 1188, 1241, 1295, 1352, 1410,
+    1470, 1532, 1596, 1662, 1730, 1800, 1872, 1946, 2022, 2100,
+    2181, 2264, 2349, 2436, 2526, 2618, 2713, 2809, 2909, 3011,
+    3115, 3222, 3331, 3443, 3557, 3675, 3794, 3917, 4042, 4170,
+    4300, 4434, 4570, 4708, 4850, 4994, 5141, 5291, 5444, 5599,
+    5758, 5919, 6083, 6250, 6419, 6592, 6767, 6945, 7126, 7310,
+    7496, 7685, 7877, 8072, 8269, 8469, 8672, 8878, 9086, 9296,
+    9509, 9725, 9943, 10164, 10387, 10613, 10841, 11071, 11303, 11538,
+    11775, 12014, 12255, 12498, 12743, 12990, 13239, 13490, 13742, 13996,
+    14251, 14509, 14767, 15027, 15288, 15551, 15815, 16079, 16345, 16612,
+    16879, 17148, 17417, 17686, 17956, 18227, 18498, 18769, 19040, 19311,
+    19583, 19854, 20125, 20395, 20665, 20935, 21204, 21472, 21739, 22006,
+    22271, 22536, 22799, 23061, 23321, 23580, 23837, 24092, 24346, 24597,
+    24847, 25094, 25339, 25582, 25822, 26060, 26295, 26527, 26756, 26983,
+    27206, 27426, 27643, 27856, 28067, 28273, 28476, 28675, 28871, 29062,
+    29250, 29433, 29612, 29787, 29958, 30124, 30286, 30443, 30596, 30744,
+    30887, 31025, 31159, 31287, 31411, 31529, 31643, 31751, 31854, 31951,
+    32044, 32131, 32212, 32288, 32359, 32424, 32483, 32537, 32586, 32628,
+    32665, 32697, 32722, 32742, 32757, 32765, 32767, 32765, 32757, 32742,
+    32722, 32697, 32665, 32628, 32586, 32537, 32483, 32424, 32359, 32288,
+    32212, 32131, 32044, 31951, 31854, 31751, 31643, 31529, 31411, 31287,
+    31159, 31025, 30887, 30744, 30596, 30443, 30286, 30124, 29958, 29787,
+    29612, 29433, 29250, 29062, 28871, 28675, 28476, 28273, 28067, 27856,
+    27643, 27426, 27206, 26983, 26756, 26527, 26295, 26060, 25822, 25582,
+    25339, 25094, 24847, 24597, 24346, 24092, 23837, 23580, 23321, 23061,
+    22799, 22536, 22271, 22006, 21739, 21472, 21204, 20935, 20665, 20395,
+    20125, 19854, 19583, 19311, 19040, 18769, 18498, 18227, 17956, 17686,
+    17417, 17148, 16879, 16612, 16345, 16079, 15815, 15551, 15288, 15027,
+    14767, 14509, 14251, 13996, 13742, 13490, 13239, 12990, 12743, 12498,
+    12255, 12014, 11775, 11538, 11303, 11071, 10841, 10613, 10387, 10164,
+    9943, 9725, 9509, 9296, 9086, 8878, 8672, 8469, 8269, 8072,
+    7877, 7685, 7496, 7310, 7126, 6945, 6767, 6592, 6419, 6250,
+    6083, 5919, 5758, 5599, 5444, 5291, 5141, 4994, 4850, 4708,
+    4570, 4434, 4300, 4170, 4042, 3917, 3794, 3675, 3557, 3443,
+    3331, 3222, 3115, 3011, 2909, 2809, 2713, 2618, 2526, 2436,
+    2349, 2264, 2181, 2100, 2022, 1946, 1872, 1800, 1730, 1662,
+    1596, 1532, 1470, 1410, 1352, 1295, 1241, 1188, 1137, 1087,
+    1039, 993, 949, 906, 864, 824, 785, 748, 712, 678,
+    645, 613, 582, 552, 524, 497, 471, 446, 422, 399,
+    377, 356, 336, 316, 298, 281, 264, 248, 233, 218,
+    205, 191, 179, 167, 156, 145, 135, 126, 117, 108,
+    100, 93, 85, 79, 72, 66, 61, 56, 51, 46,
+    42, 38, 34, 30, 27, 24, 22, 19, 17, 14,
+    13, 11, 9, 8, 7, 5, 5, 4, 3, 3,
+    2, 2
+};
+
+/* 4-term Blackman-Harris, 1024 points */
+const q15_t Window_blackmanHarris1024[1024] __attribute__((aligned(4))) = {
+    2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    4, 4, 5, 5, 5, 6, 7, 7, 8, 8,
+    9, 10, 11, 12, 13, 13, 14, 16, 17, 18,
+    19, 20, 22, 23, 24, 26, 27, 29, 30, 32,
+    34, 36, 38, 40, 42, 44, 46, 48, 51, 53,
+    56, 58, 61, 64, 66, 69, 72, 76, 79, 82,
+    85, 89, 93, 96, 100, 104, 108, 112, 117, 121,
+    126, 131, 135, 140, 145, 151, 156, 162, 167, 173,
+    179, 185, 191, 198, 205, 211, 218, 225, 233, 240,
+    248, 256, 264, 272, 281, 289, 298, 307, 316, 326,
+    336, 346, 356, 366, 377, 388, 399, 410, 422, 434,
+    446, 458, 471, 484, 497, 510, 524, 538, 552, 567,
+    582, 597, 613, 628, 645, 661, 678, 695, 712, 730,
+    748, 767, 785, 804, 824, 844, 864, 885, 906, 927,
+    949, 971, 993, 1016, 1039, 1063, 1087, 1112, 1137, 1162,
+    1188, 1214, 1241, 1268, 1295, 1323, 1352, 1381, 1410, 1440,
+    1470, 1501, 1532, 1564, 1596, 1629, 1662, 1695, 1730, 1764,
+    1800, 1835, 1872, 1908, 1946, 1984, 2022, 2061, 2100, 2140,
+    2181, 2222, 2264, 2306, 2349, 2392, 2436, 2481, 2526, 2572,
+    2618, 2665, 2713, 2761, 2809, 2859, 2909, 2959, 3011, 3062,
+    3115, 3168, 3222, 3276, 3331, 3387, 3443, 3500, 3557, 3616,
+    3675, 3734, 3794, 3855, 3917, 3979, 4042, 4106, 4170, 4235,
+    4300, 4367, 4434, 4501, 4570, 4639, 4708, 4779, 4850, 4922,
+    4994, 5067, 5141, 5216, 5291, 5367, 5444, 5521, 5599, 5678,
+    5758, 5838, 5919, 6001, 6083, 6166, 6250, 6334, 6419, 6505,
+    6592, 6679, 6767, 6856, 6945, 7035, 7126, 7218, 7310, 7403,
+    7496, 7590, 7685, 7781, 7877, 7974, 8072, 8170, 8269, 8369,
+    8469, 8570, 8672, 8775, 8878, 8981, 9086, 9191, 9296, 9403,
+    9509, 9617, 9725, 9834, 9943, 10054, 10164, 10275, 10387, 10500,
+    10613, 10727, 10841, 10956, 11071, 11187, 11303, 11420, 11538, 11656,
+    11775, 11894, 12014, 12134, 12255, 12376, 12498, 12620, 12743, 12866,
+    12990, 13114, 13239, 13364, 13490, 13616, 13742, 13869, 13996, 14123,
+    14251, 14380, 14509, 14638, 14767, 14897, 15027, 15158, 15288, 15419,
+    15551, 15683, 15815, 15947, 16079, 16212, 16345, 16478, 16612, 16746,
+    16879, 17013, 17148, 17282, 17417, 17551, 17686, 17821, 17956, 18092,
+    18227, 18362, 18498, 18633, 18769, 18905, 19040, 19176, 19311, 19447,
+    19583, 19718, 19854, 19989, 20125, 20260, 20395, 20530, 20665, 20800,
+    20935, 21069, 21204, 21338, 21472, 21606, 21739, 21873, 22006, 22139,
+    22271, 22404, 22536, 22667, 22799, 22930, 23061, 23191, 23321, 23450,
+    23580, 23708, 23837, 23965, 24092, 24219, 24346, 24472, 24597, 24722,
+    24847, 24971, 25094, 25217, 25339, 25461, 25582, 25702, 25822, 25941,
+    26060, 26177, 26295, 26411, 26527, 26642, 26756, 26870, 26983, 27095,
+    27206, 27316, 27426, 27535, 27643, 27750, 27856, 27962, 28067, 28170,
+    28273, 28375, 28476, 28576, 28675, 28773, 28871, 28967, 29062, 29156,
+    29250, 29342, 29433, 29523, 29612, 29700, 29787, 29873, 29958, 30042,
+    30124, 30206, 30286, 30365, 30443, 30520, 30596, 30670, 30744, 30816,
+    30887, 30957, 31025, 31093, 31159, 31224, 31287, 31350, 31411, 31471,
+    31529, 31587, 31643, 31697, 31751, 31803, 31854, 31903, 31951, 31998,
+    32044, 32088, 32131, 32172, 32212, 32251, 32288, 32324, 32359, 32392,
+    32424, 32454, 32483, 32511, 32537, 32562, 32586, 32608, 32628, 32647,
+    32665, 32682, 32697, 32710, 32722, 32733, 32742, 32750, 32757, 32762,
+    32765, 32767, 32767, 32767, 32765, 32762, 32757, 32750, 32742, 32733,
+    32722, 32710, 32697, 32682, 32665, 32647, 32628, 32608, 32586, 32562,
+    32537, 32511, 32483, 32454, 32424, 32392, 32359, 32324, 32288, 32251,
+    32212, 32172, 32131, 32088, 32044, 31998, 31951, 31903, 31854, 31803,
+    31751, 31697, 31643, 31587, 31529, 31471, 31411, 31350, 31287, 31224,
+    31159, 31093, 31025, 30957, 30887, 30816, 30744, 30670, 30596, 30520,
+    30443, 30365, 30286, 30206, 30124, 30042, 29958, 29873, 29787, 29700,
+    29612, 29523, 29433, 29342, 29250, 29156, 29062, 28967, 28871, 28773,
+    28675, 28576, 28476, 28375, 28273, 28170, 28067, 27962, 27856, 27750,
+    27643, 27535, 27426, 27316, 27206, 27095, 26983, 26870, 26756, 26642,
+    26527, 26411, 26295, 26177, 26060, 25941, 25822, 25702, 25582, 25461,
+    25339, 25217, 25094, 24971, 24847, 24722, 24597, 24472, 24346, 24219,
+    24092, 23965, 23837, 23708, 23580, 23450, 23321, 23191, 23061, 22930,
+    22799, 22667, 22536, 22404, 22271, 22139, 22006, 21873, 21739, 21606,
+    21472, 21338, 21204, 21069, 20935, 20800, 20665, 20530, 20395, 20260,
+    20125, 19989, 19854, 19718, 19583, 19447, 19311, 19176, 19040, 18905,
+    18769, 18633, 18498, 18362, 18227, 18092, 17956, 17821, 17686, 17551,
+    17417, 17282, 17148, 17013, 16879, 16746, 16612, 16478, 16345, 16212,
+    16079, 15947, 15815, 15683, 15551, 15419, 15288, 15158, 15027, 14897,
+    14767, 14638, 14509, 14380, 14251, 14123, 13996, 13869, 13742, 13616,
+    13490, 13364, 13239, 13114, 12990, 12866, 12743, 12620, 12498, 12376,
+    12255, 12134, 12014, 11894, 11775, 11656, 11538, 11420, 11303, 11187,
+    11071, 10956, 10841, 10727, 10613, 10500, 10387, 10275, 10164, 10054,
+    9943, 9834, 9725, 9617, 9509, 9403, 9296, 9191, 9086, 8981,
+    8878, 8775, 8672, 8570, 8469, 8369, 8269, 8170, 8072, 7974,
+    7877, 7781, 7685, 7590, 7496, 7403, 7310, 7218, 7126, 7035,
+    6945, 6856, 6767, 6679, 6592, 6505, 6419, 6334, 6250, 6166,
+    6083, 6001, 5919, 5838, 5758, 5678, 5599, 5521, 5444, 5367,
+    5291, 5216, 5141, 5067, 4994, 4922, 4850, 4779, 4708, 4639,
+    4570, 4501, 4434, 4367, 4300, 4235, 4170, 4106, 4042, 3979,
+    3917, 3855, 3794, 3734, 3675, 3616, 3557, 3500, 3443, 3387,
+    3331, 3276, 3222, 3168, 3115, 3062, 3011, 2959, 2909, 2859,
+    2809, 2761, 2713, 2665, 2618, 2572, 2526, 2481, 2436, 2392,
+    2349, 2306, 2264, 2222, 2181, 2140, 2100, 2061, 2022, 1984,
+    1946, 1908, 1872, 1835, 1800, 1764, 1730, 1695, 1662, 1629,
+    1596, 1564, 1532, 1501, 1470, 1440, 1410, 1381, 1352, 1323,
+    1295, 1268, 1241, 1214, 1188, 1162, 1137, 1112, 1087, 1063,
+    1039, 1016, 993, 971, 949, 927, 906, 885, 864, 844,
+    824, 804, 785, 767, 748, 730, 712, 695, 678, 661,
+    645, 628, 613, 597, 582, 567, 552, 538, 524, 510,
+    497, 484, 471, 458, 446, 434, 422, 410, 399, 388,
+    377, 366, 356, 346, 336, 326, 316, 307, 298, 289,
+    281, 272, 264, 256, 248, 240, 233, 225, 218, 211,
+    205, 198, 191, 185, 179, 173, 167, 162, 156, 151,
+    145, 140, 135, 131, 126, 121, 117, 112, 108, 104,
+    100, 96, 93, 89, 85, 82, 79, 76, 72, 69,
+    66, 64, 61, 58, 56, 53, 51, 48, 46, 44,
+    42, 40, 38, 36, 34, 32, 30, 29, 27, 26,
+    24, 23, 22, 20, 19, 18, 17, 16, 14, 13,
+    13, 12, 11, 10, 9, 8, 8, 7, 7, 6,
+    5, 5, 5, 4, 4, 3, 3, 3, 3, 2,
+    2, 2, 2, 2
+};
+
+/* 4-term Blackman-Harris, 2048 points */
+const q15_t Window_blackmanHarris2048[2048] __attribute__((aligned(4))) = {
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 4,
+    4, 4, 4, 4, 5, 5, 5, 5, 5, 6,
+    6, 6, 7, 7, 7, 7, 8, 8, 8, 9,
+    9, 10, 10, 10, 11, 11, 12, 12, 13, 13,
+    13, 14, 14, 15, 16, 16, 17, 17, 18, 18,
+    19, 20, 20, 21, 22, 22, 23, 24, 24, 25,
+    26, 26, 27, 28, 29, 30, 30, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 51, 52, 53, 54,
+    56, 57, 58, 59, 61, 62, 64, 65, 66, 68,
+    69, 71, 72, 74, 76, 77, 79, 80, 82, 84,
+    85, 87, 89, 91, 93, 95, 96, 98, 100, 102,
+    104, 106, 108, 110, 112, 115, 117, 119, 121, 124,
+    126, 128, 131, 133, 135, 138, 140, 143, 145, 148,
+    151, 153, 156, 159, 162, 164, 167, 170, 173, 176,
+    179, 182, 185, 188, 191, 195, 198, 201, 205, 208,
+    211, 215, 218, 222, 225, 229, 233, 236, 240, 244,
+    248, 252, 256, 260, 264, 268, 272, 276, 281, 285,
+    289, 294, 298, 303, 307, 312, 316, 321, 326, 331,
+    336, 341, 346, 351, 356, 361, 366, 371, 377, 382,
+    388, 393, 399, 404, 410, 416, 422, 428, 434, 440,
+    446, 452, 458, 464, 471, 477, 484, 490, 497, 504,
+    510, 517, 524, 531, 538, 545, 552, 560, 567, 574,
+    582, 589, 597, 605, 613, 620, 628, 636, 645, 653,
+    661, 669, 678, 686, 695, 703, 712, 721, 730, 739,
+    748, 757, 767, 776, 785, 795, 804, 814, 824, 834,
+    844, 854, 864, 874, 885, 895, 906, 916, 927, 938,
+    949, 960, 971, 982, 993, 1005, 1016, 1028, 1039, 1051,
+    1063, 1075, 1087, 1099, 1112, 1124, 1137, 1149, 1162, 1175,
+    1188, 1201, 1214, 1227, 1241, 1254, 1268, 1281, 1295, 1309,
+    1323, 1337, 1352, 1366, 1381, 1395, 1410, 1425, 1440, 1455,
+    1470, 1485, 1501, 1516, 1532, 1548, 1564, 1580, 1596, 1612,
+    1629, 1645, 1662, 1679, 1695, 1713, 1730, 1747, 1764, 1782,
+    1800, 1817, 1835, 1853, 1872, 1890, 1908, 1927, 1946, 1965,
+    1984, 2003, 2022, 2041, 2061, 2081, 2100, 2120, 2140, 2161,
+    2181, 2201, 2222, 2243, 2264, 2285, 2306, 2327, 2349, 2371,
+    2392, 2414, 2436, 2458, 2481, 2503, 2526, 2549, 2572, 2595,
+    2618, 2641, 2665, 2689, 2713, 2737, 2761, 2785, 2809, 2834,
+    2859, 2884, 2909, 2934, 2959, 2985, 3011, 3036, 3062, 3089,
+    3115, 3141, 3168, 3195, 3222, 3249, 3276, 3303, 3331, 3359,
+    3387, 3415, 3443, 3471, 3500, 3529, 3557, 3587, 3616, 3645,
+    3675, 3704, 3734, 3764, 3794, 3825, 3855, 3886, 3917, 3948,
+    3979, 4010, 4042, 4074, 4106, 4138, 4170, 4202, 4235, 4267,
+    4300, 4333, 4367, 4400, 4434, 4467, 4501, 4535, 4570, 4604,
+    4639, 4673, 4708, 4743, 4779, 4814, 4850, 4886, 4922, 4958,
+    4994, 5031, 5067, 5104, 5141, 5179, 5216, 5253, 5291, 5329,
+    5367, 5405, 5444, 5483, 5521, 5560, 5599, 5639, 5678, 5718,
+    5758, 5798, 5838, 5878, 5919, 5960, 6001, 6042, 6083, 6124,
+    6166, 6208, 6250, 6292, 6334, 6377, 6419, 6462, 6505, 6548,
+    6592, 6635, 6679, 6723, 6767, 6811, 6856, 6900, 6945, 6990,
+    7035, 7081, 7126, 7172, 7218, 7264, 7310, 7356, 7403, 7449,
+    7496, 7543, 7590, 7638, 7685, 7733, 7781, 7829, 7877, 7926,
+    7974, 8023, 8072, 8121, 8170, 8220, 8269, 8319, 8369, 8419,
+    8469, 8520, 8570, 8621, 8672, 8723, 8775, 8826, 8878, 8929,
+    8981, 9033, 9086, 9138, 9191, 9243, 9296, 9349, 9403, 9456,
+    9509, 9563, 9617, 9671, 9725, 9780, 9834, 9889, 9943, 9998,
+    10054, 10109, 10164, 10220, 10275, 10331, 10387, 10443, 10500, 10556,
+    10613, 10670, 10727, 10784, 10841, 10898, 10956, 11013, 11071, 11129,
+    11187, 11245, 11303, 11362, 11420, 11479, 11538, 11597, 11656, 11716,
+    11775, 11835, 11894, 11954, 12014, 12074, 12134, 12195, 12255, 12316,
+    12376, 12437, 12498, 12559, 12620, 12682, 12743, 12805, 12866, 12928,
+    12990, 13052, 13114, 13177, 13239, 13301, 13364, 13427, 13490, 13552,
+    13616, 13679, 13742, 13805, 13869, 13932, 13996, 14060, 14123, 14187,
+    14251, 14316, 14380, 14444, 14509, 14573, 14638, 14702, 14767, 14832,
+    14897, 14962, 15027, 15092, 15158, 15223, 15288, 15354, 15419, 15485,
+    15551, 15617, 15683, 15749, 15815, 15881, 15947, 16013, 16079, 16146,
+    16212, 16279, 16345, 16412, 16478, 16545, 16612, 16679, 16746, 16812,
+    16879, 16946, 17013, 17081, 17148, 17215, 17282, 17349, 17417, 17484,
+    17551, 17619, 17686, 17754, 17821, 17889, 17956, 18024, 18092, 18159,
+    18227, 18295, 18362, 18430, 18498, 18566, 18633, 18701, 18769, 18837,
+    18905, 18972, 19040, 19108, 19176, 19244, 19311, 19379, 19447, 19515,
+    19583, 19650, 19718, 19786, 19854, 19922, 19989, 20057, 20125, 20192,
+    20260, 20328, 20395, 20463, 20530, 20598, 20665, 20733, 20800, 20868,
+    20935, 21002, 21069, 21137, 21204, 21271, 21338, 21405, 21472, 21539,
+    21606, 21673, 21739, 21806, 21873, 21939, 22006, 22072, 22139, 22205,
+    22271, 22338, 22404, 22470, 22536, 22602, 22667, 22733, 22799, 22864,
+    22930, 22995, 23061, 23126, 23191, 23256, 23321, 23386, 23450, 23515,
+    23580, 23644, 23708, 23773, 23837, 23901, 23965, 24028, 24092, 24156,
+    24219, 24282, 24346, 24409, 24472, 24534, 24597, 24660, 24722, 24784,
+    24847, 24909, 24971, 25032, 25094, 25155, 25217, 25278, 25339, 25400,
+    25461, 25521, 25582, 25642, 25702, 25762, 25822, 25882, 25941, 26000,
+    26060, 26119, 26177, 26236, 26295, 26353, 26411, 26469, 26527, 26584,
+    26642, 26699, 26756, 26813, 26870, 26926, 26983, 27039, 27095, 27150,
+    27206, 27261, 27316, 27371, 27426, 27481, 27535, 27589, 27643, 27697,
+    27750, 27803, 27856, 27909, 27962, 28014, 28067, 28119, 28170, 28222,
+    28273, 28324, 28375, 28426, 28476, 28526, 28576, 28626, 28675, 28724,
+    28773, 28822, 28871, 28919, 28967, 29015, 29062, 29109, 29156, 29203,
+    29250, 29296, 29342, 29387, 29433, 29478, 29523, 29568, 29612, 29656,
+    29700, 29744, 29787, 29830, 29873, 29916, 29958, 30000, 30042, 30083,
+    30124, 30165, 30206, 30246, 30286, 30326, 30365, 30404, 30443, 30482,
+    30520, 30558, 30596, 30633, 30670, 30707, 30744, 30780, 30816, 30852,
+    30887, 30922, 30957, 30991, 31025, 31059, 31093, 31126, 31159, 31191,
+    31224, 31256, 31287, 31319, 31350, 31381, 31411, 31441, 31471, 31500,
+    31529, 31558, 31587, 31615, 31643, 31670, 31697, 31724, 31751, 31777,
+    31803, 31829, 31854, 31879, 31903, 31927, 31951, 31975, 31998, 32021,
+    32044, 32066, 32088, 32109, 32131, 32151, 32172, 32192, 32212, 32232,
+    32251, 32270, 32288, 32306, 32324, 32342, 32359, 32376, 32392, 32408,
+    32424, 32439, 32454, 32469, 32483, 32497, 32511, 32524, 32537, 32550,
+    32562, 32574, 32586, 32597, 32608, 32618, 32628, 32638, 32647, 32657,
+    32665, 32674, 32682, 32689, 32697, 32704, 32710, 32716, 32722, 32728,
+    32733, 32738, 32742, 32746, 32750, 32754, 32757, 32759, 32762, 32764,
+    32765, 32766, 32767, 32767, 32767, 32767, 32767, 32766, 32765, 32764,
+    32762, 32759, 32757, 32754, 32750, 32746, 32742, 32738, 32733, 32728,
+    32722, 32716, 32710, 32704, 32697, 32689, 32682, 32674, 32665, 32657,
+    32647, 32638, 32628, 32618, 32608, 32597, 32586, 32574, 32562, 32550,
+    32537, 32524, 32511, 32497, 32483, 32469, 32454, 32439, 32424, 32408,
+    32392, 32376, 32359, 32342, 32324, 32306, 32288, 32270, 32251, 32232,
+    32212, 32192, 32172, 32151, 32131, 32109, 32088, 32066, 32044, 32021,
+    31998, 31975, 31951, 31927, 31903, 31879, 31854, 31829, 31803, 31777,
+    31751, 31724, 31697, 31670, 31643, 31615, 31587, 31558, 31529, 31500,
+    31471, 31441, 31411, 31381, 31350, 31319, 31287, 31256, 31224, 31191,
+    31159, 31126, 31093, 31059, 31025, 30991, 30957, 30922, 30887, 30852,
+    30816, 30780, 30744, 30707, 30670, 30633, 30596, 30558, 30520, 30482,
+    30443, 30404, 30365, 30326, 30286, 30246, 30206, 30165, 30124, 30083,
+    30042, 30000, 29958, 29916, 29873, 29830, 29787, 29744, 29700, 29656,
+    29612, 29568, 29523, 29478, 29433, 29387, 29342, 29296, 29250, 29203,
+    29156, 29109, 29062, 29015, 28967, 28919, 28871, 28822, 28773, 28724,
+    28675, 28626, 28576, 28526, 28476, 28426, 28375, 28324, 28273, 28222,
+    28170, 28119, 28067, 28014, 27962, 27909, 27856, 27803, 27750, 27697,
+    27643, 27589, 27535, 27481, 27426, 27371, 27316, 27261, 27206, 27150,
+    27095, 27039, 26983, 26926, 26870, 26813, 26756, 26699, 26642, 26584,
+    26527, 26469, 26411, 26353, 26295, 26236, 26177, 26119, 26060, 26000,
+    25941, 25882, 25822, 25762, 25702, 25642, 25582, 25521, 25461, 25400,
+    25339, 25278, 25217, 25155, 25094, 25032, 24971, 24909, 24847, 24784,
+    24722, 24660, 24597, 24534, 24472, 24409, 24346, 24282, 24219, 24156,
+    24092, 24028, 23965, 23901, 23837, 23773, 23708, 23644, 23580, 23515,
+    23450, 23386, 23321, 23256, 23191, 23126, 23061, 22995, 22930, 22864,
+    22799, 22733, 22667, 22602, 22536, 22470, 22404, 22338, 22271, 22205,
+    22139, 22072, 22006, 21939, 21873, 21806, 21739, 21673, 21606, 21539,
+    21472, 21405, 21338, 21271, 21204, 21137, 21069, 21002, 20935, 20868,
+    20800, 20733, 20665, 20598, 20530, 20463, 20395, 20328, 20260, 20192,
+    20125, 20057, 19989, 19922, 19854, 19786, 19718, 19650, 19583, 19515,
+    19447, 19379, 19311, 19244, 19176, 19108, 19040, 18972, 18905, 18837,
+    18769, 18701, 18633, 18566, 18498, 18430, 18362, 18295, 18227, 18159,
+    18092, 18024, 17956, 17889, 17821, 17754, 17686, 17619, 17551, 17484,
+    17417, 17349, 17282, 17215, 17148, 17081, 17013, 16946, 16879, 16812,
+    16746, 16679, 16612, 16545, 16478, 16412, 16345, 16279, 16212, 16146,
+    16079, 16013, 15947, 15881, 15815, 15749, 15683, 15617, 15551, 15485,
+    15419, 15354, 15288, 15223, 15158, 15092, 15027, 14962, 14897, 14832,
+    14767, 14702, 14638, 14573, 14509, 14444, 14380, 14316, 14251, 14187,
+    14123, 14060, 13996, 13932, 13869, 13805, 13742, 13679, 13616, 13552,
+    13490, 13427, 13364, 13301, 13239, 13177, 13114, 13052, 12990, 12928,
+    12866, 12805, 12743, 12682, 12620, 12559, 12498, 12437, 12376, 12316,
+    12255, 12195, 12134, 12074, 12014, 11954, 11894, 11835, 11775, 11716,
+    11656, 11597, 11538, 11479, 11420, 11362, 11303, 11245, 11187, 11129,
+    11071, 11013, 10956, 10898, 10841, 10784, 10727, 10670, 10613, 10556,
+    10500, 10443, 10387, 10331, 10275, 10220, 10164, 10109, 10054, 9998,
+    9943, 9889, 9834, 9780, 9725, 9671, 9617, 9563, 9509, 9456,
+    9403, 9349, 9296, 9243, 9191, 9138, 9086, 9033, 8981, 8929,
+    8878, 8826, 8775, 8723, 8672, 8621, 8570, 8520, 8469, 8419,
+    8369, 8319, 8269, 8220, 8170, 8121, 8072, 8023, 7974, 7926,
+    7877, 7829, 7781, 7733, 7685, 7638, 7590, 7543, 7496, 7449,
+    7403, 7356, 7310, 7264, 7218, 7172, 7126, 7081, 7035, 6990,
+    6945, 6900, 6856, 6811, 6767, 6723, 6679, 6635, 6592, 6548,
+    6505, 6462, 6419, 6377, 6334, 6292, 6250, 6208, 6166, 6124,
+    6083, 6042, 6001, 5960, 5919, 5878, 5838, 5798, 5758, 5718,
+    5678, 5639, 5599, 5560, 5521, 5483, 5444, 5405, 5367, 5329,
+    5291, 5253, 5216, 5179, 5141, 5104, 5067, 5031, 4994, 4958,
+    4922, 4886, 4850, 4814, 4779, 4743, 4708, 4673, 4639, 4604,
+    4570, 4535, 4501, 4467, 4434, 4400, 4367, 4333, 4300, 4267,
+    4235, 4202, 4170, 4138, 4106, 4074, 4042, 4010, 3979, 3948,
+    3917, 3886, 3855, 3825, 3794, 3764, 3734, 3704, 3675, 3645,
+    3616, 3587, 3557, 3529, 3500, 3471, 3443, 3415, 3387, 3359,
+    3331, 3303, 3276, 3249, 3222, 3195, 3168, 3141, 3115, 3089,
+    3062, 3036, 3011, 2985, 2959, 2934, 2909, 2884, 2859, 2834,
+    2809, 2785, 2761, 2737, 2713, 2689, 2665, 2641, 2618, 2595,
+    2572, 2549, 2526, 2503, 2481, 2458, 2436, 2414, 2392, 2371,
+    2349, 2327, 2306, 2285, 2264, 2243, 2222, 2201, 2181, 2161,
+    2140, 2120, 2100, 2081, 2061, 2041, 2022, 2003, 1984, 1965,
+    1946, 1927, 1908, 1890, 1872, 1853, 1835, 1817, 1800, 1782,
+    1764, 1747, 1730, 1713, 1695, 1679, 1662, 1645, 1629, 1612,
+    1596, 1580, 1564, 1548, 1532, 1516, 1501, 1485, 1470, 1455,
+    1440, 1425, 1410, 1395, 1381, 1366, 1352, 1337, 1323, 1309,
+    1295, 1281, 1268, 1254, 1241, 1227, 1214, 1201, 1188, 1175,
+    1162, 1149, 1137, 1124, 1112, 1099, 1087, 1075, 1063, 1051,
+    1039, 1028, 1016, 1005, 993, 982, 971, 960, 949, 938,
+    927, 916, 906, 895, 885, 874, 864, 854, 844, 834,
+    824, 814, 804, 795, 785, 776, 767, 757, 748, 739,
+    730, 721, 712, 703, 695, 686, 678, 669, 661, 653,
+    645, 636, 628, 620, 613, 605, 597, 589, 582, 574,
+    567, 560, 552, 545, 538, 531, 524, 517, 510, 504,
+    497, 490, 484, 477, 471, 464, 458, 452, 446, 440,
+    434, 428, 422, 416, 410, 404, 399, 393, 388, 382,
+    377, 371, 366, 361, 356, 351, 346, 341, 336, 331,
+    326, 321, 316, 312, 307, 303, 298, 294, 289, 285,
+    281, 276, 272, 268, 264, 260, 256, 252, 248, 244,
+    240, 236, 233, 229, 225, 222, 218, 215, 211, 208,
+    205, 201, 198, 195, 191, 188, 185, 182, 179, 176,
+    173, 170, 167, 164, 162, 159, 156, 153, 151, 148,
+    145, 143, 140, 138, 135, 133, 131, 128, 126, 124,
+    121, 119, 117, 115, 112, 110, 108, 106, 104, 102,
+    100, 98, 96, 95, 93, 91, 89, 87, 85, 84,
+    82, 80, 79, 77, 76, 74, 72, 71, 69, 68,
+    66, 65, 64, 62, 61, 59, 58, 57, 56, 54,
+    53, 52, 51, 49, 48, 47, 46, 45, 44, 43,
+    42, 41, 40, 39, 38, 37, 36, 35, 34, 33,
+    32, 31, 30, 30, 29, 28, 27, 26, 26, 25,
+    24, 24, 23, 22, 22, 21, 20, 20, 19, 18,
+    18, 17, 17, 16, 16, 15, 14, 14, 13, 13,
+    13, 12, 12, 11, 11, 10, 10, 10, 9, 9,
+    8, 8, 8, 7, 7, 7, 7, 6, 6, 6,
+    5, 5, 5, 5, 5, 4, 4, 4, 4, 4,
+    3, 3, 3, 3, 3, 3, 3, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2
+};
+
+/* 4-term Blackman-Harris, 4096 points */
+const q15_t Window_blackmanHarris4096[4096] __attribute__((aligned(4))) = {
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+    6, 6, 6, 6, 7, 7, 7, 7, 7, 7,
+    7, 8, 8, 8, 8, 8, 8, 9, 9, 9,
+    9, 9, 10, 10, 10, 10, 10, 11, 11, 11,
+    11, 11, 12, 12, 12, 12, 13, 13, 13, 13,
+    13, 14, 14, 14, 14, 15, 15, 15, 16, 16,
+    16, 16, 17, 17, 17, 17, 18, 18, 18, 19,
+    19, 19, 20, 20, 20, 21, 21, 21, 22, 22,
+    22, 23, 23, 23, 24, 24, 24, 25, 25, 25,
+    26, 26, 26, 27, 27, 28, 28, 28, 29, 29,
+    30, 30, 30, 31, 31, 32, 32, 33, 33, 34,
+    34, 34, 35, 35, 36, 36, 37, 37, 38, 38,
+    39, 39, 40, 40, 41, 41, 42, 42, 43, 43,
+    44, 44, 45, 45, 46, 47, 47, 48, 48, 49,
+    49, 50, 51, 51, 52, 52, 53, 54, 54, 55,
+    56, 56, 57, 58, 58, 59, 59, 60, 61, 62,
+    62, 63, 64, 64, 65, 66, 66, 67, 68, 69,
+    69, 70, 71, 72, 72, 73, 74, 75, 76, 76,
+    77, 78, 79, 80, 80, 81, 82, 83, 84, 85,
+    85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+    95, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+    104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+    115, 116, 117, 118, 119, 120, 121, 122, 124, 125,
+    126, 127, 128, 129, 131, 132, 133, 134, 135, 137,
+    138, 139, 140, 142, 143, 144, 145, 147, 148, 149,
+    151, 152, 153, 155, 156, 157, 159, 160, 162, 163,
+    164, 166, 167, 169, 170, 172, 173, 175, 176, 177,
+    179, 181, 182, 184, 185, 187, 188, 190, 191, 193,
+    195, 196, 198, 200, 201, 203, 205, 206, 208, 210,
+    211, 213, 215, 217, 218, 220, 222, 224, 225, 227,
+    229, 231, 233, 235, 236, 238, 240, 242, 244, 246,
+    248, 250, 252, 254, 256, 258, 260, 262, 264, 266,
+    268, 270, 272, 274, 276, 278, 281, 283, 285, 287,
+    289, 291, 294, 296, 298, 300, 303, 305, 307, 309,
+    312, 314, 316, 319, 321, 324, 326, 328, 331, 333,
+    336, 338, 341, 343, 346, 348, 351, 353, 356, 358,
+    361, 364, 366, 369, 371, 374, 377, 379, 382, 385,
+    388, 390, 393, 396, 399, 402, 404, 407, 410, 413,
+    416, 419, 422, 425, 428, 431, 434, 437, 440, 443,
+    446, 449, 452, 455, 458, 461, 464, 468, 471, 474,
+    477, 480, 484, 487, 490, 493, 497, 500, 504, 507,
+    510, 514, 517, 521, 524, 527, 531, 534, 538, 542,
+    545, 549, 552, 556, 560, 563, 567, 571, 574, 578,
+    582, 586, 589, 593, 597, 601, 605, 609, 613, 616,
+    620, 624, 628, 632, 636, 640, 645, 649, 653, 657,
+    661, 665, 669, 673, 678, 682, 686, 691, 695, 699,
+    703, 708, 712, 717, 721, 726, 730, 734, 739, 744,
+    748, 753, 757, 762, 767, 771, 776, 781, 785, 790,
+    795, 800, 804, 809, 814, 819, 824, 829, 834, 839,
+    844, 849, 854, 859, 864, 869, 874, 879, 885, 890,
+    895, 900, 906, 911, 916, 922, 927, 932, 938, 943,
+    949, 954, 960, 965, 971, 976, 982, 988, 993, 999,
+    1005, 1010, 1016, 1022, 1028, 1034, 1039, 1045, 1051, 1057,
+    1063, 1069, 1075, 1081, 1087, 1093, 1099, 1106, 1112, 1118,
+    1124, 1130, 1137, 1143, 1149, 1156, 1162, 1168, 1175, 1181,
+    1188, 1194, 1201, 1207, 1214, 1221, 1227, 1234, 1241, 1247,
+    1254, 1261, 1268, 1275, 1281, 1288, 1295, 1302, 1309, 1316,
+    1323, 1330, 1337, 1345, 1352, 1359, 1366, 1373, 1381, 1388,
+    1395, 1403, 1410, 1417, 1425, 1432, 1440, 1447, 1455, 1462,
+    1470, 1478, 1485, 1493, 1501, 1509, 1516, 1524, 1532, 1540,
+    1548, 1556, 1564, 1572, 1580, 1588, 1596, 1604, 1612, 1620,
+    1629, 1637, 1645, 1653, 1662, 1670, 1679, 1687, 1695, 1704,
+    1713, 1721, 1730, 1738, 1747, 1756, 1764, 1773, 1782, 1791,
+    1800, 1808, 1817, 1826, 1835, 1844, 1853, 1862, 1872, 1881,
+    1890, 1899, 1908, 1918, 1927, 1936, 1946, 1955, 1965, 1974,
+    1984, 1993, 2003, 2012, 2022, 2032, 2041, 2051, 2061, 2071,
+    2081, 2090, 2100, 2110, 2120, 2130, 2140, 2150, 2161, 2171,
+    2181, 2191, 2201, 2212, 2222, 2232, 2243, 2253, 2264, 2274,
+    2285, 2295, 2306, 2317, 2327, 2338, 2349, 2360, 2371, 2381,
+    2392, 2403, 2414, 2425, 2436, 2447, 2458, 2470, 2481, 2492,
+    2503, 2515, 2526, 2537, 2549, 2560, 2572, 2583, 2595, 2606,
+    2618, 2630, 2641, 2653, 2665, 2677, 2689, 2701, 2713, 2725,
+    2737, 2749, 2761, 2773, 2785, 2797, 2809, 2822, 2834, 2846,
+    2859, 2871, 2884, 2896, 2909, 2921, 2934, 2947, 2959, 2972,
+    2985, 2998, 3011, 3023, 3036, 3049, 3062, 3075, 3089, 3102,
+    3115, 3128, 3141, 3155, 3168, 3181, 3195, 3208, 3222, 3235,
+    3249, 3262, 3276, 3290, 3303, 3317, 3331, 3345, 3359, 3373,
+    3387, 3401, 3415, 3429, 3443, 3457, 3471, 3486, 3500, 3514,
+    3529, 3543, 3557, 3572, 3587, 3601, 3616, 3630, 3645, 3660,
+    3675, 3689, 3704, 3719, 3734, 3749, 3764, 3779, 3794, 3810,
+    3825, 3840, 3855, 3871, 3886, 3901, 3917, 3932, 3948, 3963,
+    3979, 3995, 4010, 4026, 4042, 4058, 4074, 4090, 4106, 4122,
+    4138, 4154, 4170, 4186, 4202, 4218, 4235, 4251, 4267, 4284,
+    4300, 4317, 4333, 4350, 4367, 4383, 4400, 4417, 4434, 4450,
+    4467, 4484, 4501, 4518, 4535, 4552, 4570, 4587, 4604, 4621,
+    4639, 4656, 4673, 4691, 4708, 4726, 4743, 4761, 4779, 4796,
+    4814, 4832, 4850, 4868, 4886, 4904, 4922, 4940, 4958, 4976,
+    4994, 5012, 5031, 5049, 5067, 5086, 5104, 5123, 5141, 5160,
+    5179, 5197, 5216, 5235, 5253, 5272, 5291, 5310, 5329, 5348,
+    5367, 5386, 5405, 5425, 5444, 5463, 5483, 5502, 5521, 5541,
+    5560, 5580, 5599, 5619, 5639, 5659, 5678, 5698, 5718, 5738,
+    5758, 5778, 5798, 5818, 5838, 5858, 5878, 5899, 5919, 5939,
+    5960, 5980, 6001, 6021, 6042, 6062, 6083, 6104, 6124, 6145,
+    6166, 6187, 6208, 6229, 6250, 6271, 6292, 6313, 6334, 6355,
+    6377, 6398, 6419, 6441, 6462, 6484, 6505, 6527, 6548, 6570,
+    6592, 6614, 6635, 6657, 6679, 6701, 6723, 6745, 6767, 6789,
+    6811, 6834, 6856, 6878, 6900, 6923, 6945, 6968, 6990, 7013,
+    7035, 7058, 7081, 7103, 7126, 7149, 7172, 7195, 7218, 7241,
+    7264, 7287, 7310, 7333, 7356, 7379, 7403, 7426, 7449, 7473,
+    7496, 7520, 7543, 7567, 7590, 7614, 7638, 7662, 7685, 7709,
+    7733, 7757, 7781, 7805, 7829, 7853, 7877, 7901, 7926, 7950,
+    7974, 7999, 8023, 8047, 8072, 8096, 8121, 8146, 8170, 8195,
+    8220, 8245, 8269, 8294, 8319, 8344, 8369, 8394, 8419, 8444,
+    8469, 8495, 8520, 8545, 8570, 8596, 8621, 8647, 8672, 8698,
+    8723, 8749, 8775, 8800, 8826, 8852, 8878, 8903, 8929, 8955,
+    8981, 9007, 9033, 9060, 9086, 9112, 9138, 9164, 9191, 9217,
+    9243, 9270, 9296, 9323, 9349, 9376, 9403, 9429, 9456, 9483,
+    9509, 9536, 9563, 9590, 9617, 9644, 9671, 9698, 9725, 9752,
+    9780, 9807, 9834, 9861, 9889, 9916, 9943, 9971, 9998, 10026,
+    10054, 10081, 10109, 10136, 10164, 10192, 10220, 10248, 10275, 10303,
+    10331, 10359, 10387, 10415, 10443, 10472, 10500, 10528, 10556, 10585,
+    10613, 10641, 10670, 10698, 10727, 10755, 10784, 10812, 10841, 10869,
+    10898, 10927, 10956, 10984, 11013, 11042, 11071, 11100, 11129, 11158,
+    11187, 11216, 11245, 11274, 11303, 11333, 11362, 11391, 11420, 11450,
+    11479, 11509, 11538, 11568, 11597, 11627, 11656, 11686, 11716, 11745,
+    11775, 11805, 11835, 11864, 11894, 11924, 11954, 11984, 12014, 12044,
+    12074, 12104, 12134, 12164, 12195, 12225, 12255, 12285, 12316, 12346,
+    12376, 12407, 12437, 12468, 12498, 12529, 12559, 12590, 12620, 12651,
+    12682, 12712, 12743, 12774, 12805, 12836, 12866, 12897, 12928, 12959,
+    12990, 13021, 13052, 13083, 13114, 13145, 13177, 13208, 13239, 13270,
+    13301, 13333, 13364, 13395, 13427, 13458, 13490, 13521, 13552, 13584,
+    13616, 13647, 13679, 13710, 13742, 13774, 13805, 13837, 13869, 13900,
+    13932, 13964, 13996, 14028, 14060, 14092, 14123, 14155, 14187, 14219,
+    14251, 14284, 14316, 14348, 14380, 14412, 14444, 14476, 14509, 14541,
+    14573, 14605, 14638, 14670, 14702, 14735, 14767, 14800, 14832, 14864,
+    14897, 14929, 14962, 14995, 15027, 15060, 15092, 15125, 15158, 15190,
+    15223, 15256, 15288, 15321, 15354, 15387, 15419, 15452, 15485, 15518,
+    15551, 15584, 15617, 15650, 15683, 15716, 15749, 15782, 15815, 15848,
+    15881, 15914, 15947, 15980, 16013, 16046, 16079, 16113, 16146, 16179,
+    16212, 16245, 16279, 16312, 16345, 16378, 16412, 16445, 16478, 16512,
+    16545, 16578, 16612, 16645, 16679, 16712, 16746, 16779, 16812, 16846,
+    16879, 16913, 16946, 16980, 17013, 17047, 17081, 17114, 17148, 17181,
+    17215, 17249, 17282, 17316, 17349, 17383, 17417, 17450, 17484, 17518,
+    17551, 17585, 17619, 17653, 17686, 17720, 17754, 17788, 17821, 17855,
+    17889, 17923, 17956, 17990, 18024, 18058, 18092, 18125, 18159, 18193,
+    18227, 18261, 18295, 18328, 18362, 18396, 18430, 18464, 18498, 18532,
+    18566, 18599, 18633, 18667, 18701, 18735, 18769, 18803, 18837, 18871,
+    18905, 18938, 18972, 19006, 19040, 19074, 19108, 19142, 19176, 19210,
+    19244, 19278, 19311, 19345, 19379, 19413, 19447, 19481, 19515, 19549,
+    19583, 19617, 19650, 19684, 19718, 19752, 19786, 19820, 19854, 19888,
+    19922, 19955, 19989, 20023, 20057, 20091, 20125, 20158, 20192, 20226,
+    20260, 20294, 20328, 20361, 20395, 20429, 20463, 20497, 20530, 20564,
+    20598, 20632, 20665, 20699, 20733, 20766, 20800, 20834, 20868, 20901,
+    20935, 20969, 21002, 21036, 21069, 21103, 21137, 21170, 21204, 21237,
+    21271, 21305, 21338, 21372, 21405, 21439, 21472, 21506, 21539, 21572,
+    21606, 21639, 21673, 21706, 21739, 21773, 21806, 21840, 21873, 21906,
+    21939, 21973, 22006, 22039, 22072, 22106, 22139, 22172, 22205, 22238,
+    22271, 22305, 22338, 22371, 22404, 22437, 22470, 22503, 22536, 22569,
+    22602, 22635, 22667, 22700, 22733, 22766, 22799, 22832, 22864, 22897,
+    22930, 22963, 22995, 23028, 23061, 23093, 23126, 23158, 23191, 23223,
+    23256, 23288, 23321, 23353, 23386, 23418, 23450, 23483, 23515, 23547,
+    23580, 23612, 23644, 23676, 23708, 23741, 23773, 23805, 23837, 23869,
+    23901, 23933, 23965, 23997, 24028, 24060, 24092, 24124, 24156, 24187,
+    24219, 24251, 24282, 24314, 24346, 24377, 24409, 24440, 24472, 24503,
+    24534, 24566, 24597, 24628, 24660, 24691, 24722, 24753, 24784, 24816,
+    24847, 24878, 24909, 24940, 24971, 25001, 25032, 25063, 25094, 25125,
+    25155, 25186, 25217, 25247, 25278, 25309, 25339, 25370, 25400, 25430,
+    25461, 25491, 25521, 25552, 25582, 25612, 25642, 25672, 25702, 25732,
+    25762, 25792, 25822, 25852, 25882, 25911, 25941, 25971, 26000, 26030,
+    26060, 26089, 26119, 26148, 26177, 26207, 26236, 26265, 26295, 26324,
+    26353, 26382, 26411, 26440, 26469, 26498, 26527, 26556, 26584, 26613,
+    26642, 26671, 26699, 26728, 26756, 26785, 26813, 26841, 26870, 26898,
+    26926, 26954, 26983, 27011, 27039, 27067, 27095, 27123, 27150, 27178,
+    27206, 27234, 27261, 27289, 27316, 27344, 27371, 27399, 27426, 27453,
+    27481, 27508, 27535, 27562, 27589, 27616, 27643, 27670, 27697, 27723,
+    27750, 27777, 27803, 27830, 27856, 27883, 27909, 27936, 27962, 27988,
+    28014, 28041, 28067, 28093, 28119, 28144, 28170, 28196, 28222, 28247,
+    28273, 28299, 28324, 28350, 28375, 28400, 28426, 28451, 28476, 28501,
+    28526, 28551, 28576, 28601, 28626, 28651, 28675, 28700, 28724, 28749,
+    28773, 28798, 28822, 28846, 28871, 28895, 28919, 28943, 28967, 28991,
+    29015, 29038, 29062, 29086, 29109, 29133, 29156, 29180, 29203, 29226,
+    29250, 29273, 29296, 29319, 29342, 29365, 29387, 29410, 29433, 29456,
+    29478, 29501, 29523, 29545, 29568, 29590, 29612, 29634, 29656, 29678,
+    29700, 29722, 29744, 29766, 29787, 29809, 29830, 29852, 29873, 29894,
+    29916, 29937, 29958, 29979, 30000, 30021, 30042, 30062, 30083, 30104,
+    30124, 30145, 30165, 30185, 30206, 30226, 30246, 30266, 30286, 30306,
+    30326, 30345, 30365, 30385, 30404, 30424, 30443, 30463, 30482, 30501,
+    30520, 30539, 30558, 30577, 30596, 30615, 30633, 30652, 30670, 30689,
+    30707, 30726, 30744, 30762, 30780, 30798, 30816, 30834, 30852, 30869,
+    30887, 30905, 30922, 30940, 30957, 30974, 30991, 31008, 31025, 31042,
+    31059, 31076, 31093, 31109, 31126, 31142, 31159, 31175, 31191, 31208,
+    31224, 31240, 31256, 31272, 31287, 31303, 31319, 31334, 31350, 31365,
+    31381, 31396, 31411, 31426, 31441, 31456, 31471, 31486, 31500, 31515,
+    31529, 31544, 31558, 31572, 31587, 31601, 31615, 31629, 31643, 31657,
+    31670, 31684, 31697, 31711, 31724, 31738, 31751, 31764, 31777, 31790,
+    31803, 31816, 31829, 31841, 31854, 31866, 31879, 31891, 31903, 31915,
+    31927, 31939, 31951, 31963, 31975, 31987, 31998, 32010, 32021, 32032,
+    32044, 32055, 32066, 32077, 32088, 32099, 32109, 32120, 32131, 32141,
+    32151, 32162, 32172, 32182, 32192, 32202, 32212, 32222, 32232, 32241,
+    32251, 32260, 32270, 32279, 32288, 32297, 32306, 32315, 32324, 32333,
+    32342, 32350, 32359, 32367, 32376, 32384, 32392, 32400, 32408, 32416,
+    32424, 32432, 32439, 32447, 32454, 32462, 32469, 32476, 32483, 32490,
+    32497, 32504, 32511, 32518, 32524, 32531, 32537, 32544, 32550, 32556,
+    32562, 32568, 32574, 32580, 32586, 32591, 32597, 32602, 32608, 32613,
+    32618, 32623, 32628, 32633, 32638, 32643, 32647, 32652, 32657, 32661,
+    32665, 32669, 32674, 32678, 32682, 32686, 32689, 32693, 32697, 32700,
+    32704, 32707, 32710, 32713, 32716, 32719, 32722, 32725, 32728, 32730,
+    32733, 32735, 32738, 32740, 32742, 32744, 32746, 32748, 32750, 32752,
+    32754, 32755, 32757, 32758, 32759, 32760, 32762, 32763, 32764, 32764,
+    32765, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32766, 32766, 32765, 32764, 32764, 32763,
+    32762, 32760, 32759, 32758, 32757, 32755, 32754, 32752, 32750, 32748,
+    32746, 32744, 32742, 32740, 32738, 32735, 32733, 32730, 32728, 32725,
+    32722, 32719, 32716, 32713, 32710, 32707, 32704, 32700, 32697, 32693,
+    32689, 32686, 32682, 32678, 32674, 32669, 32665, 32661, 32657, 32652,
+    32647, 32643, 32638, 32633, 32628, 32623, 32618, 32613, 32608, 32602,
+    32597, 32591, 32586, 32580, 32574, 32568, 32562, 32556, 32550, 32544,
+    32537, 32531, 32524, 32518, 32511, 32504, 32497, 32490, 32483, 32476,
+    32469, 32462, 32454, 32447, 32439, 32432, 32424, 32416, 32408, 32400,
+    32392, 32384, 32376, 32367, 32359, 32350, 32342, 32333, 32324, 32315,
+    32306, 32297, 32288, 32279, 32270, 32260, 32251, 32241, 32232, 32222,
+    32212, 32202, 32192, 32182, 32172, 32162, 32151, 32141, 32131, 32120,
+    32109, 32099, 32088, 32077, 32066, 32055, 32044, 32032, 32021, 32010,
+    31998, 31987, 31975, 31963, 31951, 31939, 31927, 31915, 31903, 31891,
+    31879, 31866, 31854, 31841, 31829, 31816, 31803, 31790, 31777, 31764,
+    31751, 31738, 31724, 31711, 31697, 31684, 31670, 31657, 31643, 31629,
+    31615, 31601, 31587, 31572, 31558, 31544, 31529, 31515, 31500, 31486,
+    31471, 31456, 31441, 31426, 31411, 31396, 31381, 31365, 31350, 31334,
+    31319, 31303, 31287, 31272, 31256, 31240, 31224, 31208, 31191, 31175,
+    31159, 31142, 31126, 31109, 31093, 31076, 31059, 31042, 31025, 31008,
+    30991, 30974, 30957, 30940, 30922, 30905, 30887, 30869, 30852, 30834,
+    30816, 30798, 30780, 30762, 30744, 30726, 30707, 30689, 30670, 30652,
+    30633, 30615, 30596, 30577, 30558, 30539, 30520, 30501, 30482, 30463,
+    30443, 30424, 30404, 30385, 30365, 30345, 30326, 30306, 30286, 30266,
+    30246, 30226, 30206, 30185, 30165, 30145, 30124, 30104, 30083, 30062,
+    30042, 30021, 30000, 29979, 29958, 29937, 29916, 29894, 29873, 29852,
+    29830, 29809, 29787, 29766, 29744, 29722, 29700, 29678, 29656, 29634,
+    29612, 29590, 29568, 29545, 29523, 29501, 29478, 29456, 29433, 29410,
+    29387, 29365, 29342, 29319, 29296, 29273, 29250, 29226, 29203, 29180,
+    29156, 29133, 29109, 29086, 29062, 29038, 29015, 28991, 28967, 28943,
+    28919, 28895, 28871, 28846, 28822, 28798, 28773, 28749, 28724, 28700,
+    28675, 28651, 28626, 28601, 28576, 28551, 28526, 28501, 28476, 28451,
+    28426, 28400, 28375, 28350, 28324, 28299, 28273, 28247, 28222, 28196,
+    28170, 28144, 28119, 28093, 28067, 28041, 28014, 27988, 27962, 27936,
+    27909, 27883, 27856, 27830, 27803, 27777, 27750, 27723, 27697, 27670,
+    27643, 27616, 27589, 27562, 27535, 27508, 27481, 27453, 27426, 27399,
+    27371, 27344, 27316, 27289, 27261, 27234, 27206, 27178, 27150, 27123,
+    27095, 27067, 27039, 27011, 26983, 26954, 26926, 26898, 26870, 26841,
+    26813, 26785, 26756, 26728, 26699, 26671, 26642, 26613, 26584, 26556,
+    26527, 26498, 26469, 26440, 26411, 26382, 26353, 26324, 26295, 26265,
+    26236, 26207, 26177, 26148, 26119, 26089, 26060, 26030, 26000, 25971,
+    25941, 25911, 25882, 25852, 25822, 25792, 25762, 25732, 25702, 25672,
+    25642, 25612, 25582, 25552, 25521, 25491, 25461, 25430, 25400, 25370,
+    25339, 25309, 25278, 25247, 25217, 25186, 25155, 25125, 25094, 25063,
+    25032, 25001, 24971, 24940, 24909, 24878, 24847, 24816, 24784, 24753,
+    24722, 24691, 24660, 24628, 24597, 24566, 24534, 24503, 24472, 24440,
+    24409, 24377, 24346, 24314, 24282, 24251, 24219, 24187, 24156, 24124,
+    24092, 24060, 24028, 23997, 23965, 23933, 23901, 23869, 23837, 23805,
+    23773, 23741, 23708, 23676, 23644, 23612, 23580, 23547, 23515, 23483,
+    23450, 23418, 23386, 23353, 23321, 23288, 23256, 23223, 23191, 23158,
+    23126, 23093, 23061, 23028, 22995, 22963, 22930, 22897, 22864, 22832,
+    22799, 22766, 22733, 22700, 22667, 22635, 22602, 22569, 22536, 22503,
+    22470, 22437, 22404, 22371, 22338, 22305, 22271, 22238, 22205, 22172,
+    22139, 22106, 22072, 22039, 22006, 21973, 21939, 21906, 21873, 21840,
+    21806, 21773, 21739, 21706, 21673, 21639, 21606, 21572, 21539, 21506,
+    21472, 21439, 21405, 21372, 21338, 21305, 21271, 21237, 21204, 21170,
+    21137, 21103, 21069, 21036, 21002, 20969, 20935, 20901, 20868, 20834,
+    20800, 20766, 20733, 20699, 20665, 20632, 20598, 20564, 20530, 20497,
+    20463, 20429, 20395, 20361, 20328, 20294, 20260, 20226, 20192, 20158,
+    20125, 20091, 20057, 20023, 19989, 19955, 19922, 19888, 19854, 19820,
+    19786, 19752, 19718, 19684, 19650, 19617, 19583, 19549, 19515, 19481,
+    19447, 19413, 19379, 19345, 19311, 19278, 19244, 19210, 19176, 19142,
+    19108, 19074, 19040, 19006, 18972, 18938, 18905, 18871, 18837, 18803,
+    18769, 18735, 18701, 18667, 18633, 18599, 18566, 18532, 18498, 18464,
+    18430, 18396, 18362, 18328, 18295, 18261, 18227, 18193, 18159, 18125,
+    18092, 18058, 18024, 17990, 17956, 17923, 17889, 17855, 17821, 17788,
+    17754, 17720, 17686, 17653, 17619, 17585, 17551, 17518, 17484, 17450,
+    17417, 17383, 17349, 17316, 17282, 17249, 17215, 17181, 17148, 17114,
+    17081, 17047, 17013, 16980, 16946, 16913, 16879, 16846, 16812, 16779,
+    16746, 16712, 16679, 16645, 16612, 16578, 16545, 16512, 16478, 16445,
+    16412, 16378, 16345, 16312, 16279, 16245, 16212, 16179, 16146, 16113,
+    16079, 16046, 16013, 15980, 15947, 15914, 15881, 15848, 15815, 15782,
+    15749, 15716, 15683, 15650, 15617, 15584, 15551, 15518, 15485, 15452,
+    15419, 15387, 15354, 15321, 15288, 15256, 15223, 15190, 15158, 15125,
+    15092, 15060, 15027, 14995, 14962, 14929, 14897, 14864, 14832, 14800,
+    14767, 14735, 14702, 14670, 14638, 14605, 14573, 14541, 14509, 14476,
+    14444, 14412, 14380, 14348, 14316, 14284, 14251, 14219, 14187, 14155,
+    14123, 14092, 14060, 14028, 13996, 13964, 13932, 13900, 13869, 13837,
+    13805, 13774, 13742, 13710, 13679, 13647, 13616, 13584, 13552, 13521,
+    13490, 13458, 13427, 13395, 13364, 13333, 13301, 13270, 13239, 13208,
+    13177, 13145, 13114, 13083, 13052, 13021, 12990, 12959, 12928, 12897,
+    12866, 12836, 12805, 12774, 12743, 12712, 12682, 12651, 12620, 12590,
+    12559, 12529, 12498, 12468, 12437, 12407, 12376, 12346, 12316, 12285,
+    12255, 12225, 12195, 12164, 12134, 12104, 12074, 12044, 12014, 11984,
+    11954, 11924, 11894, 11864, 11835, 11805, 11775, 11745, 11716, 11686,
+    11656, 11627, 11597, 11568, 11538, 11509, 11479, 11450, 11420, 11391,
+    11362, 11333, 11303, 11274, 11245, 11216, 11187, 11158, 11129, 11100,
+    11071, 11042, 11013, 10984, 10956, 10927, 10898, 10869, 10841, 10812,
+    10784, 10755, 10727, 10698, 10670, 10641, 10613, 10585, 10556, 10528,
+    10500, 10472, 10443, 10415, 10387, 10359, 10331, 10303, 10275, 10248,
+    10220, 10192, 10164, 10136, 10109, 10081, 10054, 10026, 9998, 9971,
+    9943, 9916, 9889, 9861, 9834, 9807, 9780, 9752, 9725, 9698,
+    9671, 9644, 9617, 9590, 9563, 9536, 9509, 9483, 9456, 9429,
+    9403, 9376, 9349, 9323, 9296, 9270, 9243, 9217, 9191, 9164,
+    9138, 9112, 9086, 9060, 9033, 9007, 8981, 8955, 8929, 8903,
+    8878, 8852, 8826, 8800, 8775, 8749, 8723, 8698, 8672, 8647,
+    8621, 8596, 8570, 8545, 8520, 8495, 8469, 8444, 8419, 8394,
+    8369, 8344, 8319, 8294, 8269, 8245, 8220, 8195, 8170, 8146,
+    8121, 8096, 8072, 8047, 8023, 7999, 7974, 7950, 7926, 7901,
+    7877, 7853, 7829, 7805, 7781, 7757, 7733, 7709, 7685, 7662,
+    7638, 7614, 7590, 7567, 7543, 7520, 7496, 7473, 7449, 7426,
+    7403, 7379, 7356, 7333, 7310, 7287, 7264, 7241, 7218, 7195,
+    7172, 7149, 7126, 7103, 7081, 7058, 7035, 7013, 6990, 6968,
+    6945, 6923, 6900, 6878, 6856, 6834, 6811, 6789, 6767, 6745,
+    6723, 6701, 6679, 6657, 6635, 6614, 6592, 6570, 6548, 6527,
+    6505, 6484, 6462, 6441, 6419, 6398, 6377, 6355, 6334, 6313,
+    6292, 6271, 6250, 6229, 6208, 6187, 6166, 6145, 6124, 6104,
+    6083, 6062, 6042, 6021, 6001, 5980, 5960, 5939, 5919, 5899,
+    5878, 5858, 5838, 5818, 5798, 5778, 5758, 5738, 5718, 5698,
+    5678, 5659, 5639, 5619, 5599, 5580, 5560, 5541, 5521, 5502,
+    5483, 5463, 5444, 5425, 5405, 5386, 5367, 5348, 5329, 5310,
+    5291, 5272, 5253, 5235, 5216, 5197, 5179, 5160, 5141, 5123,
+    5104, 5086, 5067, 5049, 5031, 5012, 4994, 4976, 4958, 4940,
+    4922, 4904, 4886, 4868, 4850, 4832, 4814, 4796, 4779, 4761,
+    4743, 4726, 4708, 4691, 4673, 4656, 4639, 4621, 4604, 4587,
+    4570, 4552, 4535, 4518, 4501, 4484, 4467, 4450, 4434, 4417,
+    4400, 4383, 4367, 4350, 4333, 4317, 4300, 4284, 4267, 4251,
+    4235, 4218, 4202, 4186, 4170, 4154, 4138, 4122, 4106, 4090,
+    4074, 4058, 4042, 4026, 4010, 3995, 3979, 3963, 3948, 3932,
+    3917, 3901, 3886, 3871, 3855, 3840, 3825, 3810, 3794, 3779,
+    3764, 3749, 3734, 3719, 3704, 3689, 3675, 3660, 3645, 3630,
+    3616, 3601, 3587, 3572, 3557, 3543, 3529, 3514, 3500, 3486,
+    3471, 3457, 3443, 3429, 3415, 3401, 3387, 3373, 3359, 3345,
+    3331, 3317, 3303, 3290, 3276, 3262, 3249, 3235, 3222, 3208,
+    3195, 3181, 3168, 3155, 3141, 3128, 3115, 3102, 3089, 3075,
+    3062, 3049, 3036, 3023, 3011, 2998, 2985, 2972, 2959, 2947,
+    2934, 2921, 2909, 2896, 2884, 2871, 2859, 2846, 2834, 2822,
+    2809, 2797, 2785, 2773, 2761, 2749, 2737, 2725, 2713, 2701,
+    2689, 2677, 2665, 2653, 2641, 2630, 2618, 2606, 2595, 2583,
+    2572, 2560, 2549, 2537, 2526, 2515, 2503, 2492, 2481, 2470,
+    2458, 2447, 2436, 2425, 2414, 2403, 2392, 2381, 2371, 2360,
+    2349, 2338, 2327, 2317, 2306, 2295, 2285, 2274, 2264, 2253,
+    2243, 2232, 2222, 2212, 2201, 2191, 2181, 2171, 2161, 2150,
+    2140, 2130, 2120, 2110, 2100, 2090, 2081, 2071, 2061, 2051,
+    2041, 2032, 2022, 2012, 2003, 1993, 1984, 1974, 1965, 1955,
+    1946, 1936, 1927, 1918, 1908, 1899, 1890, 1881, 1872, 1862,
+    1853, 1844, 1835, 1826, 1817, 1808, 1800, 1791, 1782, 1773,
+    1764, 1756, 1747, 1738, 1730, 1721, 1713, 1704, 1695, 1687,
+    1679, 1670, 1662, 1653, 1645, 1637, 1629, 1620, 1612, 1604,
+    1596, 1588, 1580, 1572, 1564, 1556, 1548, 1540, 1532, 1524,
+    1516, 1509, 1501, 1493, 1485, 1478, 1470, 1462, 1455, 1447,
+    1440, 1432, 1425, 1417, 1410, 1403, 1395, 1388, 1381, 1373,
+    1366, 1359, 1352, 1345, 1337, 1330, 1323, 1316, 1309, 1302,
+    1295, 1288, 1281, 1275, 1268, 1261, 1254, 1247, 1241, 1234,
+    1227, 1221, 1214, 1207, 1201, 1194, 1188, 1181, 1175, 1168,
+    1162, 1156, 1149, 1143, 1137, 1130, 1124, 1118, 1112, 1106,
+    1099, 1093, 1087, 1081, 1075, 1069, 1063, 1057, 1051, 1045,
+    1039, 1034, 1028, 1022, 1016, 1010, 1005, 999, 993, 988,
+    982, 976, 971, 965, 960, 954, 949, 943, 938, 932,
+    927, 922, 916, 911, 906, 900, 895, 890, 885, 879,
+    874, 869, 864, 859, 854, 849, 844, 839, 834, 829,
+    824, 819, 814, 809, 804, 800, 795, 790, 785, 781,
+    776, 771, 767, 762, 757, 753, 748, 744, 739, 734,
+    730, 726, 721, 717, 712, 708, 703, 699, 695, 691,
+    686, 682, 678, 673, 669, 665, 661, 657, 653, 649,
+    645, 640, 636, 632, 628, 624, 620, 616, 613, 609,
+    605, 601, 597, 593, 589, 586, 582, 578, 574, 571,
+    567, 563, 560, 556, 552, 549, 545, 542, 538, 534,
+    531, 527, 524, 521, 517, 514, 510, 507, 504, 500,
+    497, 493, 490, 487, 484, 480, 477, 474, 471, 468,
+    464, 461, 458, 455, 452, 449, 446, 443, 440, 437,
+    434, 431, 428, 425, 422, 419, 416, 413, 410, 407,
+    404, 402, 399, 396, 393, 390, 388, 385, 382, 379,
+    377, 374, 371, 369, 366, 364, 361, 358, 356, 353,
+    351, 348, 346, 343, 341, 338, 336, 333, 331, 328,
+    326, 324, 321, 319, 316, 314, 312, 309, 307, 305,
+    303, 300, 298, 296, 294, 291, 289, 287, 285, 283,
+    281, 278, 276, 274, 272, 270, 268, 266, 264, 262,
+    260, 258, 256, 254, 252, 250, 248, 246, 244, 242,
+    240, 238, 236, 235, 233, 231, 229, 227, 225, 224,
+    222, 220, 218, 217, 215, 213, 211, 210, 208, 206,
+    205, 203, 201, 200, 198, 196, 195, 193, 191, 190,
+    188, 187, 185, 184, 182, 181, 179, 177, 176, 175,
+    173, 172, 170, 169, 167, 166, 164, 163, 162, 160,
+    159, 157, 156, 155, 153, 152, 151, 149, 148, 147,
+    145, 144, 143, 142, 140, 139, 138, 137, 135, 134,
+    133, 132, 131, 129, 128, 127, 126, 125, 124, 122,
+    121, 120, 119, 118, 117, 116, 115, 114, 112, 111,
+    110, 109, 108, 107, 106, 105, 104, 103, 102, 101,
+    100, 99, 98, 97, 96, 95, 95, 94, 93, 92,
+    91, 90, 89, 88, 87, 86, 85, 85, 84, 83,
+    82, 81, 80, 80, 79, 78, 77, 76, 76, 75,
+    74, 73, 72, 72, 71, 70, 69, 69, 68, 67,
+    66, 66, 65, 64, 64, 63, 62, 62, 61, 60,
+    59, 59, 58, 58, 57, 56, 56, 55, 54, 54,
+    53, 52, 52, 51, 51, 50, 49, 49, 48, 48,
+    47, 47, 46, 45, 45, 44, 44, 43, 43, 42,
+    42, 41, 41, 40, 40, 39, 39, 38, 38, 37,
+    37, 36, 36, 35, 35, 34, 34, 34, 33, 33,
+    32, 32, 31, 31, 30, 30, 30, 29, 29, 28,
+    28, 28, 27, 27, 26, 26, 26, 25, 25, 25,
+    24, 24, 24, 23, 23, 23, 22, 22, 22, 21,
+    21, 21, 20, 20, 20, 19, 19, 19, 18, 18,
+    18, 17, 17, 17, 17, 16, 16, 16, 16, 15,
+    15, 15, 14, 14, 14, 14, 13, 13, 13, 13,
+    13, 12, 12, 12, 12, 11, 11, 11, 11, 11,
+    10, 10, 10, 10, 10, 9, 9, 9, 9, 9,
+    8, 8, 8, 8, 8, 8, 7, 7, 7, 7,
+    7, 7, 7, 6, 6, 6, 6, 6, 6, 6,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2
+};